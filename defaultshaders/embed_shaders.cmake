@@ -0,0 +1,72 @@
+# Regenerates src/core/default_shaders.h from the shaders in this directory:
+#
+#   cmake -P defaultshaders/embed_shaders.cmake
+#
+# Each source is compiled to its .spv file first if glslc is found (Vulkan SDK, or pass -DGLSLC=<path>),
+# otherwise the .spv files are embedded as they are. Edit the shaders here, never the generated header.
+
+cmake_minimum_required(VERSION 3.15)
+
+set(SHADER_DIR ${CMAKE_CURRENT_LIST_DIR})
+set(OUTPUT ${CMAKE_CURRENT_LIST_DIR}/../src/core/default_shaders.h)
+
+if(NOT GLSLC)
+    find_program(GLSLC glslc HINTS $ENV{VULKAN_SDK}/bin $ENV{VULKAN_SDK}/Bin)
+endif()
+
+# array name, source, binary, comment
+set(SHADERS
+    "litVertShaderBin|lit.vert|litvert.spv|Lit vertex shader"
+    "litFragShaderBin|lit.frag|litfrag.spv|Lit fragment shader"
+    "unlitVertShaderBin|unlit.vert|unlitvert.spv|Unlit vertex shader"
+    "unlitFragShaderBin|unlit.frag|unlitfrag.spv|Unlit fragment shader"
+    "litVertPushShaderBin|litpush.vert|litpushvert.spv|Lit vertex shader (push constants)"
+    "litFragPushShaderBin|litpush.frag|litpushfrag.spv|Lit fragment shader (push constants)"
+    "unlitVertPushShaderBin|unlitpush.vert|unlitpushvert.spv|Unlit vertex shader (push constants)"
+    "unlitFragPushShaderBin|unlitpush.frag|unlitpushfrag.spv|Unlit fragment shader (push constants)"
+    "litVertInstancedShaderBin|litinstanced.vert|litinstancedvert.spv|Lit vertex shader (instanced)"
+    "unlitVertInstancedShaderBin|unlitinstanced.vert|unlitinstancedvert.spv|Unlit vertex shader (instanced)"
+    "litFragInstancedShaderBin|litinstanced.frag|litinstancedfrag.spv|Lit fragment shader (instanced)"
+    "unlitFragInstancedShaderBin|unlitinstanced.frag|unlitinstancedfrag.spv|Unlit fragment shader (instanced)"
+)
+
+set(HEADER "#pragma once\n#include <vector>\n\n")
+string(APPEND HEADER "// generated from the shaders in defaultshaders by defaultshaders/embed_shaders.cmake, do not edit\n\n")
+string(APPEND HEADER "namespace RenderingFramework3D {\n")
+
+foreach(SHADER ${SHADERS})
+    string(REPLACE "|" ";" FIELDS "${SHADER}")
+    list(GET FIELDS 0 NAME)
+    list(GET FIELDS 1 SOURCE)
+    list(GET FIELDS 2 BINARY)
+    list(GET FIELDS 3 COMMENT)
+
+    if(GLSLC)
+        execute_process(
+            COMMAND ${GLSLC} ${SHADER_DIR}/${SOURCE} -o ${SHADER_DIR}/${BINARY}
+            RESULT_VARIABLE RESULT)
+        if(NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "failed to compile ${SOURCE}")
+        endif()
+    endif()
+
+    # the source as a comment above its binary
+    file(READ ${SHADER_DIR}/${SOURCE} TEXT)
+    string(REGEX REPLACE "\n$" "" TEXT "${TEXT}")
+    string(REPLACE "\n" "\n//" TEXT "${TEXT}")
+
+    # bytes as 0x.. without leading zeros, 20 per line
+    file(READ ${SHADER_DIR}/${BINARY} BYTES HEX)
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," BYTES "${BYTES}")
+    string(REGEX REPLACE "0x0([0-9a-f])" "0x\\1" BYTES "${BYTES}")
+    string(REPEAT "0x[0-9a-f]+," 20 LINE)
+    string(REGEX REPLACE "(${LINE})" "\\1\n    " BYTES "${BYTES}")
+    string(REGEX REPLACE "\n    $" "" BYTES "${BYTES}")
+
+    string(APPEND HEADER "//${COMMENT}\n\n//${TEXT}\n")
+    string(APPEND HEADER "std::vector<uint8_t> ${NAME} = {\n    ${BYTES}\n};\n\n")
+endforeach()
+
+string(APPEND HEADER "}\n")
+file(WRITE ${OUTPUT} "${HEADER}")
+message(STATUS "wrote ${OUTPUT}")
@@ -1,7 +1,11 @@
 #version 450
 
 layout(location = 0) in vec4 inPosition;
-layout(location = 1) in vec3 inNormal;
+//float xyz, or packed as selected by normalEncoding
+layout(location = 1) in vec4 inNormal;
+
+//0 = float xyz, 1 = unorm xyz (10:10:10:2), 2 = octahedral xy (snorm 2x16), see VertexNormalFormat
+layout(constant_id = 0) const int normalEncoding = 0;
 
 layout(location = 0) out vec4 outPosition;
 layout(location = 1) out vec3 outNormal;
@@ -15,11 +19,24 @@ layout(set = 0, binding = 0) uniform TransformUniformBufferObject {
 };
 
 
+vec3 decodeNormal() {
+	vec3 normal = inNormal.xyz;
+	if (normalEncoding == 1) {
+		normal = normal * 2.0 - 1.0;
+	} else if (normalEncoding == 2) {
+		normal = vec3(inNormal.xy, 1.0 - abs(inNormal.x) - abs(inNormal.y));
+		float t = max(-normal.z, 0.0);
+		normal.xy += mix(vec2(t), vec2(-t), greaterThanEqual(normal.xy, vec2(0.0)));
+		normal = normalize(normal);
+	}
+	return normal;
+}
+
 void main() {
 	vec4 scaledPosition = objectScale * inPosition;
     gl_Position = objToScreen * scaledPosition;
 
 	mat3 objToWorld3d = mat3(objToWorld[0].xyz, objToWorld[1].xyz, objToWorld[2].xyz);
 	outPosition = objToWorld * scaledPosition;
-	outNormal = objToWorld3d * inNormal;
+	outNormal = objToWorld3d * decodeNormal();
 }
\ No newline at end of file
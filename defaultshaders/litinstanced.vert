@@ -0,0 +1,53 @@
+#version 450
+
+layout(location = 0) in vec4 inPosition;
+//float xyz, or packed as selected by normalEncoding
+layout(location = 1) in vec4 inNormal;
+
+//0 = float xyz, 1 = unorm xyz (10:10:10:2), 2 = octahedral xy (snorm 2x16), see VertexNormalFormat
+layout(constant_id = 0) const int normalEncoding = 0;
+
+layout(location = 0) out vec4 outPosition;
+layout(location = 1) out vec3 outNormal;
+//the fragment shader reads the instance's material
+layout(location = 2) flat out int outInstance;
+
+struct InstanceData {
+    mat4 objToWorld;
+	mat4 objToScreen;
+	vec4 objectScale;
+	vec4 objColour;
+	float diffuseConstant;
+	float specularConstant;
+	float shininess;
+};
+
+//instanced draws, the transform and material data of each instance is read from the instance buffer
+layout(set = 2, binding = 0) readonly buffer InstanceBufferObject {
+	InstanceData instances[];
+};
+
+
+vec3 decodeNormal() {
+	vec3 normal = inNormal.xyz;
+	if (normalEncoding == 1) {
+		normal = normal * 2.0 - 1.0;
+	} else if (normalEncoding == 2) {
+		normal = vec3(inNormal.xy, 1.0 - abs(inNormal.x) - abs(inNormal.y));
+		float t = max(-normal.z, 0.0);
+		normal.xy += mix(vec2(t), vec2(-t), greaterThanEqual(normal.xy, vec2(0.0)));
+		normal = normalize(normal);
+	}
+	return normal;
+}
+
+void main() {
+	InstanceData instance = instances[gl_InstanceIndex];
+	outInstance = gl_InstanceIndex;
+	vec4 scaledPosition = instance.objectScale * inPosition;
+    gl_Position = instance.objToScreen * scaledPosition;
+
+	mat3 objToWorld3d = mat3(instance.objToWorld[0].xyz, instance.objToWorld[1].xyz, instance.objToWorld[2].xyz);
+	outPosition = instance.objToWorld * scaledPosition;
+	outNormal = objToWorld3d * decodeNormal();
+}
\ No newline at end of file
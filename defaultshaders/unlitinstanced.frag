@@ -0,0 +1,37 @@
+#version 450
+
+
+layout(location = 0) out vec4 outColour;
+
+
+struct InstanceData {
+	mat4 objToScreen;
+	vec4 objectScale;
+	vec4 objColour;
+	float diffuseConstant;
+	float specularConstant;
+	float shininess;
+};
+
+//instanced draws, the material data of each instance follows its transform data in the instance buffer
+layout(set = 2, binding = 0) readonly buffer InstanceBufferObject {
+	InstanceData instances[];
+};
+
+layout(location = 2) flat in int inInstance;
+
+vec4 objColour;
+float diffuseConstant;
+float specularConstant;
+float shininess;
+
+
+
+void main() {
+	objColour = instances[inInstance].objColour;
+	diffuseConstant = instances[inInstance].diffuseConstant;
+	specularConstant = instances[inInstance].specularConstant;
+	shininess = instances[inInstance].shininess;
+
+    outColour = objColour;
+}
\ No newline at end of file
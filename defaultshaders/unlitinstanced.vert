@@ -0,0 +1,29 @@
+#version 450
+
+layout(location = 0) in vec4 inPosition;
+layout(location = 1) in vec3 inNormal;
+
+//the fragment shader reads the instance's material
+layout(location = 2) flat out int outInstance;
+
+struct InstanceData {
+	mat4 objToScreen;
+	vec4 objectScale;
+	vec4 objColour;
+	float diffuseConstant;
+	float specularConstant;
+	float shininess;
+};
+
+//instanced draws, the transform and material data of each instance is read from the instance buffer
+layout(set = 2, binding = 0) readonly buffer InstanceBufferObject {
+	InstanceData instances[];
+};
+
+
+void main() {
+	InstanceData instance = instances[gl_InstanceIndex];
+	outInstance = gl_InstanceIndex;
+	vec4 scaledPosition = instance.objectScale * inPosition;
+    gl_Position = instance.objToScreen * scaledPosition;
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#version 450
+
+
+layout(location = 0) out vec4 outColour;
+
+
+//enable uniformShaderInputLayout.ObjectInputs.usePushConstants in pipeline configuration, the material data
+//follows the transform data of the vertex shader (80 bytes) in the push constant range
+layout(push_constant) uniform materialUniformBufferObject {
+	layout(offset = 80) vec4 objColour;
+	float diffuseConstant;
+	float specularConstant;
+	float shininess;
+};
+
+
+
+void main() {
+    outColour = objColour;
+}
\ No newline at end of file
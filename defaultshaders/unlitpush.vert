@@ -0,0 +1,17 @@
+#version 450
+
+layout(location = 0) in vec4 inPosition;
+layout(location = 1) in vec3 inNormal;
+
+//enable uniformShaderInputLayout.ObjectInputs.usePushConstants in pipeline configuration, the transform data
+//comes first in the push constant range, the material data directly after it
+layout(push_constant) uniform TransformUniformBufferObject {
+	mat4 objToScreen;
+	vec4 objectScale;
+};
+
+
+void main() {
+	vec4 scaledPosition = objectScale * inPosition;
+    gl_Position = objToScreen * scaledPosition;
+}
\ No newline at end of file
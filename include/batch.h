@@ -0,0 +1,85 @@
+#pragma once
+#include <stddef.h>
+#include "matrix.h"
+#include "simd.h"
+
+
+namespace MathUtil {
+
+// structure of arrays layouts of many matrices or vectors for the batch functions below, which process several
+// items per instruction with the widest vectors of the target (8 with ENABLE_AVX2).
+// Matrices are stored in blocks of 8: element k of matrix i, in the order of Matrix::CopyRaw, is at
+// data[(i / 8) * 128 + k * 8 + i % 8], so data holds GetMat4SoASize(count) floats. Vectors are one array per component.
+// None of the data needs any particular alignment
+struct Mat4SoA {
+	float* data;
+};
+
+struct Vec3SoA {
+	float* x;
+	float* y;
+	float* z;
+};
+
+struct Vec4SoA {
+	float* x;
+	float* y;
+	float* z;
+	float* w;
+};
+
+inline size_t GetMat4SoASize(size_t count) {
+	return (count + SIMD::mat4_block_items - 1) / SIMD::mat4_block_items * SIMD::mat4_block_floats;
+}
+
+inline void StoreMat4SoA(const Matrix<4, 4>& m, const Mat4SoA& batch, size_t i) {
+	float raw[16];
+	m.CopyRaw(raw);
+	float* dst = batch.data + SIMD::mat4BlockOffset(i);
+	for (unsigned k = 0; k < 16; k++) {
+		dst[k * SIMD::mat4_block_items] = raw[k];
+	}
+}
+
+// copies matrix i in the column major order of Matrix::CopyRaw
+inline void LoadMat4SoA(const Mat4SoA& batch, size_t i, float* raw) {
+	const float* src = batch.data + SIMD::mat4BlockOffset(i);
+	for (unsigned k = 0; k < 16; k++) {
+		raw[k] = src[k * SIMD::mat4_block_items];
+	}
+}
+
+// the batch functions handle the items begin <= i < end, so callers can split a batch across threads by ranges,
+// preferably at multiples of 8. Outputs must not alias inputs
+
+// out[i] = a[i] * b[i]
+inline void MultiplyBatch(const Mat4SoA& a, const Mat4SoA& b, const Mat4SoA& out, size_t begin, size_t end) {
+	SIMD::MultiplyMat4Blocks(a.data, b.data, out.data, begin, end);
+}
+
+// out[i] = a * b[i]
+inline void MultiplyBatch(const Matrix<4, 4>& a, const Mat4SoA& b, const Mat4SoA& out, size_t begin, size_t end) {
+	float raw[16];
+	a.CopyRaw(raw);
+	SIMD::PremultiplyMat4Blocks(raw, b.data, out.data, begin, end);
+}
+
+// out[i] = m * (points[i], 1), w is kept for projective transforms
+inline void TransformPointsBatch(const Matrix<4, 4>& m, const Vec3SoA& points, const Vec4SoA& out, size_t begin, size_t end) {
+	float raw[16];
+	m.CopyRaw(raw);
+	const float* in[3] = { points.x, points.y, points.z };
+	float* result[4] = { out.x, out.y, out.z, out.w };
+	SIMD::TransformVec3SoA(raw, in, 1.0f, result, 4, begin, end);
+}
+
+// out[i] = upper 3x3 of m * normals[i], m should be the inverse transpose of the point transform when it does not
+// scale uniformly. The results are not normalized
+inline void TransformNormalsBatch(const Matrix<4, 4>& m, const Vec3SoA& normals, const Vec3SoA& out, size_t begin, size_t end) {
+	float raw[16];
+	m.CopyRaw(raw);
+	const float* in[3] = { normals.x, normals.y, normals.z };
+	float* result[3] = { out.x, out.y, out.z };
+	SIMD::TransformVec3SoA(raw, in, 0.0f, result, 3, begin, end);
+}
+}
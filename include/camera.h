@@ -2,20 +2,23 @@
 #include "types.h"
 #include "matrix.h"
 #include "vec.h"
+#include "quat.h"
 
 
 namespace RenderingFramework3D {
-
+class Renderer;
 
 class Camera
 {
 public:
 	Camera(const ViewPort& view, ProjectionMode mode=PROJ_MODE_PERSPECTIVE);
 
+	// the orientation is kept as a quaternion, the rotation matrix must be orthonormal
 	void SetPosition(const MathUtil::Vec<3>& position);
 	void Move(const MathUtil::Vec<3>& displacement);
 	void SetOrientationEulerXYZ(const MathUtil::Vec<3>& angles);
 	void SetRotationMatrix(const MathUtil::Matrix<3,3>& matrix);
+	void SetOrientation(const MathUtil::Quat& orientation);
 	void Rotate(const MathUtil::Vec<3>& axis, float radians);
 
 	void SetProjectionMode(ProjectionMode mode);
@@ -27,6 +30,7 @@ public:
 	const ViewPort& GetCameraViewPort() const;
 	float GetFarPlane() const;
 	float GetNearPlane() const;
+	const MathUtil::Quat& GetOrientation() const;
 	const MathUtil::Matrix<4, 4>& GetTransform() const;
 
 	MathUtil::Vec<3> GetCameraAxisX() const;
@@ -38,6 +42,7 @@ public:
 	const MathUtil::Matrix<4, 4>& GetWorldToCameraTransform();
 
 private:
+	void update_transform();
 	void update_cam_to_screen();
 	void update_world_to_cam();
 
@@ -48,6 +53,9 @@ private:
 	MathUtil::Matrix<4,4> _world_to_cam;
 	MathUtil::Matrix<4,4> _cam_to_screen;
 
+	MathUtil::Vec<3> _position;
+	MathUtil::Quat _orientation;
+	// rebuilt from _position and _orientation whenever they change, so const reads from several draw threads only read
 	MathUtil::Matrix<4, 4> _transform;
 	//view port
 	ViewPort _view_port;
@@ -61,6 +69,11 @@ private:
 	bool _update_world_to_cam = true;
 
 	ProjectionMode _proj_mode;
+
+	// identifies the camera's view in per camera draw state (level of detail hysteresis), copies share it
+	unsigned _id;
+
+	friend Renderer;
 };
 
 }
\ No newline at end of file
@@ -1,12 +1,69 @@
 #pragma once
 #include <array>
 #include "vec.h"
+#include "simd.h"
 
 
 namespace MathUtil {
 
+template <unsigned rows, unsigned columns> class Matrix;
+
+// expression templates of the element-wise matrix operators, see vec.h. Products are computed right away by the
+// kernels of simd.h, an expression operand of a product is evaluated first
+struct MatExprBase {};
+
+template <typename T>
+constexpr bool isMatExpr = std::is_base_of<MatExprBase, std::decay_t<T>>::value;
+
+// E computes element i, in column major order, in Element(i)
+template <typename E, unsigned rows, unsigned columns>
+class MatExpr : public MatExprBase
+{
+public:
+	static constexpr unsigned row_count = rows;
+	static constexpr unsigned column_count = columns;
+
+	const E& Derived() const {
+		return static_cast<const E&>(*this);
+	}
+	float operator() (unsigned row, unsigned column) const {
+		return Derived().Element(rows * column + row);
+	}
+};
+
+template <typename T>
+using MatOperand = Expr::Operand<T, Matrix<std::decay_t<T>::row_count, std::decay_t<T>::column_count>>;
+
+template <typename Op, typename L, typename R>
+class MatBinaryExpr : public MatExpr<MatBinaryExpr<Op, L, R>, std::decay_t<L>::row_count, std::decay_t<L>::column_count>
+{
+public:
+	MatBinaryExpr(L&& l, R&& r) : _l(std::forward<L>(l)), _r(std::forward<R>(r)) {}
+	float Element(unsigned i) const {
+		return Op::Apply(_l.Element(i), _r.Element(i));
+	}
+
+private:
+	MatOperand<L> _l;
+	MatOperand<R> _r;
+};
+
+template <typename Op, typename E>
+class MatScalarExpr : public MatExpr<MatScalarExpr<Op, E>, std::decay_t<E>::row_count, std::decay_t<E>::column_count>
+{
+public:
+	MatScalarExpr(E&& e, float c) : _e(std::forward<E>(e)), _c(c) {}
+	float Element(unsigned i) const {
+		return Op::Apply(_e.Element(i), _c);
+	}
+
+private:
+	MatOperand<E> _e;
+	float _c;
+};
+
 template <unsigned rows, unsigned columns>
-class Matrix
+class Matrix : public MatExpr<Matrix<rows, columns>, rows, columns>
 {
 public:
 	Matrix() = default;
@@ -19,7 +76,25 @@ public:
 		}
 	}
 	
+	// evaluates the expression in one pass, it may refer to this matrix
+	template <typename E>
+	Matrix(const MatExpr<E, rows, columns>& expr) {
+		for (unsigned i = 0; i < rows * columns; i++) {
+			_data[i] = expr.Derived().Element(i);
+		}
+	}
+	template <typename E>
+	Matrix<rows, columns>& operator=(const MatExpr<E, rows, columns>& expr) {
+		for (unsigned i = 0; i < rows * columns; i++) {
+			_data[i] = expr.Derived().Element(i);
+		}
+		return *this;
+	}
+	Matrix(const Matrix<rows, columns>&) = default;
+	Matrix<rows, columns>& operator=(const Matrix<rows, columns>&) = default;
+
 	~Matrix() {}
+	float Element(unsigned i) const { return _data[i]; }
 	unsigned GetRows() const { return rows; }
 	unsigned GetColumns() const { return columns; }
 
@@ -30,29 +105,18 @@ public:
 		return _data[rows * column + row];
 	}
 
-	Matrix<rows,columns> operator+(const Matrix< rows, columns>& second) const {
-		Matrix<rows, columns> result;
-		for (int i = 0; i < rows * columns; i++) {
-			result._data[i] = _data[i] + second._data[i];
-		}
-		return result;
-	}
-	Matrix<rows, columns> operator-(const Matrix< rows, columns>& second) const {
-		Matrix<rows, columns> result;
-		for (int i = 0; i < rows * columns; i++) {
-			result._data[i] = _data[i] - second._data[i];
-		}
-		return result;
-	}
 	template<unsigned rhsColumns>
 	Matrix<rows, rhsColumns> operator*(const Matrix<columns, rhsColumns>& second) const {
 		Matrix<rows, rhsColumns> result;
-
-		for (unsigned i = 0; i < rows; i++) {
-			for (unsigned j = 0; j < rhsColumns; j++) {
-				result._data[j * rows + i] = 0.0f;
-				for (unsigned k = 0; k < columns; k++) {
-					result._data[j * rows + i] += _data[k * rows + i] * second._data[j * columns + k];
+		if constexpr (rows == 4 && columns == 4 && rhsColumns == 4) {
+			SIMD::MultiplyMat4(_data, second._data, result._data);
+		} else {
+			for (unsigned i = 0; i < rows; i++) {
+				for (unsigned j = 0; j < rhsColumns; j++) {
+					result._data[j * rows + i] = 0.0f;
+					for (unsigned k = 0; k < columns; k++) {
+						result._data[j * rows + i] += _data[k * rows + i] * second._data[j * columns + k];
+					}
 				}
 			}
 		}
@@ -61,37 +125,56 @@ public:
 	
 	Vec<rows> operator*(const Vec<columns>& v) const {
 		Vec<rows> result(0);
-		for (unsigned i = 0; i < rows; i++) {
-			for (unsigned k = 0; k < columns; k++) {
-				result(i) += _data[k * rows + i] * v(k);
+		if constexpr (rows == 4 && columns == 4) {
+			SIMD::MultiplyMat4Vec4(_data, (const float*)v.GetData(), &result(0));
+		} else {
+			for (unsigned i = 0; i < rows; i++) {
+				for (unsigned k = 0; k < columns; k++) {
+					result(i) += _data[k * rows + i] * v(k);
+				}
 			}
 		}
 		return result;
 	}
+	template <typename E>
+	Vec<rows> operator*(const VecExpr<E, columns>& v) const {
+		return *this * Vec<columns>(v);
+	}
 
-	Matrix<rows, columns> operator*(float c) const {
-		Matrix<rows, columns> result;
-		for (int i = 0; i < rows * columns; i++) {
-			result._data[i] = _data[i] * c;
+	Matrix<columns, rows> Transpose() const {
+		Matrix<columns, rows> result;
+		if constexpr (rows == 4 && columns == 4) {
+			SIMD::TransposeMat4(_data, result._data);
+		} else {
+			for (unsigned i = 0; i < rows; i++) {
+				for (unsigned j = 0; j < columns; j++) {
+					result._data[i * columns + j] = _data[j * rows + i];
+				}
+			}
 		}
 		return result;
 	}
-	Matrix<rows, columns> operator/(float c) const {
-		Matrix<rows, columns> result;
-		for (int i = 0; i < rows * columns; i++) {
-			result._data[i] = _data[i] / c;
-		}
+
+	//description:
+	//	inverse of a 4x4 transform whose last row is (0, 0, 0, 1), e.g. rotation, scale and translation
+	//	the upper 3x3 has to be invertible
+	Matrix<4, 4> AffineInverse() const {
+		static_assert(rows == 4 && columns == 4, "affine inverse of a 4x4 matrix only");
+		Matrix<4, 4> result;
+		SIMD::AffineInverseMat4(_data, result._data);
 		return result;
 	}
-	
-	void operator+=(const Matrix<rows,columns>& second) {
+
+	template <typename E>
+	void operator+=(const MatExpr<E, rows, columns>& second) {
 		for (int i = 0; i < rows * columns; i++) {
-			_data[i] += second._data[i];
+			_data[i] += second.Derived().Element(i);
 		}
 	}
-	void operator-=(const Matrix& second) {
+	template <typename E>
+	void operator-=(const MatExpr<E, rows, columns>& second) {
 		for (int i = 0; i < rows * columns; i++) {
-			_data[i] -= second._data[i];
+			_data[i] -= second.Derived().Element(i);
 		}
 	}
 	void operator*=(float c) {
@@ -126,7 +209,8 @@ public:
 	}
 
 private:
-	float _data[rows * columns];
+	// column major, 16 byte aligned when the size allows it so the SIMD kernels' loads never split a cache line
+	alignas((rows * columns) % 4 == 0 ? 16 : alignof(float)) float _data[rows * columns];
 
 	template <unsigned r, unsigned c> friend class Matrix;
 };
@@ -139,8 +223,51 @@ Matrix<dim, dim> GetIdentity() {
 	return result;
 }
 
-template<unsigned rows, unsigned columns>
-Matrix<rows, columns> operator*(float c, const Matrix<rows, columns>& mat) {
-	return (mat * c);
+// matrix expression operators, the operands of + and - must have the same dimensions
+template <typename L, typename R, std::enable_if_t<isMatExpr<L> && isMatExpr<R>, int> = 0>
+MatBinaryExpr<Expr::Add, L, R> operator+(L&& l, R&& r) {
+	static_assert(std::decay_t<L>::row_count == std::decay_t<R>::row_count && std::decay_t<L>::column_count == std::decay_t<R>::column_count,
+		"matrices of different dimensions");
+	return MatBinaryExpr<Expr::Add, L, R>(std::forward<L>(l), std::forward<R>(r));
+}
+template <typename L, typename R, std::enable_if_t<isMatExpr<L> && isMatExpr<R>, int> = 0>
+MatBinaryExpr<Expr::Subtract, L, R> operator-(L&& l, R&& r) {
+	static_assert(std::decay_t<L>::row_count == std::decay_t<R>::row_count && std::decay_t<L>::column_count == std::decay_t<R>::column_count,
+		"matrices of different dimensions");
+	return MatBinaryExpr<Expr::Subtract, L, R>(std::forward<L>(l), std::forward<R>(r));
+}
+template <typename L, std::enable_if_t<isMatExpr<L>, int> = 0>
+MatScalarExpr<Expr::Multiply, L> operator*(L&& l, float c) {
+	return MatScalarExpr<Expr::Multiply, L>(std::forward<L>(l), c);
+}
+template <typename R, std::enable_if_t<isMatExpr<R>, int> = 0>
+MatScalarExpr<Expr::Multiply, R> operator*(float c, R&& r) {
+	return MatScalarExpr<Expr::Multiply, R>(std::forward<R>(r), c);
+}
+template <typename L, std::enable_if_t<isMatExpr<L>, int> = 0>
+MatScalarExpr<Expr::Divide, L> operator/(L&& l, float c) {
+	return MatScalarExpr<Expr::Divide, L>(std::forward<L>(l), c);
+}
+
+// a right operand converting to a matrix, e.g. a scalar for every element
+template <typename L, typename R, std::enable_if_t<isMatExpr<L> && !isMatExpr<R> &&
+	std::is_convertible<R, Matrix<std::decay_t<L>::row_count, std::decay_t<L>::column_count>>::value, int> = 0>
+auto operator+(L&& l, R&& r) {
+	return std::forward<L>(l) + Matrix<std::decay_t<L>::row_count, std::decay_t<L>::column_count>(std::forward<R>(r));
+}
+template <typename L, typename R, std::enable_if_t<isMatExpr<L> && !isMatExpr<R> &&
+	std::is_convertible<R, Matrix<std::decay_t<L>::row_count, std::decay_t<L>::column_count>>::value, int> = 0>
+auto operator-(L&& l, R&& r) {
+	return std::forward<L>(l) - Matrix<std::decay_t<L>::row_count, std::decay_t<L>::column_count>(std::forward<R>(r));
+}
+
+// products with an expression on the left, Matrix * Matrix and Matrix * Vec are the members
+template <typename L, typename R, unsigned rows, unsigned inner, unsigned columns>
+Matrix<rows, columns> operator*(const MatExpr<L, rows, inner>& l, const MatExpr<R, inner, columns>& r) {
+	return Matrix<rows, inner>(l) * Matrix<inner, columns>(r);
+}
+template <typename L, typename R, unsigned rows, unsigned columns>
+Vec<rows> operator*(const MatExpr<L, rows, columns>& l, const VecExpr<R, columns>& v) {
+	return Matrix<rows, columns>(l) * Vec<columns>(v);
 }
 }
\ No newline at end of file
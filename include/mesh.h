@@ -2,6 +2,7 @@
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <future>
 #include "matrix.h"
 
 
@@ -9,6 +10,49 @@ namespace RenderingFramework3D {
 
 class Renderer;
 class WorldObject;
+
+// one attribute of consecutive vertices in mapped vertex memory, values are copied in and out
+// since the attribute of a vertex is not necessarily aligned for T
+template<typename T>
+class StridedView {
+public:
+	StridedView() = default;
+	StridedView(uint8_t* data, unsigned stride, unsigned count) : _data(data), _stride(stride), _count(count) {}
+
+	void Set(unsigned idx, const T& value) { memcpy(_data + (size_t)idx * _stride, &value, sizeof(T)); }
+	T Get(unsigned idx) const {
+		T value;
+		memcpy(&value, _data + (size_t)idx * _stride, sizeof(T));
+		return value;
+	}
+	uint8_t* Data(unsigned idx) const { return _data + (size_t)idx * _stride; }
+
+	// reinterpret the attribute, e.g. custom vertex data as StridedView<float>
+	template<typename U>
+	StridedView<U> As() const { return StridedView<U>(_data, _stride, _count); }
+
+	unsigned Size() const { return _count; }
+	unsigned Stride() const { return _stride; }
+	bool IsValid() const { return _data != nullptr; }
+
+private:
+	uint8_t* _data = nullptr;
+	unsigned _stride = 0;
+	unsigned _count = 0;
+};
+
+// vertices [first, first + count) of a dynamically loaded mesh mapped for writing, see Mesh::MapDynamicRange.
+// Views are indexed relative to first and invalid if the mesh layout has no such attribute, it was not selected,
+// it is in a static stream of a split layout or stored in a packed format (VertexPositionFormat, VertexNormalFormat)
+struct DynamicVertexRange {
+	unsigned first = 0;
+	unsigned count = 0;
+	StridedView<MathUtil::Vec<4>> positions;
+	StridedView<MathUtil::Vec<3>> normals;
+	// one view per custom vertex input, in the order of their shader input slots
+	std::vector<StridedView<uint8_t>> customData;
+};
+
 class Mesh {
 public:
 	Mesh(const Renderer& renderer, unsigned numVerts, unsigned numIndices);
@@ -30,15 +74,54 @@ public:
 //	getters
 	unsigned GetNumVertices() const;
 	unsigned GetNumIndices() const;
+	//	bytes of vertex data stored per vertex in the formats of the mesh's layout, summed over all vertex streams
+	unsigned GetVertexSize() const;
 
 	const std::vector<MathUtil::Vec<4>>& GetVertices() const;
 	const std::vector<MathUtil::Vec<3>>& GetVertexNormals() const;
 	const std::vector<unsigned>& GetIndexBuffer() const;
 
 	const std::vector<uint8_t>& GetCustomVertexData(unsigned shaderInputSlot) const;
+	//	VERTEX_POSITION_SNORM16 layouts: position = stored * scale + bias, computed from the positions when the mesh is loaded.
+	//	The default transform data already includes it, identity for other formats
+	void GetPositionDequantization(MathUtil::Vec<3>& scale, MathUtil::Vec<3>& bias) const;
+
+//	Reorders the index buffer for the post-transform vertex cache and less overdraw, then the vertex data in the order
+//	the triangles first use it, call before loading. The overdraw order costs some cache efficiency: clusters of
+//	triangles are cut where the cache miss ratio is within overdrawThreshold of the mesh's and drawn outward facing
+//	first, so larger thresholds cut more clusters. Vertices are not reordered if a custom vertex data buffer
+//	does not hold the same number of bytes for every vertex
+	bool Optimize(MeshOptimizationStats& stats, unsigned cacheSize = 16, float overdrawThreshold = 1.05f);
+	bool Optimize();
+
+//	Level of detail chain sharing the mesh's vertices: up to levels simplified versions of the index buffer (at most
+//	MAX_MESH_LODS - 1), each with about half the triangles of the previous. Stops early where simplifying further would
+//	move the surface more than targetError times the mesh's bounding sphere radius. Call before loading, SetIndexBuffer
+//	discards the LODs. Static loads store them after the mesh's indices, in the same index buffer or index arena range,
+//	and Renderer::DrawObject picks one per draw from the object's size on screen, see Renderer::SetLODSelection
+	bool GenerateLODs(unsigned levels, float targetError);
+	//	level 0 is the full mesh, the error is relative to the bounding sphere radius
+	unsigned GetLODCount() const;
+	unsigned GetLODTriangleCount(unsigned lod) const;
+	float GetLODError(unsigned lod) const;
+
+//	Splits the mesh's triangles into clusters of at most maxVertices vertices and maxTriangles triangles, each with a
+//	bounding sphere and a cone bounding its normals, by reordering the index buffer. Call before loading and after
+//	Optimize, which discards the clusters like SetVertices and SetIndexBuffer. Draws of static loads of the full mesh
+//	skip the clusters outside the view or facing away from the camera and draw the others indirectly, see
+//	Renderer::SetClusterCulling. Meant for large meshes, clusters of small ones cost more draw commands than they save
+	bool BuildClusters(unsigned maxVertices = 64, unsigned maxTriangles = 124);
+	unsigned GetClusterCount() const;
 
 //	GPU load/unload functions
+	//	dynamic meshes keep one host visible copy per frame in flight plus one, the first write of a frame switches to
+	//	a copy no frame in flight reads, so updates never stall or modify data the GPU is still drawing.
+	//	Meshes of at most 65536 vertices are loaded with 16 bit indices, the load fails if an index is out of range
 	bool LoadMesh(bool dynamic=false);
+	//	static load without waiting for the copy: the data is staged right away and the copies of all meshes loaded during
+	//	a frame are submitted together by the next Renderer::PresentFrame, on a transfer only queue if the device has one.
+	//	Completion is checked once per frame, the future is set to true then and objects using the mesh are not drawn before
+	std::shared_future<bool> LoadMeshAsync();
     bool UnloadMesh();
 	bool Reload(bool dynamic=false);
 
@@ -49,6 +132,16 @@ public:
 
 	bool SetCustomVertexDataDynamic(unsigned vertIndex, unsigned shaderInputSlot, uint8_t* data, unsigned maxSize);
 
+//	Bulk update of a dynamic mesh: map a vertex range, write it through the views and unmap it,
+//	which makes the writes visible to the GPU with one flush. Only one range can be mapped at a time,
+//	the CPU side vertex data (GetVertices etc.) is not updated. With split streams only the streams of the
+//	selected attributes (VertexAttributeFlags) are flushed and copied to the next frame's buffers
+	bool MapDynamicRange(unsigned first, unsigned count, DynamicVertexRange& range, uint32_t attributes = VERTEX_ATTRIBUTE_ALL);
+	bool UnmapDynamicRange();
+	//	when switching copies, the data written since the new copy was last used is copied into it (default).
+	//	Can be disabled if every frame rewrites everything it changes, then unchanged data of the new copy is older
+	void SetDynamicCopyForward(bool enable);
+
 public:
 	static Mesh Quad(const Renderer& renderer);
 	static Mesh Cube(const Renderer& renderer);
@@ -0,0 +1,176 @@
+#pragma once
+#include <cmath>
+#include "matrix.h"
+#include "vec.h"
+#include "simd.h"
+
+
+namespace MathUtil {
+
+// unit quaternion rotations, stored as (x, y, z, w) with w the real part. Products, normalization and the blend of
+// Slerp run on the kernels of simd.h. A product of rotations only needs renormalizing to stay a rotation, where a
+// product of rotation matrices drifts away from orthonormal
+class Quat
+{
+public:
+	// identity rotation
+	Quat() {
+		_data[0] = 0;
+		_data[1] = 0;
+		_data[2] = 0;
+		_data[3] = 1;
+	}
+	Quat(float x, float y, float z, float w) {
+		_data[0] = x;
+		_data[1] = y;
+		_data[2] = z;
+		_data[3] = w;
+	}
+
+	// rotation by radians about axis, counter clockwise looking down the axis. The axis need not be normalized
+	static Quat FromAxisAngle(const Vec<3>& axis, float radians) {
+		float len = std::sqrt(axis.LenSqr());
+		float s = std::sin(radians / 2) / len;
+		return Quat(axis(0) * s, axis(1) * s, axis(2) * s, std::cos(radians / 2));
+	}
+
+	// x * y * z: rotation about z first, then y, then x of the parent frame, the same matrix as SetOrientationEulerXYZ of
+	// the objects
+	static Quat FromEulerXYZ(const Vec<3>& angles) {
+		Quat x(std::sin(angles(0) / 2), 0, 0, std::cos(angles(0) / 2));
+		Quat y(0, std::sin(angles(1) / 2), 0, std::cos(angles(1) / 2));
+		Quat z(0, 0, std::sin(angles(2) / 2), std::cos(angles(2) / 2));
+		return x * y * z;
+	}
+
+	// m must be a rotation, the largest of w, x, y and z is taken from the diagonal to keep the division well conditioned
+	static Quat FromRotationMatrix(const Matrix<3, 3>& m) {
+		Quat q;
+		float trace = m(0, 0) + m(1, 1) + m(2, 2);
+		if (trace > 0) {
+			float s = 2 * std::sqrt(trace + 1);
+			q = Quat((m(2, 1) - m(1, 2)) / s, (m(0, 2) - m(2, 0)) / s, (m(1, 0) - m(0, 1)) / s, s / 4);
+		}
+		else if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2)) {
+			float s = 2 * std::sqrt(1 + m(0, 0) - m(1, 1) - m(2, 2));
+			q = Quat(s / 4, (m(0, 1) + m(1, 0)) / s, (m(0, 2) + m(2, 0)) / s, (m(2, 1) - m(1, 2)) / s);
+		}
+		else if (m(1, 1) > m(2, 2)) {
+			float s = 2 * std::sqrt(1 + m(1, 1) - m(0, 0) - m(2, 2));
+			q = Quat((m(0, 1) + m(1, 0)) / s, s / 4, (m(1, 2) + m(2, 1)) / s, (m(0, 2) - m(2, 0)) / s);
+		}
+		else {
+			float s = 2 * std::sqrt(1 + m(2, 2) - m(0, 0) - m(1, 1));
+			q = Quat((m(0, 2) + m(2, 0)) / s, (m(1, 2) + m(2, 1)) / s, s / 4, (m(1, 0) - m(0, 1)) / s);
+		}
+		q.Normalize();
+		return q;
+	}
+
+	float operator() (int i) const {
+		return _data[i];
+	}
+	float& operator() (int i) {
+		return _data[i];
+	}
+
+	// rotation by q followed by this one
+	Quat operator* (const Quat& q) const {
+		Quat result;
+		SIMD::MultiplyQuat(_data, q._data, result._data);
+		return result;
+	}
+	void operator*= (const Quat& q) {
+		Quat result;
+		SIMD::MultiplyQuat(_data, q._data, result._data);
+		*this = result;
+	}
+
+	// inverse rotation of a unit quaternion
+	Quat Conjugate() const {
+		return Quat(-_data[0], -_data[1], -_data[2], _data[3]);
+	}
+	float Dot(const Quat& q) const {
+		return _data[0] * q._data[0] + _data[1] * q._data[1] + _data[2] * q._data[2] + _data[3] * q._data[3];
+	}
+
+	Quat Normalized() const {
+		Quat result;
+		SIMD::NormalizeQuat(_data, result._data);
+		return result;
+	}
+	void Normalize() {
+		SIMD::NormalizeQuat(_data, _data);
+	}
+
+	Vec<3> Rotate(const Vec<3>& v) const {
+		// v + 2w (u x v) + 2u x (u x v) with u the vector part
+		float tx = 2 * (_data[1] * v(2) - _data[2] * v(1));
+		float ty = 2 * (_data[2] * v(0) - _data[0] * v(2));
+		float tz = 2 * (_data[0] * v(1) - _data[1] * v(0));
+		return Vec<3>({
+			v(0) + _data[3] * tx + _data[1] * tz - _data[2] * ty,
+			v(1) + _data[3] * ty + _data[2] * tx - _data[0] * tz,
+			v(2) + _data[3] * tz + _data[0] * ty - _data[1] * tx });
+	}
+
+	Matrix<3, 3> GetRotationMatrix() const {
+		Matrix<3, 3> result;
+		float x = _data[0], y = _data[1], z = _data[2], w = _data[3];
+		result(0, 0) = 1 - 2 * (y * y + z * z);
+		result(0, 1) = 2 * (x * y - z * w);
+		result(0, 2) = 2 * (x * z + y * w);
+		result(1, 0) = 2 * (x * y + z * w);
+		result(1, 1) = 1 - 2 * (x * x + z * z);
+		result(1, 2) = 2 * (y * z - x * w);
+		result(2, 0) = 2 * (x * z - y * w);
+		result(2, 1) = 2 * (y * z + x * w);
+		result(2, 2) = 1 - 2 * (x * x + y * y);
+		return result;
+	}
+
+	// rotation and translation as the affine transform the objects and cameras are drawn with
+	Matrix<4, 4> GetTransform(const Vec<3>& translation) const {
+		Matrix<4, 4> result(0.0f);
+		Matrix<3, 3> rotation = GetRotationMatrix();
+		for (unsigned r = 0; r < 3; r++) {
+			for (unsigned c = 0; c < 3; c++) {
+				result(r, c) = rotation(r, c);
+			}
+			result(r, 3) = translation(r);
+		}
+		result(3, 3) = 1;
+		return result;
+	}
+
+	const float* GetData() const {
+		return _data;
+	}
+
+private:
+	alignas(16) float _data[4];
+
+	friend Quat Slerp(const Quat& a, const Quat& b, float t);
+};
+
+// rotation a fraction t of the way from a to b along the shorter arc, at constant angular speed
+inline Quat Slerp(const Quat& a, const Quat& b, float t) {
+	float cosTheta = a.Dot(b);
+	// q and -q are the same rotation, the one closer to a takes the shorter arc
+	float sign = cosTheta < 0 ? -1.0f : 1.0f;
+	cosTheta *= sign;
+
+	float wa = 1 - t, wb = t;
+	// nearly parallel: sin(theta) vanishes, interpolate linearly and renormalize
+	if (cosTheta < 0.9995f) {
+		float theta = std::acos(cosTheta);
+		float sinTheta = std::sin(theta);
+		wa = std::sin((1 - t) * theta) / sinTheta;
+		wb = std::sin(t * theta) / sinTheta;
+	}
+	Quat result;
+	SIMD::BlendQuat(a._data, wa, b._data, wb * sign, result._data);
+	result.Normalize();
+	return result;
+}
+}
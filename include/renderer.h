@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <functional>
 
 #include "window.h"
 #include "camera.h"
@@ -11,11 +12,17 @@
 namespace RenderingFramework3D {
 class Renderer
 {
+	class RendererInternal;
 public:
 	Renderer();
 	~Renderer();
 
-	bool Initialize(Window& wnd);
+	// framesInFlight: number of frames the CPU may record ahead of the GPU (1 to MAX_FRAMES_IN_FLIGHT)
+	// meshes loaded as dynamic keep a copy per frame in flight plus one, see Mesh::LoadMesh
+	bool Initialize(Window& wnd, unsigned framesInFlight=2);
+	// headless: render into device owned colour and depth images of the given size, no Window or display needed.
+	// PresentFrame submits the frame without presenting it
+	bool InitializeOffscreen(unsigned width, unsigned height, ImageFormat format=IMAGE_FORMAT_R8G8B8A8_SRGB, unsigned framesInFlight=2);
 	bool Cleanup();
 
 	// global uniform data
@@ -40,15 +47,79 @@ public:
 	void SetCustomGlobalUniformShaderData(const std::vector<unsigned>& pipeline, unsigned binding, void* data, unsigned size, unsigned offset=0);
 
 	// rendering functions
+	// the object's uniform data is captured immediately, the draw itself is recorded at PresentFrame,
+	// so meshes must stay loaded until the frame is presented
 	bool DrawObject(const WorldObject& obj, Camera& cam, unsigned pipelineID=PIPELINE_SHADED);
 	bool PresentFrame();
 
+	// records draws from several threads, each into its own secondary command buffer with its own uniform data
+	class DrawContext {
+	public:
+		DrawContext();
+		// same as Renderer::DrawObject, a context must only be used by one thread at a time
+		bool DrawObject(const WorldObject& obj, Camera& cam, unsigned pipelineID=PIPELINE_SHADED);
+		// records the context's draws on the calling thread, otherwise PresentFrame records them on the main thread
+		bool End();
+	private:
+		friend Renderer;
+		RendererInternal* _renderer;
+		unsigned _idx;
+	};
+	// hands out n draw contexts for the current frame, call at most once per frame from the main thread.
+	// Contexts are executed after the draws submitted with Renderer::DrawObject, in context order, and are sorted
+	// separately. Pipelines must not be created and meshes, objects or cameras shared by threads must not be modified
+	// until PresentFrame, each thread should use its own Camera copy as its matrices are updated lazily
+	std::vector<DrawContext> BeginParallelDraw(unsigned n);
+
+	// sort draws by pipeline, cull mode, viewport, mesh and material before recording (default on) to minimize
+	// state changes, translucent objects (colour alpha < 1) are drawn last in submission order
+	void SetDrawSorting(bool enable);
+
+	// load static meshes into shared vertex (one per vertex layout size) and index buffers (default off), consecutive
+	// draws of such meshes skip the vertex/index buffer binds. Affects meshes loaded afterwards, the buffers grow as
+	// needed and are compacted when meshes are unloaded, which waits for the device
+	void SetMeshArenas(bool enable);
+
+	// level of detail selection for meshes with LODs (see Mesh::GenerateLODs): each draw uses the coarsest level whose
+	// error projected to the screen stays within pixelError pixels (default 1), at the object's closest point to the
+	// camera. An object only switches to a coarser level once that level is within pixelError / (1 + hysteresis)
+	// (default 0.25) so it doesn't flicker between two levels near the threshold. The level is kept per camera, copies
+	// of a camera count as the same one, for the last 8 cameras drawing the object. Draws of a vertex subrange
+	// (WorldObject::SetNumVertIndices) always use the full mesh
+	void SetLODSelection(float pixelError, float hysteresis);
+
+	// cull the clusters of clustered meshes (see Mesh::BuildClusters) against the camera's view and, for objects with
+	// back face culling, by their normal cones (default on). The test runs in DrawObject on the calling thread, so
+	// parallel draw contexts split it across their threads, and the remaining clusters of an object are drawn with
+	// one indirect draw. An object without visible clusters is not drawn at all
+	void SetClusterCulling(bool enable);
+
+	// threads computing the object to screen transforms of a frame's draws, counting the thread recording them
+	// (default: one per core, at most 8). The transforms of all draws are multiplied in one batch before recording,
+	// split across the threads once there are thousands of them
+	void SetTransformThreads(unsigned threads);
+
+	// copy the colour attachment of the frame being drawn (presented by the next PresentFrame) to host memory,
+	// the callback runs on a worker thread once the GPU finished the frame, the render loop never waits for it.
+	// Returns false if all readback buffers are still in use, i.e. the callbacks can't keep up and the frame is skipped
+	bool RequestFrameReadback(const std::function<void(const FrameReadbackData&)>& callback);
+
+	// frame pacing / CPU-GPU overlap statistics
+	FrameStats GetFrameStats() const;
+	void ResetFrameStats();
+
+	// per draw uniform buffer usage, the high-water marks tell how to size ObjectInputs.dynamicUniformBufferCapacity
+	UniformBufferStats GetUniformBufferStats() const;
+	void ResetUniformBufferStats();
+
+	// device memory used by meshes, uniform buffers and render targets
+	MemoryStats GetMemoryStats() const;
+
 	// custom pipeline
 	bool CreateCustomPipeline(const PipelineConfig& config, unsigned& pipelineID);
 
 private:
 	friend Mesh;
-	class RendererInternal;
 	std::unique_ptr<RendererInternal> _internal;
 };
 }
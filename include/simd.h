@@ -0,0 +1,460 @@
+#pragma once
+#include <string.h>
+#include <stddef.h>
+#include <math.h>
+
+// instruction set of the 4x4 matrix kernels, chosen at compile time: AVX (+FMA) when the compiler targets it
+// (ENABLE_AVX2 build option), SSE2 on every other x86-64 build, NEON on ARM and plain C++ everywhere else
+#if defined(__AVX__)
+#define MATHUTIL_SIMD_AVX
+#endif
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define MATHUTIL_SIMD_FMA
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATHUTIL_SIMD_SSE
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MATHUTIL_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace MathUtil {
+namespace SIMD {
+
+// column major 4x4 matrices and 4 vectors. Every access is an unaligned load or store, as fast as an aligned one on
+// current CPUs when the data is aligned, so any float pointer can be passed. The output may not alias an input
+
+#if defined(MATHUTIL_SIMD_SSE)
+
+inline __m128 multiplyAdd(__m128 a, __m128 b, __m128 c) {
+#if defined(MATHUTIL_SIMD_FMA)
+	return _mm_fmadd_ps(a, b, c);
+#else
+	return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+// a * (v.x, v.y, v.z, v.w) as a linear combination of a's columns
+inline __m128 combineColumns(const __m128 a[4], __m128 v) {
+	__m128 result = _mm_mul_ps(a[0], _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+	result = multiplyAdd(a[1], _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), result);
+	result = multiplyAdd(a[2], _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), result);
+	return multiplyAdd(a[3], _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), result);
+}
+
+inline void MultiplyMat4(const float* a, const float* b, float* out) {
+#if defined(MATHUTIL_SIMD_AVX)
+	// two columns of the result at once, each lane broadcasts the element of its own column of b
+	__m256 b01 = _mm256_loadu_ps(b);
+	__m256 b23 = _mm256_loadu_ps(b + 8);
+	__m256 out01 = _mm256_setzero_ps(), out23 = _mm256_setzero_ps();
+	for (int k = 0; k < 4; k++) {
+		__m128 columnK = _mm_loadu_ps(a + 4 * k);
+		__m256 column = _mm256_insertf128_ps(_mm256_castps128_ps256(columnK), columnK, 1);
+		__m256 b01k, b23k;
+		switch (k) {
+		case 0: b01k = _mm256_permute_ps(b01, _MM_SHUFFLE(0, 0, 0, 0)); b23k = _mm256_permute_ps(b23, _MM_SHUFFLE(0, 0, 0, 0)); break;
+		case 1: b01k = _mm256_permute_ps(b01, _MM_SHUFFLE(1, 1, 1, 1)); b23k = _mm256_permute_ps(b23, _MM_SHUFFLE(1, 1, 1, 1)); break;
+		case 2: b01k = _mm256_permute_ps(b01, _MM_SHUFFLE(2, 2, 2, 2)); b23k = _mm256_permute_ps(b23, _MM_SHUFFLE(2, 2, 2, 2)); break;
+		default: b01k = _mm256_permute_ps(b01, _MM_SHUFFLE(3, 3, 3, 3)); b23k = _mm256_permute_ps(b23, _MM_SHUFFLE(3, 3, 3, 3)); break;
+		}
+#if defined(MATHUTIL_SIMD_FMA)
+		out01 = _mm256_fmadd_ps(column, b01k, out01);
+		out23 = _mm256_fmadd_ps(column, b23k, out23);
+#else
+		out01 = _mm256_add_ps(_mm256_mul_ps(column, b01k), out01);
+		out23 = _mm256_add_ps(_mm256_mul_ps(column, b23k), out23);
+#endif
+	}
+	_mm256_storeu_ps(out, out01);
+	_mm256_storeu_ps(out + 8, out23);
+#else
+	__m128 columns[4] = { _mm_loadu_ps(a), _mm_loadu_ps(a + 4), _mm_loadu_ps(a + 8), _mm_loadu_ps(a + 12) };
+	for (int j = 0; j < 4; j++) {
+		_mm_storeu_ps(out + 4 * j, combineColumns(columns, _mm_loadu_ps(b + 4 * j)));
+	}
+#endif
+}
+
+inline void MultiplyMat4Vec4(const float* m, const float* v, float* out) {
+	__m128 columns[4] = { _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12) };
+	_mm_storeu_ps(out, combineColumns(columns, _mm_loadu_ps(v)));
+}
+
+inline void TransposeMat4(const float* m, float* out) {
+	__m128 c0 = _mm_loadu_ps(m), c1 = _mm_loadu_ps(m + 4), c2 = _mm_loadu_ps(m + 8), c3 = _mm_loadu_ps(m + 12);
+	_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+	_mm_storeu_ps(out, c0);
+	_mm_storeu_ps(out + 4, c1);
+	_mm_storeu_ps(out + 8, c2);
+	_mm_storeu_ps(out + 12, c3);
+}
+
+inline __m128 cross3(__m128 a, __m128 b) {
+	__m128 aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 zxy = _mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b));
+	return _mm_shuffle_ps(zxy, zxy, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+// inverse of a matrix whose last row is (0, 0, 0, 1): the rows of the 3x3 inverse are the cross products of the
+// columns over the determinant, the translation is moved back by the 3x3 inverse
+inline void AffineInverseMat4(const float* m, float* out) {
+	const __m128 xyz = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+	__m128 c0 = _mm_and_ps(_mm_loadu_ps(m), xyz);
+	__m128 c1 = _mm_and_ps(_mm_loadu_ps(m + 4), xyz);
+	__m128 c2 = _mm_and_ps(_mm_loadu_ps(m + 8), xyz);
+	__m128 translation = _mm_loadu_ps(m + 12);
+
+	__m128 r0 = cross3(c1, c2), r1 = cross3(c2, c0), r2 = cross3(c0, c1);
+	__m128 det = _mm_mul_ps(c0, r0);
+	det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(2, 3, 0, 1)));
+	det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(1, 0, 3, 2)));
+	__m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+	r0 = _mm_mul_ps(r0, invDet);
+	r1 = _mm_mul_ps(r1, invDet);
+	r2 = _mm_mul_ps(r2, invDet);
+
+	__m128 r3 = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	__m128 inverse[4] = { r0, r1, r2, _mm_setzero_ps() };
+	__m128 moved = combineColumns(inverse, translation);
+	_mm_storeu_ps(out, r0);
+	_mm_storeu_ps(out + 4, r1);
+	_mm_storeu_ps(out + 8, r2);
+	_mm_storeu_ps(out + 12, _mm_sub_ps(_mm_set_ps(1, 0, 0, 0), _mm_and_ps(moved, xyz)));
+}
+
+// quaternions as (x, y, z, w) with w the real part
+
+// Hamilton product a * b: a.w * b plus the x, y and z of a times b's elements reordered with the signs of the product
+inline void MultiplyQuat(const float* a, const float* b, float* out) {
+	__m128 qa = _mm_loadu_ps(a), qb = _mm_loadu_ps(b);
+	__m128 result = _mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(3, 3, 3, 3)), qb);
+	__m128 x = _mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(0, 1, 2, 3)));
+	__m128 y = _mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(1, 0, 3, 2)));
+	__m128 z = _mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(2, 3, 0, 1)));
+	result = _mm_add_ps(result, _mm_xor_ps(x, _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f)));
+	result = _mm_add_ps(result, _mm_xor_ps(y, _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f)));
+	result = _mm_add_ps(result, _mm_xor_ps(z, _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f)));
+	_mm_storeu_ps(out, result);
+}
+
+inline void NormalizeQuat(const float* q, float* out) {
+	__m128 v = _mm_loadu_ps(q);
+	__m128 lenSqr = _mm_mul_ps(v, v);
+	lenSqr = _mm_add_ps(lenSqr, _mm_shuffle_ps(lenSqr, lenSqr, _MM_SHUFFLE(2, 3, 0, 1)));
+	lenSqr = _mm_add_ps(lenSqr, _mm_shuffle_ps(lenSqr, lenSqr, _MM_SHUFFLE(1, 0, 3, 2)));
+	_mm_storeu_ps(out, _mm_div_ps(v, _mm_sqrt_ps(lenSqr)));
+}
+
+// a * wa + b * wb, the interpolation step of slerp
+inline void BlendQuat(const float* a, float wa, const float* b, float wb, float* out) {
+	_mm_storeu_ps(out, multiplyAdd(_mm_loadu_ps(b), _mm_set1_ps(wb), _mm_mul_ps(_mm_loadu_ps(a), _mm_set1_ps(wa))));
+}
+
+#elif defined(MATHUTIL_SIMD_NEON)
+
+inline float32x4_t combineColumns(const float32x4_t a[4], float32x4_t v) {
+#if defined(__aarch64__) || defined(_M_ARM64)
+	float32x4_t result = vmulq_laneq_f32(a[0], v, 0);
+	result = vfmaq_laneq_f32(result, a[1], v, 1);
+	result = vfmaq_laneq_f32(result, a[2], v, 2);
+	return vfmaq_laneq_f32(result, a[3], v, 3);
+#else
+	float32x4_t result = vmulq_lane_f32(a[0], vget_low_f32(v), 0);
+	result = vmlaq_lane_f32(result, a[1], vget_low_f32(v), 1);
+	result = vmlaq_lane_f32(result, a[2], vget_high_f32(v), 0);
+	return vmlaq_lane_f32(result, a[3], vget_high_f32(v), 1);
+#endif
+}
+
+inline void MultiplyMat4(const float* a, const float* b, float* out) {
+	float32x4_t columns[4] = { vld1q_f32(a), vld1q_f32(a + 4), vld1q_f32(a + 8), vld1q_f32(a + 12) };
+	for (int j = 0; j < 4; j++) {
+		vst1q_f32(out + 4 * j, combineColumns(columns, vld1q_f32(b + 4 * j)));
+	}
+}
+
+inline void MultiplyMat4Vec4(const float* m, const float* v, float* out) {
+	float32x4_t columns[4] = { vld1q_f32(m), vld1q_f32(m + 4), vld1q_f32(m + 8), vld1q_f32(m + 12) };
+	vst1q_f32(out, combineColumns(columns, vld1q_f32(v)));
+}
+
+inline void TransposeMat4(const float* m, float* out) {
+	// the de-interleaving load reads the rows
+	float32x4x4_t rows = vld4q_f32(m);
+	vst1q_f32(out, rows.val[0]);
+	vst1q_f32(out + 4, rows.val[1]);
+	vst1q_f32(out + 8, rows.val[2]);
+	vst1q_f32(out + 12, rows.val[3]);
+}
+
+inline float32x4_t cross3(float32x4_t a, float32x4_t b) {
+	float a0 = vgetq_lane_f32(a, 0), a1 = vgetq_lane_f32(a, 1), a2 = vgetq_lane_f32(a, 2);
+	float b0 = vgetq_lane_f32(b, 0), b1 = vgetq_lane_f32(b, 1), b2 = vgetq_lane_f32(b, 2);
+	float result[4] = { a1 * b2 - a2 * b1, a2 * b0 - a0 * b2, a0 * b1 - a1 * b0, 0 };
+	return vld1q_f32(result);
+}
+
+inline void AffineInverseMat4(const float* m, float* out) {
+	float32x4_t c0 = vsetq_lane_f32(0, vld1q_f32(m), 3);
+	float32x4_t c1 = vsetq_lane_f32(0, vld1q_f32(m + 4), 3);
+	float32x4_t c2 = vsetq_lane_f32(0, vld1q_f32(m + 8), 3);
+	float32x4_t translation = vld1q_f32(m + 12);
+
+	float32x4_t rows[3] = { cross3(c1, c2), cross3(c2, c0), cross3(c0, c1) };
+	float32x4_t dot = vmulq_f32(c0, rows[0]);
+	float invDet = 1.0f / (vgetq_lane_f32(dot, 0) + vgetq_lane_f32(dot, 1) + vgetq_lane_f32(dot, 2));
+	float rowData[16] = {};
+	for (int i = 0; i < 3; i++) {
+		vst1q_f32(rowData + 4 * i, vmulq_n_f32(rows[i], invDet));
+	}
+	TransposeMat4(rowData, out);
+	float32x4_t inverse[4] = { vld1q_f32(out), vld1q_f32(out + 4), vld1q_f32(out + 8), vdupq_n_f32(0) };
+	float32x4_t moved = vnegq_f32(combineColumns(inverse, translation));
+	vst1q_f32(out + 12, vsetq_lane_f32(1, moved, 3));
+}
+
+inline void MultiplyQuat(const float* a, const float* b, float* out) {
+	static const float signX[4] = { 1, -1, 1, -1 };
+	static const float signY[4] = { 1, 1, -1, -1 };
+	static const float signZ[4] = { -1, 1, 1, -1 };
+	float32x4_t qa = vld1q_f32(a), qb = vld1q_f32(b);
+	// b reordered as (w, z, y, x), (z, w, x, y) and (y, x, w, z)
+	float32x4_t bWzyx = vrev64q_f32(vcombine_f32(vget_high_f32(qb), vget_low_f32(qb)));
+	float32x4_t bZwxy = vcombine_f32(vget_high_f32(qb), vget_low_f32(qb));
+	float32x4_t bYxwz = vrev64q_f32(qb);
+	float32x4_t result = vmulq_n_f32(qb, vgetq_lane_f32(qa, 3));
+	result = vmlaq_f32(result, vmulq_n_f32(bWzyx, vgetq_lane_f32(qa, 0)), vld1q_f32(signX));
+	result = vmlaq_f32(result, vmulq_n_f32(bZwxy, vgetq_lane_f32(qa, 1)), vld1q_f32(signY));
+	result = vmlaq_f32(result, vmulq_n_f32(bYxwz, vgetq_lane_f32(qa, 2)), vld1q_f32(signZ));
+	vst1q_f32(out, result);
+}
+
+inline void NormalizeQuat(const float* q, float* out) {
+	float32x4_t v = vld1q_f32(q);
+	float32x4_t square = vmulq_f32(v, v);
+	float32x2_t sum = vadd_f32(vget_low_f32(square), vget_high_f32(square));
+	float len = sqrtf(vget_lane_f32(vpadd_f32(sum, sum), 0));
+	vst1q_f32(out, vmulq_n_f32(v, 1.0f / len));
+}
+
+inline void BlendQuat(const float* a, float wa, const float* b, float wb, float* out) {
+	vst1q_f32(out, vmlaq_n_f32(vmulq_n_f32(vld1q_f32(a), wa), vld1q_f32(b), wb));
+}
+
+#else
+
+inline void MultiplyMat4(const float* a, const float* b, float* out) {
+	for (int j = 0; j < 4; j++) {
+		for (int i = 0; i < 4; i++) {
+			out[4 * j + i] = a[i] * b[4 * j] + a[4 + i] * b[4 * j + 1] + a[8 + i] * b[4 * j + 2] + a[12 + i] * b[4 * j + 3];
+		}
+	}
+}
+
+inline void MultiplyMat4Vec4(const float* m, const float* v, float* out) {
+	for (int i = 0; i < 4; i++) {
+		out[i] = m[i] * v[0] + m[4 + i] * v[1] + m[8 + i] * v[2] + m[12 + i] * v[3];
+	}
+}
+
+inline void TransposeMat4(const float* m, float* out) {
+	for (int j = 0; j < 4; j++) {
+		for (int i = 0; i < 4; i++) {
+			out[4 * j + i] = m[4 * i + j];
+		}
+	}
+}
+
+inline void AffineInverseMat4(const float* m, float* out) {
+	// rows of the 3x3 inverse from the cross products of the columns
+	const float* c0 = m;
+	const float* c1 = m + 4;
+	const float* c2 = m + 8;
+	float rows[3][3] = {
+		{ c1[1] * c2[2] - c1[2] * c2[1], c1[2] * c2[0] - c1[0] * c2[2], c1[0] * c2[1] - c1[1] * c2[0] },
+		{ c2[1] * c0[2] - c2[2] * c0[1], c2[2] * c0[0] - c2[0] * c0[2], c2[0] * c0[1] - c2[1] * c0[0] },
+		{ c0[1] * c1[2] - c0[2] * c1[1], c0[2] * c1[0] - c0[0] * c1[2], c0[0] * c1[1] - c0[1] * c1[0] },
+	};
+	float invDet = 1.0f / (c0[0] * rows[0][0] + c0[1] * rows[0][1] + c0[2] * rows[0][2]);
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			out[4 * j + i] = rows[i][j] * invDet;
+		}
+		out[12 + i] = -(out[i] * m[12] + out[4 + i] * m[13] + out[8 + i] * m[14]);
+		out[4 * i + 3] = 0;
+	}
+	out[15] = 1;
+}
+
+inline void MultiplyQuat(const float* a, const float* b, float* out) {
+	out[0] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+	out[1] = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+	out[2] = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+	out[3] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+}
+
+inline void NormalizeQuat(const float* q, float* out) {
+	float len = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+	for (int i = 0; i < 4; i++) {
+		out[i] = q[i] / len;
+	}
+}
+
+inline void BlendQuat(const float* a, float wa, const float* b, float wb, float* out) {
+	for (int i = 0; i < 4; i++) {
+		out[i] = a[i] * wa + b[i] * wb;
+	}
+}
+
+#endif
+
+// batch kernels: several items per instruction, each lane of a register holding the same element of another item.
+// Lanes of VectorLanes::count items run at once, the remaining items one by one
+
+struct ScalarLanes {
+	typedef float Type;
+	static constexpr size_t count = 1;
+	static float Load(const float* p) { return *p; }
+	static void Store(float* p, float v) { *p = v; }
+	static float Set(float v) { return v; }
+	static float Multiply(float a, float b) { return a * b; }
+	static float MultiplyAdd(float a, float b, float c) { return a * b + c; }
+};
+
+#if defined(MATHUTIL_SIMD_AVX)
+struct VectorLanes {
+	typedef __m256 Type;
+	static constexpr size_t count = 8;
+	static __m256 Load(const float* p) { return _mm256_loadu_ps(p); }
+	static void Store(float* p, __m256 v) { _mm256_storeu_ps(p, v); }
+	static __m256 Set(float v) { return _mm256_set1_ps(v); }
+	static __m256 Multiply(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+#if defined(MATHUTIL_SIMD_FMA)
+	static __m256 MultiplyAdd(__m256 a, __m256 b, __m256 c) { return _mm256_fmadd_ps(a, b, c); }
+#else
+	static __m256 MultiplyAdd(__m256 a, __m256 b, __m256 c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#endif
+};
+#elif defined(MATHUTIL_SIMD_SSE)
+struct VectorLanes {
+	typedef __m128 Type;
+	static constexpr size_t count = 4;
+	static __m128 Load(const float* p) { return _mm_loadu_ps(p); }
+	static void Store(float* p, __m128 v) { _mm_storeu_ps(p, v); }
+	static __m128 Set(float v) { return _mm_set1_ps(v); }
+	static __m128 Multiply(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+	static __m128 MultiplyAdd(__m128 a, __m128 b, __m128 c) { return multiplyAdd(a, b, c); }
+};
+#elif defined(MATHUTIL_SIMD_NEON)
+struct VectorLanes {
+	typedef float32x4_t Type;
+	static constexpr size_t count = 4;
+	static float32x4_t Load(const float* p) { return vld1q_f32(p); }
+	static void Store(float* p, float32x4_t v) { vst1q_f32(p, v); }
+	static float32x4_t Set(float v) { return vdupq_n_f32(v); }
+	static float32x4_t Multiply(float32x4_t a, float32x4_t b) { return vmulq_f32(a, b); }
+	static float32x4_t MultiplyAdd(float32x4_t a, float32x4_t b, float32x4_t c) { return vmlaq_f32(c, a, b); }
+};
+#else
+typedef ScalarLanes VectorLanes;
+#endif
+
+// matrices of the batch kernels are stored in blocks of 8: element k of matrix i, in the column major order of
+// the matrices, is at data[(i / 8) * 128 + k * 8 + i % 8]. A block is 16 rows of 8 lanes, one row per element,
+// so a matrix stays within 512 bytes where 16 separate arrays would stream the kernels' operands from 48 places
+static constexpr size_t mat4_block_items = 8;
+static constexpr size_t mat4_block_floats = 16 * mat4_block_items;
+
+inline size_t mat4BlockOffset(size_t i) {
+	return (i / mat4_block_items) * mat4_block_floats + i % mat4_block_items;
+}
+
+// a * b of the lanes starting at the given elements, the elements of a lane are mat4_block_items apart
+template <typename Lanes>
+inline void multiplyMat4Lanes(const float* a, const float* b, float* out) {
+	typedef typename Lanes::Type Type;
+	for (int j = 0; j < 4; j++) {
+		Type b0 = Lanes::Load(b + (4 * j) * mat4_block_items), b1 = Lanes::Load(b + (4 * j + 1) * mat4_block_items);
+		Type b2 = Lanes::Load(b + (4 * j + 2) * mat4_block_items), b3 = Lanes::Load(b + (4 * j + 3) * mat4_block_items);
+		for (int r = 0; r < 4; r++) {
+			Type result = Lanes::Multiply(Lanes::Load(a + r * mat4_block_items), b0);
+			result = Lanes::MultiplyAdd(Lanes::Load(a + (4 + r) * mat4_block_items), b1, result);
+			result = Lanes::MultiplyAdd(Lanes::Load(a + (8 + r) * mat4_block_items), b2, result);
+			Lanes::Store(out + (4 * j + r) * mat4_block_items, Lanes::MultiplyAdd(Lanes::Load(a + (12 + r) * mat4_block_items), b3, result));
+		}
+	}
+}
+
+// the same with a single column major a for every lane
+template <typename Lanes>
+inline void premultiplyMat4Lanes(const float a[16], const float* b, float* out) {
+	typedef typename Lanes::Type Type;
+	for (int j = 0; j < 4; j++) {
+		Type b0 = Lanes::Load(b + (4 * j) * mat4_block_items), b1 = Lanes::Load(b + (4 * j + 1) * mat4_block_items);
+		Type b2 = Lanes::Load(b + (4 * j + 2) * mat4_block_items), b3 = Lanes::Load(b + (4 * j + 3) * mat4_block_items);
+		for (int r = 0; r < 4; r++) {
+			Type result = Lanes::Multiply(Lanes::Set(a[r]), b0);
+			result = Lanes::MultiplyAdd(Lanes::Set(a[4 + r]), b1, result);
+			result = Lanes::MultiplyAdd(Lanes::Set(a[8 + r]), b2, result);
+			Lanes::Store(out + (4 * j + r) * mat4_block_items, Lanes::MultiplyAdd(Lanes::Set(a[12 + r]), b3, result));
+		}
+	}
+}
+
+// out[i] = a[i] * b[i] for begin <= i < end, all in blocks
+inline void MultiplyMat4Blocks(const float* a, const float* b, float* out, size_t begin, size_t end) {
+	for (size_t i = begin; i < end;) {
+		size_t offset = mat4BlockOffset(i);
+		if (i % VectorLanes::count == 0 && end - i >= VectorLanes::count) {
+			multiplyMat4Lanes<VectorLanes>(a + offset, b + offset, out + offset);
+			i += VectorLanes::count;
+		} else {
+			multiplyMat4Lanes<ScalarLanes>(a + offset, b + offset, out + offset);
+			i++;
+		}
+	}
+}
+
+// out[i] = a * b[i] for begin <= i < end, a is one column major matrix
+inline void PremultiplyMat4Blocks(const float a[16], const float* b, float* out, size_t begin, size_t end) {
+	for (size_t i = begin; i < end;) {
+		size_t offset = mat4BlockOffset(i);
+		if (i % VectorLanes::count == 0 && end - i >= VectorLanes::count) {
+			premultiplyMat4Lanes<VectorLanes>(a, b + offset, out + offset);
+			i += VectorLanes::count;
+		} else {
+			premultiplyMat4Lanes<ScalarLanes>(a, b + offset, out + offset);
+			i++;
+		}
+	}
+}
+
+// the first outCount components of m * (v, w) for the lanes starting at item i of the arrays
+template <typename Lanes>
+inline void transformVec3Lanes(const float m[16], const float* const v[3], float w, float* const out[], int outCount, size_t i) {
+	typedef typename Lanes::Type Type;
+	Type x = Lanes::Load(v[0] + i), y = Lanes::Load(v[1] + i), z = Lanes::Load(v[2] + i);
+	for (int r = 0; r < outCount; r++) {
+		Type result = Lanes::MultiplyAdd(Lanes::Set(m[r]), x, Lanes::Set(m[12 + r] * w));
+		result = Lanes::MultiplyAdd(Lanes::Set(m[4 + r]), y, result);
+		Lanes::Store(out[r] + i, Lanes::MultiplyAdd(Lanes::Set(m[8 + r]), z, result));
+	}
+}
+
+// out[i] = the first outCount components of m * (v[i], w) for begin <= i < end, the vectors are one array per component
+inline void TransformVec3SoA(const float m[16], const float* const v[3], float w, float* const out[], int outCount, size_t begin, size_t end) {
+	size_t i = begin;
+	for (; i < end && end - i >= VectorLanes::count; i += VectorLanes::count) {
+		transformVec3Lanes<VectorLanes>(m, v, w, out, outCount, i);
+	}
+	for (; i < end; i++) {
+		transformVec3Lanes<ScalarLanes>(m, v, w, out, outCount, i);
+	}
+}
+}
+}
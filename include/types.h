@@ -15,6 +15,10 @@ namespace RenderingFramework3D {
 #define PIPELINE_WIREFRAME 2
 #define PIPELINE_LINKED_LINES 3
 
+#define MAX_FRAMES_IN_FLIGHT 3
+// levels of detail of a mesh including the full mesh, see Mesh::GenerateLODs
+#define MAX_MESH_LODS 8
+
 enum GLSLType {
 	GLSL_BOOL,
 	GLSL_INT,
@@ -33,24 +37,66 @@ struct CustomVertInputLayout {
 
 	//number of components
 	unsigned components;
+
+	//split streams only: host visible buffer that can be updated after a dynamic load, device local otherwise
+	bool dynamic = true;
+};
+
+// storage formats of vertex positions, all are read as a vec4 with w = 1 by the vertex shader
+enum VertexPositionFormat {
+	//16 bytes
+	VERTEX_POSITION_FLOAT4,
+	//12 bytes, w is filled in by the vertex input
+	VERTEX_POSITION_FLOAT3,
+	//8 bytes, xyz normalized to [-1, 1] over the mesh's bounding box, the per mesh scale and bias
+	//(Mesh::GetPositionDequantization) are folded into the object scale and transform data, pipelines
+	//need useObjectScale
+	VERTEX_POSITION_SNORM16,
+};
+
+// storage formats of vertex normals, packed formats are decoded by the default lit vertex shaders
+enum VertexNormalFormat {
+	//12 bytes
+	VERTEX_NORMAL_FLOAT3,
+	//4 bytes, octahedral encoding in 2x16 bit snorm, read as vec2
+	VERTEX_NORMAL_OCT16,
+	//4 bytes, xyz in 10 bit unorm (n * 0.5 + 0.5), read as vec4
+	VERTEX_NORMAL_UNORM10,
 };
 
 struct VertDataLayout {
 	bool useVertBuffer = true;
 	//in vertex shader: layout(location = 0) in
 	uint8_t vertInputSlot = 0;
+	VertexPositionFormat vertFormat = VERTEX_POSITION_FLOAT4;
 
 	bool useVertNormBuffer = true;
 	//in vertex shader: layout(location = 1) in
 	uint8_t vertNormInputSlot = 1;
+	VertexNormalFormat vertNormFormat = VERTEX_NORMAL_FLOAT3;
 	
 	std::vector<CustomVertInputLayout> customVertInputLayouts;
+
+	//one vertex buffer (binding) per attribute in the order position, normal, custom inputs by slot instead of one interleaved buffer
+	bool splitStreams = false;
+	//split streams only: attributes that are never updated after a dynamic load are kept in device local memory
+	bool vertBufferDynamic = true;
+	bool vertNormBufferDynamic = true;
+};
+
+// attributes selected by Mesh::MapDynamicRange, the custom input with the i-th lowest shader input slot is VERTEX_ATTRIBUTE_CUSTOM << i
+enum VertexAttributeFlags : uint32_t {
+	VERTEX_ATTRIBUTE_POSITION = 0x1,
+	VERTEX_ATTRIBUTE_NORMAL = 0x2,
+	VERTEX_ATTRIBUTE_CUSTOM = 0x4,
+	VERTEX_ATTRIBUTE_ALL = 0xFFFFFFFF,
 };
 
 
 struct CustomUniformShaderInputLayout {
 	bool vertInput;
 	bool fragInput;
+	//bytes, pipelines with an empty input fail to initialize
 	uint8_t size;
 	unsigned bindSlot;
 };
@@ -82,6 +128,27 @@ struct UniformShaderInputLayout {
 
 		std::vector<CustomUniformShaderInputLayout> CustomUniformShaderInput;
 
+		//suballocate per object uniform buffers from one large buffer per descriptor pool,
+		//bound with dynamic offsets (VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC), no shader changes required
+		bool useDynamicUniformBuffers = true;
+		//dynamic mode: per frame in flight slots reserved up front, a frame exceeding it grows the allocator
+		//and the next reset of that frame slot merges everything into one buffer sized for the peak
+		unsigned dynamicUniformBufferCapacity = 256;
+
+		//send the transform and material data with vkCmdPushConstants instead of uniform buffers,
+		//in shader: layout(push_constant) blocks, transform data at offset 0 and material data directly after it
+		//(the default shaders have push constant variants). Custom object inputs and the camera transform stay uniform buffers.
+		//Pipelines using the default shaders fall back to uniform buffers if the data exceeds maxPushConstantsSize
+		bool usePushConstants = false;
+
+		//draw consecutive (after sorting) draws of the same mesh with equal state as one instanced draw,
+		//the transform and material data are read from a per frame storage buffer instead of the set 0 bindings,
+		//in shader: layout(set=2,binding=0) readonly buffer { InstanceData instances[]; } indexed by gl_InstanceIndex,
+		//each record the transform data followed by the material data padded to 16 bytes. Fragment shaders reading
+		//the material get the index from the vertex shader as a flat input (the default shaders have instanced variants).
+		//Requires transformFragInput to be false, cannot be combined with usePushConstants
+		bool useInstancing = false;
+
 	} ObjectInputs;
 	
 	//set 1
@@ -109,6 +176,29 @@ enum DefaultVertShader {
 	NUM_DEFAULT_VERT_SHADER
 };
 
+// device memory of buffers and images suballocated by the renderer's memory allocator
+struct MemoryStats {
+	//bytes of device memory allocated from the driver and bytes handed out to buffers and images
+	unsigned long long reservedBytes = 0;
+	unsigned long long usedBytes = 0;
+	//shared blocks suballocated by small resources and resources large enough to get their own allocation
+	unsigned blockCount = 0;
+	unsigned dedicatedCount = 0;
+	unsigned allocationCount = 0;
+	//fraction of the free bytes of the blocks outside the largest free range of their block, 0 if every block's free space is contiguous
+	double fragmentation = 0;
+};
+
+// colour formats of offscreen render targets
+enum ImageFormat {
+	IMAGE_FORMAT_R8G8B8A8_UNORM,
+	IMAGE_FORMAT_R8G8B8A8_SRGB,
+	IMAGE_FORMAT_B8G8R8A8_UNORM,
+	IMAGE_FORMAT_B8G8R8A8_SRGB,
+	IMAGE_FORMAT_R16G16B16A16_SFLOAT,
+	IMAGE_FORMAT_R32G32B32A32_SFLOAT,
+};
+
 enum PrimitiveType {
 	PRIM_TYPE_TRIANGLE_FILLED,
 	PRIM_TYPE_TRIANGLE_WIREFRAME,
@@ -151,6 +241,78 @@ struct ViewPort {
 	}
 };
 
+// frame pacing statistics averaged over the frames since the last reset, times in milliseconds
+struct FrameStats {
+	unsigned framesInFlight = 0;
+	unsigned long long frameCount = 0;
+
+	//wall time between the start of consecutive frames
+	double frameTime = 0;
+	//time the CPU spent blocked waiting for a frame slot to be released by the GPU
+	double fenceWaitTime = 0;
+	//frame time minus fence wait time, i.e. time the CPU was busy (recording, simulation, etc.)
+	double cpuTime = 0;
+	//GPU execution time of the frame command buffer measured with timestamp queries, 0 if unsupported
+	double gpuTime = 0;
+
+	//draws, pipeline binds and vertex/index buffer binds recorded per frame
+	double draws = 0;
+	//draw commands recorded per frame, fewer than draws when draws are combined into instanced draws
+	double drawCalls = 0;
+	double pipelineBinds = 0;
+	double meshBinds = 0;
+	//triangles drawn per frame, counting every instance and the LOD drawn
+	double triangles = 0;
+	//clusters of clustered meshes tested per frame (Mesh::BuildClusters) and those of them that were not drawn
+	double clusters = 0;
+	double culledClusters = 0;
+	//bytes of dynamic mesh data written by updates and copied forward between their copies per frame
+	double dynamicBytes = 0;
+
+	//fraction of the shorter of cpuTime/gpuTime that ran concurrently with the other
+	//0 = CPU and GPU fully serialized, 1 = fully overlapped, negative if GPU timing is unavailable
+	double overlap = -1;
+};
+
+// per draw uniform data usage summed over all pipelines, see UniformShaderInputLayout::ObjectInputs
+struct UniformBufferStats {
+	//slots/bytes used by the most recently reset frame and the peak of any frame since the last stats reset
+	unsigned long long lastFrameAllocations = 0;
+	unsigned long long lastFrameBytes = 0;
+	unsigned long long highWaterAllocations = 0;
+	unsigned long long highWaterBytes = 0;
+
+	//slots/bytes reserved over all frames in flight and the number of buffers backing them
+	unsigned long long capacityAllocations = 0;
+	unsigned long long capacityBytes = 0;
+	unsigned bufferCount = 0;
+};
+
+// post-transform vertex cache efficiency of a mesh's triangle order before and after Mesh::Optimize,
+// simulated on a FIFO cache of cacheSize vertices
+struct MeshOptimizationStats {
+	unsigned cacheSize = 0;
+	//average cache miss ratio: vertex shader invocations per triangle, 3 without any reuse, 0.5 is the limit for large meshes
+	float acmrBefore = 0;
+	float acmrAfter = 0;
+	//average transform to vertex ratio: vertex shader invocations per vertex used, 1 is optimal
+	float atvrBefore = 0;
+	float atvrAfter = 0;
+};
+
+// colour attachment of a presented frame copied to host memory, see Renderer::RequestFrameReadback
+struct FrameReadbackData {
+	unsigned width = 0;
+	unsigned height = 0;
+	//bytes per row, rows are tightly packed from the top of the image
+	unsigned rowPitch = 0;
+	ImageFormat format = IMAGE_FORMAT_R8G8B8A8_UNORM;
+	//number of the frame counted from the renderer's first presented frame
+	unsigned long long frame = 0;
+	//only valid during the callback
+	const uint8_t* data = nullptr;
+};
+
 enum ProjectionMode {
 	PROJ_MODE_PERSPECTIVE,
 	PROJ_MODE_ISOMETRIC
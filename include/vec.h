@@ -4,11 +4,95 @@
 #include <stdio.h>
 #include <array>
 #include <cmath>
+#include <type_traits>
+#include <utility>
 
 
 namespace MathUtil {
+template <unsigned size> class Vec;
+
+// expression templates: +, - and the scalar * and / of vectors return an expression holding the operands instead of
+// a vector. Its elements are computed when they are read, so building or assigning a Vec from a chain like
+// p + v * dt - n * k runs one loop without a temporary vector per operator.
+// Named vectors are held by reference and temporaries by value, an expression kept in an auto variable sees later
+// changes of the vectors it refers to and must not outlive them
+namespace Expr {
+struct Add { static float Apply(float a, float b) { return a + b; } };
+struct Subtract { static float Apply(float a, float b) { return a - b; } };
+struct Multiply { static float Apply(float a, float b) { return a * b; } };
+struct Divide { static float Apply(float a, float b) { return a / b; } };
+
+// operand of an expression of type T as passed to an operator: lvalue vectors and matrices by reference,
+// everything else by value
+template <typename T, typename Leaf>
+using Operand = std::conditional_t<std::is_lvalue_reference<T>::value && std::is_same<std::decay_t<T>, Leaf>::value,
+	const Leaf&, std::decay_t<T>>;
+}
+
+struct VecExprBase {};
+
+template <typename T>
+constexpr bool isVecExpr = std::is_base_of<VecExprBase, std::decay_t<T>>::value;
+
+// E computes element i of the expression in Element(i)
+template <typename E, unsigned size>
+class VecExpr : public VecExprBase
+{
+public:
+	static constexpr unsigned dimension = size;
+
+	const E& Derived() const {
+		return static_cast<const E&>(*this);
+	}
+	float operator()(int index) const {
+		return Derived().Element(index);
+	}
+	template <typename U>
+	float Dot(const VecExpr<U, size>& u) const {
+		float result = 0;
+		for (unsigned i = 0; i < size; i++) {
+			result += Derived().Element(i) * u.Derived().Element(i);
+		}
+		return result;
+	}
+	float LenSqr() const {
+		return Dot(*this);
+	}
+	Vec<size> Normalized() const {
+		return Vec<size>(*this).Normalized();
+	}
+};
+
+template <typename Op, typename L, typename R>
+class VecBinaryExpr : public VecExpr<VecBinaryExpr<Op, L, R>, std::decay_t<L>::dimension>
+{
+public:
+	VecBinaryExpr(L&& l, R&& r) : _l(std::forward<L>(l)), _r(std::forward<R>(r)) {}
+	float Element(unsigned i) const {
+		return Op::Apply(_l.Element(i), _r.Element(i));
+	}
+
+private:
+	Expr::Operand<L, Vec<std::decay_t<L>::dimension>> _l;
+	Expr::Operand<R, Vec<std::decay_t<R>::dimension>> _r;
+};
+
+template <typename Op, typename E>
+class VecScalarExpr : public VecExpr<VecScalarExpr<Op, E>, std::decay_t<E>::dimension>
+{
+public:
+	VecScalarExpr(E&& e, float scaler) : _e(std::forward<E>(e)), _scaler(scaler) {}
+	float Element(unsigned i) const {
+		return Op::Apply(_e.Element(i), _scaler);
+	}
+
+private:
+	Expr::Operand<E, Vec<std::decay_t<E>::dimension>> _e;
+	float _scaler;
+};
+
 template <unsigned size>
-class Vec
+class Vec : public VecExpr<Vec<size>, size>
 {
 public:
 	Vec() = default;
@@ -20,6 +104,27 @@ public:
 	Vec(const std::array<float, size>& arr) {
 		memcpy(_data, arr.data(), arr.size() * sizeof(float));
 	}
+	// evaluates the expression in one pass
+	template <typename E>
+	Vec(const VecExpr<E, size>& expr) {
+		for (unsigned i = 0; i < size; i++) {
+			_data[i] = expr.Derived().Element(i);
+		}
+	}
+	// every element of an expression only reads the same element of its operands, so expr may refer to this vector
+	template <typename E>
+	Vec<size>& operator=(const VecExpr<E, size>& expr) {
+		for (unsigned i = 0; i < size; i++) {
+			_data[i] = expr.Derived().Element(i);
+		}
+		return *this;
+	}
+	Vec(const Vec<size>&) = default;
+	Vec<size>& operator=(const Vec<size>&) = default;
+
+	float Element(unsigned i) const {
+		return _data[i];
+	}
 
 	const float& operator()(int index) const {
 		return _data[index];
@@ -40,43 +145,17 @@ public:
 		return size;
 	}
 
-	//Simple Arithmetic
-	Vec<size> operator+ (const Vec<size>& u) const {
-		Vec<size> result;
-		for (int i = 0; i < size; i++) {
-			result._data[i] = _data[i] + u._data[i];
-		}
-		return result;
-	}
-	Vec<size> operator-(const Vec& u) const {
-		Vec<size> result;
-		for (int i = 0; i < size; i++) {
-			result._data[i] = _data[i] - u._data[i];
-		}
-		return result;
-	}
-	Vec<size> operator* (float scaler) const {
-		Vec<size> result;
+	//Simple Arithmetic, + - * and / are the expression operators below
+	template <typename E>
+	void operator+= (const VecExpr<E, size>& u) {
 		for (int i = 0; i < size; i++) {
-			result._data[i] = _data[i] * scaler;
+			_data[i] += u.Derived().Element(i);
 		}
-		return result;
 	}
-	Vec<size> operator/ (float scaler) const {
-		Vec<size> result;
+	template <typename E>
+	void operator-= (const VecExpr<E, size>& u) {
 		for (int i = 0; i < size; i++) {
-			result._data[i] = _data[i] / scaler;
-		}
-		return result;
-	}
-	void operator+= (const Vec<size>& u) {
-		for (int i = 0; i < size; i++) {
-			_data[i] += u._data[i];
-		}
-	}
-	void operator-= (const Vec& u) {
-		for (int i = 0; i < size; i++) {
-			_data[i] -= u._data[i];
+			_data[i] -= u.Derived().Element(i);
 		}
 	}
 	void operator*= (float scaler) {
@@ -91,10 +170,11 @@ public:
 	}
 
 	//Special vector operations
-	float Dot(const Vec<size>& u)const {
+	template <typename E>
+	float Dot(const VecExpr<E, size>& u)const {
 		float result = 0;
 		for (int i = 0; i < size; i++) {
-			result += _data[i] * u._data[i];
+			result += _data[i] * u.Derived().Element(i);
 		}
 		return result;
 	}
@@ -146,19 +226,49 @@ public:
 	}
 
 private:
-	float _data[size];
+	// 16 byte aligned when the vector fills whole SIMD registers, so SIMD loads never split a cache line, see simd.h
+	alignas(size % 4 == 0 ? 16 : alignof(float)) float _data[size];
 };
 
-template<unsigned size>
-Vec<size> operator* (float scaler, Vec<size> v) {
-	return v * scaler;
+// vector expression operators, the operands must have the same size
+template <typename L, typename R, std::enable_if_t<isVecExpr<L> && isVecExpr<R>, int> = 0>
+VecBinaryExpr<Expr::Add, L, R> operator+ (L&& l, R&& r) {
+	static_assert(std::decay_t<L>::dimension == std::decay_t<R>::dimension, "vectors of different sizes");
+	return VecBinaryExpr<Expr::Add, L, R>(std::forward<L>(l), std::forward<R>(r));
+}
+template <typename L, typename R, std::enable_if_t<isVecExpr<L> && isVecExpr<R>, int> = 0>
+VecBinaryExpr<Expr::Subtract, L, R> operator- (L&& l, R&& r) {
+	static_assert(std::decay_t<L>::dimension == std::decay_t<R>::dimension, "vectors of different sizes");
+	return VecBinaryExpr<Expr::Subtract, L, R>(std::forward<L>(l), std::forward<R>(r));
+}
+template <typename L, std::enable_if_t<isVecExpr<L>, int> = 0>
+VecScalarExpr<Expr::Multiply, L> operator* (L&& l, float scaler) {
+	return VecScalarExpr<Expr::Multiply, L>(std::forward<L>(l), scaler);
+}
+template <typename R, std::enable_if_t<isVecExpr<R>, int> = 0>
+VecScalarExpr<Expr::Multiply, R> operator* (float scaler, R&& r) {
+	return VecScalarExpr<Expr::Multiply, R>(std::forward<R>(r), scaler);
+}
+template <typename L, std::enable_if_t<isVecExpr<L>, int> = 0>
+VecScalarExpr<Expr::Divide, L> operator/ (L&& l, float scaler) {
+	return VecScalarExpr<Expr::Divide, L>(std::forward<L>(l), scaler);
+}
+
+// a right operand converting to a vector, e.g. a scalar for every element
+template <typename L, typename R, std::enable_if_t<isVecExpr<L> && !isVecExpr<R> && std::is_convertible<R, Vec<std::decay_t<L>::dimension>>::value, int> = 0>
+auto operator+ (L&& l, R&& r) {
+	return std::forward<L>(l) + Vec<std::decay_t<L>::dimension>(std::forward<R>(r));
+}
+template <typename L, typename R, std::enable_if_t<isVecExpr<L> && !isVecExpr<R> && std::is_convertible<R, Vec<std::decay_t<L>::dimension>>::value, int> = 0>
+auto operator- (L&& l, R&& r) {
+	return std::forward<L>(l) - Vec<std::decay_t<L>::dimension>(std::forward<R>(r));
 }
 
 inline Vec<3> Cross(const Vec<3>& v1, const Vec<3>& v2) {
 	Vec<3> result;
 
 	result(0) = v1(1)*v2(2)-v1(2)*v2(1);
-	result(1) = v1(3)*v2(0)-v1(0)*v2(3);
+	result(1) = v1(2)*v2(0)-v1(0)*v2(2);
 	result(2) = v1(0)*v2(1)-v1(1)*v2(0);
 
 	return result;
@@ -4,6 +4,7 @@
 #include "types.h"
 #include "matrix.h"
 #include "vec.h"
+#include "quat.h"
 
 #include "mesh.h"
 
@@ -38,11 +39,13 @@ public:
 	void SetBackFaceCulling(bool enable);
 	bool GetBackFaceCulling() const;
 
-	// movement and rotation wrt. parent object frame
+	// movement and rotation wrt. parent object frame. The orientation is kept as a quaternion, the rotation matrix
+	// must be orthonormal, and the transform is rebuilt on the first read after a change
 	void SetPosition(const MathUtil::Vec<3>& position);
 	void Move(const MathUtil::Vec<3>& displacement);
 	void SetOrientationEulerXYZ(const MathUtil::Vec<3>& angles);
 	void SetRotationMatrix(const MathUtil::Matrix<3,3>& matrix);
+	void SetOrientation(const MathUtil::Quat& orientation);
 	void Rotate(const MathUtil::Vec<3>& axis, float radians);
 
 	// scale object
@@ -51,7 +54,8 @@ public:
 	void SetScaleY(float y);
 	void SetScaleZ(float z);
 
-	// attach a parent object reference frame
+	// attach a parent object reference frame, the objects attached to this one move along. World transforms are
+	// cached and updated for the whole tree in one pass on the first read after an object in it changed
 	void AttachReferenceFrame(const WorldObject& ref);
 	void DetachReferenceFrame();
 
@@ -67,6 +71,7 @@ public:
 
 	// transform and postition wrt. parent object frame
 	MathUtil::Vec<3> GetLocalPosition() const;
+	const MathUtil::Quat& GetOrientation() const;
 	const MathUtil::Matrix<4,4>& GetLocalTransform() const;
 
 	const MathUtil::Vec<4>& GetObjectScale() const;
@@ -1,3 +1,4 @@
+#include <atomic>
 #include <cmath>
 #include "camera.h"
 
@@ -9,12 +10,17 @@ using namespace MathUtil;
 static constexpr float base_scale_pers = 0.02;
 static constexpr float base_scale_iso = 0.1;
 
+static std::atomic<unsigned> next_camera_id(0);
+
 Camera::Camera(const ViewPort& view, ProjectionMode mode)
 	:
 	_world_to_cam(GetIdentity<4>()),
 	_cam_to_screen(GetIdentity<4>()),
+	_position(0.0f),
+	_orientation(),
 	_transform(GetIdentity<4>()),
-	_proj_mode(mode)
+	_proj_mode(mode),
+	_id(next_camera_id++)
 {
 	_view_port = view;
 	_zmax = 1000;
@@ -25,89 +31,46 @@ Camera::Camera(const ViewPort& view, ProjectionMode mode)
 }
 
 void Camera::SetPosition(const Vec<3>& position) {
-	_transform(0, 3) = position(0);
-	_transform(1, 3) = position(1);
-	_transform(2, 3) = position(2);
+	_position = position;
 
+	update_transform();
 	_update_world_to_cam = true;
 }
 
 void Camera::Move(const Vec<3>& displacement) {
-	_transform(0, 3) += displacement(0);
-	_transform(1, 3) += displacement(1);
-	_transform(2, 3) += displacement(2);
+	_position += displacement;
 
+	update_transform();
 	_update_world_to_cam = true;
 }
 
 void Camera::SetOrientationEulerXYZ(const Vec<3>& angles) {
-    float cx = cos(angles(0)), sx = sin(angles(0));
-    float cy = cos(angles(1)), sy = sin(angles(1));
-    float cz = cos(angles(2)), sz = sin(angles(2));
-
-    _transform(0,0) = cy * cz;
-    _transform(0,1) = -cy * sz;
-    _transform(0,2) = sy;
-
-    _transform(1,0) = cx * sz + sx * sy * cz;
-    _transform(1,1) = cx * cz - sx * sy * sz;
-    _transform(1,2) = -sx * cy;
-
-    _transform(2,0) = sx * sz - cx * sy * cz;
-    _transform(2,1) = sx * cz + cx * sy * sz;
-    _transform(2,2) = cx * cy;
+	_orientation = Quat::FromEulerXYZ(angles);
 
+	update_transform();
 	_update_world_to_cam = true;
 }
 
 void Camera::SetRotationMatrix(const MathUtil::Matrix<3,3>& matrix) {
-    _transform(0,0) = matrix(0,0);
-    _transform(0,1) = matrix(0,1);
-    _transform(0,2) = matrix(0,2);
-
-    _transform(1,0) = matrix(1,0);
-    _transform(1,1) = matrix(1,1);
-    _transform(1,2) = matrix(1,2);
+	_orientation = Quat::FromRotationMatrix(matrix);
 
-    _transform(2,0) = matrix(2,0);
-    _transform(2,1) = matrix(2,1);
-    _transform(2,2) = matrix(2,2);
-	
+	update_transform();
 	_update_world_to_cam = true;
 }
 
-void Camera::Rotate(const Vec<3>& axis, float radians) {
-
-	auto u = axis;
-	u.Normalize();
-	Matrix<4,4> transform(0);
-	transform(3, 3) = 1;
-
-	//cos+ux^2(1-cos)	uxuy(1-cos)-uzsin	uxuz(1-cos)+uysin
-	//uyux(1-cos)+uzsin	cos+uy^2(1-cos)		uyuz(1-cos)-uxsin
-	//uzux(1-cos)-uysin	uzuy(1-cos)+uxsin	cos+uz^2(1-cos)
-	float tempx = _transform(0, 3), tempy = _transform(1, 3), tempz = _transform(2, 3);
-
-	float costheta = std::cos(radians);
-	float sintheta = std::sin(radians);
+void Camera::SetOrientation(const Quat& orientation) {
+	_orientation = orientation.Normalized();
 
-	transform(0, 0) = costheta + u(0) * u(0) * (1 - costheta);
-	transform(1, 0) = u(1) * u(0) * (1 - costheta) + u(2) * sintheta;
-	transform(2, 0) = u(2) * u(0) * (1 - costheta) - u(1) * sintheta;
-
-	transform(0, 1) = u(0) * u(1) * (1 - costheta) - u(2) * sintheta;
-	transform(1, 1) = costheta + u(1) * u(1) * (1 - costheta);
-	transform(2, 1) = u(2) * u(1) * (1 - costheta) + u(0) * sintheta;
-
-	transform(0, 2) = u(0) * u(2) * (1 - costheta) + u(1) * sintheta;
-	transform(1, 2) = u(1) * u(2) * (1 - costheta) - u(0) * sintheta;
-	transform(2, 2) = costheta + u(2) * u(2) * (1 - costheta);
+	update_transform();
+	_update_world_to_cam = true;
+}
 
-	_transform = transform * _transform;
-	_transform(0, 3) = tempx;
-	_transform(1, 3) = tempy;
-	_transform(2, 3) = tempz;
+void Camera::Rotate(const Vec<3>& axis, float radians) {
+	// renormalized so repeated rotations stay rotations
+	_orientation = Quat::FromAxisAngle(axis, radians) * _orientation;
+	_orientation.Normalize();
 
+	update_transform();
 	_update_world_to_cam = true;
 }
 
@@ -149,22 +112,26 @@ float Camera::GetNearPlane() const {
 	return _zmin;
 }
 
+const Quat& Camera::GetOrientation() const {
+	return _orientation;
+}
+
 const Matrix<4, 4>& Camera::GetTransform() const {
 	return _transform;
 }
 
 Vec<3> Camera::GetCameraAxisX() const {
-	return Vec<3>({ _transform(0,0), _transform(1,0) , _transform(2,0) });
+	return _orientation.Rotate(Vec<3>({ 1, 0, 0 }));
 }
 Vec<3> Camera::GetCameraAxisY() const {
-	return Vec<3>({ _transform(0,1), _transform(1,1) , _transform(2,1) });
+	return _orientation.Rotate(Vec<3>({ 0, 1, 0 }));
 }
 Vec<3> Camera::GetCameraAxisZ() const {
-	return Vec<3>({ _transform(0,2), _transform(1,2) , _transform(2,2) });
+	return _orientation.Rotate(Vec<3>({ 0, 0, 1 }));
 }
 
 Vec<4> Camera::GetPosition() const {
-	return Vec<4>({_transform(0,0), _transform(1,3), _transform(2,3), _transform(3,3)});
+	return Vec<4>({_position(0), _position(1), _position(2), 1});
 }
 const Matrix<4,4>& Camera::GetCamToScreenTransform() {
 	if (_update_cam_to_screen) {
@@ -210,22 +177,27 @@ void Camera::update_cam_to_screen_iso() {
 	_cam_to_screen(3, 3) = 1;
 }
 
-void Camera::update_world_to_cam() {
-	_world_to_cam(0, 0) = _transform(0, 0);
-	_world_to_cam(0, 1) = _transform(1, 0);
-	_world_to_cam(0, 2) = _transform(2, 0);
+void Camera::update_transform() {
+	_transform = _orientation.GetTransform(_position);
+}
 
-	_world_to_cam(1, 0) = _transform(0, 1);
-	_world_to_cam(1, 1) = _transform(1, 1);
-	_world_to_cam(1, 2) = _transform(2, 1);
+void Camera::update_world_to_cam() {
+	const Matrix<4, 4>& transform = GetTransform();
+	_world_to_cam(0, 0) = transform(0, 0);
+	_world_to_cam(0, 1) = transform(1, 0);
+	_world_to_cam(0, 2) = transform(2, 0);
+
+	_world_to_cam(1, 0) = transform(0, 1);
+	_world_to_cam(1, 1) = transform(1, 1);
+	_world_to_cam(1, 2) = transform(2, 1);
 	
-	_world_to_cam(2, 0) = _transform(0, 2);
-	_world_to_cam(2, 1) = _transform(1, 2);
-	_world_to_cam(2, 2) = _transform(2, 2);
+	_world_to_cam(2, 0) = transform(0, 2);
+	_world_to_cam(2, 1) = transform(1, 2);
+	_world_to_cam(2, 2) = transform(2, 2);
 
-	_world_to_cam(0, 3) = -_world_to_cam(0, 0) * _transform(0, 3) - _world_to_cam(0, 1) * _transform(1, 3) - _world_to_cam(0, 2) * _transform(2, 3);
-	_world_to_cam(1, 3) = -_world_to_cam(1, 0) * _transform(0, 3) - _world_to_cam(1, 1) * _transform(1, 3) - _world_to_cam(1, 2) * _transform(2, 3);
-	_world_to_cam(2, 3) = -_world_to_cam(2, 0) * _transform(0, 3) - _world_to_cam(2, 1) * _transform(1, 3) - _world_to_cam(2, 2) * _transform(2, 3);
+	_world_to_cam(0, 3) = -_world_to_cam(0, 0) * transform(0, 3) - _world_to_cam(0, 1) * transform(1, 3) - _world_to_cam(0, 2) * transform(2, 3);
+	_world_to_cam(1, 3) = -_world_to_cam(1, 0) * transform(0, 3) - _world_to_cam(1, 1) * transform(1, 3) - _world_to_cam(1, 2) * transform(2, 3);
+	_world_to_cam(2, 3) = -_world_to_cam(2, 0) * transform(0, 3) - _world_to_cam(2, 1) * transform(1, 3) - _world_to_cam(2, 2) * transform(2, 3);
 }
 
 }
\ No newline at end of file
@@ -56,6 +56,9 @@ unsigned Mesh::GetNumVertices() const {
 unsigned Mesh::GetNumIndices() const {
 	return _internal->GetNumIndices();
 }
+unsigned Mesh::GetVertexSize() const {
+	return _internal->GetVertexSize();
+}
 
 const std::vector<Vec<4>>& Mesh::GetVertices() const {
 	return _internal->GetVertices();
@@ -71,9 +74,50 @@ const std::vector<uint8_t>& Mesh::GetCustomVertexData(unsigned shaderInputSlot)
 	return _internal->GetCustomVertexData(shaderInputSlot);
 }
 
+void Mesh::GetPositionDequantization(Vec<3>& scale, Vec<3>& bias) const {
+	scale = Vec<3>(1.0f);
+	bias = Vec<3>(0.0f);
+	const PositionDequantization* dequant = _internal->GetPositionDequantization();
+	if (dequant) {
+		scale = Vec<3>({ dequant->scale[0], dequant->scale[1], dequant->scale[2] });
+		bias = Vec<3>({ dequant->bias[0], dequant->bias[1], dequant->bias[2] });
+	}
+}
+
+bool Mesh::Optimize(MeshOptimizationStats& stats, unsigned cacheSize, float overdrawThreshold) {
+    return _internal->Optimize(stats, cacheSize, overdrawThreshold);
+}
+bool Mesh::Optimize() {
+    MeshOptimizationStats stats;
+    return _internal->Optimize(stats, 16, 1.05f);
+}
+
+bool Mesh::GenerateLODs(unsigned levels, float targetError) {
+    return _internal->GenerateLODs(levels, targetError);
+}
+unsigned Mesh::GetLODCount() const {
+    return _internal->GetLODCount();
+}
+unsigned Mesh::GetLODTriangleCount(unsigned lod) const {
+    return _internal->GetLODTriangleCount(lod);
+}
+float Mesh::GetLODError(unsigned lod) const {
+    return _internal->GetLODError(lod);
+}
+
+bool Mesh::BuildClusters(unsigned maxVertices, unsigned maxTriangles) {
+    return _internal->BuildClusters(maxVertices, maxTriangles);
+}
+unsigned Mesh::GetClusterCount() const {
+    return _internal->GetClusterCount();
+}
+
 bool Mesh::LoadMesh(bool dynamic) {
     return _internal->LoadMesh(dynamic);
 }
+std::shared_future<bool> Mesh::LoadMeshAsync() {
+    return _internal->LoadMeshAsync();
+}
 bool Mesh::UnloadMesh() {
     return _internal->UnloadMesh();
 }
@@ -95,6 +139,16 @@ bool Mesh::SetCustomVertexDataDynamic(unsigned vertIndex, unsigned shaderInputSl
     return _internal->SetCustomVertexDataDynamic(vertIndex, shaderInputSlot, data, maxSize);
 }
 
+bool Mesh::MapDynamicRange(unsigned first, unsigned count, DynamicVertexRange& range, uint32_t attributes) {
+    return _internal->MapDynamicRange(first, count, range, attributes);
+}
+bool Mesh::UnmapDynamicRange() {
+    return _internal->UnmapDynamicRange();
+}
+void Mesh::SetDynamicCopyForward(bool enable) {
+    _internal->SetDynamicCopyForward(enable);
+}
+
 Mesh Mesh::Cube(const Renderer& renderer) {
     std::vector<Vec<4>> cubeVerts = {
         Vec<4>({ 1.0f,  1.0f,  1.0f, 1}),
@@ -14,8 +14,12 @@ Renderer::Renderer() {
 
 Renderer::~Renderer() {}
 
-bool Renderer::Initialize(Window& wnd) {
-	return _internal->Initialize(wnd._internal);
+bool Renderer::Initialize(Window& wnd, unsigned framesInFlight) {
+	return _internal->Initialize(wnd._internal, framesInFlight);
+}
+
+bool Renderer::InitializeOffscreen(unsigned width, unsigned height, ImageFormat format, unsigned framesInFlight) {
+	return _internal->InitializeOffscreen(width, height, format, framesInFlight);
 }
 
 bool Renderer::Cleanup() {
@@ -84,10 +88,82 @@ bool Renderer::DrawObject(const WorldObject& obj, Camera& cam, unsigned pipeline
 	return _internal->DrawObject(obj, cam, pipelineID);
 }
 
+Renderer::DrawContext::DrawContext() : _renderer(nullptr), _idx(0) {}
+
+bool Renderer::DrawContext::DrawObject(const WorldObject& obj, Camera& cam, unsigned pipelineID) {
+	if (_renderer == nullptr) {
+		return false;
+	}
+	return _renderer->DrawObject(obj, cam, pipelineID, _idx);
+}
+
+bool Renderer::DrawContext::End() {
+	if (_renderer == nullptr) {
+		return false;
+	}
+	return _renderer->EndDrawContext(_idx);
+}
+
+std::vector<Renderer::DrawContext> Renderer::BeginParallelDraw(unsigned n) {
+	std::vector<DrawContext> contexts;
+	if (_internal->BeginParallelDraw(n)) {
+		contexts.resize(n);
+		for (unsigned i = 0; i < n; i++) {
+			contexts[i]._renderer = _internal.get();
+			contexts[i]._idx = i;
+		}
+	}
+	return contexts;
+}
+
 bool Renderer::PresentFrame() {
 	return _internal->PresentFrame();
 }
 
+bool Renderer::RequestFrameReadback(const std::function<void(const FrameReadbackData&)>& callback) {
+	return _internal->RequestFrameReadback(callback);
+}
+
+void Renderer::SetDrawSorting(bool enable) {
+	_internal->SetDrawSorting(enable);
+}
+
+void Renderer::SetMeshArenas(bool enable) {
+	_internal->SetMeshArenas(enable);
+}
+
+void Renderer::SetLODSelection(float pixelError, float hysteresis) {
+	_internal->SetLODSelection(pixelError, hysteresis);
+}
+
+void Renderer::SetClusterCulling(bool enable) {
+	_internal->SetClusterCulling(enable);
+}
+
+void Renderer::SetTransformThreads(unsigned threads) {
+	_internal->SetTransformThreads(threads);
+}
+
+FrameStats Renderer::GetFrameStats() const {
+	return _internal->GetFrameStats();
+}
+
+void Renderer::ResetFrameStats() {
+	_internal->ResetFrameStats();
+}
+
+UniformBufferStats Renderer::GetUniformBufferStats() const {
+	return _internal->GetUniformBufferStats();
+}
+
+void Renderer::ResetUniformBufferStats() {
+	_internal->ResetUniformBufferStats();
+}
+
+MemoryStats Renderer::GetMemoryStats() const {
+	return _internal->GetMemoryStats();
+}
+
 
 bool Renderer::CreateCustomPipeline(const PipelineConfig& config, unsigned& pipelineID) {
 	if(_internal->IsReady()) {
@@ -71,6 +71,10 @@ void WorldObject::SetRotationMatrix(const MathUtil::Matrix<3,3>& matrix) {
     _internal->SetRotationMatrix(matrix);
 }
 
+void WorldObject::SetOrientation(const Quat& orientation) {
+    _internal->SetOrientation(orientation);
+}
+
 void WorldObject::Rotate(const Vec<3>& axis, float radians) {
     _internal->Rotate(axis, radians);
 }
@@ -108,6 +112,10 @@ Vec<3> WorldObject::GetLocalPosition() const {
     return _internal->GetLocalPosition();
 }
 
+const Quat& WorldObject::GetOrientation() const {
+    return _internal->GetOrientation();
+}
+
 Matrix<4,4> WorldObject::GetTransform() const {
     return _internal->GetTransform();
 }
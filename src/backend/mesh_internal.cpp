@@ -1,8 +1,13 @@
 #pragma once
 #include <iostream>
 #include <algorithm>
+#include <cfloat>
 #include "types_internal.h"
 #include "mesh_internal.h"
+#include "memalloc.h"
+#include "arena.h"
+#include "vertexpack.h"
+#include "meshopt.h"
 
 
 namespace RenderingFramework3D {
@@ -10,6 +15,13 @@ namespace RenderingFramework3D {
 
 using namespace MathUtil;
 
+// custom attributes are laid out in shader input slot order, as the pipelines' vertex input descriptions are
+static void sortCustomInputs(VertDataLayout& layout) {
+    std::sort(layout.customVertInputLayouts.begin(), layout.customVertInputLayouts.end(), [](const CustomVertInputLayout& lhs, const CustomVertInputLayout& rhs) {
+        return lhs.shaderInputSlot < rhs.shaderInputSlot;
+    });
+}
+
 Mesh::MeshInternal::MeshInternal(const Renderer::RendererInternal& renderer, const VertDataLayout& layout, unsigned numVerts, unsigned numIndices)
 	:
 	_num_indices(numIndices),
@@ -20,11 +32,41 @@ Mesh::MeshInternal::MeshInternal(const Renderer::RendererInternal& renderer, con
 	_normals(),
 	_indices(),
 	_custom_data(),
-	_vertbuffer_res(),
+	_streams(),
+	_position_location(),
+	_normal_location(),
+	_custom_locations(),
+	_position_dequant(),
 	_idxbuffer_res(),
+	_index_size(sizeof(unsigned)),
+	_lods(),
+	_lod_indices(),
+	_bounds_center(0.0f),
+	_bounds_radius(0),
+	_lod_index_offset(0),
+	_loaded_lods(0),
+	_clusters(),
+	_dynamic_copies(),
+	_dynamic_current(0),
+	_dynamic_frame(0),
+	_copy_forward(true),
+	_frame_clock(renderer.GetFrameClock()),
+	_mapped_first(0),
+	_mapped_count(0),
+	_mapped_streams(),
+	_range_mapped(false),
+	_arenas(renderer.GetMeshArenas()),
+	_vertex_arena(0),
+	_vertex_range(0),
+	_index_range(0),
+	_in_arena(false),
+	_uploads(renderer.GetUploadQueue()),
+	_upload_batch(0),
 	_loaded(false),
     _dynamic_load(false)
-{}
+{
+    sortCustomInputs(_layout);
+}
 
 Mesh::MeshInternal::~MeshInternal() {
     if(_loaded) {
@@ -35,7 +77,7 @@ Mesh::MeshInternal::~MeshInternal() {
 bool Mesh::MeshInternal::SetMeshDataLayout(const VertDataLayout& layout) {
     if(_loaded == false) {
         _layout = layout;
-        if(_layout.customVertInputLayouts.size() > 1) std::sort(_layout.customVertInputLayouts.begin(), _layout.customVertInputLayouts.end(), [](const CustomVertInputLayout& lhs, const CustomVertInputLayout& rhs) { return lhs.shaderInputSlot < rhs.shaderInputSlot; });
+        sortCustomInputs(_layout);
         return true;
     }
     return false;
@@ -43,6 +85,10 @@ bool Mesh::MeshInternal::SetMeshDataLayout(const VertDataLayout& layout) {
 
 void Mesh::MeshInternal::SetVertices(const std::vector<Vec<4>>& vertexBuffer) {
 	_verts = vertexBuffer;
+	// the LOD errors and bounds were computed from the previous positions
+	clearLODs();
+	// the cluster bounds were computed from the previous positions
+	_clusters.clear();
 }
 
 void Mesh::MeshInternal::SetVertexNormals(const std::vector<Vec<3>>& normalBuffer) {
@@ -54,6 +100,9 @@ void Mesh::MeshInternal::SetVertexNormals(const std::vector<Vec<3>>& normalBuffe
 
 void Mesh::MeshInternal::SetIndexBuffer(const std::vector<unsigned>& indexBuffer) {
 	_indices = indexBuffer;
+	// the LODs and clusters were built from the previous indices
+	clearLODs();
+	_clusters.clear();
 }
 
 void Mesh::MeshInternal::SetCustomVertexDataBuffer(unsigned shaderInputSlot, const std::vector<bool>& data) {
@@ -92,6 +141,15 @@ unsigned Mesh::MeshInternal::GetNumVertices() const {
 unsigned Mesh::MeshInternal::GetNumIndices() const {
 	return _num_indices;
 }
+unsigned Mesh::MeshInternal::GetVertexSize() const {
+	unsigned size = 0;
+	if (_layout.useVertBuffer) size += getVertDataSize(_layout.vertFormat);
+	if (_layout.useVertNormBuffer) size += getVertDataSize(_layout.vertNormFormat);
+	for (const auto& e : _layout.customVertInputLayouts) {
+		size += getVertDataSize(e.type, e.components);
+	}
+	return size;
+}
 
 const std::vector<Vec<4>>& Mesh::MeshInternal::GetVertices() const {
 	return _verts;
@@ -111,79 +169,318 @@ const std::vector<uint8_t>& Mesh::MeshInternal::GetCustomVertexData(unsigned sha
 	return _custom_data.at(shaderInputSlot);
 }
 
-bool Mesh::MeshInternal::LoadMesh(bool dynamic) {
-	if(_loaded == true) {
-		return false;
-	}
-	if(_num_verts <= 0 || _num_indices <= 0) {
-		return false;
-	}
+// LOD index lists are put in vertex cache order for this cache size
+static constexpr unsigned lod_cache_size = 16;
 
-    for (const auto idx : _indices) {
-        if (idx >= _num_verts) {
-            printf("unable to load mesh, one or more indices in the index buffer out of range\n");
-            return false;
+// moves the element of vertex v to remap[v], elements past the first remap.size() are kept in place
+static void remapVertexData(uint8_t* data, unsigned elementSize, const std::vector<unsigned>& remap) {
+    std::vector<uint8_t> src(data, data + (size_t)elementSize * remap.size());
+    for (unsigned v = 0; v < remap.size(); v++) {
+        memcpy(data + (size_t)remap[v] * elementSize, &src[(size_t)v * elementSize], elementSize);
+    }
+}
+
+bool Mesh::MeshInternal::Optimize(MeshOptimizationStats& stats, unsigned cacheSize, float overdrawThreshold) {
+    stats = MeshOptimizationStats();
+    stats.cacheSize = cacheSize;
+    // the loaded buffers would no longer match the CPU side data
+    if (_loaded || cacheSize == 0) {
+        return false;
+    }
+    unsigned numIndices = _num_indices < _indices.size() ? _num_indices : _indices.size();
+    numIndices -= numIndices % 3;
+    if (numIndices == 0) {
+        return false;
+    }
+    if (indicesInRange(numIndices) == false) {
+        printf("unable to optimize mesh, one or more indices in the index buffer out of range\n");
+        return false;
+    }
+    analyzeVertexCache(_indices.data(), numIndices, _num_verts, cacheSize, stats.acmrBefore, stats.atvrBefore);
+    // the triangles no longer come cluster by cluster
+    _clusters.clear();
+
+    std::vector<unsigned> cacheOrder(numIndices);
+    optimizeVertexCache(cacheOrder.data(), _indices.data(), numIndices, _num_verts, cacheSize);
+    if (_verts.size() >= _num_verts) {
+        optimizeOverdraw(_indices.data(), cacheOrder.data(), numIndices, _verts.data(), _num_verts, cacheSize, overdrawThreshold);
+    } else {
+        std::copy(cacheOrder.begin(), cacheOrder.end(), _indices.begin());
+    }
+
+    // every per vertex array has to follow the new vertex order, partially set ones can't
+    bool remapVertices = (_verts.empty() || _verts.size() >= _num_verts) && (_normals.empty() || _normals.size() >= _num_verts);
+    for (const auto& data : _custom_data) {
+        remapVertices = remapVertices && data.second.size() % _num_verts == 0;
+    }
+    if (remapVertices) {
+        std::vector<unsigned> remap;
+        optimizeVertexFetch(_indices.data(), numIndices, _num_verts, remap);
+        // indices past the optimized triangles, a partial last one or ones beyond the mesh's index count, keep pointing
+        // at the same vertices, out of range ones stay out of range
+        for (size_t i = numIndices; i < _indices.size(); i++) {
+            if (_indices[i] < _num_verts) {
+                _indices[i] = remap[_indices[i]];
+            }
+        }
+        for (auto& idx : _lod_indices) {
+            idx = remap[idx];
+        }
+        if (_verts.empty() == false) {
+            remapVertexData((uint8_t*)_verts.data(), sizeof(Vec<4>), remap);
+        }
+        if (_normals.empty() == false) {
+            remapVertexData((uint8_t*)_normals.data(), sizeof(Vec<3>), remap);
+        }
+        for (auto& data : _custom_data) {
+            if (data.second.empty() == false) {
+                remapVertexData(data.second.data(), data.second.size() / _num_verts, remap);
+            }
         }
     }
 
-    unsigned strideSize = 0;
-    unsigned bufferSize = 0;
-    VkBuffer stagingBuffer, vertexBuffer, indexBuffer;
-    VkDeviceMemory stagingBufferMemory, vertexBufferMemory, indexBufferMemory;
-    uint8_t* data;
-    
-    if (_layout.useVertBuffer) strideSize += sizeof(float)*4;
-    if (_layout.useVertNormBuffer) strideSize += sizeof(float)*3;
+    analyzeVertexCache(_indices.data(), numIndices, _num_verts, cacheSize, stats.acmrAfter, stats.atvrAfter);
+    return true;
+}
+
+void Mesh::MeshInternal::clearLODs() {
+    _lods.clear();
+    _lod_indices.clear();
+    _bounds_center = Vec<3>(0.0f);
+    _bounds_radius = 0;
+    // a loaded mesh draws its full index range until it is loaded again
+    _loaded_lods = 0;
+}
 
-    for (auto& e : _layout.customVertInputLayouts) {
-        unsigned size = getVertDataSize(e.type, e.components);
-        strideSize += size;
+bool Mesh::MeshInternal::GenerateLODs(unsigned levels, float targetError) {
+    // LODs index the mesh's vertices, so every position is needed, and the loaded index buffer has no room for them
+    if (_loaded || _verts.size() < _num_verts) {
+        return false;
     }
-    VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
-    if (dev == VK_NULL_HANDLE) {
+    unsigned numIndices = _num_indices < _indices.size() ? _num_indices : _indices.size();
+    numIndices -= numIndices % 3;
+    if (numIndices == 0) {
         return false;
     }
-
-    VkPhysicalDevice physdev = DeviceManager::GetVkPhyDevice(_dev_id);
-    if(physdev == VK_NULL_HANDLE) {
+    if (indicesInRange(numIndices) == false) {
+        printf("unable to generate mesh LODs, one or more indices in the index buffer out of range\n");
+        return false;
+    }
+    _lods.clear();
+    _lod_indices.clear();
+
+    // bounding sphere around the centre of the bounding box, errors are relative to its radius
+    Vec<3> lo(FLT_MAX), hi(-FLT_MAX);
+    for (unsigned v = 0; v < _num_verts; v++) {
+        for (unsigned c = 0; c < 3; c++) {
+            lo(c) = std::min(lo(c), _verts[v](c));
+            hi(c) = std::max(hi(c), _verts[v](c));
+        }
+    }
+    _bounds_center = (lo + hi) * 0.5f;
+    _bounds_radius = 0;
+    for (unsigned v = 0; v < _num_verts; v++) {
+        Vec<3> d = Vec<3>({ _verts[v](0), _verts[v](1), _verts[v](2) }) - _bounds_center;
+        _bounds_radius = std::max(_bounds_radius, d.LenSqr());
+    }
+    _bounds_radius = std::sqrt(_bounds_radius);
+    if (_bounds_radius <= 0) {
         return false;
     }
 
-    bufferSize = strideSize * _num_verts;
-    void* pdata = nullptr;
-    if(bufferSize <= 0) {
+    // each level halves the triangles of the previous one, as far as the error bound allows
+    MeshSimplifier simplifier(_indices.data(), numIndices, _verts.data(), _num_verts);
+    unsigned previous = numIndices;
+    for (unsigned l = 0; l < levels && l + 1 < MAX_MESH_LODS; l++) {
+        float error = simplifier.Simplify(previous / 6 * 3, targetError * _bounds_radius);
+        const std::vector<unsigned>& indices = simplifier.GetIndices();
+        if (indices.empty() || indices.size() > previous / 10 * 9) {
+            break;
+        }
+        LodLevel lod;
+        lod.firstIndex = _lod_indices.size();
+        lod.indexCount = indices.size();
+        lod.error = error / _bounds_radius;
+        _lod_indices.resize(lod.firstIndex + lod.indexCount);
+        optimizeVertexCache(&_lod_indices[lod.firstIndex], indices.data(), lod.indexCount, _num_verts, lod_cache_size);
+        _lods.push_back(lod);
+        previous = lod.indexCount;
+    }
+    return true;
+}
+
+unsigned Mesh::MeshInternal::GetLODCount() const {
+    return 1 + _lods.size();
+}
+
+unsigned Mesh::MeshInternal::GetLODTriangleCount(unsigned lod) const {
+    if (lod == 0) {
+        return (_num_indices < _indices.size() ? _num_indices : _indices.size()) / 3;
+    }
+    return lod <= _lods.size() ? _lods[lod - 1].indexCount / 3 : 0;
+}
+
+float Mesh::MeshInternal::GetLODError(unsigned lod) const {
+    return lod > 0 && lod <= _lods.size() ? _lods[lod - 1].error : 0;
+}
+
+unsigned Mesh::MeshInternal::GetLoadedLODCount() const {
+    return _loaded ? 1 + _loaded_lods : 0;
+}
+
+void Mesh::MeshInternal::GetBoundingSphere(Vec<3>& center, float& radius) const {
+    center = _bounds_center;
+    radius = _bounds_radius;
+}
+
+bool Mesh::MeshInternal::BuildClusters(unsigned maxVertices, unsigned maxTriangles) {
+    // the bounds need every position, and the loaded index buffer would no longer match
+    if (_loaded || _verts.size() < _num_verts || maxVertices < 3 || maxTriangles == 0) {
+        return false;
+    }
+    unsigned numIndices = _num_indices < _indices.size() ? _num_indices : _indices.size();
+    numIndices -= numIndices % 3;
+    if (numIndices == 0) {
         return false;
     }
-    if(dynamic == false) {
-        if (createBuffer(physdev, dev, bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingBufferMemory) == false) {
-            printf("failed to create vertex staging buffer\n");
+    if (indicesInRange(numIndices) == false) {
+        printf("unable to build mesh clusters, one or more indices in the index buffer out of range\n");
+        return false;
+    }
+    std::vector<unsigned> clustered(numIndices);
+    buildClusters(clustered.data(), _indices.data(), numIndices, _verts.data(), _num_verts, maxVertices, maxTriangles, _clusters);
+    std::copy(clustered.begin(), clustered.end(), _indices.begin());
+    return true;
+}
+
+unsigned Mesh::MeshInternal::GetClusterCount() const {
+    return _clusters.size();
+}
+
+bool Mesh::MeshInternal::HasLoadedClusters() const {
+    return _loaded && _dynamic_load == false && _clusters.empty() == false;
+}
+
+const std::vector<MeshCluster>& Mesh::MeshInternal::GetClusters() const {
+    return _clusters;
+}
+
+bool Mesh::MeshInternal::indicesInRange(unsigned count) const {
+    for (unsigned i = 0; i < count; i++) {
+        if (_indices[i] >= _num_verts) {
             return false;
         }
-        if (vkMapMemory(dev, stagingBufferMemory, 0, bufferSize, 0, &pdata) != VK_SUCCESS) {
+    }
+    return true;
+}
+
+bool Mesh::MeshInternal::LoadMesh(bool dynamic) {
+	if(_loaded == true) {
+		return false;
+	}
+    if (prepareLoad(dynamic) == false) {
+        return false;
+    }
+    // a draw has one vertexOffset for all bindings, so only interleaved meshes are placed in the arenas
+    if (dynamic == false && _streams.size() == 1 && _arenas && _arenas->IsEnabled()) {
+        return loadIntoArenas();
+    }
+
+    if (_lod_index_offset == 0) {
+        return false;
+    }
+    for (unsigned i = 0; i < _streams.size(); i++) {
+        VertexStream& stream = _streams[i];
+        if (createFilledBuffer((VkDeviceSize)stream.stride * _num_verts, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, stream.dynamic, [this, i](uint8_t* data) { writeStreamData(i, data); return true; }, stream.buffer) == false) {
+            printf("failed to create vertex buffer\n");
+            destroyBuffers();
             return false;
         }
-    } else {
-        if (createBuffer(physdev, dev, bufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, vertexBuffer, vertexBufferMemory) == false) {
-            printf("failed to create vertex staging buffer\n");
-            return false;
+    }
+    VkDeviceSize indexSize = (VkDeviceSize)getLoadIndexCount() * _index_size;
+    bool indicesValid = true;
+    auto writeIndices = [this, &indicesValid](uint8_t* data) {
+        indicesValid = writeIndexData(data);
+        return indicesValid;
+    };
+    if (createFilledBuffer(indexSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, dynamic, writeIndices, _idxbuffer_res) == false) {
+        if (indicesValid) {
+            printf("failed to create index buffer\n");
+        } else {
+            printf("unable to load mesh, one or more indices in the index buffer out of range\n");
         }
-        if (vkMapMemory(dev, vertexBufferMemory, 0, bufferSize, 0, &pdata) != VK_SUCCESS) {
-            return false;
+        destroyBuffers();
+        return false;
+    }
+    if (dynamic && createDynamicCopies() == false) {
+        printf("failed to create dynamic mesh buffers\n");
+        destroyBuffers();
+        return false;
+    }
+
+	_loaded = true;
+    _dynamic_load = dynamic;
+
+    return true;
+}
+
+bool Mesh::MeshInternal::prepareLoad(bool dynamic) {
+	if(_num_verts <= 0 || _num_indices <= 0) {
+		return false;
+	}
+
+    // indices are validated while they are written in the index buffer's width
+    _index_size = getIndexSize(_num_verts);
+    // static loads append the LOD indices to the mesh's
+    _lod_index_offset = _num_indices < _indices.size() ? _num_indices : _indices.size();
+    _loaded_lods = dynamic ? 0 : _lods.size();
+
+    // interleaved: every attribute in stream 0, split: one stream per attribute in the order position, normal, custom inputs
+    _streams.clear();
+    _custom_locations.clear();
+    auto addAttribute = [this, dynamic](unsigned size, bool dynamicAttribute) {
+        if (_layout.splitStreams || _streams.empty()) {
+            _streams.push_back(VertexStream());
+            _streams.back().dynamic = dynamic && (_layout.splitStreams == false || dynamicAttribute);
         }
+        AttributeLocation location = { (unsigned)_streams.size() - 1, _streams.back().stride };
+        _streams.back().stride += size;
+        return location;
+    };
+    if (_layout.useVertBuffer) _position_location = addAttribute(getVertDataSize(_layout.vertFormat), _layout.vertBufferDynamic);
+    if (_layout.useVertNormBuffer) _normal_location = addAttribute(getVertDataSize(_layout.vertNormFormat), _layout.vertNormBufferDynamic);
+    for (auto& e : _layout.customVertInputLayouts) {
+        _custom_locations.push_back(addAttribute(getVertDataSize(e.type, e.components), e.dynamic));
+    }
+    if (_streams.empty()) {
+        return false;
+    }
+
+    // quantized positions cover the bounding box of the data loaded now, later dynamic updates are clamped to it
+    _position_dequant = PositionDequantization();
+    if (_layout.useVertBuffer && _layout.vertFormat == VERTEX_POSITION_SNORM16) {
+        computePositionDequantization(_verts.data(), std::min<size_t>(_verts.size(), _num_verts), _position_dequant);
+    }
+    return DeviceManager::GetVkDevice(_dev_id) != VK_NULL_HANDLE;
+}
+
+void Mesh::MeshInternal::writeStreamData(unsigned stream, uint8_t* data) {
+    unsigned strideSize = _streams[stream].stride;
+    // positions and normals are converted to their storage format in one pass each
+    if (_layout.useVertBuffer && _position_location.stream == stream) {
+        unsigned count = std::min<size_t>(_verts.size(), _num_verts);
+        packPositions(_verts.data(), count, _layout.vertFormat, _position_dequant, data + _position_location.offset, strideSize);
+    }
+    if (_layout.useVertNormBuffer && _normal_location.stream == stream) {
+        unsigned count = std::min<size_t>(_normals.size(), _num_verts);
+        packNormals(_normals.data(), count, _layout.vertNormFormat, data + _normal_location.offset, strideSize);
     }
-    
-    data = (uint8_t*)pdata;
     for (int i = 0; i < _num_verts; i++) {
-        int offset = 0;
-        if (_layout.useVertBuffer) {
-            if(i < _verts.size()) _verts[i].CopyRaw((float*)(&data[i * strideSize + offset]));
-            offset += sizeof(float) * 4;
-        }
-        if (_layout.useVertNormBuffer) {
-            if(i < _normals.size())_normals[i].CopyRaw((float*)(&data[i * strideSize + offset]));
-            offset += sizeof(float) * 3;
-        }
-        for (const auto& layout : _layout.customVertInputLayouts) {
+        for (unsigned l = 0; l < _layout.customVertInputLayouts.size(); l++) {
+            const auto& layout = _layout.customVertInputLayouts[l];
+            if (_custom_locations[l].stream != stream) {
+                continue;
+            }
             unsigned size = getVertDataSize(layout.type, layout.components);
             unsigned idx = size * i;
 			if(_custom_data.find(layout.shaderInputSlot) == _custom_data.end()) {
@@ -195,80 +492,195 @@ bool Mesh::MeshInternal::LoadMesh(bool dynamic) {
             }
 
             const void* src = &_custom_data[layout.shaderInputSlot][idx];
-            void* dst = &data[i * strideSize + offset];
+            void* dst = &data[i * strideSize + _custom_locations[l].offset];
 
             memcpy(dst, src, size);
-            offset += size;
         }
     }
-    if(dynamic == false) {
-        vkUnmapMemory(dev, stagingBufferMemory);
-
-        if (createBuffer(physdev, dev, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vertexBuffer, vertexBufferMemory) == false) {
-            printf("failed to create vertex buffer\n");
-            return false;
-        }
+}
 
-        if( DeviceManager::CopyBuffer(_dev_id, stagingBuffer, vertexBuffer, bufferSize) == false ) {
-            return false;
-        }
-        
-        vkFreeMemory(dev, stagingBufferMemory, nullptr);
-        vkDestroyBuffer(dev, stagingBuffer, nullptr);
+unsigned Mesh::MeshInternal::getLoadIndexCount() const {
+    return _lod_index_offset + (_loaded_lods > 0 ? (unsigned)_lod_indices.size() : 0);
+}
 
-    } else {
-        _vertbuffer_mapped = pdata;
+bool Mesh::MeshInternal::writeIndexData(uint8_t* data) {
+    if (packIndices(_indices.data(), _lod_index_offset, _num_verts, _index_size, data) == false) {
+        return false;
     }
+    unsigned lodIndices = getLoadIndexCount() - _lod_index_offset;
+    return packIndices(_lod_indices.data(), lodIndices, _num_verts, _index_size, data + (size_t)_lod_index_offset * _index_size);
+}
 
-    unsigned numIndices = _num_indices < _indices.size() ? _num_indices : _indices.size();
-    bufferSize = numIndices * sizeof(unsigned);
-    pdata = nullptr;
-    if(bufferSize <= 0) {
+bool Mesh::MeshInternal::createFilledBuffer(VkDeviceSize size, VkBufferUsageFlags usage, bool dynamic, const std::function<bool(uint8_t*)>& write, BufferResources& buffer) {
+    if (size == 0) {
         return false;
     }
-    if(dynamic == false) {
-        if (createBuffer(physdev, dev, bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingBufferMemory) == false) {
-            printf("failed to create index staging buffer\n");
+    if (dynamic) {
+        if (MemoryAllocator::CreateBuffer(_dev_id, size, usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, buffer) == false) {
             return false;
         }
-        if(vkMapMemory(dev, stagingBufferMemory, 0, bufferSize, 0, &pdata) != VK_SUCCESS) {
+        if (write(buffer.memory.mapped) == false) {
+            MemoryAllocator::DestroyBuffer(_dev_id, buffer);
             return false;
         }
-    } else {
-        if (createBuffer(physdev, dev, bufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, indexBuffer, indexBufferMemory) == false) {
-            printf("failed to create index staging buffer\n");
-            return false;
+        // dynamic buffers may be in non coherent memory
+        return MemoryAllocator::FlushRange(_dev_id, buffer.memory, 0, size);
+    }
+
+    BufferResources stagingBuffer;
+    if (MemoryAllocator::CreateBuffer(_dev_id, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer) == false) {
+        printf("failed to create staging buffer\n");
+        return false;
+    }
+    if (write(stagingBuffer.memory.mapped) == false ||
+        MemoryAllocator::CreateBuffer(_dev_id, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, buffer) == false) {
+        MemoryAllocator::DestroyBuffer(_dev_id, stagingBuffer);
+        return false;
+    }
+    bool copied = DeviceManager::CopyBuffer(_dev_id, stagingBuffer.vkBuffer, buffer.vkBuffer, size);
+    MemoryAllocator::DestroyBuffer(_dev_id, stagingBuffer);
+    return copied;
+}
+
+void Mesh::MeshInternal::destroyBuffers() {
+    // the current copy's buffers are the stream and index buffers destroyed below
+    for (unsigned i = 0; i < _dynamic_copies.size(); i++) {
+        if (i == _dynamic_current) {
+            continue;
         }
-        if(vkMapMemory(dev, indexBufferMemory, 0, bufferSize, 0, &pdata) != VK_SUCCESS) {
-            return false;
+        for (auto& buffer : _dynamic_copies[i].vertexBuffers) {
+            MemoryAllocator::DestroyBuffer(_dev_id, buffer);
         }
+        MemoryAllocator::DestroyBuffer(_dev_id, _dynamic_copies[i].indexBuffer);
+    }
+    _dynamic_copies.clear();
+    _dynamic_current = 0;
+
+    for (auto& stream : _streams) {
+        MemoryAllocator::DestroyBuffer(_dev_id, stream.buffer);
     }
+    MemoryAllocator::DestroyBuffer(_dev_id, _idxbuffer_res);
+}
 
-    data = (uint8_t*)pdata;
-    memcpy(data, _indices.data(), (size_t)bufferSize);
+static std::shared_future<bool> failedLoad() {
+    std::promise<bool> result;
+    result.set_value(false);
+    return result.get_future().share();
+}
 
-    if(dynamic == false) {
-        vkUnmapMemory(dev, stagingBufferMemory);
+std::shared_future<bool> Mesh::MeshInternal::LoadMeshAsync() {
+    if (_loaded == true || _uploads == nullptr || prepareLoad(false) == false) {
+        return failedLoad();
+    }
+    unsigned numIndices = getLoadIndexCount();
+    VkDeviceSize indexSize = (VkDeviceSize)numIndices * _index_size;
+    if (_lod_index_offset == 0) {
+        return failedLoad();
+    }
 
-        if (createBuffer(physdev, dev, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, indexBuffer, indexBufferMemory) == false) {
-            printf("failed to create index buffer\n");
-            return false;
+    // the destinations are reserved now, the copies are recorded when the batch is submitted
+    std::vector<UploadQueue::Destination> vertexDst(_streams.size());
+    UploadQueue::Destination indexDst;
+    if (_streams.size() == 1 && _arenas && _arenas->IsEnabled()) {
+        GeometryArena* vertexArena = _arenas->GetVertexArena(_streams[0].stride, _vertex_arena);
+        GeometryArena* indexArena = _arenas->GetIndexArena(_index_size);
+        if (vertexArena == nullptr || indexArena == nullptr || vertexArena->Reserve(_num_verts, _vertex_range) == false) {
+            printf("failed to load mesh into vertex arena\n");
+            return failedLoad();
         }
-        if( DeviceManager::CopyBuffer(_dev_id, stagingBuffer, indexBuffer, bufferSize) == false ) {
-            return false;
+        if (indexArena->Reserve(numIndices, _index_range) == false) {
+            printf("failed to load mesh into index arena\n");
+            // nothing was staged into the range yet, but earlier batches and frames in flight still use the buffer
+            vertexArena->Release(_vertex_range);
+            return failedLoad();
         }
-        vkFreeMemory(dev, stagingBufferMemory, nullptr);
-        vkDestroyBuffer(dev, stagingBuffer, nullptr);
+        vertexDst[0].arena = vertexArena;
+        vertexDst[0].range = _vertex_range;
+        indexDst.arena = indexArena;
+        indexDst.range = _index_range;
+        _in_arena = true;
     } else {
-        _indexbuffer_mapped = pdata;
+        for (unsigned i = 0; i < _streams.size(); i++) {
+            if (MemoryAllocator::CreateBuffer(_dev_id, (VkDeviceSize)_streams[i].stride * _num_verts, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, _streams[i].buffer, true) == false) {
+                printf("failed to create vertex buffer\n");
+                destroyBuffers();
+                return failedLoad();
+            }
+            vertexDst[i].buffer = _streams[i].buffer.vkBuffer;
+        }
+        if (MemoryAllocator::CreateBuffer(_dev_id, indexSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, _idxbuffer_res, true) == false) {
+            printf("failed to create index buffer\n");
+            destroyBuffers();
+            return failedLoad();
+        }
+        indexDst.buffer = _idxbuffer_res.vkBuffer;
+    }
+    _loaded = true;
+    _dynamic_load = false;
+
+    uint8_t* data = nullptr;
+    uint64_t batch = 0;
+    for (unsigned i = 0; i < _streams.size(); i++) {
+        if (_uploads->Stage((VkDeviceSize)_streams[i].stride * _num_verts, vertexDst[i], data, batch) == false) {
+            printf("failed to stage mesh upload\n");
+            UnloadMesh();
+            return failedLoad();
+        }
+        writeStreamData(i, data);
+        _upload_batch = batch;
+    }
+    if (_uploads->Stage(indexSize, indexDst, data, batch) == false) {
+        printf("failed to stage mesh upload\n");
+        UnloadMesh();
+        return failedLoad();
+    }
+    _upload_batch = batch;
+    // the staged copy is still submitted, the ranges are only freed once it completed
+    if (writeIndexData(data) == false) {
+        printf("unable to load mesh, one or more indices in the index buffer out of range\n");
+        UnloadMesh();
+        return failedLoad();
     }
 
-	_vertbuffer_res = {vertexBufferMemory,vertexBuffer};
-	_idxbuffer_res = {indexBufferMemory, indexBuffer};
+    return _uploads->GetFuture(_upload_batch);
+}
 
-	_loaded = true;
-    _dynamic_load = dynamic;
+bool Mesh::MeshInternal::IsUploadComplete() const {
+    return _uploads == nullptr || _uploads->IsComplete(_upload_batch);
+}
+
+bool Mesh::MeshInternal::loadIntoArenas() {
+    unsigned numIndices = getLoadIndexCount();
+    unsigned strideSize = _streams[0].stride;
+    if (strideSize == 0 || _lod_index_offset == 0) {
+        return false;
+    }
+    GeometryArena* vertexArena = _arenas->GetVertexArena(strideSize, _vertex_arena);
+    GeometryArena* indexArena = _arenas->GetIndexArena(_index_size);
+    if (vertexArena == nullptr || indexArena == nullptr) {
+        return false;
+    }
 
+    std::vector<uint8_t> indices((size_t)numIndices * _index_size);
+    if (writeIndexData(indices.data()) == false) {
+        printf("unable to load mesh, one or more indices in the index buffer out of range\n");
+        return false;
+    }
+    std::vector<uint8_t> data((size_t)strideSize * _num_verts, 0);
+    writeStreamData(0, data.data());
+    if (vertexArena->Allocate(data.data(), _num_verts, _vertex_range) == false) {
+        printf("failed to load mesh into vertex arena\n");
+        return false;
+    }
+    if (indexArena->Allocate(indices.data(), numIndices, _index_range) == false) {
+        printf("failed to load mesh into index arena\n");
+        vertexArena->Release(_vertex_range);
+        return false;
+    }
+
+    _in_arena = true;
+    _loaded = true;
+    _dynamic_load = false;
     return true;
 }
 
@@ -281,18 +693,28 @@ bool Mesh::MeshInternal::UnloadMesh() {
         return false;
     }
 
-    if(_dynamic_load) {
-        vkUnmapMemory(dev, _vertbuffer_res.vkBufferMem);
-        _vertbuffer_mapped = nullptr;
+    // the copies of a pending asynchronous load must not land in ranges handed out again
+    if (IsUploadComplete() == false) {
+        _uploads->Finish();
+    }
+    // frames still in flight may reference the buffers
+    if (DeviceManager::WaitIdle(_dev_id) == false) {
+        return false;
     }
 
-    vkDestroyBuffer(dev, _vertbuffer_res.vkBuffer, nullptr);
-    vkFreeMemory(dev, _vertbuffer_res.vkBufferMem, nullptr);
+    if (_in_arena) {
+        GeometryArena* vertexArena = _arenas->FindVertexArena(_vertex_arena);
+        GeometryArena* indexArena = _arenas->FindIndexArena(_index_size);
+        if (vertexArena) vertexArena->Free(_vertex_range);
+        if (indexArena) indexArena->Free(_index_range);
+        _in_arena = false;
+    }
 
-    vkDestroyBuffer(dev, _idxbuffer_res.vkBuffer, nullptr);
-    vkFreeMemory(dev, _idxbuffer_res.vkBufferMem, nullptr);
+    _range_mapped = false;
+    destroyBuffers();
 
 	_loaded = false;
+    _loaded_lods = 0;
 
     return true;
 }
@@ -324,19 +746,10 @@ bool Mesh::MeshInternal::SetVertexDynamic(unsigned idx, const MathUtil::Vec<4>&
     if(idx >= _num_verts) {
         return false;
     }
-    
-    unsigned offset = 0;
-    unsigned strideSize = 0;
-    uint8_t* data = (uint8_t*)_vertbuffer_mapped;
 
-    if (_layout.useVertBuffer) strideSize += sizeof(float)*4;
-    if (_layout.useVertNormBuffer) strideSize += sizeof(float)*3;
-    for (auto& e : _layout.customVertInputLayouts) {
-        unsigned size = getVertDataSize(e.type, e.components);
-        strideSize += size;
-    }
-    position.CopyRaw((float*)(&data[idx * strideSize + offset]));
-    return true;
+    uint8_t data[sizeof(float) * 4];
+    packPositions(&position, 1, _layout.vertFormat, _position_dequant, data, sizeof(data));
+    return writeDynamicAttribute(_position_location, idx, data, getVertDataSize(_layout.vertFormat));
 }
 
 bool Mesh::MeshInternal::SetVertexNormalDynamic(unsigned idx, const MathUtil::Vec<3>& normal) {
@@ -361,21 +774,9 @@ bool Mesh::MeshInternal::SetVertexNormalDynamic(unsigned idx, const MathUtil::Ve
         return false;
     }
 
-    unsigned offset = 0;
-    unsigned strideSize = 0;
-    uint8_t* data = (uint8_t*)_vertbuffer_mapped;
-
-    if (_layout.useVertBuffer) {
-        strideSize += sizeof(float)*4;
-        offset += sizeof(float)*4;
-    }
-    if (_layout.useVertNormBuffer) strideSize += sizeof(float)*3;
-    for (auto& e : _layout.customVertInputLayouts) {
-        unsigned size = getVertDataSize(e.type, e.components);
-        strideSize += size;
-    }
-    normal.CopyRaw((float*)(&data[idx * strideSize + offset]));
-    return true;
+    uint8_t data[sizeof(float) * 3];
+    packNormals(&normal, 1, _layout.vertNormFormat, data, sizeof(data));
+    return writeDynamicAttribute(_normal_location, idx, data, getVertDataSize(_layout.vertNormFormat));
 }
 bool Mesh::MeshInternal::SetIndexDynamic(unsigned idx, unsigned vertIndex) {
     if(_loaded == true && _dynamic_load == false) {
@@ -390,9 +791,16 @@ bool Mesh::MeshInternal::SetIndexDynamic(unsigned idx, unsigned vertIndex) {
     if(idx >= _num_indices) {
         return false;
     }
-    unsigned* data = (unsigned*)_indexbuffer_mapped;
-    memcpy(&data[idx], &vertIndex, sizeof(vertIndex));
-    return true;
+    if (beginDynamicWrite() == false) {
+        return false;
+    }
+    // the buffer holds 16 bit indices when the mesh was loaded with at most 65536 vertices
+    if (packIndices(&vertIndex, 1, _num_verts, _index_size, _idxbuffer_res.memory.mapped + (size_t)idx * _index_size) == false) {
+        return false;
+    }
+    markDynamicIndexWrite(idx, 1);
+    addDynamicBytes(_index_size);
+    return MemoryAllocator::FlushRange(_dev_id, _idxbuffer_res.memory, (VkDeviceSize)idx * _index_size, _index_size);
 }
 
 
@@ -401,29 +809,11 @@ bool Mesh::MeshInternal::SetCustomVertexDataDynamic(unsigned vertIndex, unsigned
         return false;
     }
 
-    unsigned strideSize = 0;
-    unsigned offset = 0;
-    if(_layout.useVertBuffer) {
-        offset += sizeof(float)*4;
-        strideSize += sizeof(float)*4;
-    }
-    
-    if(_layout.useVertNormBuffer) {
-        offset += sizeof(float)*3;
-        strideSize += sizeof(float)*3;
-    }
-
-    for(const auto& e : _layout.customVertInputLayouts) {
-        unsigned sizefromlayout = getVertDataSize(e.type, e.components);
-        strideSize += sizefromlayout;
-    }
-
-    unsigned layoutidx = 0;
-    for(const auto& e : _layout.customVertInputLayouts) {
+    for(unsigned layoutidx = 0; layoutidx < _layout.customVertInputLayouts.size(); layoutidx++) {
+        const auto& e = _layout.customVertInputLayouts[layoutidx];
         unsigned sizefromlayout = getVertDataSize(e.type, e.components);
         if(e.shaderInputSlot == shaderInputSlot) {
             unsigned size = maxSize < sizefromlayout ? maxSize : sizefromlayout;
-            uint8_t* datadst = (uint8_t*)_vertbuffer_mapped;
 
             if (_custom_data.find(shaderInputSlot) != _custom_data.end() && _custom_data[shaderInputSlot].size() > vertIndex * sizefromlayout) {
                 memcpy(&_custom_data[shaderInputSlot][vertIndex*sizefromlayout], data, size);
@@ -434,32 +824,331 @@ bool Mesh::MeshInternal::SetCustomVertexDataDynamic(unsigned vertIndex, unsigned
             }
             
             if(vertIndex < _num_verts) {
-                memcpy(&datadst[vertIndex * strideSize + offset], data, size);
+                return writeDynamicAttribute(_custom_locations[layoutidx], vertIndex, data, size);
             }
             
             return true;
         }
-        offset += sizefromlayout; 
-        layoutidx++;
     }
     return false;
 }
 
+bool Mesh::MeshInternal::MapDynamicRange(unsigned first, unsigned count, DynamicVertexRange& range, uint32_t attributes) {
+    if (_loaded == false || _dynamic_load == false || _range_mapped) {
+        return false;
+    }
+    if (count == 0 || first >= _num_verts || count > _num_verts - first) {
+        return false;
+    }
+    if (beginDynamicWrite() == false) {
+        return false;
+    }
+
+    // views of attributes not selected or in static streams stay invalid
+    _mapped_streams.assign(_streams.size(), false);
+    auto view = [this, first, count](const AttributeLocation& location, bool selected) {
+        VertexStream& stream = _streams[location.stream];
+        if (selected == false || stream.dynamic == false) {
+            return StridedView<uint8_t>();
+        }
+        _mapped_streams[location.stream] = true;
+        return StridedView<uint8_t>(stream.buffer.memory.mapped + (size_t)first * stream.stride + location.offset, stream.stride, count);
+    };
+    range.first = first;
+    range.count = count;
+    range.positions = StridedView<Vec<4>>();
+    range.normals = StridedView<Vec<3>>();
+    range.customData.clear();
+    // packed formats have no view
+    bool positions = _layout.vertFormat == VERTEX_POSITION_FLOAT4 && (attributes & VERTEX_ATTRIBUTE_POSITION);
+    bool normals = _layout.vertNormFormat == VERTEX_NORMAL_FLOAT3 && (attributes & VERTEX_ATTRIBUTE_NORMAL);
+    if (_layout.useVertBuffer) range.positions = view(_position_location, positions).As<Vec<4>>();
+    if (_layout.useVertNormBuffer) range.normals = view(_normal_location, normals).As<Vec<3>>();
+    for (unsigned i = 0; i < _custom_locations.size(); i++) {
+        range.customData.push_back(view(_custom_locations[i], i < 30 && (attributes & (VERTEX_ATTRIBUTE_CUSTOM << i))));
+    }
+
+    for (unsigned i = 0; i < _streams.size(); i++) {
+        if (_mapped_streams[i]) markDynamicWrite(i, first, count);
+    }
+    _mapped_first = first;
+    _mapped_count = count;
+    _range_mapped = true;
+    return true;
+}
+
+bool Mesh::MeshInternal::UnmapDynamicRange() {
+    if (_range_mapped == false) {
+        return false;
+    }
+    _range_mapped = false;
+    bool flushed = true;
+    for (unsigned i = 0; i < _streams.size() && i < _mapped_streams.size(); i++) {
+        if (_mapped_streams[i]) flushed = flushStream(i, _mapped_first, _mapped_count) && flushed;
+    }
+    return flushed;
+}
+
+void Mesh::MeshInternal::SetDynamicCopyForward(bool enable) {
+    _copy_forward = enable;
+}
+
+bool Mesh::MeshInternal::createDynamicCopies() {
+    unsigned copies = (_frame_clock ? _frame_clock->framesInFlight : 1) + 1;
+    VkDeviceSize indexSize = _idxbuffer_res.memory.size;
+    _dynamic_copies.assign(copies, DynamicCopy());
+    _dynamic_current = 0;
+    for (unsigned i = 0; i < copies; i++) {
+        DynamicCopy& copy = _dynamic_copies[i];
+        copy.vertexBuffers.resize(_streams.size());
+        copy.vertexRanges.resize(_streams.size());
+        if (i == 0) {
+            for (unsigned s = 0; s < _streams.size(); s++) {
+                if (_streams[s].dynamic) copy.vertexBuffers[s] = _streams[s].buffer;
+            }
+            copy.indexBuffer = _idxbuffer_res;
+            continue;
+        }
+        for (unsigned s = 0; s < _streams.size(); s++) {
+            if (_streams[s].dynamic == false) {
+                continue;
+            }
+            VkDeviceSize size = (VkDeviceSize)_streams[s].stride * _num_verts;
+            if (MemoryAllocator::CreateBuffer(_dev_id, size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, copy.vertexBuffers[s]) == false) {
+                return false;
+            }
+            memcpy(copy.vertexBuffers[s].memory.mapped, _streams[s].buffer.memory.mapped, size);
+            MemoryAllocator::FlushRange(_dev_id, copy.vertexBuffers[s].memory, 0, size);
+        }
+        if (MemoryAllocator::CreateBuffer(_dev_id, indexSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, copy.indexBuffer) == false) {
+            return false;
+        }
+        memcpy(copy.indexBuffer.memory.mapped, _idxbuffer_res.memory.mapped, indexSize);
+        MemoryAllocator::FlushRange(_dev_id, copy.indexBuffer.memory, 0, indexSize);
+    }
+    _dynamic_frame = _frame_clock ? _frame_clock->frame.load() : 0;
+    return true;
+}
+
+static void copyForward(unsigned devID, BufferResources& dst, const BufferResources& src, VkDeviceSize offset, VkDeviceSize size) {
+    memcpy(dst.memory.mapped + offset, src.memory.mapped + offset, size);
+    MemoryAllocator::FlushRange(devID, dst.memory, offset, size);
+}
+
+bool Mesh::MeshInternal::beginDynamicWrite() {
+    unsigned long long frame = _frame_clock ? _frame_clock->frame.load() : 0;
+    if (_dynamic_copies.size() < 2 || frame == _dynamic_frame) {
+        return true;
+    }
+    _dynamic_frame = frame;
+
+    // copies are released at most once per frame, so the least recently released of the other copies
+    // was released framesInFlight frames ago or earlier and the frame that last drew it has completed
+    unsigned next = _dynamic_current;
+    for (unsigned i = 0; i < _dynamic_copies.size(); i++) {
+        if (i != _dynamic_current && (next == _dynamic_current || _dynamic_copies[i].released < _dynamic_copies[next].released)) {
+            next = i;
+        }
+    }
+    DynamicCopy& dst = _dynamic_copies[next];
+    if (dst.released > 0 && dst.released + _frame_clock->framesInFlight > frame) {
+        if (DeviceManager::WaitIdle(_dev_id) == false) {
+            return false;
+        }
+    }
+    DynamicCopy& src = _dynamic_copies[_dynamic_current];
+    src.released = frame;
+
+    for (unsigned s = 0; s < _streams.size(); s++) {
+        DirtyRange& range = dst.vertexRanges[s];
+        if (_streams[s].dynamic == false) {
+            continue;
+        }
+        if (_copy_forward && range.begin < range.end) {
+            VkDeviceSize stride = _streams[s].stride;
+            copyForward(_dev_id, dst.vertexBuffers[s], src.vertexBuffers[s], range.begin * stride, (range.end - range.begin) * stride);
+            addDynamicBytes((range.end - range.begin) * stride);
+        }
+        range = DirtyRange();
+        _streams[s].buffer = dst.vertexBuffers[s];
+    }
+    if (_copy_forward && dst.indexRange.begin < dst.indexRange.end) {
+        copyForward(_dev_id, dst.indexBuffer, src.indexBuffer, dst.indexRange.begin * _index_size, (dst.indexRange.end - dst.indexRange.begin) * _index_size);
+        addDynamicBytes((dst.indexRange.end - dst.indexRange.begin) * _index_size);
+    }
+    dst.indexRange = DirtyRange();
+    _idxbuffer_res = dst.indexBuffer;
+
+    _dynamic_current = next;
+    return true;
+}
+
+static void extendRange(unsigned& begin, unsigned& end, unsigned first, unsigned count) {
+    if (begin == end) {
+        begin = first;
+        end = first + count;
+    } else {
+        begin = std::min(begin, first);
+        end = std::max(end, first + count);
+    }
+}
+
+void Mesh::MeshInternal::markDynamicWrite(unsigned stream, unsigned first, unsigned count) {
+    for (unsigned i = 0; i < _dynamic_copies.size(); i++) {
+        if (i != _dynamic_current) {
+            DirtyRange& range = _dynamic_copies[i].vertexRanges[stream];
+            extendRange(range.begin, range.end, first, count);
+        }
+    }
+}
+
+void Mesh::MeshInternal::markDynamicIndexWrite(unsigned first, unsigned count) {
+    for (unsigned i = 0; i < _dynamic_copies.size(); i++) {
+        if (i != _dynamic_current) {
+            DirtyRange& range = _dynamic_copies[i].indexRange;
+            extendRange(range.begin, range.end, first, count);
+        }
+    }
+}
+
+bool Mesh::MeshInternal::writeDynamicAttribute(const AttributeLocation& location, unsigned vertIndex, const void* data, unsigned size) {
+    // static streams of a split layout can't be written
+    if (_streams[location.stream].dynamic == false) {
+        return false;
+    }
+    if (beginDynamicWrite() == false) {
+        return false;
+    }
+    VertexStream& stream = _streams[location.stream];
+    memcpy(stream.buffer.memory.mapped + (size_t)vertIndex * stream.stride + location.offset, data, size);
+    markDynamicWrite(location.stream, vertIndex, 1);
+    return flushStream(location.stream, vertIndex, 1);
+}
+
+bool Mesh::MeshInternal::flushStream(unsigned stream, unsigned first, unsigned count) {
+    // no-op for coherent memory, otherwise rounded to the non coherent atom size
+    const VertexStream& vertexStream = _streams[stream];
+    addDynamicBytes((VkDeviceSize)count * vertexStream.stride);
+    return MemoryAllocator::FlushRange(_dev_id, vertexStream.buffer.memory, (VkDeviceSize)first * vertexStream.stride, (VkDeviceSize)count * vertexStream.stride);
+}
+
+void Mesh::MeshInternal::addDynamicBytes(VkDeviceSize bytes) const {
+    if (_frame_clock) {
+        _frame_clock->dynamicBytes += bytes;
+    }
+}
+
 
 bool Mesh::MeshInternal::AddCommandDrawMesh(VkCommandBuffer cmdBuffer, unsigned maxIndices) {
-    VkBuffer vertexBuffers[] = { _vertbuffer_res.vkBuffer };
+    return AddCommandBindMesh(cmdBuffer) && AddCommandDraw(cmdBuffer, maxIndices, 0);
+}
+
+bool Mesh::MeshInternal::AddCommandBindMesh(VkCommandBuffer cmdBuffer) {
     VkDeviceSize offsets[] = { 0 };
+    VkBuffer indexBuffer = getIndexBuffer();
+    if (indexBuffer == VK_NULL_HANDLE) {
+        return false;
+    }
+    // split streams are bound to consecutive bindings
+    for (unsigned i = 0; i < getStreamCount(); i++) {
+        VkBuffer vertexBuffers[] = { getVertexBuffer(i) };
+        if (vertexBuffers[0] == VK_NULL_HANDLE) {
+            return false;
+        }
+        vkCmdBindVertexBuffers(cmdBuffer, i, 1, vertexBuffers, offsets);
+    }
+    vkCmdBindIndexBuffer(cmdBuffer, indexBuffer, 0, _index_size == sizeof(uint16_t) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+    return true;
+}
+
+bool Mesh::MeshInternal::BindsSameBuffers(const MeshInternal& other) const {
+    if (getStreamCount() != other.getStreamCount() || getIndexBuffer() != other.getIndexBuffer()) {
+        return false;
+    }
+    for (unsigned i = 0; i < getStreamCount(); i++) {
+        if (getVertexBuffer(i) != other.getVertexBuffer(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const PositionDequantization* Mesh::MeshInternal::GetPositionDequantization() const {
+    if (_layout.useVertBuffer == false || _layout.vertFormat != VERTEX_POSITION_SNORM16) {
+        return nullptr;
+    }
+    return &_position_dequant;
+}
+
+uint32_t Mesh::MeshInternal::GetSortBits(unsigned lod) const {
+    // draws of one LOD of a mesh sort next to each other, so they can be instanced
+    uint32_t meshBits = ((reinterpret_cast<uintptr_t>(this) >> 4) << 3) | (lod & 0x7);
+    if (_in_arena) {
+        // meshes sharing arenas sort next to each other, so their buffers are bound once
+        return 0x800000 | ((_vertex_arena & 0x3F) << 17) | ((_index_size == sizeof(uint16_t)) << 16) | (meshBits & 0xFFFF);
+    }
+    return meshBits & 0x7FFFFF;
+}
+
+unsigned Mesh::MeshInternal::getStreamCount() const {
+    return _in_arena ? 1 : _streams.size();
+}
+
+VkBuffer Mesh::MeshInternal::getVertexBuffer(unsigned stream) const {
+    if (_in_arena) {
+        GeometryArena* vertexArena = _arenas->FindVertexArena(_vertex_arena);
+        return vertexArena ? vertexArena->GetBuffer() : VK_NULL_HANDLE;
+    }
+    return stream < _streams.size() ? _streams[stream].buffer.vkBuffer : VK_NULL_HANDLE;
+}
 
-    unsigned indices = _num_indices;
+VkBuffer Mesh::MeshInternal::getIndexBuffer() const {
+    if (_in_arena) {
+        GeometryArena* indexArena = _arenas->FindIndexArena(_index_size);
+        return indexArena ? indexArena->GetBuffer() : VK_NULL_HANDLE;
+    }
+    return _idxbuffer_res.vkBuffer;
+}
 
+unsigned Mesh::MeshInternal::GetDrawIndexCount(unsigned maxIndices, unsigned lod) const {
+    if (lod > 0 && lod <= _loaded_lods) {
+        return _lods[lod - 1].indexCount;
+    }
     if (maxIndices > 0) {
-        indices = _num_indices > maxIndices ? maxIndices : _num_indices;
+        return _num_indices > maxIndices ? maxIndices : _num_indices;
+    }
+    return _num_indices;
+}
+
+bool Mesh::MeshInternal::AddCommandDraw(VkCommandBuffer cmdBuffer, unsigned maxIndices, unsigned lod, unsigned instanceCount, unsigned firstInstance) {
+    unsigned indices = GetDrawIndexCount(maxIndices, lod);
+
+    unsigned firstIndex = 0;
+    if (lod > 0 && lod <= _loaded_lods) {
+        firstIndex = _lod_index_offset + _lods[lod - 1].firstIndex;
+    }
+    unsigned baseIndex = 0;
+    int vertexOffset = 0;
+    if (GetDrawOffsets(baseIndex, vertexOffset) == false) {
+        return false;
     }
 
-    vkCmdBindVertexBuffers(cmdBuffer, 0, 1, vertexBuffers,offsets);
-    vkCmdBindIndexBuffer(cmdBuffer, _idxbuffer_res.vkBuffer, 0, VK_INDEX_TYPE_UINT32);
+    vkCmdDrawIndexed(cmdBuffer, indices, instanceCount, baseIndex + firstIndex, vertexOffset, firstInstance);
+    return true;
+}
 
-    vkCmdDrawIndexed(cmdBuffer, indices, 1, 0, 0, 0);
+bool Mesh::MeshInternal::GetDrawOffsets(unsigned& firstIndex, int& vertexOffset) const {
+    firstIndex = 0;
+    vertexOffset = 0;
+    if (_in_arena) {
+        GeometryArena* vertexArena = _arenas->FindVertexArena(_vertex_arena);
+        GeometryArena* indexArena = _arenas->FindIndexArena(_index_size);
+        if (vertexArena == nullptr || indexArena == nullptr) {
+            return false;
+        }
+        vertexOffset = vertexArena->GetOffset(_vertex_range);
+        firstIndex = indexArena->GetOffset(_index_range);
+    }
     return true;
 }
 
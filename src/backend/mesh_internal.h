@@ -1,10 +1,15 @@
 #pragma once
 #include <vector>
 #include <unordered_map>
+#include <future>
+#include <functional>
 #include "matrix.h"
 #include "mesh.h"
 #include "renderer_internal.h"
 #include "types_internal.h"
+#include "arena.h"
+#include "upload.h"
+#include "meshopt.h"
 
 namespace RenderingFramework3D {
 
@@ -28,6 +33,8 @@ public:
 
 	unsigned GetNumVertices() const;
 	unsigned GetNumIndices() const;
+	// bytes per vertex of all streams, from the layout
+	unsigned GetVertexSize() const;
 
 	const std::vector<MathUtil::Vec<4>>& GetVertices() const;
 	const std::vector<MathUtil::Vec<3>>& GetVertexNormals() const;
@@ -35,9 +42,32 @@ public:
 
 	const std::vector<uint8_t>& GetCustomVertexData(unsigned shaderInputSlot) const;
 
+	// reorders the CPU side index and vertex data, not while loaded
+	bool Optimize(MeshOptimizationStats& stats, unsigned cacheSize, float overdrawThreshold);
+	// simplified index lists sharing the mesh's vertices, not while loaded. Level 0 is the mesh itself
+	bool GenerateLODs(unsigned levels, float targetError);
+	unsigned GetLODCount() const;
+	unsigned GetLODTriangleCount(unsigned lod) const;
+	float GetLODError(unsigned lod) const;
+	// levels in the loaded index buffer, 1 for dynamic loads, 0 if not loaded
+	unsigned GetLoadedLODCount() const;
+	// mesh space bounding sphere computed by GenerateLODs
+	void GetBoundingSphere(MathUtil::Vec<3>& center, float& radius) const;
+
+	// reorders the mesh's triangles into clusters with culling bounds, not while loaded
+	bool BuildClusters(unsigned maxVertices, unsigned maxTriangles);
+	unsigned GetClusterCount() const;
+	// static loads of a clustered mesh, the cluster index ranges are relative to GetDrawOffsets
+	bool HasLoadedClusters() const;
+	const std::vector<MeshCluster>& GetClusters() const;
+
 	bool LoadMesh(bool dynamic);
+	// static only, the data is staged in the renderer's upload queue and copied by the next PresentFrame
+	std::shared_future<bool> LoadMeshAsync();
     bool UnloadMesh();
 	bool Reload(bool dynamic);
+	// false while an asynchronous load is still copying the data, the mesh is not drawn until then
+	bool IsUploadComplete() const;
 
 	bool SetVertexDynamic(unsigned idx, const MathUtil::Vec<4>& position);
 	bool SetVertexNormalDynamic(unsigned idx, const MathUtil::Vec<3>& normal);
@@ -45,7 +75,64 @@ public:
 
 	bool SetCustomVertexDataDynamic(unsigned vertIndex, unsigned shaderInputSlot, uint8_t* data, unsigned maxSize);
 
+	bool MapDynamicRange(unsigned first, unsigned count, DynamicVertexRange& range, uint32_t attributes);
+	bool UnmapDynamicRange();
+	void SetDynamicCopyForward(bool enable);
+
 	bool AddCommandDrawMesh(VkCommandBuffer cmdBuffer, unsigned maxIndices);
+	// bind the vertex/index buffers once and draw several times
+	bool AddCommandBindMesh(VkCommandBuffer cmdBuffer);
+	// lod 0 draws at most maxIndices (0 = all) of the mesh's own indices, loaded LODs always draw all of theirs
+	bool AddCommandDraw(VkCommandBuffer cmdBuffer, unsigned maxIndices, unsigned lod, unsigned instanceCount = 1, unsigned firstInstance = 0);
+	unsigned GetDrawIndexCount(unsigned maxIndices, unsigned lod) const;
+	// first index and vertex offset of the mesh in its buffers, non zero for meshes in the arenas
+	bool GetDrawOffsets(unsigned& firstIndex, int& vertexOffset) const;
+	// meshes in the same arenas bind the same buffers, the bind can be skipped between their draws
+	bool BindsSameBuffers(const MeshInternal& other) const;
+	// 24 bit mesh field of the draw sort key
+	uint32_t GetSortBits(unsigned lod) const;
+	// decode of VERTEX_POSITION_SNORM16 positions, nullptr for other formats
+	const PositionDequantization* GetPositionDequantization() const;
+
+private:
+	// where an attribute is stored: vertex stream (binding) and byte offset in the stream's vertex
+	struct AttributeLocation {
+		unsigned stream = 0;
+		unsigned offset = 0;
+	};
+	struct DirtyRange {
+		unsigned begin = 0;
+		unsigned end = 0;
+	};
+
+	bool indicesInRange(unsigned count) const;
+	// drops the LODs and their bounds, they were computed from the current vertices and indices
+	void clearLODs();
+	// checks the mesh data and assigns the attributes of the layout to streams
+	bool prepareLoad(bool dynamic);
+	void writeStreamData(unsigned stream, uint8_t* data);
+	// the mesh's indices followed by those of the LODs included in the load, false if one is out of range
+	unsigned getLoadIndexCount() const;
+	bool writeIndexData(uint8_t* data);
+	// device local buffer filled through a staging copy, or host visible for dynamic data
+	bool createFilledBuffer(VkDeviceSize size, VkBufferUsageFlags usage, bool dynamic, const std::function<bool(uint8_t*)>& write, BufferResources& buffer);
+	void destroyBuffers();
+	bool loadIntoArenas();
+
+	bool createDynamicCopies();
+	// switches to copies the GPU is done with on the first write of a frame
+	bool beginDynamicWrite();
+	// the other copies receive the written elements when they become current again
+	void markDynamicWrite(unsigned stream, unsigned first, unsigned count);
+	void markDynamicIndexWrite(unsigned first, unsigned count);
+	bool writeDynamicAttribute(const AttributeLocation& location, unsigned vertIndex, const void* data, unsigned size);
+	bool flushStream(unsigned stream, unsigned first, unsigned count);
+	// counted in the frame stats of the renderer
+	void addDynamicBytes(VkDeviceSize bytes) const;
+
+	unsigned getStreamCount() const;
+	VkBuffer getVertexBuffer(unsigned stream) const;
+	VkBuffer getIndexBuffer() const;
 
 private:
 	unsigned _num_verts;
@@ -56,10 +143,75 @@ private:
 	std::vector<unsigned> _indices;
 	std::unordered_map<int, std::vector<uint8_t>> _custom_data;
 
-	void* _vertbuffer_mapped;
-	void* _indexbuffer_mapped;
-	BufferResources _vertbuffer_res;
+	// one vertex buffer binding, every attribute is interleaved in stream 0 unless the layout splits them
+	struct VertexStream {
+		unsigned stride = 0;
+		// host visible and written by the dynamic setters, split streams of a dynamic mesh may be static
+		bool dynamic = false;
+		// the static buffer or the current copy of a dynamic stream
+		BufferResources buffer;
+	};
+	std::vector<VertexStream> _streams;
+	AttributeLocation _position_location;
+	AttributeLocation _normal_location;
+	// same order as _layout.customVertInputLayouts
+	std::vector<AttributeLocation> _custom_locations;
+	PositionDequantization _position_dequant;
 	BufferResources _idxbuffer_res;
+	// bytes per index in the index buffer, 2 when every vertex can be addressed with 16 bit indices
+	unsigned _index_size;
+
+	// LOD levels 1 and up, their indices are stored after the mesh's own ones in the index buffer of static loads
+	struct LodLevel {
+		unsigned firstIndex = 0;
+		unsigned indexCount = 0;
+		// simplification error relative to the bounding sphere radius
+		float error = 0;
+	};
+	std::vector<LodLevel> _lods;
+	std::vector<unsigned> _lod_indices;
+	MathUtil::Vec<3> _bounds_center;
+	float _bounds_radius;
+	// first LOD index in the loaded index buffer and the number of LODs loaded
+	unsigned _lod_index_offset;
+	unsigned _loaded_lods;
+	// triangle runs of the mesh's own indices, see BuildClusters
+	std::vector<MeshCluster> _clusters;
+
+	// dynamic meshes keep one copy more than the renderer has frames in flight, writes go to the current copy
+	// (aliased by the stream buffers and _idxbuffer_res) and frames draw the copy current when recorded
+	struct DynamicCopy {
+		// per stream, empty for static streams
+		std::vector<BufferResources> vertexBuffers;
+		BufferResources indexBuffer;
+		// frame in which the copy stopped being current, the last frame drawing it is the one before
+		unsigned long long released = 0;
+		// elements written while the copy was not current
+		std::vector<DirtyRange> vertexRanges;
+		DirtyRange indexRange;
+	};
+	std::vector<DynamicCopy> _dynamic_copies;
+	unsigned _dynamic_current;
+	unsigned long long _dynamic_frame;
+	bool _copy_forward;
+	std::shared_ptr<const FrameClock> _frame_clock;
+
+	// dynamic mesh vertex range mapped by MapDynamicRange and the streams it covers
+	unsigned _mapped_first;
+	unsigned _mapped_count;
+	std::vector<bool> _mapped_streams;
+	bool _range_mapped;
+
+	// static meshes loaded while the renderer's mesh arenas are enabled are ranges of the shared buffers instead
+	std::shared_ptr<MeshArenas> _arenas;
+	unsigned _vertex_arena;
+	unsigned _vertex_range;
+	unsigned _index_range;
+	bool _in_arena;
+
+	// asynchronous loads: the upload batch copying the mesh data
+	std::shared_ptr<UploadQueue> _uploads;
+	uint64_t _upload_batch;
 
 	VertDataLayout _layout;
 
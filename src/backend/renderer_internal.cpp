@@ -1,6 +1,8 @@
 #include <iostream>
+#include <algorithm>
 #include "renderer_internal.h"
 #include "wnd_internal.h"
+#include "memalloc.h"
 
 
 namespace RenderingFramework3D {
@@ -9,19 +11,47 @@ using namespace MathUtil;
 
 
 static unsigned _renderer_count = 0;
+// staging memory of asynchronous mesh loads, larger loads get a temporary staging buffer
+static constexpr VkDeviceSize upload_ring_size = 16 << 20;
+// lower bound of maxDrawIndirectCount on devices with multiDrawIndirect, longer runs are split
+static constexpr unsigned max_indirect_draw_count = 0xFFFF;
+// default number of threads computing screen transforms, for cores beyond it the gain is below the wake up cost
+static constexpr unsigned max_transform_threads = 8;
 
 Renderer::RendererInternal::RendererInternal()
 	:
 	_init(false),
 	_pipelines(),
 	_swapchain(),
+	_offscreen(),
+	_offscreen_format(IMAGE_FORMAT_R8G8B8A8_SRGB),
+	_headless(false),
+	_readback(),
+	_frame_clock(std::make_shared<FrameClock>()),
+	_frames(),
+	_frame_idx(0),
 	_cmd_buffer(VK_NULL_HANDLE),
-	_image_available_sem(VK_NULL_HANDLE),
-	_render_complete_sem(VK_NULL_HANDLE),
+	_timestamp_period(0),
+	_last_frame_start(),
+	_last_frame_start_valid(false),
+	_frame_stats(),
 	_window(),
+	_draw_state(),
+	_draw_list(),
+	_sort_draws(true),
+	_lod_pixel_error(1.0f),
+	_lod_hysteresis(0.25f),
+	_cluster_culling(true),
+	_transform_threads(std::max(1u, std::min(std::thread::hardware_concurrency(), max_transform_threads))),
+	_transform_workers(),
+	_mesh_arenas(std::make_shared<MeshArenas>()),
+	_uploads(std::make_shared<UploadQueue>()),
+	_parallel_contexts(),
+	_parallel_count(0),
+	_execute_buffers(),
 	_dev_id(0)
 {}
-bool Renderer::RendererInternal::Initialize(std::shared_ptr<Window::WindowInternal>& wnd) {
+bool Renderer::RendererInternal::Initialize(std::shared_ptr<Window::WindowInternal>& wnd, unsigned framesInFlight) {
 	if (_init == true) {
 		return true;
 	}
@@ -54,56 +84,23 @@ bool Renderer::RendererInternal::Initialize(std::shared_ptr<Window::WindowIntern
 		if (DeviceManager::FindSuitableDevice(surface, _dev_id, swpSupport) == false) {
 			return false;
 		}
-		if (DeviceManager::CreateCommandBuffer(_dev_id, DeviceManager::QUEUE_TYPE_GRAPHICS, true, _cmd_buffer) == false) {
+		_mesh_arenas->Initialize(_dev_id);
+		if (_uploads->Initialize(_dev_id, upload_ring_size) == false) {
 			return false;
 		}
-		if (_swapchain.Initialize(_dev_id, { surface,extent,swpSupport }) == false) {
-			return false;
-		}
-
-		VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
-		if (dev == VK_NULL_HANDLE) {
-			return false;
-		}
-		VkSemaphoreCreateInfo semaphoreInfo{};
-		semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-
-		if (vkCreateSemaphore(dev, &semaphoreInfo, nullptr, &_image_available_sem) != VK_SUCCESS) {
-			return false;
-		}
-		if (vkCreateSemaphore(dev, &semaphoreInfo, nullptr, &_render_complete_sem) != VK_SUCCESS) {
+		if (createFrameResources(framesInFlight) == false) {
 			return false;
 		}
-
-		PipelineConfig config;
-		config.useDefaultShaders = true;
-		config.useDefaultVertData = true;
-		
-		unsigned pipelineID;
-		if (CreatePipeline(config, pipelineID) == false) {
+		if (_swapchain.Initialize(_dev_id, { surface,extent,swpSupport }) == false) {
 			return false;
 		}
-
-		config.uniformShaderInputLayout.ObjectInputs.useObjToWorldTransform = false;
-		config.defFragShaderSelect = DEFAULT_FRAG_SHADER_UNLIT;
-		config.defVertShaderSelect = DEFAULT_VERT_SHADER_UNLIT;
-		if (CreatePipeline(config, pipelineID) == false) {
+		if (_readback.Initialize(_dev_id, _frames.size() + 1) == false) {
 			return false;
 		}
-		
-		config.uniformShaderInputLayout.ObjectInputs.useObjToWorldTransform = false;
-		config.defFragShaderSelect = DEFAULT_FRAG_SHADER_UNLIT;
-		config.defVertShaderSelect = DEFAULT_VERT_SHADER_UNLIT;
-		config.primitiveType=PRIM_TYPE_TRIANGLE_WIREFRAME;
-		if (CreatePipeline(config, pipelineID) == false) {
+		if (createDefaultPipelines() == false) {
 			return false;
 		}
-
-		config.uniformShaderInputLayout.ObjectInputs.useObjToWorldTransform = false;
-		config.defFragShaderSelect = DEFAULT_FRAG_SHADER_UNLIT;
-		config.defVertShaderSelect = DEFAULT_VERT_SHADER_UNLIT;
-		config.primitiveType = PRIM_TYPE_LINE_LINKED;
-		if (CreatePipeline(config, pipelineID) == false) {
+		if (_transform_workers.Initialize(_transform_threads - 1) == false) {
 			return false;
 		}
 
@@ -115,6 +112,82 @@ bool Renderer::RendererInternal::Initialize(std::shared_ptr<Window::WindowIntern
 	return false;
 }
 
+bool Renderer::RendererInternal::InitializeOffscreen(unsigned width, unsigned height, ImageFormat format, unsigned framesInFlight) {
+	if (_init == true) {
+		return true;
+	}
+	if (DeviceManager::Initialize() == false) {
+		return false;
+	}
+
+	_headless = true;
+	if (DeviceManager::FindHeadlessDevice(_dev_id) == false) {
+		printf("no vulkan device with a graphics queue found\n");
+		return false;
+	}
+	_mesh_arenas->Initialize(_dev_id);
+	if (_uploads->Initialize(_dev_id, upload_ring_size) == false) {
+		return false;
+	}
+	if (createFrameResources(framesInFlight) == false) {
+		return false;
+	}
+	if (_offscreen.Initialize(_dev_id, { width, height }, getVkFormat(format)) == false) {
+		return false;
+	}
+	_offscreen_format = format;
+	if (_readback.Initialize(_dev_id, _frames.size() + 1) == false) {
+		return false;
+	}
+	if (createDefaultPipelines() == false) {
+		return false;
+	}
+	if (_transform_workers.Initialize(_transform_threads - 1) == false) {
+		return false;
+	}
+
+	_init = true;
+	_renderer_count++;
+	_draw_state.startPass = true;
+	return true;
+}
+
+bool Renderer::RendererInternal::createDefaultPipelines() {
+	PipelineConfig config;
+	config.useDefaultShaders = true;
+	config.useDefaultVertData = true;
+	config.uniformShaderInputLayout.ObjectInputs.useInstancing = true;
+	
+	unsigned pipelineID;
+	if (CreatePipeline(config, pipelineID) == false) {
+		return false;
+	}
+
+	config.uniformShaderInputLayout.ObjectInputs.useObjToWorldTransform = false;
+	config.defFragShaderSelect = DEFAULT_FRAG_SHADER_UNLIT;
+	config.defVertShaderSelect = DEFAULT_VERT_SHADER_UNLIT;
+	if (CreatePipeline(config, pipelineID) == false) {
+		return false;
+	}
+	
+	config.uniformShaderInputLayout.ObjectInputs.useObjToWorldTransform = false;
+	config.defFragShaderSelect = DEFAULT_FRAG_SHADER_UNLIT;
+	config.defVertShaderSelect = DEFAULT_VERT_SHADER_UNLIT;
+	config.primitiveType=PRIM_TYPE_TRIANGLE_WIREFRAME;
+	if (CreatePipeline(config, pipelineID) == false) {
+		return false;
+	}
+
+	config.uniformShaderInputLayout.ObjectInputs.useObjToWorldTransform = false;
+	config.defFragShaderSelect = DEFAULT_FRAG_SHADER_UNLIT;
+	config.defVertShaderSelect = DEFAULT_VERT_SHADER_UNLIT;
+	config.primitiveType = PRIM_TYPE_LINE_LINKED;
+	if (CreatePipeline(config, pipelineID) == false) {
+		return false;
+	}
+	return true;
+}
+
 bool Renderer::RendererInternal::Cleanup() {
 	if (_init == false) {
 		return true;
@@ -122,12 +195,24 @@ bool Renderer::RendererInternal::Cleanup() {
 	_init = false;
 	_renderer_count--;
 
+	// frames may still be executing
+	DeviceManager::WaitIdle(_dev_id);
+	_readback.Cleanup();
+	_transform_workers.Cleanup();
+	destroyFrameResources();
+
 	for (auto& pipeline : _pipelines) {
 		pipeline.Cleanup();
 	}
 	_pipelines.clear();
+	_uploads->Cleanup();
+	_mesh_arenas->Cleanup();
 
-	_swapchain.Cleanup();
+	if (_headless) {
+		_offscreen.Cleanup();
+	} else {
+		_swapchain.Cleanup();
+	}
 
 	if (_renderer_count <= 0) {
 		DeviceManager::Cleanup();
@@ -189,121 +274,693 @@ void Renderer::RendererInternal::SetCustomGlobalUniformShaderData(unsigned pipel
 	}
 }
 
+// 64 bit draw sort key, most significant first:
+// translucent(1) | pipeline(8) | cull(1) | viewport(6) | mesh(24) | material(24)
+// translucent draws only use the top bit, the stable sort keeps them in submission order after all opaque draws
+static uint64_t drawSortKey(unsigned pipeline, bool cull, unsigned viewport, uint32_t meshBits, const Material& material) {
+	if (material.colour(3) < 1.0f) {
+		return 1ull << 63;
+	}
+
+	// FNV-1a over the material constants, equal materials end up next to each other
+	uint32_t hash = 2166136261u;
+	auto hashFloat = [&hash](float f) {
+		uint32_t bits;
+		memcpy(&bits, &f, sizeof(bits));
+		for (unsigned i = 0; i < 4; i++) {
+			hash = (hash ^ ((bits >> (i * 8)) & 0xFF)) * 16777619u;
+		}
+	};
+	for (unsigned i = 0; i < 4; i++) {
+		hashFloat(material.colour(i));
+	}
+	hashFloat(material.diffuseConstant);
+	hashFloat(material.specularConstant);
+	hashFloat(material.shininess);
+
+	return ((uint64_t)(pipeline & 0xFF) << 55) |
+		((uint64_t)(cull ? 1 : 0) << 54) |
+		((uint64_t)(viewport & 0x3F) << 48) |
+		((uint64_t)(meshBits & 0xFFFFFF) << 24) |
+		(hash & 0xFFFFFF);
+}
+
 bool Renderer::RendererInternal::DrawObject(const WorldObject& obj, Camera& cam, unsigned pipelineID) {
 	
 	if (_init) {
-		if (pipelineID >= _pipelines.size()) {
-			return false;
-		}
-		if(obj.GetMesh()._internal == nullptr) {
-			return false;
-		}
-		
-		bool first = _draw_state.startPass;
 		if (_draw_state.startPass ) {
-
 			_draw_state.startPass = false;
-			if (DeviceManager::WaitForQueue(_dev_id, DeviceManager::QUEUE_TYPE_GRAPHICS) == false) {
+			if (beginFrame() == false) {
 				return false;
 			}
-			if (commandBufferStart() == false) {
+		}
+		return addDrawPacket(obj, cam, pipelineID, _draw_list, 0);
+	}
+	return false;
+}
+
+bool Renderer::RendererInternal::DrawObject(const WorldObject& obj, Camera& cam, unsigned pipelineID, unsigned context) {
+	if (_init == false || context >= _parallel_count || _parallel_contexts[context].recorded) {
+		return false;
+	}
+	return addDrawPacket(obj, cam, pipelineID, _parallel_contexts[context].list, context + 1);
+}
+
+bool Renderer::RendererInternal::BeginParallelDraw(unsigned n) {
+	if (_init == false || n == 0 || _parallel_count) {
+		return false;
+	}
+	if (_draw_state.startPass) {
+		_draw_state.startPass = false;
+		if (beginFrame() == false) {
+			return false;
+		}
+	}
+
+	while (_parallel_contexts.size() < n) {
+		ParallelContext context;
+		if (DeviceManager::CreateCommandPool(_dev_id, DeviceManager::QUEUE_TYPE_GRAPHICS, false, context.cmdPool) == false) {
+			return false;
+		}
+		context.cmdBuffers.resize(_frames.size());
+		for (auto& cmdBuffer : context.cmdBuffers) {
+			if (DeviceManager::CreateCommandBuffer(_dev_id, context.cmdPool, false, cmdBuffer) == false) {
 				return false;
 			}
-			bool needUpdate;
-			if (_swapchain.UpdateFrameBufferIndex(_image_available_sem, needUpdate) == false) {
-				return false;
+		}
+		_parallel_contexts.push_back(std::move(context));
+	}
+	for (auto& pipeline : _pipelines) {
+		if (pipeline.IsReady() && pipeline.ReserveContexts(n + 1) == false) {
+			return false;
+		}
+	}
+	for (unsigned i = 0; i < n; i++) {
+		_parallel_contexts[i].recorded = false;
+	}
+	_parallel_count = n;
+	return true;
+}
+
+bool Renderer::RendererInternal::EndDrawContext(unsigned context) {
+	if (_init == false || context >= _parallel_count) {
+		return false;
+	}
+	ParallelContext& parallel = _parallel_contexts[context];
+	if (parallel.recorded) {
+		return true;
+	}
+	parallel.recorded = true;
+
+	VkCommandBuffer cmdBuffer = parallel.cmdBuffers[_frame_idx];
+	if (beginSecondaryCommandBuffer(cmdBuffer) == false) {
+		return false;
+	}
+	bool ret = recordDrawList(parallel.list, cmdBuffer, context + 1);
+	return vkEndCommandBuffer(cmdBuffer) == VK_SUCCESS && ret;
+}
+
+unsigned Renderer::RendererInternal::selectLOD(const WorldObject& obj, Camera& cam, const Mesh::MeshInternal& mesh) const {
+	unsigned lodCount = mesh.GetLoadedLODCount();
+	if (lodCount <= 1 || obj.GetNumVertIndices() > 0) {
+		return 0;
+	}
+
+	// bounding sphere in world space: mesh to world is the object scale followed by the transform, the radius grows
+	// with the longest scaled axis of both, so scales along the reference frame chain are included
+	Vec<3> sphereCenter;
+	float radius;
+	mesh.GetBoundingSphere(sphereCenter, radius);
+	Matrix<4, 4> model = obj.GetTransform();
+	const Vec<4>& scale = obj.GetObjectScale();
+	float radiusScale = 0;
+	for (unsigned c = 0; c < 3; c++) {
+		for (unsigned r = 0; r < 4; r++) {
+			model(r, c) *= scale(c);
+		}
+		radiusScale = std::max(radiusScale, model(0, c) * model(0, c) + model(1, c) * model(1, c) + model(2, c) * model(2, c));
+	}
+	radius *= std::sqrt(radiusScale);
+	Vec<4> center({ sphereCenter(0), sphereCenter(1), sphereCenter(2), 1 });
+	float depth = (cam.GetWorldToCameraTransform() * (model * center))(2) - radius;
+
+	// pixels per world unit at the sphere's closest depth, the whole sphere is as fine as its nearest point
+	const Matrix<4, 4>& proj = cam.GetCamToScreenTransform();
+	float w = proj(3, 2) * depth + proj(3, 3);
+	if (w <= 0 || (proj(3, 2) != 0 && depth <= cam.GetNearPlane())) {
+		return 0;
+	}
+	float screenRadius = radius * std::abs(proj(0, 0)) * cam.GetCameraViewPort().width / 2 / w;
+
+	// each camera keeps its own level, the same object can be near one and far from another
+	unsigned current = std::min(obj._internal->GetLOD(cam._id), lodCount - 1);
+	unsigned lod = current;
+	while (lod > 0 && mesh.GetLODError(lod) * screenRadius > _lod_pixel_error) {
+		lod--;
+	}
+	if (lod == current) {
+		while (lod + 1 < lodCount && mesh.GetLODError(lod + 1) * screenRadius * (1 + _lod_hysteresis) <= _lod_pixel_error) {
+			lod++;
+		}
+	}
+	obj._internal->SetLOD(cam._id, lod);
+	return lod;
+}
+
+bool Renderer::RendererInternal::cullClusters(const WorldObject& obj, Camera& cam, const Mesh::MeshInternal& mesh, DrawList& list, DrawPacket& packet) {
+	// mesh to world, the object scale is applied before the transform
+	Matrix<4, 4> model = obj.GetTransform();
+	const Vec<4>& scale = obj.GetObjectScale();
+	for (unsigned r = 0; r < 4; r++) {
+		for (unsigned c = 0; c < 3; c++) {
+			model(r, c) *= scale(c);
+		}
+	}
+
+	// frustum planes of clip space -w <= x, y <= w and 0 <= z <= w, normalized in world space and moved to mesh space,
+	// where they give the world space distance of mesh space points
+	Matrix<4, 4> viewProj = cam.GetCamToScreenTransform() * cam.GetWorldToCameraTransform();
+	static constexpr int plane_rows[6][2] = { { 0, 1 }, { 0, -1 }, { 1, 1 }, { 1, -1 }, { 2, 0 }, { 2, -1 } };
+	Vec<4> planes[6];
+	for (unsigned p = 0; p < 6; p++) {
+		unsigned row = plane_rows[p][0];
+		float sign = (float)plane_rows[p][1];
+		Vec<4> world;
+		for (unsigned c = 0; c < 4; c++) {
+			// the near plane is z >= 0 alone
+			world(c) = sign == 0 ? viewProj(row, c) : viewProj(3, c) + sign * viewProj(row, c);
+		}
+		float length = std::sqrt(world(0) * world(0) + world(1) * world(1) + world(2) * world(2));
+		if (length > 0) {
+			world /= length;
+		}
+		for (unsigned c = 0; c < 4; c++) {
+			planes[p](c) = world(0) * model(0, c) + world(1) * model(1, c) + world(2) * model(2, c) + world(3) * model(3, c);
+		}
+	}
+	float radiusScale = 0;
+	for (unsigned c = 0; c < 3; c++) {
+		radiusScale = std::max(radiusScale, model(0, c) * model(0, c) + model(1, c) * model(1, c) + model(2, c) * model(2, c));
+	}
+	radiusScale = std::sqrt(radiusScale);
+
+	// the cone test runs in mesh space where facing is the same as in world space, unless a mirroring scale reverses
+	// the winding. Perspective cameras test from their position, isometric ones along their view direction
+	Vec<3> axisX({ model(0, 0), model(1, 0), model(2, 0) });
+	Vec<3> axisY({ model(0, 1), model(1, 1), model(2, 1) });
+	Vec<3> axisZ({ model(0, 2), model(1, 2), model(2, 2) });
+	bool coneCulling = obj.GetBackFaceCulling() && axisX.Dot(Cross(axisY, axisZ)) > 0;
+	bool perspective = cam.GetCamToScreenTransform()(3, 2) != 0;
+	Vec<3> viewPoint(0.0f);
+	if (coneCulling) {
+		Vec<3> forward = cam.GetCameraAxisZ();
+		Vec<4> view = perspective ? cam.GetPosition() : Vec<4>({ forward(0), forward(1), forward(2), 0 });
+		Vec<4> meshView = model.AffineInverse() * view;
+		viewPoint = Vec<3>({ meshView(0), meshView(1), meshView(2) });
+		if (perspective == false) {
+			viewPoint.Normalize();
+		}
+	}
+
+	const std::vector<MeshCluster>& clusters = mesh.GetClusters();
+	packet.firstClusterDraw = list.clusterDraws.size();
+	unsigned culled = 0;
+	for (const auto& cluster : clusters) {
+		const Vec<3>& center = cluster.center;
+		float radius = cluster.radius * radiusScale;
+		bool visible = true;
+		for (unsigned p = 0; p < 6 && visible; p++) {
+			visible = planes[p](0) * center(0) + planes[p](1) * center(1) + planes[p](2) * center(2) + planes[p](3) >= -radius;
+		}
+		if (visible && coneCulling && cluster.coneCutoff < 1) {
+			if (perspective) {
+				Vec<3> toCluster = center - viewPoint;
+				visible = toCluster.Dot(cluster.coneAxis) < cluster.coneCutoff * std::sqrt(toCluster.LenSqr()) + cluster.radius;
+			} else {
+				visible = viewPoint.Dot(cluster.coneAxis) < cluster.coneCutoff;
 			}
-			if (needUpdate) {
-				if (auto wndShared = _window.lock()) {
-					int width = 0, height = 0;
-
-					GLFWwindow* glfwWnd = wndShared->GetGlfwHandle();
-					if (glfwWnd == nullptr) {
-						return false;
-					}
-
-					glfwGetFramebufferSize(wndShared->GetGlfwHandle(), &width, &height);
-					VkExtent2D extent = {
-						static_cast<uint32_t>(width),
-						static_cast<uint32_t>(height)
-					};
-					if (_swapchain.UpdateSwapChain(extent) == false) {
-						return false;
-					}
-					if (_swapchain.UpdateFrameBufferIndex(_image_available_sem, needUpdate) == false) {
-						return false;
-					}
-					if (needUpdate) {
-						return false;
-					}
-				} else {
-					return false;
-				}
+		}
+		if (visible == false) {
+			culled++;
+			continue;
+		}
+		// clusters are consecutive in the index buffer, visible neighbours become one draw
+		if (list.clusterDraws.size() > packet.firstClusterDraw) {
+			VkDrawIndexedIndirectCommand& last = list.clusterDraws.back();
+			if (last.firstIndex + last.indexCount == cluster.firstIndex) {
+				last.indexCount += cluster.indexCount;
+				continue;
 			}
+		}
+		list.clusterDraws.push_back({ cluster.indexCount, 1, cluster.firstIndex, 0, 0 });
+	}
+	packet.clusterDraws = list.clusterDraws.size() - packet.firstClusterDraw;
+	list.clusters += clusters.size();
+	list.culledClusters += culled;
+	return packet.clusterDraws > 0;
+}
 
-			if (_swapchain.AddCommandBindRenderpass(_cmd_buffer) == false) {
-				return false;
-			}
+bool Renderer::RendererInternal::addDrawPacket(const WorldObject& obj, Camera& cam, unsigned pipelineID, DrawList& list, unsigned ctx) {
+	if (pipelineID >= _pipelines.size() || _pipelines[pipelineID].IsReady() == false) {
+		return false;
+	}
+	std::shared_ptr<Mesh::MeshInternal> mesh = std::move(obj.GetMesh()._internal);
+	if(mesh == nullptr) {
+		return false;
+	}
+	// the mesh is still being copied by an asynchronous load
+	if (mesh->IsUploadComplete() == false) {
+		return true;
+	}
+
+	DrawPacket packet;
+	packet.numIndices = obj.GetNumVertIndices();
+	packet.lod = selectLOD(obj, cam, *mesh);
+	packet.firstClusterDraw = 0;
+	packet.clusterDraws = 0;
+	if (_cluster_culling && packet.lod == 0 && packet.numIndices == 0 && mesh->HasLoadedClusters() &&
+		cullClusters(obj, cam, *mesh, list, packet) == false) {
+		return true;
+	}
+
+	// uniform data is written now, the object and camera may change before the frame is recorded
+	if (_pipelines[pipelineID].PrepareObjectData(obj, cam, mesh->GetPositionDequantization(), packet.objectData, list.pushData, ctx, &list.screenTransforms) == false) {
+		return false;
+	}
+	packet.pipeline = pipelineID;
+	packet.cull = obj.GetBackFaceCulling();
+
+	ViewPort vp = cam.GetCameraViewPort();
+	packet.viewport = list.viewports.size();
+	for (unsigned i = list.viewports.size(); i > 0; i--) {
+		if (list.viewports[i - 1] == vp) {
+			packet.viewport = i - 1;
+			break;
 		}
-		if(first || _draw_state.cull != obj.GetBackFaceCulling()) {
-			_draw_state.cull = obj.GetBackFaceCulling();
-			if(addCommandSetCullMode(_cmd_buffer, _draw_state.cull) == false) {
-				return false;
+	}
+	if (packet.viewport == list.viewports.size()) {
+		list.viewports.push_back(vp);
+	}
+
+	uint64_t key = drawSortKey(packet.pipeline, packet.cull, packet.viewport, mesh->GetSortBits(packet.lod), obj.GetMaterial());
+	packet.mesh = std::move(mesh);
+	list.keys.push_back({ key, (uint32_t)list.packets.size() });
+	list.packets.push_back(std::move(packet));
+	return true;
+}
+
+bool Renderer::RendererInternal::recordDrawList(DrawList& list, VkCommandBuffer cmdBuffer, unsigned ctx) {
+	if (_sort_draws) {
+		radixSort(list.keys, list.keysScratch);
+	}
+
+	list.screenTransforms.Compute(list.pushData, _transform_workers);
+	bool ret = reserveIndirectDraws(list);
+	for (auto& pipeline : _pipelines) {
+		if (pipeline.IsInstanced()) {
+			ret = ret && pipeline.ReserveInstances(ctx);
+		}
+	}
+	unsigned indirectWritten = 0;
+
+	unsigned pipeline = ~0u;
+	unsigned viewport = ~0u;
+	bool cull = false;
+	Mesh::MeshInternal* mesh = nullptr;
+	for (unsigned i = 0; i < list.keys.size() && ret; i++) {
+		const DrawPacket& packet = list.packets[list.keys[i].idx];
+		// unloaded after it was drawn
+		if (packet.mesh->GetLoadedLODCount() == 0) {
+			continue;
+		}
+		if (pipeline == ~0u || packet.cull != cull) {
+			cull = packet.cull;
+			ret = ret && addCommandSetCullMode(cmdBuffer, cull);
+		}
+		if (packet.viewport != viewport) {
+			viewport = packet.viewport;
+			ret = ret && addCommandBindViewPort(cmdBuffer, list.viewports[viewport]);
+		}
+		if (packet.pipeline != pipeline) {
+			pipeline = packet.pipeline;
+			ret = ret && _pipelines[pipeline].AddCommandBindPipeline(cmdBuffer, ctx);
+			list.pipelineBinds++;
+		}
+		ret = ret && _pipelines[pipeline].AddCommandBindObjectData(cmdBuffer, packet.objectData, list.pushData, ctx);
+		if (packet.mesh.get() != mesh) {
+			// meshes sharing an arena only differ in their draw offsets
+			if (mesh == nullptr || mesh->BindsSameBuffers(*packet.mesh) == false) {
+				ret = ret && packet.mesh->AddCommandBindMesh(cmdBuffer);
+				list.meshBinds++;
 			}
+			mesh = packet.mesh.get();
 		}
-		if(first || _draw_state.vp != cam.GetCameraViewPort()) {
-			_draw_state.vp = cam.GetCameraViewPort();
-			if (addCommandBindViewPort(_cmd_buffer, cam) == false) {
-				return false;
+		list.drawCalls++;
+		if (packet.clusterDraws > 0) {
+			// culled per object, so never an instance of another draw
+			unsigned firstInstance = 0;
+			if (_pipelines[pipeline].IsInstanced()) {
+				ret = ret && _pipelines[pipeline].WriteInstance(packet.objectData, list.pushData, firstInstance, ctx);
 			}
+			ret = ret && addCommandDrawClusters(cmdBuffer, list, packet, firstInstance, indirectWritten);
+			continue;
 		}
-		if(first || _draw_state.pipeline != pipelineID) {
-			_draw_state.pipeline = pipelineID;
-			if (_pipelines[pipelineID].AddCommandBindPipeline(_cmd_buffer) == false) {
-				return false;
+		unsigned triangles = packet.mesh->GetDrawIndexCount(packet.numIndices, packet.lod) / 3;
+		if (_pipelines[pipeline].IsInstanced() == false) {
+			ret = ret && packet.mesh->AddCommandDraw(cmdBuffer, packet.numIndices, packet.lod);
+			list.triangles += triangles;
+			continue;
+		}
+
+		// following draws differing only in their transform and material become instances of this draw
+		unsigned firstInstance = 0, instanceIdx = 0, instanceCount = 1;
+		ret = ret && _pipelines[pipeline].WriteInstance(packet.objectData, list.pushData, firstInstance, ctx);
+		while (ret && i + 1 < list.keys.size()) {
+			const DrawPacket& next = list.packets[list.keys[i + 1].idx];
+			if (next.pipeline != packet.pipeline || next.mesh != packet.mesh || next.numIndices != packet.numIndices || next.lod != packet.lod || next.clusterDraws > 0 ||
+				next.cull != packet.cull || next.viewport != packet.viewport ||
+				_pipelines[pipeline].CanBatch(packet.objectData, next.objectData) == false) {
+				break;
 			}
+			ret = _pipelines[pipeline].WriteInstance(next.objectData, list.pushData, instanceIdx, ctx);
+			instanceCount++;
+			i++;
 		}
-		//bind descriptor set
-		if (_pipelines[pipelineID].AddCommandBindUniformBufferSet(_cmd_buffer, obj, cam) == false) {
-			return false;
+		ret = ret && packet.mesh->AddCommandDraw(cmdBuffer, packet.numIndices, packet.lod, instanceCount, firstInstance);
+		list.triangles += (unsigned long long)triangles * instanceCount;
+	}
+	list.draws += list.keys.size();
+
+	// the GPU is done with what this frame slot recorded before. The meshes recorded now are kept until the slot
+	// is recorded again, dropping the last reference to one cannot free buffers the frame still reads
+	if (list.recordedMeshes.size() < _frames.size()) {
+		list.recordedMeshes.resize(_frames.size());
+	}
+	std::vector<std::shared_ptr<Mesh::MeshInternal>>& recorded = list.recordedMeshes[_frame_idx];
+	recorded.clear();
+	for (DrawPacket& packet : list.packets) {
+		if (recorded.empty() || recorded.back() != packet.mesh) {
+			recorded.push_back(std::move(packet.mesh));
 		}
-		//draw call
-		if (obj.GetMesh()._internal->AddCommandDrawMesh(_cmd_buffer, obj.GetNumVertIndices()) == false) {
-			return false;
+	}
+	list.packets.clear();
+	list.keys.clear();
+	list.clusterDraws.clear();
+	list.viewports.clear();
+	list.pushData.clear();
+	return ret;
+}
+
+bool Renderer::RendererInternal::reserveIndirectDraws(DrawList& list) {
+	if (list.clusterDraws.empty() || DeviceManager::HasMultiDrawIndirect(_dev_id) == false) {
+		return true;
+	}
+	if (list.indirectBuffers.size() < _frames.size()) {
+		list.indirectBuffers.resize(_frames.size());
+	}
+	IndirectBuffer& indirect = list.indirectBuffers[_frame_idx];
+	if (list.clusterDraws.size() <= indirect.capacity) {
+		return true;
+	}
+
+	// the frame slot is no longer in use by the GPU and nothing has been recorded with it yet
+	MemoryAllocator::DestroyBuffer(_dev_id, indirect.buffer);
+	indirect.capacity = 0;
+	unsigned capacity = 256;
+	while (capacity < list.clusterDraws.size()) {
+		capacity *= 2;
+	}
+	if (MemoryAllocator::CreateBuffer(_dev_id, (VkDeviceSize)capacity * sizeof(VkDrawIndexedIndirectCommand), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, indirect.buffer) == false) {
+		return false;
+	}
+	indirect.capacity = capacity;
+	return true;
+}
+
+bool Renderer::RendererInternal::addCommandDrawClusters(VkCommandBuffer cmdBuffer, DrawList& list, const DrawPacket& packet, unsigned firstInstance, unsigned& indirectWritten) {
+	unsigned firstIndex = 0;
+	int vertexOffset = 0;
+	if (packet.mesh->GetDrawOffsets(firstIndex, vertexOffset) == false) {
+		return false;
+	}
+	VkDrawIndexedIndirectCommand* draws = &list.clusterDraws[packet.firstClusterDraw];
+	for (unsigned i = 0; i < packet.clusterDraws; i++) {
+		draws[i].firstIndex += firstIndex;
+		draws[i].vertexOffset = vertexOffset;
+		draws[i].firstInstance = firstInstance;
+		list.triangles += draws[i].indexCount / 3;
+	}
+
+	// without multiDrawIndirect the visible clusters are drawn one by one
+	if (list.indirectBuffers.size() <= _frame_idx || list.indirectBuffers[_frame_idx].capacity == 0) {
+		for (unsigned i = 0; i < packet.clusterDraws; i++) {
+			vkCmdDrawIndexed(cmdBuffer, draws[i].indexCount, 1, draws[i].firstIndex, draws[i].vertexOffset, draws[i].firstInstance);
 		}
 		return true;
 	}
-	return false;
+	IndirectBuffer& indirect = list.indirectBuffers[_frame_idx];
+	if (indirectWritten + packet.clusterDraws > indirect.capacity) {
+		return false;
+	}
+	memcpy((VkDrawIndexedIndirectCommand*)indirect.buffer.memory.mapped + indirectWritten, draws, packet.clusterDraws * sizeof(VkDrawIndexedIndirectCommand));
+	for (unsigned first = 0; first < packet.clusterDraws; first += max_indirect_draw_count) {
+		unsigned count = std::min(packet.clusterDraws - first, max_indirect_draw_count);
+		vkCmdDrawIndexedIndirect(cmdBuffer, indirect.buffer.vkBuffer, (VkDeviceSize)(indirectWritten + first) * sizeof(VkDrawIndexedIndirectCommand),
+			count, sizeof(VkDrawIndexedIndirectCommand));
+	}
+	indirectWritten += packet.clusterDraws;
+	return true;
+}
+
+bool Renderer::RendererInternal::recordFrame() {
+	// a subpass is either recorded inline or made of secondary command buffers only
+	bool secondary = _parallel_count > 0;
+	if (addCommandBindRenderpass(_cmd_buffer, secondary) == false) {
+		return false;
+	}
+
+	bool ret = true;
+	if (secondary == false) {
+		ret = recordDrawList(_draw_list, _cmd_buffer, 0);
+	} else {
+		// the renderer's own draws first, then the contexts in order
+		_execute_buffers.clear();
+		VkCommandBuffer cmdBuffer = _frames[_frame_idx].secondaryCmdBuffer;
+		ret = beginSecondaryCommandBuffer(cmdBuffer);
+		if (ret) {
+			ret = recordDrawList(_draw_list, cmdBuffer, 0);
+			ret = vkEndCommandBuffer(cmdBuffer) == VK_SUCCESS && ret;
+		}
+		_execute_buffers.push_back(cmdBuffer);
+		for (unsigned i = 0; i < _parallel_count && ret; i++) {
+			ret = EndDrawContext(i);
+			_execute_buffers.push_back(_parallel_contexts[i].cmdBuffers[_frame_idx]);
+		}
+		if (ret) {
+			vkCmdExecuteCommands(_cmd_buffer, _execute_buffers.size(), _execute_buffers.data());
+		}
+	}
+
+	_frame_stats.recordedFrames++;
+	auto addStats = [this](DrawList& list) {
+		_frame_stats.draws += list.draws;
+		_frame_stats.drawCalls += list.drawCalls;
+		_frame_stats.pipelineBinds += list.pipelineBinds;
+		_frame_stats.meshBinds += list.meshBinds;
+		_frame_stats.triangles += list.triangles;
+		_frame_stats.clusters += list.clusters;
+		_frame_stats.culledClusters += list.culledClusters;
+		list.draws = list.drawCalls = list.pipelineBinds = list.meshBinds = list.triangles = 0;
+		list.clusters = list.culledClusters = 0;
+	};
+	addStats(_draw_list);
+	for (unsigned i = 0; i < _parallel_count; i++) {
+		addStats(_parallel_contexts[i].list);
+	}
+	_frame_stats.dynamicBytes += _frame_clock->dynamicBytes.exchange(0);
+	_parallel_count = 0;
+	return ret;
+}
+
+bool Renderer::RendererInternal::beginSecondaryCommandBuffer(VkCommandBuffer cmdBuffer) {
+	if (vkResetCommandBuffer(cmdBuffer, 0) != VK_SUCCESS) {
+		return false;
+	}
+
+	VkCommandBufferInheritanceInfo inheritanceInfo{};
+	inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+	inheritanceInfo.renderPass = getRenderPass();
+	inheritanceInfo.subpass = 0;
+	inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+
+	VkCommandBufferBeginInfo beginInfo{};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+	beginInfo.pInheritanceInfo = &inheritanceInfo;
+	return vkBeginCommandBuffer(cmdBuffer, &beginInfo) == VK_SUCCESS;
+}
+
+bool Renderer::RendererInternal::RequestFrameReadback(const std::function<void(const FrameReadbackData&)>& callback) {
+	if (_init == false) {
+		return false;
+	}
+	if (_headless == false && _swapchain.SupportsTransferSrc() == false) {
+		printf("frame readback not supported by the swapchain\n");
+		return false;
+	}
+	return _readback.Request(callback);
+}
+
+bool Renderer::RendererInternal::addCommandCopyReadback() {
+	FrameResources& frame = _frames[_frame_idx];
+	if (_headless) {
+		return _readback.AddCommandCopyImage(_cmd_buffer, _offscreen.GetColorImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			_offscreen.GetExtent(), _offscreen_format, frame.fence, _frame_clock->frame);
+	}
+	// the swapchain format is always B8G8R8A8_SRGB, see Swapchain::chooseFormat
+	return _readback.AddCommandCopyImage(_cmd_buffer, _swapchain.GetCurrentImage(), VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+		_swapchain.GetExtent(), IMAGE_FORMAT_B8G8R8A8_SRGB, frame.fence, _frame_clock->frame);
+}
+
+void Renderer::RendererInternal::SetDrawSorting(bool enable) {
+	_sort_draws = enable;
+}
+
+void Renderer::RendererInternal::SetMeshArenas(bool enable) {
+	_mesh_arenas->SetEnabled(enable);
+}
+
+void Renderer::RendererInternal::SetLODSelection(float pixelError, float hysteresis) {
+	_lod_pixel_error = std::max(pixelError, 0.0f);
+	_lod_hysteresis = std::max(hysteresis, 0.0f);
+}
+
+void Renderer::RendererInternal::SetClusterCulling(bool enable) {
+	_cluster_culling = enable;
+}
+
+void Renderer::RendererInternal::SetTransformThreads(unsigned threads) {
+	_transform_threads = std::max(threads, 1u);
+	if (_init) {
+		_transform_workers.Cleanup();
+		_transform_workers.Initialize(_transform_threads - 1);
+	}
+}
+
+std::shared_ptr<MeshArenas> Renderer::RendererInternal::GetMeshArenas() const {
+	return _mesh_arenas;
+}
+
+std::shared_ptr<UploadQueue> Renderer::RendererInternal::GetUploadQueue() const {
+	return _uploads;
+}
+
+std::shared_ptr<const FrameClock> Renderer::RendererInternal::GetFrameClock() const {
+	return _frame_clock;
 }
 
 bool Renderer::RendererInternal::PresentFrame() {
 	if (_init) {
+		// meshes loaded asynchronously during the frame are copied as one batch
+		_uploads->Submit();
 		if (_draw_state.startPass == true) {
 			return true;
 		}
 
-		if (submitGraphicsCommands(true) == false) {
+		if (recordFrame() == false) {
+			_draw_state.startPass = true;
 			return false;
 		}
-
-		if (_swapchain.PresentFrame(_render_complete_sem) == false) {
+		if (submitGraphicsCommands(_headless == false) == false) {
 			return false;
 		}
 
-		for (auto& pipeline : _pipelines) {
-			pipeline.EndRenderPass();
+		if (_headless == false && _swapchain.PresentFrame(_frames[_frame_idx].renderCompleteSem) == false) {
+			return false;
 		}
+
+		_frame_idx = (_frame_idx + 1) % _frames.size();
+		_frame_clock->frame++;
 		_draw_state.startPass = true;
+		_readback.Dispatch();
 		return true;
 	}
 	return false;
 }
 
+FrameStats Renderer::RendererInternal::GetFrameStats() const {
+	FrameStats stats;
+	stats.framesInFlight = _frames.size();
+	stats.frameCount = _frame_stats.frames;
+	if (_frame_stats.frames == 0) {
+		return stats;
+	}
+	stats.frameTime = _frame_stats.frameTime / _frame_stats.frames;
+	stats.fenceWaitTime = _frame_stats.fenceWaitTime / _frame_stats.frames;
+	stats.cpuTime = stats.frameTime - stats.fenceWaitTime;
+
+	if (_frame_stats.recordedFrames) {
+		stats.draws = (double)_frame_stats.draws / _frame_stats.recordedFrames;
+		stats.drawCalls = (double)_frame_stats.drawCalls / _frame_stats.recordedFrames;
+		stats.pipelineBinds = (double)_frame_stats.pipelineBinds / _frame_stats.recordedFrames;
+		stats.meshBinds = (double)_frame_stats.meshBinds / _frame_stats.recordedFrames;
+		stats.triangles = (double)_frame_stats.triangles / _frame_stats.recordedFrames;
+		stats.clusters = (double)_frame_stats.clusters / _frame_stats.recordedFrames;
+		stats.culledClusters = (double)_frame_stats.culledClusters / _frame_stats.recordedFrames;
+		stats.dynamicBytes = (double)_frame_stats.dynamicBytes / _frame_stats.recordedFrames;
+	}
+
+	if (_frame_stats.gpuFrames) {
+		stats.gpuTime = _frame_stats.gpuTime / _frame_stats.gpuFrames;
+
+		// serialized execution makes the frame as long as cpu + gpu, perfect overlap as long as the longer of the two
+		double shorter = std::min(stats.cpuTime, stats.gpuTime);
+		if (shorter > 0) {
+			stats.overlap = std::clamp((stats.cpuTime + stats.gpuTime - stats.frameTime) / shorter, 0.0, 1.0);
+		}
+	}
+	return stats;
+}
+
+void Renderer::RendererInternal::ResetFrameStats() {
+	_frame_stats = {};
+	_last_frame_start_valid = false;
+}
+
+UniformBufferStats Renderer::RendererInternal::GetUniformBufferStats() const {
+	UniformBufferStats stats;
+	for (const auto& pipeline : _pipelines) {
+		UniformBufferStats pipelineStats;
+		pipeline.GetUniformBufferStats(pipelineStats);
+		stats.lastFrameAllocations += pipelineStats.lastFrameAllocations;
+		stats.lastFrameBytes += pipelineStats.lastFrameBytes;
+		stats.highWaterAllocations += pipelineStats.highWaterAllocations;
+		stats.highWaterBytes += pipelineStats.highWaterBytes;
+		stats.capacityAllocations += pipelineStats.capacityAllocations;
+		stats.capacityBytes += pipelineStats.capacityBytes;
+		stats.bufferCount += pipelineStats.bufferCount;
+	}
+	return stats;
+}
+
+void Renderer::RendererInternal::ResetUniformBufferStats() {
+	for (auto& pipeline : _pipelines) {
+		pipeline.ResetUniformBufferStats();
+	}
+}
+
+MemoryStats Renderer::RendererInternal::GetMemoryStats() const {
+	MemoryStats stats;
+	MemoryAllocator::GetStats(_dev_id, stats);
+	return stats;
+}
+
 bool Renderer::RendererInternal::CreatePipeline(const PipelineConfig& config, unsigned& pipelineID) {
 	unsigned idx = 0;
 	for (auto& pipeline : _pipelines) {
 		if (pipeline.IsReady() == false) {
-			if (pipeline.Initialize(_dev_id, config, _swapchain.GetRenderPass()) == false) {
+			if (pipeline.Initialize(_dev_id, config, _swapchain.GetRenderPass(), _frames.size()) == false) {
 				return false;
 			}
 			pipeline.SetLightDir(Vec<3>({0,0,1}));
@@ -318,7 +975,7 @@ bool Renderer::RendererInternal::CreatePipeline(const PipelineConfig& config, un
 	}
 
 	_pipelines.push_back(Pipeline());
-	if (_pipelines.back().Initialize(_dev_id, config, _swapchain.GetRenderPass()) == false) {
+	if (_pipelines.back().Initialize(_dev_id, config, getRenderPass(), _frames.size()) == false) {
 		
 		return false;
 	}
@@ -336,6 +993,20 @@ unsigned Renderer::RendererInternal::GetDeviceID() const {
 	return _dev_id;
 }
 
+VkRenderPass Renderer::RendererInternal::getRenderPass() {
+	if (_headless) {
+		return _offscreen.GetRenderPass();
+	}
+	return _swapchain.GetRenderPass();
+}
+
+bool Renderer::RendererInternal::addCommandBindRenderpass(VkCommandBuffer cmdBuffer, bool secondaryContents) {
+	if (_headless) {
+		return _offscreen.AddCommandBindRenderpass(cmdBuffer, secondaryContents);
+	}
+	return _swapchain.AddCommandBindRenderpass(cmdBuffer, secondaryContents);
+}
+
 bool Renderer::RendererInternal::addCommandSetCullMode(VkCommandBuffer cmdBuffer, bool cull) {
 	if (_init) {
 		if(cull)vkCmdSetCullMode(cmdBuffer, VK_CULL_MODE_BACK_BIT);
@@ -345,9 +1016,8 @@ bool Renderer::RendererInternal::addCommandSetCullMode(VkCommandBuffer cmdBuffer
 	return false;
 }
 
-bool Renderer::RendererInternal::addCommandBindViewPort(VkCommandBuffer cmdBuffer, const Camera& cam) {
+bool Renderer::RendererInternal::addCommandBindViewPort(VkCommandBuffer cmdBuffer, const ViewPort& vp) {
 	if (_init) {
-		const auto& vp = cam.GetCameraViewPort();
 		VkViewport viewport{};
 		viewport.x = static_cast<float>(vp.posX);
 		viewport.y = static_cast<float>(vp.posY);
@@ -369,7 +1039,16 @@ bool Renderer::RendererInternal::addCommandBindViewPort(VkCommandBuffer cmdBuffe
 
 bool Renderer::RendererInternal::submitGraphicsCommands(bool wait_for_image) {
 	if (_init) {
+		FrameResources& frame = _frames[_frame_idx];
 		vkCmdEndRenderPass(_cmd_buffer);
+
+		if (_readback.HasRequest() && addCommandCopyReadback() == false) {
+			printf("failed to record frame readback\n");
+		}
+
+		if (frame.timestampPool != VK_NULL_HANDLE) {
+			vkCmdWriteTimestamp(_cmd_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, frame.timestampPool, 1);
+		}
 		
 		if (vkEndCommandBuffer(_cmd_buffer) != VK_SUCCESS) {
 			printf("failed to close command buffer\n");
@@ -378,12 +1057,23 @@ bool Renderer::RendererInternal::submitGraphicsCommands(bool wait_for_image) {
 
 		VkSemaphore sem = VK_NULL_HANDLE;
 		if (wait_for_image) {
-			sem = _render_complete_sem;
+			sem = frame.renderCompleteSem;
 		}
 
-		if (DeviceManager::SubmitCommandBuffer(_dev_id, DeviceManager::QUEUE_TYPE_GRAPHICS, _cmd_buffer, _image_available_sem, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, sem, true) == false) {
+		VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+		if (dev == VK_NULL_HANDLE) {
 			return false;
 		}
+		// the fence is only reset once there is work to signal it, so a failed frame can't deadlock the next wait
+		if (vkResetFences(dev, 1, &frame.fence) != VK_SUCCESS) {
+			return false;
+		}
+		// offscreen frames have no image to acquire
+		VkSemaphore waitSem = _headless ? VK_NULL_HANDLE : frame.imageAvailableSem;
+		if (DeviceManager::SubmitCommandBuffer(_dev_id, DeviceManager::QUEUE_TYPE_GRAPHICS, _cmd_buffer, waitSem, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, sem, frame.fence) == false) {
+			return false;
+		}
+		frame.timestampsWritten = (frame.timestampPool != VK_NULL_HANDLE);
 		return true;
 	}
 	return false;
@@ -397,14 +1087,197 @@ bool Renderer::RendererInternal::commandBufferStart() {
 
 		VkCommandBufferBeginInfo beginInfo{};
 		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-		beginInfo.flags = 0; // Optional
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 		beginInfo.pInheritanceInfo = nullptr; // Optional
 		if (vkBeginCommandBuffer(_cmd_buffer, &beginInfo) != VK_SUCCESS) {
 			return false;
 		}
+
+		VkQueryPool timestampPool = _frames[_frame_idx].timestampPool;
+		if (timestampPool != VK_NULL_HANDLE) {
+			vkCmdResetQueryPool(_cmd_buffer, timestampPool, 0, 2);
+			vkCmdWriteTimestamp(_cmd_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestampPool, 0);
+		}
 		
 		return true;
 	}
 	return false;
 }
+
+bool Renderer::RendererInternal::beginFrame() {
+	FrameResources& frame = _frames[_frame_idx];
+	VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+	if (dev == VK_NULL_HANDLE) {
+		return false;
+	}
+
+	auto frameStart = std::chrono::steady_clock::now();
+	if (vkWaitForFences(dev, 1, &frame.fence, VK_TRUE, UINT64_MAX) != VK_SUCCESS) {
+		return false;
+	}
+	auto waitEnd = std::chrono::steady_clock::now();
+	// readbacks of the frame are complete and must be handed over before its fence is reset
+	_readback.Dispatch();
+
+	if (_last_frame_start_valid) {
+		_frame_stats.frames++;
+		_frame_stats.frameTime += std::chrono::duration<double, std::milli>(frameStart - _last_frame_start).count();
+		_frame_stats.fenceWaitTime += std::chrono::duration<double, std::milli>(waitEnd - frameStart).count();
+	}
+	_last_frame_start = frameStart;
+	_last_frame_start_valid = true;
+
+	readFrameTimestamps();
+
+	// the GPU is done with this slot, its command buffer and uniform buffers can be reused
+	_cmd_buffer = frame.cmdBuffer;
+	for (auto& pipeline : _pipelines) {
+		if (pipeline.IsReady() && pipeline.BeginFrame(_frame_idx) == false) {
+			return false;
+		}
+	}
+
+	if (commandBufferStart() == false) {
+		return false;
+	}
+	if (_headless) {
+		return true;
+	}
+	bool needUpdate;
+	if (_swapchain.UpdateFrameBufferIndex(frame.imageAvailableSem, needUpdate) == false) {
+		return false;
+	}
+	if (needUpdate) {
+		if (auto wndShared = _window.lock()) {
+			int width = 0, height = 0;
+
+			GLFWwindow* glfwWnd = wndShared->GetGlfwHandle();
+			if (glfwWnd == nullptr) {
+				return false;
+			}
+
+			glfwGetFramebufferSize(wndShared->GetGlfwHandle(), &width, &height);
+			VkExtent2D extent = {
+				static_cast<uint32_t>(width),
+				static_cast<uint32_t>(height)
+			};
+			// other frames in flight may still reference the old framebuffers
+			if (DeviceManager::WaitIdle(_dev_id) == false) {
+				return false;
+			}
+			if (_swapchain.UpdateSwapChain(extent) == false) {
+				return false;
+			}
+			if (_swapchain.UpdateFrameBufferIndex(frame.imageAvailableSem, needUpdate) == false) {
+				return false;
+			}
+			if (needUpdate) {
+				return false;
+			}
+		} else {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void Renderer::RendererInternal::readFrameTimestamps() {
+	FrameResources& frame = _frames[_frame_idx];
+	if (frame.timestampsWritten == false) {
+		return;
+	}
+	frame.timestampsWritten = false;
+
+	VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+	uint64_t timestamps[2];
+	if (vkGetQueryPoolResults(dev, frame.timestampPool, 0, 2, sizeof(timestamps), timestamps, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT) != VK_SUCCESS) {
+		return;
+	}
+	if (timestamps[1] >= timestamps[0]) {
+		_frame_stats.gpuFrames++;
+		_frame_stats.gpuTime += (timestamps[1] - timestamps[0]) * (double)_timestamp_period / 1e6;
+	}
+}
+
+bool Renderer::RendererInternal::createFrameResources(unsigned framesInFlight) {
+	VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+	if (dev == VK_NULL_HANDLE) {
+		return false;
+	}
+	if (framesInFlight < 1) framesInFlight = 1;
+	if (framesInFlight > MAX_FRAMES_IN_FLIGHT) framesInFlight = MAX_FRAMES_IN_FLIGHT;
+
+	bool timestamps = DeviceManager::GetTimestampPeriod(_dev_id, _timestamp_period);
+
+	_frames.resize(framesInFlight);
+	_frame_clock->framesInFlight = framesInFlight;
+	for (auto& frame : _frames) {
+		if (DeviceManager::CreateCommandBuffer(_dev_id, DeviceManager::QUEUE_TYPE_GRAPHICS, true, frame.cmdBuffer) == false) {
+			return false;
+		}
+		if (DeviceManager::CreateCommandBuffer(_dev_id, DeviceManager::QUEUE_TYPE_GRAPHICS, false, frame.secondaryCmdBuffer) == false) {
+			return false;
+		}
+
+		VkSemaphoreCreateInfo semaphoreInfo{};
+		semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+		if (vkCreateSemaphore(dev, &semaphoreInfo, nullptr, &frame.imageAvailableSem) != VK_SUCCESS) {
+			return false;
+		}
+		if (vkCreateSemaphore(dev, &semaphoreInfo, nullptr, &frame.renderCompleteSem) != VK_SUCCESS) {
+			return false;
+		}
+
+		// created signalled, the first use of a slot must not wait
+		VkFenceCreateInfo fenceInfo{};
+		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+		if (vkCreateFence(dev, &fenceInfo, nullptr, &frame.fence) != VK_SUCCESS) {
+			return false;
+		}
+
+		if (timestamps) {
+			VkQueryPoolCreateInfo queryInfo{};
+			queryInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+			queryInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+			queryInfo.queryCount = 2;
+			if (vkCreateQueryPool(dev, &queryInfo, nullptr, &frame.timestampPool) != VK_SUCCESS) {
+				frame.timestampPool = VK_NULL_HANDLE;
+			}
+		}
+	}
+	_frame_idx = 0;
+	return true;
+}
+
+void Renderer::RendererInternal::destroyFrameResources() {
+	VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+	if (dev == VK_NULL_HANDLE) {
+		return;
+	}
+	for (auto& frame : _frames) {
+		if (frame.imageAvailableSem != VK_NULL_HANDLE) vkDestroySemaphore(dev, frame.imageAvailableSem, nullptr);
+		if (frame.renderCompleteSem != VK_NULL_HANDLE) vkDestroySemaphore(dev, frame.renderCompleteSem, nullptr);
+		if (frame.fence != VK_NULL_HANDLE) vkDestroyFence(dev, frame.fence, nullptr);
+		if (frame.timestampPool != VK_NULL_HANDLE) vkDestroyQueryPool(dev, frame.timestampPool, nullptr);
+	}
+	_frames.clear();
+	_cmd_buffer = VK_NULL_HANDLE;
+
+	auto destroyIndirectBuffers = [this](DrawList& list) {
+		for (auto& indirect : list.indirectBuffers) {
+			MemoryAllocator::DestroyBuffer(_dev_id, indirect.buffer);
+		}
+		list.indirectBuffers.clear();
+		list.recordedMeshes.clear();
+	};
+	destroyIndirectBuffers(_draw_list);
+	for (auto& context : _parallel_contexts) {
+		if (context.cmdPool != VK_NULL_HANDLE) vkDestroyCommandPool(dev, context.cmdPool, nullptr);
+		destroyIndirectBuffers(context.list);
+	}
+	_parallel_contexts.clear();
+	_parallel_count = 0;
 }
+}
\ No newline at end of file
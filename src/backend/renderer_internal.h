@@ -1,9 +1,16 @@
 #pragma once
 #include <vector>
+#include <chrono>
 #include "types_internal.h"
 #include "renderer.h"
 #include "worldobj_internal.h"
 #include "pipeline.h"
+#include "offscreen.h"
+#include "readback.h"
+#include "arena.h"
+#include "upload.h"
+#include "workerpool.h"
+#include "transformbatch.h"
 
 namespace RenderingFramework3D {
 class Renderer::RendererInternal {
@@ -11,7 +18,8 @@ public:
 	
 	RendererInternal();
 
-	bool Initialize(std::shared_ptr<Window::WindowInternal>& wnd);
+	bool Initialize(std::shared_ptr<Window::WindowInternal>& wnd, unsigned framesInFlight);
+	bool InitializeOffscreen(unsigned width, unsigned height, ImageFormat format, unsigned framesInFlight);
 	bool Cleanup();
 
 	void SetLightDirection(const MathUtil::Vec<3>& direction);
@@ -31,6 +39,30 @@ public:
 	bool DrawObject(const WorldObject& obj, Camera& cam, unsigned pipelineID);
 	bool PresentFrame();
 
+	// parallel draw contexts, DrawObject and EndDrawContext may be called from the context's own thread
+	bool BeginParallelDraw(unsigned n);
+	bool DrawObject(const WorldObject& obj, Camera& cam, unsigned pipelineID, unsigned context);
+	bool EndDrawContext(unsigned context);
+
+	void SetDrawSorting(bool enable);
+	void SetMeshArenas(bool enable);
+	void SetLODSelection(float pixelError, float hysteresis);
+	void SetClusterCulling(bool enable);
+	void SetTransformThreads(unsigned threads);
+	std::shared_ptr<MeshArenas> GetMeshArenas() const;
+	std::shared_ptr<UploadQueue> GetUploadQueue() const;
+
+	bool RequestFrameReadback(const std::function<void(const FrameReadbackData&)>& callback);
+
+	FrameStats GetFrameStats() const;
+	void ResetFrameStats();
+
+	UniformBufferStats GetUniformBufferStats() const;
+	void ResetUniformBufferStats();
+
+	MemoryStats GetMemoryStats() const;
+	std::shared_ptr<const FrameClock> GetFrameClock() const;
+
 	bool IsReady() const;
 
 	bool CreatePipeline(const PipelineConfig& config, unsigned& pipelineID);
@@ -38,29 +70,154 @@ public:
 	unsigned GetDeviceID() const;
 
 private:
+	bool createDefaultPipelines();
+	VkRenderPass getRenderPass();
+	bool addCommandBindRenderpass(VkCommandBuffer cmdBuffer, bool secondaryContents);
 	bool addCommandSetCullMode(VkCommandBuffer cmdBuffer, bool cull);
-	bool addCommandBindViewPort(VkCommandBuffer cmdBuffer, const Camera& cam);
+	bool addCommandBindViewPort(VkCommandBuffer cmdBuffer, const ViewPort& vp);
+	struct DrawList;
+	struct DrawPacket;
+	unsigned selectLOD(const WorldObject& obj, Camera& cam, const Mesh::MeshInternal& mesh) const;
+	// appends the draws of the object's clusters that are in view and not facing away, false if there are none
+	bool cullClusters(const WorldObject& obj, Camera& cam, const Mesh::MeshInternal& mesh, DrawList& list, DrawPacket& packet);
+	bool reserveIndirectDraws(DrawList& list);
+	bool addCommandDrawClusters(VkCommandBuffer cmdBuffer, DrawList& list, const DrawPacket& packet, unsigned firstInstance, unsigned& indirectWritten);
+	bool addDrawPacket(const WorldObject& obj, Camera& cam, unsigned pipelineID, DrawList& list, unsigned ctx);
+	bool recordDrawList(DrawList& list, VkCommandBuffer cmdBuffer, unsigned ctx);
+	bool recordFrame();
+	bool beginSecondaryCommandBuffer(VkCommandBuffer cmdBuffer);
+	bool addCommandCopyReadback();
 	bool submitGraphicsCommands(bool wait_for_image = false);
 	bool commandBufferStart();
+	bool beginFrame();
+	bool createFrameResources(unsigned framesInFlight);
+	void destroyFrameResources();
+	void readFrameTimestamps();
 
 private:
+	// resources owned by one frame in flight, reused once the frame's fence is signalled
+	struct FrameResources {
+		VkCommandBuffer cmdBuffer = VK_NULL_HANDLE;
+		// records the renderer's own draws when the frame's pass is made of secondary command buffers
+		VkCommandBuffer secondaryCmdBuffer = VK_NULL_HANDLE;
+		VkSemaphore imageAvailableSem = VK_NULL_HANDLE;
+		VkSemaphore renderCompleteSem = VK_NULL_HANDLE;
+		VkFence fence = VK_NULL_HANDLE;
+		VkQueryPool timestampPool = VK_NULL_HANDLE;
+		bool timestampsWritten = false;
+	};
+
 	bool _init;
 	std::vector<Pipeline> _pipelines;
 	Swapchain _swapchain;
+	// headless mode: frames are rendered to the offscreen target and never presented
+	OffscreenTarget _offscreen;
+	ImageFormat _offscreen_format;
+	bool _headless;
 
+	// colour attachment copies of requested frames, one buffer per frame in flight plus one the callback may hold
+	ReadbackRing _readback;
+	std::shared_ptr<FrameClock> _frame_clock;
+
+	std::vector<FrameResources> _frames;
+	unsigned _frame_idx;
 	VkCommandBuffer _cmd_buffer;
-	VkSemaphore _image_available_sem;
-	VkSemaphore _render_complete_sem;
+
+	float _timestamp_period;
+	std::chrono::steady_clock::time_point _last_frame_start;
+	bool _last_frame_start_valid;
+
+	struct {
+		unsigned long long frames;
+		unsigned long long gpuFrames;
+		double frameTime;
+		double fenceWaitTime;
+		double gpuTime;
+		unsigned long long recordedFrames;
+		unsigned long long draws;
+		unsigned long long drawCalls;
+		unsigned long long pipelineBinds;
+		unsigned long long meshBinds;
+		unsigned long long triangles;
+		unsigned long long clusters;
+		unsigned long long culledClusters;
+		unsigned long long dynamicBytes;
+	} _frame_stats;
 
 	std::weak_ptr<Window::WindowInternal> _window;
 
 	struct {
 		bool startPass;
-		ViewPort vp;
-		bool cull;
-		unsigned pipeline;
 	} _draw_state;
 
+	// draws are collected during the frame and recorded at PresentFrame, ordered by their sort key
+	struct DrawPacket {
+		// a reference, the object may drop or replace its mesh before the frame is recorded
+		std::shared_ptr<Mesh::MeshInternal> mesh;
+		unsigned numIndices;
+		unsigned lod;
+		// cluster culled draws: range of the list's cluster draws, none for draws of the whole index range
+		unsigned firstClusterDraw;
+		unsigned clusterDraws;
+		unsigned pipeline;
+		unsigned viewport;
+		bool cull;
+		Pipeline::ObjectDrawData objectData;
+	};
+	// indirect draw commands of one draw list and frame in flight, written while recording
+	struct IndirectBuffer {
+		BufferResources buffer;
+		unsigned capacity = 0;
+	};
+	struct DrawList {
+		std::vector<DrawPacket> packets;
+		std::vector<SortKey> keys;
+		std::vector<SortKey> keysScratch;
+		std::vector<ViewPort> viewports;
+		std::vector<float> pushData;
+		// object to screen transforms of the packets, computed in one pass when the list is recorded
+		ScreenTransformBatch screenTransforms;
+		// visible clusters of the draws, mesh relative until they are recorded
+		std::vector<VkDrawIndexedIndirectCommand> clusterDraws;
+		std::vector<IndirectBuffer> indirectBuffers;
+		// meshes recorded per frame in flight, released once the frame slot is recorded again
+		std::vector<std::vector<std::shared_ptr<Mesh::MeshInternal>>> recordedMeshes;
+		// commands recorded from the list, added to the frame stats at PresentFrame
+		unsigned long long draws = 0;
+		unsigned long long drawCalls = 0;
+		unsigned long long pipelineBinds = 0;
+		unsigned long long meshBinds = 0;
+		unsigned long long triangles = 0;
+		unsigned long long clusters = 0;
+		unsigned long long culledClusters = 0;
+	};
+	DrawList _draw_list;
+	bool _sort_draws;
+	float _lod_pixel_error;
+	float _lod_hysteresis;
+	bool _cluster_culling;
+	// threads computing the screen transforms of a draw list, the recording thread and the pool's workers
+	unsigned _transform_threads;
+	WorkerPool _transform_workers;
+
+	// shared vertex/index buffers of static meshes, meshes keep a reference so it outlives the renderer
+	std::shared_ptr<MeshArenas> _mesh_arenas;
+	// asynchronous mesh loads, submitted and polled once per frame
+	std::shared_ptr<UploadQueue> _uploads;
+
+	// draw contexts handed out by BeginParallelDraw, pipeline context i + 1, each with its own command pool
+	// and one secondary command buffer per frame in flight
+	struct ParallelContext {
+		DrawList list;
+		VkCommandPool cmdPool = VK_NULL_HANDLE;
+		std::vector<VkCommandBuffer> cmdBuffers;
+		bool recorded = false;
+	};
+	std::vector<ParallelContext> _parallel_contexts;
+	// contexts in use this frame, 0 if the frame is recorded inline
+	unsigned _parallel_count;
+	std::vector<VkCommandBuffer> _execute_buffers;
+
 
 	unsigned _dev_id;
 };
@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include "transformhierarchy.h"
+
+
+
+namespace RenderingFramework3D {
+
+using namespace MathUtil;
+
+
+WorldObject::WorldObjectInternal::TransformHierarchy::TransformHierarchy()
+    :
+    _nodes(),
+    _pass(0),
+    _update(false)
+{}
+
+bool WorldObject::WorldObjectInternal::TransformHierarchy::Attach(WorldObjectInternal* child, WorldObjectInternal* parent) {
+    bool cycle = child == parent;
+    if (child->_hierarchy && child->_hierarchy == parent->_hierarchy) {
+        const std::vector<Node>& nodes = child->_hierarchy->_nodes;
+        for (int i = (int)parent->_hierarchy_index; i >= 0 && cycle == false; i = nodes[i].parent) {
+            cycle = nodes[i].object == child;
+        }
+    }
+    if (cycle) {
+        printf("cannot attach an object to its own reference frame or an object attached to it\n");
+        return false;
+    }
+    Detach(child);
+
+    if (parent->_hierarchy == nullptr) {
+        std::vector<Node> root = { { parent, -1, true, 0, GetIdentity<4>() } };
+        std::make_shared<TransformHierarchy>()->append(root, -1);
+    }
+
+    std::vector<Node> subtree;
+    if (auto hierarchy = child->_hierarchy) {
+        subtree = hierarchy->extract(child->_hierarchy_index);
+        release(hierarchy);
+    }
+    else {
+        subtree.push_back({ child, -1, true, 0, GetIdentity<4>() });
+    }
+    parent->_hierarchy->append(subtree, (int)parent->_hierarchy_index);
+    return true;
+}
+
+void WorldObject::WorldObjectInternal::TransformHierarchy::Detach(WorldObjectInternal* object) {
+    std::shared_ptr<TransformHierarchy> hierarchy = object->_hierarchy;
+    if (hierarchy == nullptr || hierarchy->_nodes[object->_hierarchy_index].parent < 0) {
+        return;
+    }
+    std::vector<Node> subtree = hierarchy->extract(object->_hierarchy_index);
+    if (subtree.size() > 1) {
+        std::make_shared<TransformHierarchy>()->append(subtree, -1);
+    }
+    else {
+        object->_hierarchy.reset();
+    }
+    release(hierarchy);
+}
+
+void WorldObject::WorldObjectInternal::TransformHierarchy::Remove(WorldObjectInternal* object) {
+    std::shared_ptr<TransformHierarchy> hierarchy = object->_hierarchy;
+    if (hierarchy == nullptr) {
+        return;
+    }
+    std::vector<Node>& nodes = hierarchy->_nodes;
+    int index = (int)object->_hierarchy_index;
+    for (size_t i = index + 1; i < nodes.size(); i++) {
+        if (nodes[i].parent == index) {
+            nodes[i].parent = -1;
+            nodes[i].dirty = true;
+        }
+    }
+    hierarchy->extract(index);
+    hierarchy->_update.MarkDirty();
+    object->_hierarchy.reset();
+    release(hierarchy);
+}
+
+WorldObject::WorldObjectInternal* WorldObject::WorldObjectInternal::TransformHierarchy::GetParent(unsigned index) const {
+    int parent = _nodes[index].parent;
+    return parent >= 0 ? _nodes[parent].object : nullptr;
+}
+
+void WorldObject::WorldObjectInternal::TransformHierarchy::MarkDirty(unsigned index) {
+    _nodes[index].dirty = true;
+    _update.MarkDirty();
+}
+
+const Matrix<4, 4>& WorldObject::WorldObjectInternal::TransformHierarchy::GetWorldTransform(unsigned index) const {
+    _update.Update([this]() {
+        // parents come first, so a node's parent is final when the node is reached
+        _pass++;
+        for (Node& node : _nodes) {
+            if (node.parent < 0) {
+                if (node.dirty) {
+                    node.world = node.object->GetLocalTransform();
+                    node.updated = _pass;
+                }
+            }
+            else if (node.dirty || _nodes[node.parent].updated == _pass) {
+                node.world = _nodes[node.parent].world * node.object->GetLocalTransform();
+                node.updated = _pass;
+            }
+            node.dirty = false;
+        }
+    });
+    return _nodes[index].world;
+}
+
+std::vector<WorldObject::WorldObjectInternal::TransformHierarchy::Node> WorldObject::WorldObjectInternal::TransformHierarchy::extract(unsigned root) {
+    // the subtree is closed downwards: a node is in it if it is the root or its parent is
+    std::vector<Node> subtree;
+    std::vector<int> newIndex(_nodes.size());
+    std::vector<bool> moved(_nodes.size(), false);
+    size_t kept = 0;
+    for (size_t i = 0; i < _nodes.size(); i++) {
+        Node node = _nodes[i];
+        if (i == root || (i > root && node.parent >= 0 && moved[node.parent])) {
+            moved[i] = true;
+            newIndex[i] = (int)subtree.size();
+            node.parent = i == root ? -1 : newIndex[node.parent];
+            subtree.push_back(node);
+        }
+        else {
+            newIndex[i] = (int)kept;
+            node.parent = node.parent >= 0 ? newIndex[node.parent] : -1;
+            node.object->_hierarchy_index = (unsigned)kept;
+            _nodes[kept++] = node;
+        }
+    }
+    _nodes.resize(kept);
+    subtree[0].dirty = true;
+    return subtree;
+}
+
+void WorldObject::WorldObjectInternal::TransformHierarchy::append(std::vector<Node>& subtree, int parent) {
+    int offset = (int)_nodes.size();
+    for (Node& node : subtree) {
+        node.parent = node.parent >= 0 ? node.parent + offset : parent;
+        node.object->_hierarchy = shared_from_this();
+        node.object->_hierarchy_index = (unsigned)_nodes.size();
+        _nodes.push_back(node);
+    }
+    _nodes[offset].dirty = true;
+    _update.MarkDirty();
+}
+
+void WorldObject::WorldObjectInternal::TransformHierarchy::release(const std::shared_ptr<TransformHierarchy>& hierarchy) {
+    std::vector<Node>& nodes = hierarchy->_nodes;
+    std::vector<bool> hasChildren(nodes.size(), false);
+    for (const Node& node : nodes) {
+        if (node.parent >= 0) {
+            hasChildren[node.parent] = true;
+        }
+    }
+    // the kept nodes move up over the released ones, their parents come first and are already renumbered
+    std::vector<int> newIndex(nodes.size());
+    size_t kept = 0;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        Node node = nodes[i];
+        if (node.parent < 0 && hasChildren[i] == false) {
+            node.object->_hierarchy.reset();
+            continue;
+        }
+        newIndex[i] = (int)kept;
+        node.parent = node.parent >= 0 ? newIndex[node.parent] : -1;
+        node.object->_hierarchy_index = (unsigned)kept;
+        nodes[kept++] = node;
+    }
+    nodes.resize(kept);
+}
+}
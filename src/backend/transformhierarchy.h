@@ -0,0 +1,58 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "matrix.h"
+#include "lazyupdate.h"
+#include "worldobj_internal.h"
+
+
+namespace RenderingFramework3D {
+
+// the objects of reference frame trees, flattened into one array with every parent before its children. Objects
+// attached to each other share one hierarchy, objects without parent or children have none.
+// World transforms are cached in the array. A change marks its object dirty, the first read after it walks the
+// array once in order, so the changed objects and everything below them are updated in O(n) from the already
+// updated parents, without following parent pointers
+class WorldObject::WorldObjectInternal::TransformHierarchy : public std::enable_shared_from_this<TransformHierarchy>
+{
+public:
+	TransformHierarchy();
+
+	// attaches child and the objects below it to parent, fails if parent is below child
+	static bool Attach(WorldObjectInternal* child, WorldObjectInternal* parent);
+	// makes object a root, the objects below it stay attached to it
+	static void Detach(WorldObjectInternal* object);
+	// removes a destroyed object, the objects attached to it become roots
+	static void Remove(WorldObjectInternal* object);
+
+	WorldObjectInternal* GetParent(unsigned index) const;
+	void MarkDirty(unsigned index);
+	const MathUtil::Matrix<4, 4>& GetWorldTransform(unsigned index) const;
+
+private:
+	struct Node {
+		WorldObjectInternal* object;
+		// index of the parent's node, -1 for roots
+		int parent;
+		// the object changed since the last update
+		bool dirty;
+		// number of the update pass which last changed world, the nodes below a node updated in the current
+		// pass are updated as well
+		unsigned updated;
+		MathUtil::Matrix<4, 4> world;
+	};
+
+	// moves the subtree of nodes[root] out of the array, in order and with the indices of the returned array
+	std::vector<Node> extract(unsigned root);
+	// appends a subtree returned by extract, its root attached to nodes[parent] or a root if parent is -1
+	void append(std::vector<Node>& subtree, int parent);
+	// drops the objects left without parent or children after nodes were extracted or made roots, the hierarchy is
+	// freed with its last object once none is left attached
+	static void release(const std::shared_ptr<TransformHierarchy>& hierarchy);
+
+private:
+	mutable std::vector<Node> _nodes;
+	mutable unsigned _pass;
+	LazyUpdate _update;
+};
+}
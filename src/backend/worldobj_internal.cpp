@@ -1,6 +1,7 @@
 #include <cmath>
 #include "types.h"
 #include "worldobj_internal.h"
+#include "transformhierarchy.h"
 
 
 
@@ -8,31 +9,104 @@ namespace RenderingFramework3D {
 
 using namespace MathUtil;
 
+static constexpr unsigned max_lod_cameras = 8;
+
 
 WorldObject::WorldObjectInternal::WorldObjectInternal()
     :
+    _position(0.0f),
+    _orientation(),
+    _scale({1,1,1,1}),
     _transform(GetIdentity<4>()),
+    _transform_update(false),
     _material(),
-    _scale({1,1,1,1}),
     _num_indices(0),
-    _cull_mode(true)
+    _cull_mode(true),
+    _camera_lods(),
+    _hierarchy(),
+    _hierarchy_index(0)
 {
 
 }
 
 WorldObject::WorldObjectInternal::WorldObjectInternal(const std::shared_ptr<Mesh::MeshInternal>& mesh)
     :
+    _position(0.0f),
+    _orientation(),
+    _scale({1,1,1,1}),
     _transform(GetIdentity<4>()),
+    _transform_update(false),
     _material(),
-    _scale({1,1,1,1}),
     _num_indices(0),
     _cull_mode(true),
-    _mesh(mesh)
+    _camera_lods(),
+    _mesh(mesh),
+    _hierarchy(),
+    _hierarchy_index(0)
 {}
 
+WorldObject::WorldObjectInternal::WorldObjectInternal(const WorldObjectInternal& src)
+    :
+    _position(src._position),
+    _orientation(src._orientation),
+    _scale(src._scale),
+    _transform(GetIdentity<4>()),
+    _transform_update(true),
+    _material(src._material),
+    _num_indices(src._num_indices),
+    _cull_mode(src._cull_mode),
+    _camera_lods(),
+    _custom_uniform_data(src._custom_uniform_data),
+    _mesh(src._mesh),
+    _hierarchy(),
+    _hierarchy_index(0)
+{
+    {
+        std::lock_guard<std::mutex> lock(src._lod_mutex);
+        _camera_lods = src._camera_lods;
+    }
+    // the copy is attached to the same parent, the objects attached to src stay with src
+    if (src._hierarchy) {
+        if (WorldObjectInternal* parent = src._hierarchy->GetParent(src._hierarchy_index)) {
+            TransformHierarchy::Attach(this, parent);
+        }
+    }
+}
+
+WorldObject::WorldObjectInternal::~WorldObjectInternal() {
+    TransformHierarchy::Remove(this);
+}
+
 
 void WorldObject::WorldObjectInternal::SetMesh(const std::shared_ptr<Mesh::MeshInternal>& mesh) {
     _mesh = mesh;
+    std::lock_guard<std::mutex> lock(_lod_mutex);
+    _camera_lods.clear();
+}
+
+void WorldObject::WorldObjectInternal::SetLOD(unsigned camera, unsigned lod) const {
+    std::lock_guard<std::mutex> lock(_lod_mutex);
+    for (auto& entry : _camera_lods) {
+        if (entry.camera == camera) {
+            entry.lod = lod;
+            return;
+        }
+    }
+    if (_camera_lods.size() >= max_lod_cameras) {
+        _camera_lods.erase(_camera_lods.begin());
+    }
+    _camera_lods.push_back({ camera, lod });
+}
+
+unsigned WorldObject::WorldObjectInternal::GetLOD(unsigned camera) const {
+    std::lock_guard<std::mutex> lock(_lod_mutex);
+    for (const auto& entry : _camera_lods) {
+        if (entry.camera == camera) {
+            return entry.lod;
+        }
+    }
+    // cameras drawing the object for the first time start at the full mesh
+    return 0;
 }
 
 
@@ -53,91 +127,42 @@ bool WorldObject::WorldObjectInternal::GetBackFaceCulling() const {
 }
 
 void WorldObject::WorldObjectInternal::SetPosition(const Vec<3>& position) {
-    _transform(0, 3) = position(0);
-    _transform(1, 3) = position(1);
-    _transform(2, 3) = position(2);
+    _position = position;
+    markTransformDirty();
 }
 
 void WorldObject::WorldObjectInternal::Move(const Vec<3>& displacement) {
-    _transform(0, 3) += displacement(0);
-    _transform(1, 3) += displacement(1);
-    _transform(2, 3) += displacement(2);
+    _position += displacement;
+    markTransformDirty();
 }
 
 void WorldObject::WorldObjectInternal::SetOrientationEulerXYZ(const Vec<3>& angles) {
-    float cx = cos(angles(0)), sx = sin(angles(0));
-    float cy = cos(angles(1)), sy = sin(angles(1));
-    float cz = cos(angles(2)), sz = sin(angles(2));
-
-    _transform(0,0) = cy * cz;
-    _transform(0,1) = -cy * sz;
-    _transform(0,2) = sy;
-
-    _transform(1,0) = cx * sz + sx * sy * cz;
-    _transform(1,1) = cx * cz - sx * sy * sz;
-    _transform(1,2) = -sx * cy;
-
-    _transform(2,0) = sx * sz - cx * sy * cz;
-    _transform(2,1) = sx * cz + cx * sy * sz;
-    _transform(2,2) = cx * cy;
+    _orientation = Quat::FromEulerXYZ(angles);
+    markTransformDirty();
 }
 
-
 void WorldObject::WorldObjectInternal::SetRotationMatrix(const MathUtil::Matrix<3,3>& matrix) {
-    _transform(0,0) = matrix(0,0);
-    _transform(0,1) = matrix(0,1);
-    _transform(0,2) = matrix(0,2);
-
-    _transform(1,0) = matrix(1,0);
-    _transform(1,1) = matrix(1,1);
-    _transform(1,2) = matrix(1,2);
-
-    _transform(2,0) = matrix(2,0);
-    _transform(2,1) = matrix(2,1);
-    _transform(2,2) = matrix(2,2);
+    _orientation = Quat::FromRotationMatrix(matrix);
+    markTransformDirty();
 }
 
 void WorldObject::WorldObjectInternal::Rotate(const Vec<3>& axis, float radians) {
+    // rotation about the parent frame's axis after the current one, renormalized so repeated rotations stay rotations
+    _orientation = Quat::FromAxisAngle(axis, radians) * _orientation;
+    _orientation.Normalize();
+    markTransformDirty();
+}
 
-    auto u = axis;
-    u.Normalize();
-    //axis(2, 0) = 1;
-    Matrix<4,4> transform;
-    transform(3, 3) = 1;
-
-    //cos+ux^2(1-cos)	uxuy(1-cos)-uzsin	uxuz(1-cos)+uysin
-    //uyux(1-cos)+uzsin	cos+uy^2(1-cos)		uyuz(1-cos)-uxsin
-    //uzux(1-cos)-uysin	uzuy(1-cos)+uxsin	cos+uz^2(1-cos)
-    float tempx = _transform(0, 3), tempy = _transform(1, 3), tempz = _transform(2, 3);
-
-    float costheta = std::cos(radians);
-    float sintheta = std::sin(radians);
-
-    transform(0, 0) = costheta + u(0) * u(0) * (1 - costheta);
-    transform(1, 0) = u(1) * u(0) * (1 - costheta) + u(2) * sintheta;
-    transform(2, 0) = u(2) * u(0) * (1 - costheta) - u(1) * sintheta;
-
-    transform(0, 1) = u(0) * u(1) * (1 - costheta) - u(2) * sintheta;
-    transform(1, 1) = costheta + u(1) * u(1) * (1 - costheta);
-    transform(2, 1) = u(2) * u(1) * (1 - costheta) + u(0) * sintheta;
-
-    transform(0, 2) = u(0) * u(2) * (1 - costheta) + u(1) * sintheta;
-    transform(1, 2) = u(1) * u(2) * (1 - costheta) - u(0) * sintheta;
-    transform(2, 2) = costheta + u(2) * u(2) * (1 - costheta);
-
-    transform(3, 0) = 0;
-    transform(3, 1) = 0;
-    transform(3, 2) = 0;
-    transform(0, 3) = 0;
-    transform(1, 3) = 0;
-    transform(2, 3) = 0;
+void WorldObject::WorldObjectInternal::SetOrientation(const Quat& orientation) {
+    _orientation = orientation.Normalized();
+    markTransformDirty();
+}
 
-    //_transform.print();
-    _transform = transform * _transform;
-    _transform(0, 3) = tempx;
-    _transform(1, 3) = tempy;
-    _transform(2, 3) = tempz;
-    //_transform.print();
+void WorldObject::WorldObjectInternal::markTransformDirty() {
+    _transform_update.MarkDirty();
+    if (_hierarchy) {
+        _hierarchy->MarkDirty(_hierarchy_index);
+    }
 }
 
 void WorldObject::WorldObjectInternal::SetCustomUniformShaderInputData(unsigned binding, const void* data, unsigned bytes, unsigned offset) {
@@ -162,33 +187,40 @@ void WorldObject::WorldObjectInternal::SetScaleZ(float z) {
 }
 
 void WorldObject::WorldObjectInternal::AttachReferenceFrame(const std::shared_ptr<WorldObjectInternal>& ref) {
-    _parent = std::const_pointer_cast<const WorldObjectInternal>(ref);
+    TransformHierarchy::Attach(this, ref.get());
 }
 
 void WorldObject::WorldObjectInternal::DetachReferenceFrame() {
-    _parent.reset();
+    TransformHierarchy::Detach(this);
 }
 
 Vec<3> WorldObject::WorldObjectInternal::GetPosition() const {
-    if(auto ref = _parent.lock()) {
-        Vec<4> pos4 = ref->GetTransform() * Vec<4>({_transform(0,3), _transform(1,3), _transform(2,3),1});
-        return Vec<3>({pos4(0), pos4(1), pos4(2)});
+    if (_hierarchy) {
+        const Matrix<4, 4>& transform = _hierarchy->GetWorldTransform(_hierarchy_index);
+        return Vec<3>({transform(0, 3), transform(1, 3), transform(2, 3)});
     }
-    return Vec<3>({_transform(0,3), _transform(1,3), _transform(2,3)});
+    return _position;
 }
 
 Vec<3> WorldObject::WorldObjectInternal::GetLocalPosition() const {
-    return Vec<3>({_transform(0,3), _transform(1,3), _transform(2,3)});
+    return _position;
 }
 
-Matrix<4,4> WorldObject::WorldObjectInternal::GetTransform() const {
-    if(auto ref = _parent.lock()) {
-        return ref->GetTransform() * _transform;
+const Quat& WorldObject::WorldObjectInternal::GetOrientation() const {
+    return _orientation;
+}
+
+const Matrix<4,4>& WorldObject::WorldObjectInternal::GetTransform() const {
+    if (_hierarchy) {
+        return _hierarchy->GetWorldTransform(_hierarchy_index);
     }
-    return _transform;
+    return GetLocalTransform();
 }
 
 const Matrix<4, 4>& WorldObject::WorldObjectInternal::GetLocalTransform() const {
+    _transform_update.Update([this]() {
+        _transform = _orientation.GetTransform(_position);
+    });
     return _transform;
 }
 
@@ -1,12 +1,15 @@
 #pragma once
 #include <memory>
+#include <mutex>
 #include <vector>
 #include "types.h"
 #include "matrix.h"
 #include "vec.h"
+#include "quat.h"
 
 #include "worldobj.h"
 #include "mesh_internal.h"
+#include "lazyupdate.h"
 
 
 
@@ -17,6 +20,8 @@ class WorldObject::WorldObjectInternal
 public:
 	WorldObjectInternal();
 	WorldObjectInternal(const std::shared_ptr<Mesh::MeshInternal>& mesh);
+	WorldObjectInternal(const WorldObjectInternal& src);
+	~WorldObjectInternal();
 
 	void SetMesh(const std::shared_ptr<Mesh::MeshInternal>& mesh);
 
@@ -31,6 +36,7 @@ public:
 	void SetOrientationEulerXYZ(const MathUtil::Vec<3>& angles);
 	void SetRotationMatrix(const MathUtil::Matrix<3,3>& matrix);
 	void Rotate(const MathUtil::Vec<3>& axis, float radians);
+	void SetOrientation(const MathUtil::Quat& orientation);
 	void SetScale(float x, float y, float z);
 	void SetScaleX(float x);
 	void SetScaleY(float y);
@@ -45,10 +51,12 @@ public:
 	//must follow glsl alignment requirements for uniform buffer objects
 	void SetCustomUniformShaderInputData(unsigned binding, const void* data, unsigned bytes, unsigned offset=0);
 
+	// world transforms are cached, see TransformHierarchy
 	MathUtil::Vec<3> GetPosition() const;
-	MathUtil::Matrix<4,4> GetTransform() const;
+	const MathUtil::Matrix<4,4>& GetTransform() const;
 
 	MathUtil::Vec<3> GetLocalPosition() const;
+	const MathUtil::Quat& GetOrientation() const;
 	const MathUtil::Matrix<4,4>& GetLocalTransform() const;
 
 	const MathUtil::Vec<4>& GetObjectScale() const;
@@ -56,15 +64,38 @@ public:
 
 	const std::shared_ptr<Mesh::MeshInternal>& GetMesh() const;
 
+	// level of detail drawn last for a camera, selection only changes it by the renderer's hysteresis. Draw state kept
+	// for the renderer rather than part of the object, so it is written through const objects, also from parallel draws
+	void SetLOD(unsigned camera, unsigned lod) const;
+	unsigned GetLOD(unsigned camera) const;
+
+private:
+	class TransformHierarchy;
+
+	void markTransformDirty();
+
 private:
-	MathUtil::Matrix<4, 4> _transform;
+	MathUtil::Vec<3> _position;
+	MathUtil::Quat _orientation;
 	MathUtil::Vec<4> _scale;
+	// built from _position and _orientation on the first read after they change
+	mutable MathUtil::Matrix<4, 4> _transform;
+	LazyUpdate _transform_update;
 	Material _material;
 	unsigned _num_indices;
 	bool _cull_mode;
+	struct CameraLOD {
+		unsigned camera;
+		unsigned lod;
+	};
+	// the cameras that drew the object most recently, the oldest is dropped when a new one draws it
+	mutable std::vector<CameraLOD> _camera_lods;
+	mutable std::mutex _lod_mutex;
 	std::unordered_map<unsigned, std::vector<uint8_t>> _custom_uniform_data;
 
 	std::shared_ptr<Mesh::MeshInternal> _mesh;
-	std::weak_ptr<const WorldObjectInternal> _parent;
+	// reference frame tree of the object and its node in it, none while the object has no parent or children
+	std::shared_ptr<TransformHierarchy> _hierarchy;
+	unsigned _hierarchy_index;
 };
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+#include <thread>
+
+
+namespace RenderingFramework3D {
+
+// dirty flag of a value rebuilt on its first read after a change. Reads may come from several draw threads at once,
+// the first one to claim the rebuild runs it while the others wait for it. Changes must not overlap reads
+class LazyUpdate
+{
+public:
+	LazyUpdate(bool dirty)
+		:
+		_state(dirty ? state_dirty : state_clean)
+	{}
+
+	void MarkDirty() {
+		_state.store(state_dirty, std::memory_order_release);
+	}
+
+	// runs update if the value is dirty, returns once it is clean
+	template <typename Fn>
+	void Update(Fn update) const {
+		uint8_t state = _state.load(std::memory_order_acquire);
+		while (state != state_clean) {
+			if (state == state_dirty && _state.compare_exchange_weak(state, state_building, std::memory_order_acquire)) {
+				update();
+				_state.store(state_clean, std::memory_order_release);
+				return;
+			}
+			std::this_thread::yield();
+			state = _state.load(std::memory_order_acquire);
+		}
+	}
+
+private:
+	static constexpr uint8_t state_clean = 0;
+	static constexpr uint8_t state_dirty = 1;
+	static constexpr uint8_t state_building = 2;
+
+	mutable std::atomic<uint8_t> _state;
+};
+}
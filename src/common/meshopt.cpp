@@ -0,0 +1,632 @@
+#include "meshopt.h"
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+
+
+namespace RenderingFramework3D {
+
+using namespace MathUtil;
+
+// a simplification pass makes at most one in this many of its candidate collapses
+static constexpr unsigned collapse_pass_fraction = 10;
+
+// FIFO cache simulation: a vertex is cached while fewer than cacheSize vertices were inserted after it.
+// cachedAt holds the insertion time of each vertex, times start above cacheSize so 0 means never inserted
+class VertexCacheSim {
+public:
+	VertexCacheSim(unsigned numVerts, unsigned cacheSize) : _cached_at(numVerts, 0), _cache_size(cacheSize), _time(cacheSize + 1) {}
+
+	// true on a cache miss, the vertex is inserted then
+	bool Access(unsigned v) {
+		if (_time - _cached_at[v] > _cache_size) {
+			_cached_at[v] = _time++;
+			return true;
+		}
+		return false;
+	}
+	// every vertex misses on its next access
+	void Flush() {
+		_time += _cache_size + 1;
+	}
+	// insertions since v was inserted, larger than the cache size if it is not cached
+	unsigned Age(unsigned v) const {
+		return _time - _cached_at[v];
+	}
+
+private:
+	std::vector<unsigned> _cached_at;
+	unsigned _cache_size;
+	unsigned _time;
+};
+
+// triangles around each vertex: the triangles of vertex v are adjacency[offsets[v]] to adjacency[offsets[v + 1] - 1]
+static void buildTriangleAdjacency(const unsigned* indices, unsigned count, unsigned numVerts, std::vector<unsigned>& offsets, std::vector<unsigned>& adjacency) {
+	offsets.assign(numVerts + 1, 0);
+	for (unsigned i = 0; i < count; i++) {
+		offsets[indices[i] + 1]++;
+	}
+	for (unsigned v = 0; v < numVerts; v++) {
+		offsets[v + 1] += offsets[v];
+	}
+	adjacency.resize(count);
+	std::vector<unsigned> fill(offsets.begin(), offsets.end() - 1);
+	for (unsigned i = 0; i < count; i++) {
+		adjacency[fill[indices[i]]++] = i / 3;
+	}
+}
+
+void analyzeVertexCache(const unsigned* indices, unsigned count, unsigned numVerts, unsigned cacheSize, float& acmr, float& atvr) {
+	acmr = 0;
+	atvr = 0;
+	unsigned triCount = count / 3;
+	if (triCount == 0 || numVerts == 0) {
+		return;
+	}
+	VertexCacheSim cache(numVerts, cacheSize);
+	std::vector<bool> referenced(numVerts, false);
+	unsigned misses = 0;
+	unsigned unique = 0;
+	for (unsigned i = 0; i < triCount * 3; i++) {
+		unsigned v = indices[i];
+		if (cache.Access(v)) {
+			misses++;
+		}
+		if (referenced[v] == false) {
+			referenced[v] = true;
+			unique++;
+		}
+	}
+	acmr = (float)misses / triCount;
+	atvr = (float)misses / unique;
+}
+
+void optimizeVertexCache(unsigned* dst, const unsigned* indices, unsigned count, unsigned numVerts, unsigned cacheSize) {
+	unsigned triCount = count / 3;
+	if (triCount == 0) {
+		return;
+	}
+
+	// triangles around each vertex and how many of them are not emitted yet
+	std::vector<unsigned> offsets;
+	std::vector<unsigned> adjacency;
+	buildTriangleAdjacency(indices, triCount * 3, numVerts, offsets, adjacency);
+	std::vector<unsigned> live(numVerts);
+	for (unsigned v = 0; v < numVerts; v++) {
+		live[v] = offsets[v + 1] - offsets[v];
+	}
+
+	VertexCacheSim cache(numVerts, cacheSize);
+	std::vector<bool> emitted(triCount, false);
+	// recently emitted vertices, the next fan continues from them when the current one has no good successor
+	std::vector<unsigned> deadEnd;
+	std::vector<unsigned> candidates;
+	unsigned cursor = 0;
+	unsigned out = 0;
+	auto skipDeadEnd = [&]() -> int {
+		while (deadEnd.empty() == false) {
+			unsigned v = deadEnd.back();
+			deadEnd.pop_back();
+			if (live[v] > 0) {
+				return (int)v;
+			}
+		}
+		for (; cursor < numVerts; cursor++) {
+			if (live[cursor] > 0) {
+				return (int)cursor;
+			}
+		}
+		return -1;
+	};
+
+	int fan = skipDeadEnd();
+	while (fan >= 0) {
+		// emit every remaining triangle around the fanning vertex
+		candidates.clear();
+		for (unsigned k = offsets[fan]; k < offsets[fan + 1]; k++) {
+			unsigned tri = adjacency[k];
+			if (emitted[tri]) {
+				continue;
+			}
+			for (unsigned c = 0; c < 3; c++) {
+				unsigned v = indices[tri * 3 + c];
+				dst[out++] = v;
+				deadEnd.push_back(v);
+				candidates.push_back(v);
+				live[v]--;
+				cache.Access(v);
+			}
+			emitted[tri] = true;
+		}
+
+		// next fan: the oldest candidate that is still cached after its remaining triangles (two new vertices each)
+		// were emitted, any candidate with triangles left otherwise
+		int next = -1;
+		int bestPriority = -1;
+		for (unsigned v : candidates) {
+			if (live[v] == 0) {
+				continue;
+			}
+			int priority = 0;
+			if (cache.Age(v) + 2 * live[v] <= cacheSize) {
+				priority = (int)cache.Age(v);
+			}
+			if (priority > bestPriority) {
+				bestPriority = priority;
+				next = (int)v;
+			}
+		}
+		fan = next >= 0 ? next : skipDeadEnd();
+	}
+}
+
+void optimizeOverdraw(unsigned* dst, const unsigned* indices, unsigned count, const Vec<4>* positions, unsigned numVerts, unsigned cacheSize, float threshold) {
+	unsigned triCount = count / 3;
+	if (triCount == 0) {
+		return;
+	}
+
+	std::vector<uint8_t> misses(triCount, 0);
+	VertexCacheSim cache(numVerts, cacheSize);
+	unsigned totalMisses = 0;
+	for (unsigned t = 0; t < triCount; t++) {
+		for (unsigned c = 0; c < 3; c++) {
+			misses[t] += cache.Access(indices[t * 3 + c]) ? 1 : 0;
+		}
+		totalMisses += misses[t];
+	}
+	float maxAcmr = threshold * totalMisses / triCount;
+
+	// hard boundaries where the cache was flushed anyway, soft ones where the cluster so far, starting from an empty
+	// cache, is about as cache efficient as the whole mesh, so drawing it after any other cluster costs little
+	std::vector<unsigned> clusters;
+	VertexCacheSim clusterCache(numVerts, cacheSize);
+	unsigned clusterMisses = 0;
+	for (unsigned t = 0; t < triCount; t++) {
+		bool soft = clusters.empty() == false && (float)clusterMisses / (t - clusters.back()) <= maxAcmr;
+		if (t == 0 || misses[t] == 3 || soft) {
+			clusters.push_back(t);
+			clusterMisses = 0;
+			clusterCache.Flush();
+		}
+		for (unsigned c = 0; c < 3; c++) {
+			clusterMisses += clusterCache.Access(indices[t * 3 + c]) ? 1 : 0;
+		}
+	}
+	clusters.push_back(triCount);
+
+	// area weighted centroid and normal of each cluster and of the whole mesh
+	auto position = [&](unsigned idx) {
+		const Vec<4>& p = positions[indices[idx]];
+		return Vec<3>({ p(0), p(1), p(2) });
+	};
+	unsigned clusterCount = (unsigned)clusters.size() - 1;
+	std::vector<Vec<3>> centroids(clusterCount, Vec<3>(0.0f));
+	std::vector<Vec<3>> normals(clusterCount, Vec<3>(0.0f));
+	Vec<3> meshCentroid(0.0f);
+	float meshArea = 0;
+	for (unsigned c = 0; c < clusterCount; c++) {
+		float clusterArea = 0;
+		for (unsigned t = clusters[c]; t < clusters[c + 1]; t++) {
+			Vec<3> p0 = position(t * 3), p1 = position(t * 3 + 1), p2 = position(t * 3 + 2);
+			Vec<3> normal = Cross(p1 - p0, p2 - p0);
+			float area = std::sqrt(normal.LenSqr());
+			centroids[c] += (p0 + p1 + p2) * (area / 3.0f);
+			normals[c] += normal;
+			clusterArea += area;
+		}
+		meshCentroid += centroids[c];
+		meshArea += clusterArea;
+		if (clusterArea > 0) {
+			centroids[c] /= clusterArea;
+		}
+	}
+	if (meshArea > 0) {
+		meshCentroid /= meshArea;
+	}
+
+	std::vector<std::pair<float, unsigned>> order(clusterCount);
+	for (unsigned c = 0; c < clusterCount; c++) {
+		float length = std::sqrt(normals[c].LenSqr());
+		float facing = length > 0 ? (centroids[c] - meshCentroid).Dot(normals[c]) / length : 0;
+		order[c] = { -facing, c };
+	}
+	std::stable_sort(order.begin(), order.end(), [](const std::pair<float, unsigned>& lhs, const std::pair<float, unsigned>& rhs) { return lhs.first < rhs.first; });
+
+	unsigned out = 0;
+	for (const auto& entry : order) {
+		unsigned c = entry.second;
+		for (unsigned i = clusters[c] * 3; i < clusters[c + 1] * 3; i++) {
+			dst[out++] = indices[i];
+		}
+	}
+}
+
+static Vec<3> toVec3(const Vec<4>& p) {
+	return Vec<3>({ p(0), p(1), p(2) });
+}
+
+MeshSimplifier::MeshSimplifier(const unsigned* indices, unsigned count, const Vec<4>* positions, unsigned numVerts)
+	:
+	_positions(positions),
+	_indices(indices, indices + count - count % 3),
+	_quadrics(numVerts),
+	_planes(),
+	_vertex_planes(numVerts),
+	_locked(numVerts, false),
+	_offsets(),
+	_adjacency(),
+	_error(0)
+{
+	// vertices sharing a position: the first of them in position order represents the group
+	std::vector<unsigned> sorted(numVerts);
+	for (unsigned v = 0; v < numVerts; v++) {
+		sorted[v] = v;
+	}
+	auto less = [positions](unsigned lhs, unsigned rhs) {
+		for (unsigned c = 0; c < 3; c++) {
+			if (positions[lhs](c) != positions[rhs](c)) {
+				return positions[lhs](c) < positions[rhs](c);
+			}
+		}
+		return false;
+	};
+	std::sort(sorted.begin(), sorted.end(), less);
+	std::vector<unsigned> group(numVerts);
+	for (unsigned i = 0; i < numVerts; i++) {
+		bool seam = i > 0 && less(sorted[i - 1], sorted[i]) == false;
+		group[sorted[i]] = seam ? group[sorted[i - 1]] : sorted[i];
+		if (seam) {
+			_locked[sorted[i]] = _locked[sorted[i - 1]] = true;
+		}
+	}
+
+	// edges between position groups used by one triangle are open borders, by more than two non-manifold
+	std::vector<uint64_t> edges;
+	edges.reserve(_indices.size());
+	for (unsigned i = 0; i < _indices.size(); i++) {
+		unsigned a = group[_indices[i]];
+		unsigned b = group[_indices[i - i % 3 + (i + 1) % 3]];
+		edges.push_back((uint64_t)std::min(a, b) << 32 | std::max(a, b));
+	}
+	std::sort(edges.begin(), edges.end());
+	std::vector<bool> lockedGroup(numVerts, false);
+	for (unsigned i = 0; i < edges.size();) {
+		unsigned run = 1;
+		while (i + run < edges.size() && edges[i + run] == edges[i]) {
+			run++;
+		}
+		if (run != 2) {
+			lockedGroup[edges[i] >> 32] = lockedGroup[edges[i] & 0xFFFFFFFF] = true;
+		}
+		i += run;
+	}
+	for (unsigned v = 0; v < numVerts; v++) {
+		_locked[v] = _locked[v] || lockedGroup[group[v]];
+	}
+
+	// plane quadrics of the triangles around each vertex
+	_planes.resize(_indices.size() / 3);
+	for (unsigned t = 0; t < _indices.size() / 3; t++) {
+		Vec<3> p0 = toVec3(positions[_indices[t * 3]]);
+		Vec<3> normal = Cross(toVec3(positions[_indices[t * 3 + 1]]) - p0, toVec3(positions[_indices[t * 3 + 2]]) - p0);
+		double area = std::sqrt(normal.LenSqr());
+		if (area <= 0) {
+			continue;
+		}
+		double n[3] = { normal(0) / area, normal(1) / area, normal(2) / area };
+		double d = -(n[0] * p0(0) + n[1] * p0(1) + n[2] * p0(2));
+		_planes[t] = { { n[0], n[1], n[2] }, d };
+		Quadric q;
+		q.a[0] = n[0] * n[0] * area; q.a[1] = n[0] * n[1] * area; q.a[2] = n[0] * n[2] * area;
+		q.a[3] = n[1] * n[1] * area; q.a[4] = n[1] * n[2] * area; q.a[5] = n[2] * n[2] * area;
+		for (unsigned c = 0; c < 3; c++) {
+			q.b[c] = n[c] * d * area;
+		}
+		q.c = d * d * area;
+		q.weight = area;
+		for (unsigned c = 0; c < 3; c++) {
+			addQuadric(_quadrics[_indices[t * 3 + c]], q);
+			_vertex_planes[_indices[t * 3 + c]].push_back(t);
+		}
+	}
+	buildAdjacency();
+}
+
+float MeshSimplifier::Simplify(unsigned targetCount, float maxError) {
+	struct Collapse {
+		double cost;
+		unsigned from;
+		unsigned to;
+	};
+	double maxCost = (double)maxError * maxError;
+	std::vector<Collapse> collapses;
+	std::vector<unsigned> remap(_quadrics.size());
+	std::vector<bool> touched(_quadrics.size());
+
+	// each pass collapses the cheapest edges not sharing a vertex with an earlier collapse of the pass
+	while (_indices.size() > targetCount) {
+		collapses.clear();
+		for (unsigned i = 0; i < _indices.size(); i++) {
+			unsigned a = _indices[i];
+			unsigned b = _indices[i - i % 3 + (i + 1) % 3];
+			// interior edges are seen from both of their triangles, border edges can't be collapsed
+			if (a > b) {
+				continue;
+			}
+			Quadric q = _quadrics[a];
+			addQuadric(q, _quadrics[b]);
+			Collapse collapse = { -1, a, b };
+			if (_locked[a] == false) {
+				collapse.cost = evaluate(q, _positions[b]);
+			}
+			if (_locked[b] == false) {
+				double cost = evaluate(q, _positions[a]);
+				if (collapse.cost < 0 || cost < collapse.cost) {
+					collapse = { cost, b, a };
+				}
+			}
+			if (collapse.cost >= 0 && collapse.cost <= maxCost) {
+				collapses.push_back(collapse);
+			}
+		}
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& lhs, const Collapse& rhs) { return lhs.cost < rhs.cost; });
+
+		// a collapse removes two triangles of a closed surface. Passes stop at the cheapest part of the candidates, the
+		// vertices of the cheap collapses block others in the same pass which would then be picked in cost order
+		unsigned triangles = _indices.size() / 3;
+		unsigned limit = std::min<unsigned>((triangles - targetCount / 3 + 1) / 2, collapses.size() / collapse_pass_fraction + 1);
+		for (unsigned v = 0; v < remap.size(); v++) {
+			remap[v] = v;
+		}
+		std::fill(touched.begin(), touched.end(), false);
+		unsigned made = 0;
+		for (const auto& collapse : collapses) {
+			if (made >= limit) {
+				break;
+			}
+			if (touched[collapse.from] || touched[collapse.to] || flipsTriangle(collapse.from, collapse.to, remap)) {
+				continue;
+			}
+			// to stays where it is, so only the planes collapsed into from get further from it
+			double error = planeDistance(collapse.from, _positions[collapse.to]);
+			if (error > maxError) {
+				continue;
+			}
+			remap[collapse.from] = collapse.to;
+			addQuadric(_quadrics[collapse.to], _quadrics[collapse.from]);
+			std::vector<unsigned>& planes = _vertex_planes[collapse.to];
+			planes.insert(planes.end(), _vertex_planes[collapse.from].begin(), _vertex_planes[collapse.from].end());
+			std::sort(planes.begin(), planes.end());
+			planes.erase(std::unique(planes.begin(), planes.end()), planes.end());
+			std::vector<unsigned>().swap(_vertex_planes[collapse.from]);
+			touched[collapse.from] = touched[collapse.to] = true;
+			_error = std::max(_error, (float)error);
+			made++;
+		}
+		if (made == 0) {
+			break;
+		}
+
+		unsigned out = 0;
+		for (unsigned t = 0; t < triangles; t++) {
+			unsigned a = remap[_indices[t * 3]], b = remap[_indices[t * 3 + 1]], c = remap[_indices[t * 3 + 2]];
+			if (a == b || b == c || c == a) {
+				continue;
+			}
+			_indices[out++] = a;
+			_indices[out++] = b;
+			_indices[out++] = c;
+		}
+		_indices.resize(out);
+		buildAdjacency();
+	}
+	return _error;
+}
+
+const std::vector<unsigned>& MeshSimplifier::GetIndices() const {
+	return _indices;
+}
+
+void MeshSimplifier::addQuadric(Quadric& q, const Quadric& add) const {
+	for (unsigned i = 0; i < 6; i++) {
+		q.a[i] += add.a[i];
+	}
+	for (unsigned i = 0; i < 3; i++) {
+		q.b[i] += add.b[i];
+	}
+	q.c += add.c;
+	q.weight += add.weight;
+}
+
+double MeshSimplifier::evaluate(const Quadric& q, const Vec<4>& p) const {
+	if (q.weight <= 0) {
+		return 0;
+	}
+	double x = p(0), y = p(1), z = p(2);
+	double error = q.a[0] * x * x + 2 * q.a[1] * x * y + 2 * q.a[2] * x * z + q.a[3] * y * y + 2 * q.a[4] * y * z + q.a[5] * z * z +
+		2 * (q.b[0] * x + q.b[1] * y + q.b[2] * z) + q.c;
+	return std::max(error, 0.0) / q.weight;
+}
+
+double MeshSimplifier::planeDistance(unsigned v, const Vec<4>& p) const {
+	double distance = 0;
+	for (unsigned t : _vertex_planes[v]) {
+		const Plane& plane = _planes[t];
+		distance = std::max(distance, std::abs(plane.n[0] * p(0) + plane.n[1] * p(1) + plane.n[2] * p(2) + plane.d));
+	}
+	return distance;
+}
+
+bool MeshSimplifier::flipsTriangle(unsigned from, unsigned to, const std::vector<unsigned>& remap) const {
+	// the triangles around from after the collapses made so far in this pass, turning more than about 75 degrees
+	// or degenerating when from moves to the position of to
+	for (unsigned k = _offsets[from]; k < _offsets[from + 1]; k++) {
+		unsigned t = _adjacency[k];
+		unsigned v[3] = { remap[_indices[t * 3]], remap[_indices[t * 3 + 1]], remap[_indices[t * 3 + 2]] };
+		if (v[0] == to || v[1] == to || v[2] == to || v[0] == v[1] || v[1] == v[2] || v[2] == v[0]) {
+			continue;
+		}
+		Vec<3> p[3];
+		for (unsigned c = 0; c < 3; c++) {
+			p[c] = toVec3(_positions[v[c]]);
+		}
+		Vec<3> before = Cross(p[1] - p[0], p[2] - p[0]);
+		for (unsigned c = 0; c < 3; c++) {
+			if (v[c] == from) {
+				p[c] = toVec3(_positions[to]);
+			}
+		}
+		Vec<3> after = Cross(p[1] - p[0], p[2] - p[0]);
+		if (after.Dot(before) <= 0.25f * std::sqrt(before.LenSqr() * after.LenSqr())) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void MeshSimplifier::buildAdjacency() {
+	buildTriangleAdjacency(_indices.data(), _indices.size(), _quadrics.size(), _offsets, _adjacency);
+}
+
+void buildClusters(unsigned* dst, const unsigned* indices, unsigned count, const Vec<4>* positions, unsigned numVerts, unsigned maxVerts, unsigned maxTris, std::vector<MeshCluster>& clusters) {
+	clusters.clear();
+	unsigned triCount = count / 3;
+	std::vector<unsigned> offsets, adjacency;
+	buildTriangleAdjacency(indices, triCount * 3, numVerts, offsets, adjacency);
+
+	std::vector<bool> emitted(triCount, false);
+	// cluster a triangle was last made a candidate of, so it is listed once per cluster
+	std::vector<unsigned> candidateOf(triCount, ~0u);
+	std::vector<bool> inCluster(numVerts, false);
+	std::vector<unsigned> clusterVerts;
+	std::vector<unsigned> candidates;
+	std::vector<Vec<3>> normals;
+	auto triangleCentre = [&](unsigned t) {
+		return (toVec3(positions[indices[t * 3]]) + toVec3(positions[indices[t * 3 + 1]]) + toVec3(positions[indices[t * 3 + 2]])) / 3.0f;
+	};
+
+	unsigned out = 0;
+	unsigned seed = 0;
+	while (true) {
+		while (seed < triCount && emitted[seed]) {
+			seed++;
+		}
+		if (seed == triCount) {
+			break;
+		}
+		unsigned id = clusters.size();
+		MeshCluster cluster;
+		cluster.firstIndex = out;
+		clusterVerts.clear();
+		candidates.clear();
+		Vec<3> sum(0.0f);
+
+		unsigned next = seed;
+		unsigned tris = 0;
+		while (next != ~0u) {
+			emitted[next] = true;
+			tris++;
+			for (unsigned c = 0; c < 3; c++) {
+				unsigned v = indices[next * 3 + c];
+				dst[out++] = v;
+				if (inCluster[v]) {
+					continue;
+				}
+				inCluster[v] = true;
+				clusterVerts.push_back(v);
+				sum += toVec3(positions[v]);
+				for (unsigned a = offsets[v]; a < offsets[v + 1]; a++) {
+					unsigned t = adjacency[a];
+					if (emitted[t] == false && candidateOf[t] != id) {
+						candidateOf[t] = id;
+						candidates.push_back(t);
+					}
+				}
+			}
+			next = ~0u;
+			if (tris == maxTris) {
+				break;
+			}
+
+			Vec<3> centre = sum / (float)clusterVerts.size();
+			unsigned bestNew = 4;
+			float bestDist = FLT_MAX;
+			unsigned live = 0;
+			for (unsigned t : candidates) {
+				if (emitted[t]) {
+					continue;
+				}
+				candidates[live++] = t;
+				unsigned newVerts = 0;
+				for (unsigned c = 0; c < 3; c++) {
+					newVerts += inCluster[indices[t * 3 + c]] ? 0 : 1;
+				}
+				if (clusterVerts.size() + newVerts > maxVerts || newVerts > bestNew) {
+					continue;
+				}
+				float dist = (triangleCentre(t) - centre).LenSqr();
+				if (newVerts < bestNew || dist < bestDist) {
+					bestNew = newVerts;
+					bestDist = dist;
+					next = t;
+				}
+			}
+			candidates.resize(live);
+		}
+		cluster.indexCount = out - cluster.firstIndex;
+
+		// sphere around the vertices' mean, cone around the mean of the triangle normals
+		cluster.center = sum / (float)clusterVerts.size();
+		cluster.radius = 0;
+		for (unsigned v : clusterVerts) {
+			cluster.radius = std::max(cluster.radius, (toVec3(positions[v]) - cluster.center).LenSqr());
+			inCluster[v] = false;
+		}
+		cluster.radius = std::sqrt(cluster.radius);
+
+		normals.clear();
+		Vec<3> axis(0.0f);
+		for (unsigned i = cluster.firstIndex; i < out; i += 3) {
+			Vec<3> p0 = toVec3(positions[dst[i]]), p1 = toVec3(positions[dst[i + 1]]), p2 = toVec3(positions[dst[i + 2]]);
+			Vec<3> normal = Cross(p1 - p0, p2 - p0);
+			float length = std::sqrt(normal.LenSqr());
+			if (length > 0) {
+				normals.push_back(normal / length);
+				axis += normals.back();
+			}
+		}
+		float axisLength = std::sqrt(axis.LenSqr());
+		cluster.coneAxis = axisLength > 0 ? axis / axisLength : Vec<3>(0.0f);
+		cluster.coneCutoff = 1;
+		if (axisLength > 0) {
+			float minDot = 1;
+			for (const auto& normal : normals) {
+				minDot = std::min(minDot, normal.Dot(cluster.coneAxis));
+			}
+			// normals within acos(minDot) of the axis, a spread of 90 degrees or more can't be culled
+			if (minDot > 0) {
+				cluster.coneCutoff = std::sqrt(1 - minDot * minDot);
+			}
+		}
+		clusters.push_back(cluster);
+	}
+}
+
+void optimizeVertexFetch(unsigned* indices, unsigned count, unsigned numVerts, std::vector<unsigned>& remap) {
+	remap.assign(numVerts, ~0u);
+	unsigned next = 0;
+	for (unsigned i = 0; i < count; i++) {
+		unsigned& v = remap[indices[i]];
+		if (v == ~0u) {
+			v = next++;
+		}
+		indices[i] = v;
+	}
+	for (auto& v : remap) {
+		if (v == ~0u) {
+			v = next++;
+		}
+	}
+}
+}
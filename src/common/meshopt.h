@@ -0,0 +1,91 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+#include "vec.h"
+
+
+namespace RenderingFramework3D {
+
+// post-transform cache efficiency of a triangle list on a FIFO cache of cacheSize vertices:
+// acmr = cache misses per triangle (0.5 is the limit of large regular meshes, 3 is no reuse),
+// atvr = cache misses per referenced vertex (1 is optimal)
+void analyzeVertexCache(const unsigned* indices, unsigned count, unsigned numVerts, unsigned cacheSize, float& acmr, float& atvr);
+
+// reorders the triangles for post-transform cache locality (Tipsify: fans around the vertex that stays in the
+// cache the longest), dst must not alias indices
+void optimizeVertexCache(unsigned* dst, const unsigned* indices, unsigned count, unsigned numVerts, unsigned cacheSize);
+
+// reorders cache optimized triangles for less overdraw: the triangle list is cut into clusters where the cache
+// is flushed and where the cluster's ACMR is within threshold of the whole mesh's, then the clusters facing away
+// from the mesh centre the most are drawn first since they are the most likely to occlude the others.
+// dst must not alias indices
+void optimizeOverdraw(unsigned* dst, const unsigned* indices, unsigned count, const MathUtil::Vec<4>* positions, unsigned numVerts, unsigned cacheSize, float threshold);
+
+// quadric error metric simplification by edge collapses onto existing vertices, so the simplified index lists index the
+// same vertex data. Vertices on open borders and seams (several vertices at one position) stay in place, collapses
+// flipping a triangle are skipped. The quadrics keep accumulating, successive Simplify calls build an LOD chain
+class MeshSimplifier {
+public:
+	MeshSimplifier(const unsigned* indices, unsigned count, const MathUtil::Vec<4>* positions, unsigned numVerts);
+
+	// collapses edges cheapest first until at most targetCount indices are left or every remaining collapse would move
+	// the surface further than maxError, returns the largest error of the collapses made so far. The quadrics' area
+	// weighted mean only orders the collapses, the error is the largest distance of a collapsed vertex's new position
+	// to the plane of any original triangle it was part of, so no vertex moves further off the surface
+	float Simplify(unsigned targetCount, float maxError);
+	const std::vector<unsigned>& GetIndices() const;
+
+private:
+	struct Quadric {
+		// symmetric 3x3 a, b and c of the squared plane distance x'ax + 2b'x + c, weighted by triangle area
+		double a[6] = { 0, 0, 0, 0, 0, 0 };
+		double b[3] = { 0, 0, 0 };
+		double c = 0;
+		double weight = 0;
+	};
+	// unit normal and offset
+	struct Plane {
+		double n[3] = { 0, 0, 0 };
+		double d = 0;
+	};
+	void addQuadric(Quadric& q, const Quadric& add) const;
+	// mean squared distance of the point to the planes of the quadric
+	double evaluate(const Quadric& q, const MathUtil::Vec<4>& p) const;
+	bool flipsTriangle(unsigned from, unsigned to, const std::vector<unsigned>& remap) const;
+	// largest distance of p to the original triangle planes of vertex v
+	double planeDistance(unsigned v, const MathUtil::Vec<4>& p) const;
+	void buildAdjacency();
+
+	const MathUtil::Vec<4>* _positions;
+	std::vector<unsigned> _indices;
+	std::vector<Quadric> _quadrics;
+	// planes of the original triangles, zero for degenerate ones, and those of the triangles collapsed into each vertex
+	std::vector<Plane> _planes;
+	std::vector<std::vector<unsigned>> _vertex_planes;
+	std::vector<bool> _locked;
+	// triangles around each vertex of the current index list
+	std::vector<unsigned> _offsets;
+	std::vector<unsigned> _adjacency;
+	float _error;
+};
+
+// a run of triangles built by buildClusters with a bounding sphere and a cone bounding their normals. Seen from p,
+// every triangle faces away if (center - p) . coneAxis >= coneCutoff * |center - p| + radius, a cutoff of 1 never culls
+struct MeshCluster {
+	unsigned firstIndex = 0;
+	unsigned indexCount = 0;
+	MathUtil::Vec<3> center;
+	float radius = 0;
+	MathUtil::Vec<3> coneAxis;
+	float coneCutoff = 1;
+};
+
+// splits the triangles into clusters of at most maxVerts vertices and maxTris triangles, grown from the first triangle
+// not yet used by adding the neighbouring triangle that brings the fewest new vertices, closest to the cluster's centre
+// first. dst receives the triangles cluster by cluster, it must not alias indices
+void buildClusters(unsigned* dst, const unsigned* indices, unsigned count, const MathUtil::Vec<4>* positions, unsigned numVerts, unsigned maxVerts, unsigned maxTris, std::vector<MeshCluster>& clusters);
+
+// remap table numbering the vertices in the order the indices first reference them, unreferenced vertices last.
+// The indices are rewritten with the new numbers
+void optimizeVertexFetch(unsigned* indices, unsigned count, unsigned numVerts, std::vector<unsigned>& remap);
+}
@@ -0,0 +1,71 @@
+#include <string.h>
+#include "transformbatch.h"
+
+
+namespace RenderingFramework3D {
+
+using namespace MathUtil;
+
+// transforms per thread and chunk, a multiple of the matrix block size. Fewer are computed on the recording thread alone
+static constexpr size_t transform_chunk_size = 1024;
+
+ScreenTransformBatch::ScreenTransformBatch()
+	:
+	_targets(),
+	_view_projections(),
+	_cam_to_screen(0.0f),
+	_world_to_cam(0.0f),
+	_models(),
+	_results()
+{}
+
+void ScreenTransformBatch::Clear() {
+	_targets.clear();
+	_view_projections.clear();
+}
+
+unsigned ScreenTransformBatch::GetCount() const {
+	return (unsigned)_targets.size();
+}
+
+void ScreenTransformBatch::Add(const Matrix<4, 4>& camToScreen, const Matrix<4, 4>& worldToCam, const Matrix<4, 4>& model, float* dst, unsigned pushDataOffset) {
+	if (_view_projections.empty() || memcmp(&camToScreen, &_cam_to_screen, sizeof(_cam_to_screen)) != 0 ||
+		memcmp(&worldToCam, &_world_to_cam, sizeof(_world_to_cam)) != 0) {
+		_cam_to_screen = camToScreen;
+		_world_to_cam = worldToCam;
+		_view_projections.push_back(camToScreen * worldToCam);
+	}
+
+	size_t i = _targets.size();
+	if (GetMat4SoASize(i + 1) > _models.size()) {
+		_models.resize(GetMat4SoASize(std::max<size_t>(256, 2 * i)));
+	}
+	StoreMat4SoA(model, { _models.data() }, i);
+	_targets.push_back({ dst, pushDataOffset, (unsigned)_view_projections.size() - 1 });
+}
+
+void ScreenTransformBatch::Compute(std::vector<float>& pushData, WorkerPool& pool) {
+	_results.resize(_models.size());
+	Mat4SoA models = { _models.data() };
+	Mat4SoA results = { _results.data() };
+	for (size_t first = 0; first < _targets.size();) {
+		size_t last = first + 1;
+		while (last < _targets.size() && _targets[last].viewProjection == _targets[first].viewProjection) {
+			last++;
+		}
+
+		const Matrix<4, 4>& viewProj = _view_projections[_targets[first].viewProjection];
+		pool.ParallelFor(last - first, transform_chunk_size, [&](size_t begin, size_t end) {
+			begin += first;
+			end += first;
+			MultiplyBatch(viewProj, models, results, begin, end);
+			for (size_t i = begin; i < end; i++) {
+				const Target& target = _targets[i];
+				LoadMat4SoA(results, i, target.dst ? target.dst : pushData.data() + target.pushDataOffset);
+			}
+		});
+		first = last;
+	}
+	Clear();
+}
+}
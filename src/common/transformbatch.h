@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include "matrix.h"
+#include "batch.h"
+#include "workerpool.h"
+
+
+namespace RenderingFramework3D {
+
+// object to screen transforms of a draw list: the draws queue their object transform and camera while they are
+// prepared, Compute multiplies them all in structure of arrays layout before the list is recorded
+class ScreenTransformBatch
+{
+public:
+	ScreenTransformBatch();
+
+	void Clear();
+	unsigned GetCount() const;
+
+	// queues camToScreen * worldToCam * model, written to dst, or to pushData at pushDataOffset if dst is nullptr
+	// since the push data array may still grow
+	void Add(const MathUtil::Matrix<4, 4>& camToScreen, const MathUtil::Matrix<4, 4>& worldToCam, const MathUtil::Matrix<4, 4>& model, float* dst, unsigned pushDataOffset);
+
+	// writes every queued transform and clears the batch, pool splits large batches across its threads
+	void Compute(std::vector<float>& pushData, WorkerPool& pool);
+
+private:
+	struct Target {
+		float* dst;
+		unsigned pushDataOffset;
+		// index of the view projection, draws of one camera follow each other
+		unsigned viewProjection;
+	};
+	std::vector<Target> _targets;
+	std::vector<MathUtil::Matrix<4, 4>> _view_projections;
+	// camera matrices of the last view projection, so consecutive draws of one camera multiply them once
+	MathUtil::Matrix<4, 4> _cam_to_screen;
+	MathUtil::Matrix<4, 4> _world_to_cam;
+
+	// model matrices and results in the blocked layout of MathUtil::Mat4SoA
+	std::vector<float> _models;
+	std::vector<float> _results;
+};
+}
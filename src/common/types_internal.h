@@ -1,5 +1,6 @@
 #pragma once
 #include <vector>
+#include <atomic>
 #include "vulkaninc.h"
 #include "types.h"
 
@@ -18,13 +19,40 @@ struct UniformShaderInputLayoutInternal {
 	VkDescriptorSetLayout vklayoutglobal;
 };
 
+// range of a device memory block handed out by the MemoryAllocator, or a dedicated allocation
+struct MemoryAllocation {
+	VkDeviceMemory memory = VK_NULL_HANDLE;
+	VkDeviceSize offset = 0;
+	VkDeviceSize size = 0;
+	// host visible memory is persistently mapped, points at offset
+	uint8_t* mapped = nullptr;
+	VkMemoryPropertyFlags properties = 0;
+	// block pool and block the range belongs to, ~0u for dedicated allocations
+	unsigned pool = ~0u;
+	unsigned block = ~0u;
+};
+
 struct BufferResources {
-	VkDeviceMemory vkBufferMem;
-	VkBuffer vkBuffer;
+	MemoryAllocation memory;
+	VkBuffer vkBuffer = VK_NULL_HANDLE;
 };
 
 struct ImageResources {
-	VkDeviceMemory vkImgMem;
-	VkImage vkImage;
+	MemoryAllocation memory;
+	VkImage vkImage = VK_NULL_HANDLE;
+};
+
+// decode of VERTEX_POSITION_SNORM16 positions: position = stored * scale + bias
+struct PositionDequantization {
+	float scale[3] = { 1, 1, 1 };
+	float bias[3] = { 0, 0, 0 };
+};
+
+// number of frames the renderer presented, shared with meshes keeping per frame copies of their data
+struct FrameClock {
+	std::atomic<unsigned long long> frame{0};
+	unsigned framesInFlight = 1;
+	// bytes dynamic mesh updates wrote or copied forward since the last recorded frame, see FrameStats::dynamicBytes
+	mutable std::atomic<unsigned long long> dynamicBytes{0};
 };
 }
\ No newline at end of file
@@ -3,10 +3,7 @@
 
 namespace RenderingFramework3D {
 
-bool findMemoryType(VkPhysicalDevice physdev, uint32_t typeFilter, VkMemoryPropertyFlags properties, unsigned& idx) {
-	VkPhysicalDeviceMemoryProperties memProperties;
-
-	vkGetPhysicalDeviceMemoryProperties(physdev, &memProperties);
+bool findMemoryType(const VkPhysicalDeviceMemoryProperties& memProperties, uint32_t typeFilter, VkMemoryPropertyFlags properties, unsigned& idx) {
 	for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
 		if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
 			idx = i;
@@ -17,74 +14,11 @@ bool findMemoryType(VkPhysicalDevice physdev, uint32_t typeFilter, VkMemoryPrope
 	return false;
 }
 
-bool createBuffer(VkPhysicalDevice physdev, VkDevice dev, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory) {
-	VkBufferCreateInfo bufferInfo{};
-	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-	bufferInfo.size = size;
-	bufferInfo.usage = usage;
-	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-	if (vkCreateBuffer(dev, &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
-		return false;
-	}
-
-	VkMemoryRequirements memRequirements;
-	vkGetBufferMemoryRequirements(dev, buffer, &memRequirements);
-
-	VkMemoryAllocateInfo allocInfo{};
-	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-	allocInfo.allocationSize = memRequirements.size;
-
-	if (findMemoryType(physdev, memRequirements.memoryTypeBits, properties, allocInfo.memoryTypeIndex) == false) {
-		return false;
-	}
-
-	if (vkAllocateMemory(dev, &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS) {
-		return false;
-	}
-	if (vkBindBufferMemory(dev, buffer, bufferMemory, 0) != VK_SUCCESS) {
-		return false;
-	}
-	return true;
-}
-
-bool createImage(VkPhysicalDevice physdev, VkDevice dev, uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory) {
-	VkImageCreateInfo imageInfo{};
-	imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-	imageInfo.imageType = VK_IMAGE_TYPE_2D;
-	imageInfo.extent.width = width;
-	imageInfo.extent.height = height;
-	imageInfo.extent.depth = 1;
-	imageInfo.mipLevels = 1;
-	imageInfo.arrayLayers = 1;
-	imageInfo.format = format;
-	imageInfo.tiling = tiling;
-	imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-	imageInfo.usage = usage;
-	imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
-	imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-
-	if (vkCreateImage(dev, &imageInfo, nullptr, &image) != VK_SUCCESS) {
-		return false;
-	}
-
-	VkMemoryRequirements memRequirements;
-	vkGetImageMemoryRequirements(dev, image, &memRequirements);
-
-	VkMemoryAllocateInfo allocInfo{};
-	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-	allocInfo.allocationSize = memRequirements.size;
-	if (findMemoryType(physdev, memRequirements.memoryTypeBits, properties, allocInfo.memoryTypeIndex) == false) {
-		return false;
-	}
-
-	if (vkAllocateMemory(dev, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS) {
-		return false;
-	}
+bool findMemoryType(VkPhysicalDevice physdev, uint32_t typeFilter, VkMemoryPropertyFlags properties, unsigned& idx) {
+	VkPhysicalDeviceMemoryProperties memProperties;
 
-	vkBindImageMemory(dev, image, imageMemory, 0);
-	return true;
+	vkGetPhysicalDeviceMemoryProperties(physdev, &memProperties);
+	return findMemoryType(memProperties, typeFilter, properties, idx);
 }
 
 bool createImageView(VkDevice dev, VkImage img, VkFormat fmt, VkImageAspectFlags aspectFlags, VkImageView& imgView) {
@@ -105,6 +39,78 @@ bool createImageView(VkDevice dev, VkImage img, VkFormat fmt, VkImageAspectFlags
 	return true;
 }
 
+bool createRenderPass(VkDevice dev, VkFormat colorFormat, VkImageLayout colorFinalLayout, VkRenderPass& renderPass) {
+	VkAttachmentDescription colorAttachment{};
+	colorAttachment.format = colorFormat;
+	colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+	colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+	colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+	colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+	colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+	colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	colorAttachment.finalLayout = colorFinalLayout;
+
+	VkAttachmentReference colorAttachmentRef{};
+	colorAttachmentRef.attachment = 0;
+	colorAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+	VkAttachmentDescription depthAttachment{};
+	depthAttachment.format = VK_FORMAT_D32_SFLOAT;
+	depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+	depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+	depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+	depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+	depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+	depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+	VkAttachmentReference depthAttachmentRef{};
+	depthAttachmentRef.attachment = 1;
+	depthAttachmentRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+	std::vector<VkAttachmentDescription> attachments = { colorAttachment, depthAttachment };
+
+	VkSubpassDescription subpass{};
+	subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+	subpass.colorAttachmentCount = 1;
+	subpass.pColorAttachments = &colorAttachmentRef;
+	subpass.pDepthStencilAttachment = &depthAttachmentRef;
+
+	std::vector<VkSubpassDependency> dependencies(1);
+	dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+	dependencies[0].dstSubpass = 0;
+	dependencies[0].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+	dependencies[0].srcAccessMask = 0;
+	dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+	dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+	// the colour attachment is copied out after the pass
+	if (colorFinalLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL) {
+		VkSubpassDependency dependency{};
+		dependency.srcSubpass = 0;
+		dependency.dstSubpass = VK_SUBPASS_EXTERNAL;
+		dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+		dependency.dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+		dependency.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+		dependencies.push_back(dependency);
+	}
+
+	VkRenderPassCreateInfo renderPassInfo{};
+	renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+	renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
+	renderPassInfo.pAttachments = attachments.data();
+	renderPassInfo.subpassCount = 1;
+	renderPassInfo.pSubpasses = &subpass;
+	renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
+	renderPassInfo.pDependencies = dependencies.data();
+
+	if (vkCreateRenderPass(dev, &renderPassInfo, nullptr, &renderPass) != VK_SUCCESS) {
+		return false;
+	}
+	return true;
+}
+
 VkShaderModule createShaderModule(VkDevice dev, std::vector<uint8_t> code) {
 
 	VkShaderModuleCreateInfo createInfo = {};
@@ -162,6 +168,35 @@ VkFormat getVkFormat(GLSLType type, unsigned components) {
 	return VK_FORMAT_UNDEFINED;
 }
 
+VkFormat getVkFormat(ImageFormat format) {
+	switch (format) {
+	case IMAGE_FORMAT_R8G8B8A8_UNORM:
+		return VK_FORMAT_R8G8B8A8_UNORM;
+	case IMAGE_FORMAT_R8G8B8A8_SRGB:
+		return VK_FORMAT_R8G8B8A8_SRGB;
+	case IMAGE_FORMAT_B8G8R8A8_UNORM:
+		return VK_FORMAT_B8G8R8A8_UNORM;
+	case IMAGE_FORMAT_B8G8R8A8_SRGB:
+		return VK_FORMAT_B8G8R8A8_SRGB;
+	case IMAGE_FORMAT_R16G16B16A16_SFLOAT:
+		return VK_FORMAT_R16G16B16A16_SFLOAT;
+	case IMAGE_FORMAT_R32G32B32A32_SFLOAT:
+		return VK_FORMAT_R32G32B32A32_SFLOAT;
+	}
+	return VK_FORMAT_UNDEFINED;
+}
+
+unsigned getImageFormatSize(ImageFormat format) {
+	switch (format) {
+	case IMAGE_FORMAT_R16G16B16A16_SFLOAT:
+		return 8;
+	case IMAGE_FORMAT_R32G32B32A32_SFLOAT:
+		return 16;
+	default:
+		return 4;
+	}
+}
+
 unsigned getVertDataSize(GLSLType type, unsigned components) {
 	if (components > 4) components = 4;
 	else if (components < 1) components = 1;
@@ -173,4 +208,81 @@ unsigned getVertDataSize(GLSLType type, unsigned components) {
 	}
 }
 
+VkFormat getVkFormat(VertexPositionFormat format) {
+	switch (format) {
+	case VERTEX_POSITION_FLOAT4:
+		return VK_FORMAT_R32G32B32A32_SFLOAT;
+	case VERTEX_POSITION_FLOAT3:
+		return VK_FORMAT_R32G32B32_SFLOAT;
+	case VERTEX_POSITION_SNORM16:
+		return VK_FORMAT_R16G16B16A16_SNORM;
+	}
+	return VK_FORMAT_UNDEFINED;
+}
+
+VkFormat getVkFormat(VertexNormalFormat format) {
+	switch (format) {
+	case VERTEX_NORMAL_FLOAT3:
+		return VK_FORMAT_R32G32B32_SFLOAT;
+	case VERTEX_NORMAL_OCT16:
+		return VK_FORMAT_R16G16_SNORM;
+	case VERTEX_NORMAL_UNORM10:
+		return VK_FORMAT_A2B10G10R10_UNORM_PACK32;
+	}
+	return VK_FORMAT_UNDEFINED;
+}
+
+unsigned getVertDataSize(VertexPositionFormat format) {
+	switch (format) {
+	case VERTEX_POSITION_FLOAT3:
+		return 12;
+	case VERTEX_POSITION_SNORM16:
+		return 8;
+	default:
+		return 16;
+	}
+}
+
+unsigned getVertDataSize(VertexNormalFormat format) {
+	switch (format) {
+	case VERTEX_NORMAL_OCT16:
+	case VERTEX_NORMAL_UNORM10:
+		return 4;
+	default:
+		return 12;
+	}
+}
+
+void radixSort(std::vector<SortKey>& keys, std::vector<SortKey>& scratch) {
+	if (keys.size() < 2) {
+		return;
+	}
+	scratch.resize(keys.size());
+
+	// histograms of all 8 digits in one pass over the keys
+	std::array<std::array<uint32_t, 256>, 8> counts{};
+	for (const auto& k : keys) {
+		for (unsigned d = 0; d < 8; d++) {
+			counts[d][(k.key >> (d * 8)) & 0xFF]++;
+		}
+	}
+
+	for (unsigned d = 0; d < 8; d++) {
+		auto& count = counts[d];
+		if (count[(keys[0].key >> (d * 8)) & 0xFF] == keys.size()) {
+			continue;
+		}
+		uint32_t offset = 0;
+		for (auto& c : count) {
+			uint32_t n = c;
+			c = offset;
+			offset += n;
+		}
+		for (const auto& k : keys) {
+			scratch[count[(k.key >> (d * 8)) & 0xFF]++] = k;
+		}
+		keys.swap(scratch);
+	}
+}
+
 }
@@ -9,14 +9,28 @@
 
 namespace RenderingFramework3D {
 
+bool findMemoryType(const VkPhysicalDeviceMemoryProperties& memProperties, uint32_t typeFilter, VkMemoryPropertyFlags properties, unsigned& idx);
 bool findMemoryType(VkPhysicalDevice physdev, uint32_t typeFilter, VkMemoryPropertyFlags properties, unsigned& idx);
-bool createBuffer(VkPhysicalDevice physdev, VkDevice dev, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory);
-bool createImage(VkPhysicalDevice physdev, VkDevice dev, uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory);
 bool createImageView(VkDevice dev, VkImage img, VkFormat fmt, VkImageAspectFlags aspectFlags, VkImageView& imgView);
+// one subpass render pass clearing a colour and a D32 depth attachment, the colour attachment ends in colorFinalLayout
+bool createRenderPass(VkDevice dev, VkFormat colorFormat, VkImageLayout colorFinalLayout, VkRenderPass& renderPass);
 VkShaderModule createShaderModule(VkDevice dev, std::vector<uint8_t> code);
 std::vector<uint8_t> readFile(const std::string& filename);
 VkFormat getVkFormat(GLSLType type, unsigned components);
+VkFormat getVkFormat(ImageFormat format);
+unsigned getImageFormatSize(ImageFormat format);
 unsigned getVertDataSize(GLSLType type, unsigned components);
+VkFormat getVkFormat(VertexPositionFormat format);
+VkFormat getVkFormat(VertexNormalFormat format);
+unsigned getVertDataSize(VertexPositionFormat format);
+unsigned getVertDataSize(VertexNormalFormat format);
+
+struct SortKey {
+	uint64_t key;
+	uint32_t idx;
+};
+// stable LSD radix sort on the 64 bit keys, 8 bits per pass, passes where all keys share the digit are skipped
+void radixSort(std::vector<SortKey>& keys, std::vector<SortKey>& scratch);
 }
 
 
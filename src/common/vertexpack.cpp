@@ -0,0 +1,235 @@
+#include "vertexpack.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VERTEXPACK_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace RenderingFramework3D {
+
+static_assert(sizeof(MathUtil::Vec<4>) == sizeof(float) * 4 && sizeof(MathUtil::Vec<3>) == sizeof(float) * 3, "vertex data is packed from contiguous floats");
+
+// scalar versions of the SIMD kernels below, used for the remaining vertices, they must round the same way
+static inline int16_t toSnorm16(float v) {
+	v = std::min(std::max(v, -1.0f), 1.0f);
+	return (int16_t)std::nearbyint(v * 32767.0f);
+}
+
+static inline uint32_t toUnorm10(float v) {
+	v = std::min(std::max(v * 0.5f + 0.5f, 0.0f), 1.0f);
+	return (uint32_t)std::nearbyint(v * 1023.0f);
+}
+
+static void packOct16(const float* n, uint8_t* dst) {
+	float inv = 1.0f / std::max(std::fabs(n[0]) + std::fabs(n[1]) + std::fabs(n[2]), FLT_MIN);
+	float x = n[0] * inv;
+	float y = n[1] * inv;
+	if (n[2] < 0) {
+		float fx = (1.0f - std::fabs(y)) * (x >= 0 ? 1.0f : -1.0f);
+		float fy = (1.0f - std::fabs(x)) * (y >= 0 ? 1.0f : -1.0f);
+		x = fx;
+		y = fy;
+	}
+	int16_t packed[2] = { toSnorm16(x), toSnorm16(y) };
+	memcpy(dst, packed, sizeof(packed));
+}
+
+static void packUnorm10(const float* n, uint8_t* dst) {
+	uint32_t packed = toUnorm10(n[0]) | (toUnorm10(n[1]) << 10) | (toUnorm10(n[2]) << 20);
+	memcpy(dst, &packed, sizeof(packed));
+}
+
+void computePositionDequantization(const MathUtil::Vec<4>* positions, unsigned count, PositionDequantization& dequant) {
+	float lo[4] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX };
+	float hi[4] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	unsigned i = 0;
+#ifdef VERTEXPACK_SSE2
+	__m128 vlo = _mm_loadu_ps(lo);
+	__m128 vhi = _mm_loadu_ps(hi);
+	for (; i < count; i++) {
+		__m128 p = _mm_loadu_ps(&positions[i](0));
+		vlo = _mm_min_ps(vlo, p);
+		vhi = _mm_max_ps(vhi, p);
+	}
+	_mm_storeu_ps(lo, vlo);
+	_mm_storeu_ps(hi, vhi);
+#endif
+	for (; i < count; i++) {
+		for (unsigned c = 0; c < 3; c++) {
+			lo[c] = std::min(lo[c], positions[i](c));
+			hi[c] = std::max(hi[c], positions[i](c));
+		}
+	}
+
+	dequant = PositionDequantization();
+	if (count == 0) {
+		return;
+	}
+	for (unsigned c = 0; c < 3; c++) {
+		dequant.bias[c] = (lo[c] + hi[c]) * 0.5f;
+		dequant.scale[c] = (hi[c] - lo[c]) * 0.5f;
+		// flat along this axis, every position quantizes to 0
+		if (dequant.scale[c] <= 0) {
+			dequant.scale[c] = 1;
+		}
+	}
+}
+
+void packPositions(const MathUtil::Vec<4>* positions, unsigned count, VertexPositionFormat format, const PositionDequantization& dequant, uint8_t* dst, unsigned stride) {
+	if (format == VERTEX_POSITION_FLOAT4 || format == VERTEX_POSITION_FLOAT3) {
+		unsigned size = format == VERTEX_POSITION_FLOAT4 ? sizeof(float) * 4 : sizeof(float) * 3;
+		for (unsigned i = 0; i < count; i++) {
+			memcpy(dst + (size_t)i * stride, &positions[i](0), size);
+		}
+		return;
+	}
+
+	float inv[3];
+	for (unsigned c = 0; c < 3; c++) {
+		inv[c] = 1.0f / dequant.scale[c];
+	}
+	unsigned i = 0;
+#ifdef VERTEXPACK_SSE2
+	// two vertices per iteration, w is stored as 1
+	const __m128 vbias = _mm_setr_ps(dequant.bias[0], dequant.bias[1], dequant.bias[2], 0);
+	const __m128 vinv = _mm_setr_ps(inv[0], inv[1], inv[2], 0);
+	const __m128 w1 = _mm_setr_ps(0, 0, 0, 1);
+	const __m128 vmin = _mm_set1_ps(-1.0f);
+	const __m128 vmax = _mm_set1_ps(1.0f);
+	const __m128 vrange = _mm_set1_ps(32767.0f);
+	for (; i + 2 <= count; i += 2) {
+		__m128i q[2];
+		for (unsigned k = 0; k < 2; k++) {
+			__m128 p = _mm_loadu_ps(&positions[i + k](0));
+			p = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(p, vbias), vinv), w1);
+			p = _mm_min_ps(_mm_max_ps(p, vmin), vmax);
+			q[k] = _mm_cvtps_epi32(_mm_mul_ps(p, vrange));
+		}
+		__m128i packed = _mm_packs_epi32(q[0], q[1]);
+		_mm_storel_epi64((__m128i*)(dst + (size_t)i * stride), packed);
+		_mm_storel_epi64((__m128i*)(dst + (size_t)(i + 1) * stride), _mm_unpackhi_epi64(packed, packed));
+	}
+#endif
+	for (; i < count; i++) {
+		int16_t packed[4];
+		for (unsigned c = 0; c < 3; c++) {
+			packed[c] = toSnorm16((positions[i](c) - dequant.bias[c]) * inv[c]);
+		}
+		packed[3] = 32767;
+		memcpy(dst + (size_t)i * stride, packed, sizeof(packed));
+	}
+}
+
+void packNormals(const MathUtil::Vec<3>* normals, unsigned count, VertexNormalFormat format, uint8_t* dst, unsigned stride) {
+	if (format == VERTEX_NORMAL_FLOAT3) {
+		for (unsigned i = 0; i < count; i++) {
+			memcpy(dst + (size_t)i * stride, &normals[i](0), sizeof(float) * 3);
+		}
+		return;
+	}
+
+	unsigned i = 0;
+#ifdef VERTEXPACK_SSE2
+	// four vertices per iteration with one component per register
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	const __m128 vmin = _mm_set1_ps(-1.0f);
+	const __m128 half = _mm_set1_ps(0.5f);
+	for (; i + 4 <= count; i += 4) {
+		const MathUtil::Vec<3>* n = &normals[i];
+		__m128 x = _mm_setr_ps(n[0](0), n[1](0), n[2](0), n[3](0));
+		__m128 y = _mm_setr_ps(n[0](1), n[1](1), n[2](1), n[3](1));
+		__m128 z = _mm_setr_ps(n[0](2), n[1](2), n[2](2), n[3](2));
+		alignas(16) uint32_t packed[4];
+		if (format == VERTEX_NORMAL_OCT16) {
+			__m128 l1 = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, x), _mm_andnot_ps(signMask, y)), _mm_andnot_ps(signMask, z));
+			__m128 inv = _mm_div_ps(one, _mm_max_ps(l1, _mm_set1_ps(FLT_MIN)));
+			x = _mm_mul_ps(x, inv);
+			y = _mm_mul_ps(y, inv);
+			// lower hemisphere: fold over the diagonals
+			__m128 signX = _mm_or_ps(one, _mm_and_ps(_mm_cmplt_ps(x, zero), signMask));
+			__m128 signY = _mm_or_ps(one, _mm_and_ps(_mm_cmplt_ps(y, zero), signMask));
+			__m128 foldX = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, y)), signX);
+			__m128 foldY = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), signY);
+			__m128 lower = _mm_cmplt_ps(z, zero);
+			x = _mm_or_ps(_mm_and_ps(lower, foldX), _mm_andnot_ps(lower, x));
+			y = _mm_or_ps(_mm_and_ps(lower, foldY), _mm_andnot_ps(lower, y));
+			__m128i qx = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(x, vmin), one), _mm_set1_ps(32767.0f)));
+			__m128i qy = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(y, vmin), one), _mm_set1_ps(32767.0f)));
+			__m128i q = _mm_packs_epi32(qx, qy);
+			_mm_store_si128((__m128i*)packed, _mm_unpacklo_epi16(q, _mm_unpackhi_epi64(q, q)));
+		} else {
+			__m128 range = _mm_set1_ps(1023.0f);
+			__m128i qx = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(x, half), half), zero), one), range));
+			__m128i qy = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(y, half), half), zero), one), range));
+			__m128i qz = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(z, half), half), zero), one), range));
+			_mm_store_si128((__m128i*)packed, _mm_or_si128(_mm_or_si128(qx, _mm_slli_epi32(qy, 10)), _mm_slli_epi32(qz, 20)));
+		}
+		for (unsigned k = 0; k < 4; k++) {
+			memcpy(dst + (size_t)(i + k) * stride, &packed[k], sizeof(uint32_t));
+		}
+	}
+#endif
+	for (; i < count; i++) {
+		if (format == VERTEX_NORMAL_OCT16) {
+			packOct16(&normals[i](0), dst + (size_t)i * stride);
+		} else {
+			packUnorm10(&normals[i](0), dst + (size_t)i * stride);
+		}
+	}
+}
+
+unsigned getIndexSize(unsigned numVerts) {
+	return numVerts <= 0x10000 ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+bool packIndices(const unsigned* indices, unsigned count, unsigned numVerts, unsigned indexSize, uint8_t* dst) {
+	bool narrow = indexSize == sizeof(uint16_t);
+	if (narrow && numVerts > 0x10000) {
+		return false;
+	}
+	unsigned i = 0;
+#ifdef VERTEXPACK_SSE2
+	// eight indices per iteration, SSE2 has no unsigned compare or pack: compare with the sign bit flipped and
+	// narrow to [-32768, 32767] before the signed saturating pack, then flip the sign bit of the 16 bit values back
+	const __m128i sign32 = _mm_set1_epi32((int)0x80000000);
+	const __m128i limit = _mm_xor_si128(_mm_set1_epi32((int)numVerts), sign32);
+	const __m128i bias32 = _mm_set1_epi32(0x8000);
+	const __m128i sign16 = _mm_set1_epi16((short)0x8000);
+	__m128i valid = _mm_set1_epi32(-1);
+	for (; i + 8 <= count; i += 8) {
+		__m128i a = _mm_loadu_si128((const __m128i*)&indices[i]);
+		__m128i b = _mm_loadu_si128((const __m128i*)&indices[i + 4]);
+		valid = _mm_and_si128(valid, _mm_cmpgt_epi32(limit, _mm_xor_si128(a, sign32)));
+		valid = _mm_and_si128(valid, _mm_cmpgt_epi32(limit, _mm_xor_si128(b, sign32)));
+		if (narrow) {
+			__m128i packed = _mm_packs_epi32(_mm_sub_epi32(a, bias32), _mm_sub_epi32(b, bias32));
+			_mm_storeu_si128((__m128i*)(dst + (size_t)i * sizeof(uint16_t)), _mm_xor_si128(packed, sign16));
+		} else {
+			_mm_storeu_si128((__m128i*)(dst + (size_t)i * sizeof(uint32_t)), a);
+			_mm_storeu_si128((__m128i*)(dst + (size_t)(i + 4) * sizeof(uint32_t)), b);
+		}
+	}
+	if (_mm_movemask_epi8(valid) != 0xFFFF) {
+		return false;
+	}
+#endif
+	for (; i < count; i++) {
+		if (indices[i] >= numVerts) {
+			return false;
+		}
+		if (narrow) {
+			uint16_t index = (uint16_t)indices[i];
+			memcpy(dst + (size_t)i * sizeof(uint16_t), &index, sizeof(index));
+		} else {
+			memcpy(dst + (size_t)i * sizeof(uint32_t), &indices[i], sizeof(uint32_t));
+		}
+	}
+	return true;
+}
+}
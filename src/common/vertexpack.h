@@ -0,0 +1,21 @@
+#pragma once
+#include <stdint.h>
+#include "types_internal.h"
+#include "vec.h"
+
+
+namespace RenderingFramework3D {
+
+// scale and bias mapping the bounding box of the positions to [-1, 1]
+void computePositionDequantization(const MathUtil::Vec<4>* positions, unsigned count, PositionDequantization& dequant);
+
+// write count positions or normals in a vertex storage format, one every stride bytes starting at dst.
+// Quantized values are clamped to the range of the format
+void packPositions(const MathUtil::Vec<4>* positions, unsigned count, VertexPositionFormat format, const PositionDequantization& dequant, uint8_t* dst, unsigned stride);
+void packNormals(const MathUtil::Vec<3>* normals, unsigned count, VertexNormalFormat format, uint8_t* dst, unsigned stride);
+
+// 2 byte indices if every vertex of the mesh can be addressed with them, 4 bytes otherwise
+unsigned getIndexSize(unsigned numVerts);
+// checks count indices against numVerts while writing them to dst as indexSize byte values, false if any is out of range
+bool packIndices(const unsigned* indices, unsigned count, unsigned numVerts, unsigned indexSize, uint8_t* dst);
+}
@@ -0,0 +1,116 @@
+#include "workerpool.h"
+
+
+namespace RenderingFramework3D {
+
+WorkerPool::WorkerPool()
+	:
+	_init(false),
+	_workers(),
+	_mutex(),
+	_cond(),
+	_done_cond(),
+	_loop_mutex(),
+	_stop(false),
+	_fn(nullptr),
+	_count(0),
+	_chunk(1),
+	_generation(0),
+	_next_chunk(0),
+	_active(0)
+{}
+
+WorkerPool::~WorkerPool() {
+	Cleanup();
+}
+
+bool WorkerPool::Initialize(unsigned workers) {
+	if (_init) {
+		return true;
+	}
+	_stop = false;
+	for (unsigned i = 0; i < workers; i++) {
+		_workers.emplace_back(&WorkerPool::workerLoop, this);
+	}
+	_init = true;
+	return true;
+}
+
+void WorkerPool::Cleanup() {
+	if (_init == false) {
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stop = true;
+	}
+	_cond.notify_all();
+	for (auto& worker : _workers) {
+		worker.join();
+	}
+	_workers.clear();
+	_init = false;
+}
+
+unsigned WorkerPool::GetWorkerCount() const {
+	return (unsigned)_workers.size();
+}
+
+void WorkerPool::ParallelFor(size_t count, size_t minChunk, const std::function<void(size_t, size_t)>& fn) {
+	if (count == 0) {
+		return;
+	}
+	minChunk = minChunk ? minChunk : 1;
+	std::unique_lock<std::mutex> loopLock(_loop_mutex, std::try_to_lock);
+	if (_workers.empty() || count < 2 * minChunk || loopLock.owns_lock() == false) {
+		fn(0, count);
+		return;
+	}
+
+	// a few chunks per thread so threads finishing early pick up the rest
+	size_t threads = _workers.size() + 1;
+	size_t chunk = (count + 4 * threads - 1) / (4 * threads);
+	chunk = (chunk + minChunk - 1) / minChunk * minChunk;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_fn = &fn;
+		_count = count;
+		_chunk = chunk;
+		_next_chunk = 0;
+		_active = (unsigned)_workers.size();
+		_generation++;
+	}
+	_cond.notify_all();
+	runChunks();
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_done_cond.wait(lock, [this] { return _active == 0; });
+	_fn = nullptr;
+}
+
+void WorkerPool::runChunks() {
+	size_t chunks = (_count + _chunk - 1) / _chunk;
+	for (size_t i = _next_chunk++; i < chunks; i = _next_chunk++) {
+		size_t begin = i * _chunk;
+		(*_fn)(begin, std::min(begin + _chunk, _count));
+	}
+}
+
+void WorkerPool::workerLoop() {
+	unsigned long long generation = 0;
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (true) {
+		_cond.wait(lock, [this, generation] { return _stop || _generation != generation; });
+		if (_stop) {
+			return;
+		}
+		generation = _generation;
+		lock.unlock();
+		runChunks();
+		lock.lock();
+		if (--_active == 0) {
+			_done_cond.notify_one();
+		}
+	}
+}
+}
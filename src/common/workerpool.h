@@ -0,0 +1,54 @@
+#pragma once
+#include <stddef.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+
+namespace RenderingFramework3D {
+
+// fixed set of threads splitting the range of a loop into chunks, the thread running the loop takes chunks as well.
+// One loop runs at a time, loops started while another one runs are run on the calling thread alone
+class WorkerPool
+{
+public:
+	WorkerPool();
+	~WorkerPool();
+
+	// workers besides the calling thread, 0 runs every loop on the calling thread
+	bool Initialize(unsigned workers);
+	void Cleanup();
+	unsigned GetWorkerCount() const;
+
+	// calls fn(begin, end) on ranges covering [0, count) and returns once all are done. The ranges are multiples of
+	// minChunk items long, except for the last one
+	void ParallelFor(size_t count, size_t minChunk, const std::function<void(size_t, size_t)>& fn);
+
+private:
+	void workerLoop();
+	void runChunks();
+
+private:
+	bool _init;
+	std::vector<std::thread> _workers;
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	std::condition_variable _done_cond;
+	// held by the thread running a loop
+	std::mutex _loop_mutex;
+	bool _stop;
+
+	// the running loop, a new generation wakes the workers
+	const std::function<void(size_t, size_t)>* _fn;
+	size_t _count;
+	size_t _chunk;
+	unsigned long long _generation;
+	std::atomic<size_t> _next_chunk;
+	// workers still running chunks of the current generation
+	unsigned _active;
+};
+}
@@ -0,0 +1,294 @@
+#include <algorithm>
+#include "arena.h"
+#include "devicemgr.h"
+#include "memalloc.h"
+
+
+namespace RenderingFramework3D {
+
+static constexpr unsigned vertex_arena_capacity = 1 << 16;
+static constexpr unsigned index_arena_capacity = 1 << 18;
+
+GeometryArena::GeometryArena()
+	:
+	_buffer(),
+	_usage(0),
+	_element_size(0),
+	_capacity(0),
+	_min_capacity(0),
+	_used(0),
+	_free(),
+	_ranges(),
+	_free_handles(),
+	_dev_id(0)
+{}
+
+GeometryArena::~GeometryArena() {
+	Cleanup();
+}
+
+bool GeometryArena::Initialize(unsigned dev, unsigned elementSize, VkBufferUsageFlags usage, unsigned initialCapacity) {
+	_dev_id = dev;
+	_element_size = elementSize;
+	_usage = usage | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+	_min_capacity = initialCapacity;
+	if (_element_size == 0 || _min_capacity == 0) {
+		return false;
+	}
+	return reallocate(_min_capacity);
+}
+
+void GeometryArena::Cleanup() {
+	MemoryAllocator::DestroyBuffer(_dev_id, _buffer);
+	_capacity = 0;
+	_used = 0;
+	_free.clear();
+	_ranges.clear();
+	_free_handles.clear();
+}
+
+bool GeometryArena::Allocate(const void* data, unsigned count, unsigned& handle) {
+	if (Reserve(count, handle) == false) {
+		return false;
+	}
+	if (upload(data, count, _ranges[handle].offset) == false) {
+		Release(handle);
+		return false;
+	}
+	return true;
+}
+
+bool GeometryArena::Reserve(unsigned count, unsigned& handle) {
+	if (_buffer.vkBuffer == VK_NULL_HANDLE || count == 0) {
+		return false;
+	}
+	unsigned offset;
+	if (findRange(count, offset) == false) {
+		// frames in flight may still read the old buffer
+		if (DeviceManager::WaitIdle(_dev_id) == false) {
+			return false;
+		}
+		unsigned capacity = _capacity;
+		while (capacity - _used < count) {
+			capacity *= 2;
+		}
+		if (reallocate(capacity) == false || findRange(count, offset) == false) {
+			return false;
+		}
+	}
+	if (_free_handles.size()) {
+		handle = _free_handles.back();
+		_free_handles.pop_back();
+	} else {
+		handle = _ranges.size();
+		_ranges.push_back({});
+	}
+	_ranges[handle] = { offset, count };
+	_used += count;
+	return true;
+}
+
+void GeometryArena::Free(unsigned handle) {
+	if (handle >= _ranges.size() || _ranges[handle].count == 0) {
+		return;
+	}
+	Release(handle);
+
+	// compact when less than half of the free space is in one piece, shrink when mostly empty
+	unsigned largest = 0;
+	for (const auto& range : _free) {
+		largest = std::max(largest, range.count);
+	}
+	unsigned freeCount = _capacity - _used;
+	unsigned capacity = _capacity;
+	while (capacity / 2 >= _min_capacity && capacity / 4 >= _used) {
+		capacity /= 2;
+	}
+	if (capacity != _capacity || largest * 2 < freeCount) {
+		reallocate(capacity);
+	}
+}
+
+void GeometryArena::Release(unsigned handle) {
+	if (handle >= _ranges.size() || _ranges[handle].count == 0) {
+		return;
+	}
+	releaseRange(_ranges[handle]);
+	_used -= _ranges[handle].count;
+	_ranges[handle] = { 0, 0 };
+	_free_handles.push_back(handle);
+}
+
+VkBuffer GeometryArena::GetBuffer() const {
+	return _buffer.vkBuffer;
+}
+
+unsigned GeometryArena::GetOffset(unsigned handle) const {
+	return handle < _ranges.size() ? _ranges[handle].offset : 0;
+}
+
+unsigned GeometryArena::GetElementSize() const {
+	return _element_size;
+}
+
+bool GeometryArena::findRange(unsigned count, unsigned& offset) {
+	// first fit keeps the arena packed towards its start
+	for (unsigned i = 0; i < _free.size(); i++) {
+		if (_free[i].count < count) {
+			continue;
+		}
+		offset = _free[i].offset;
+		_free[i].offset += count;
+		_free[i].count -= count;
+		if (_free[i].count == 0) {
+			_free.erase(_free.begin() + i);
+		}
+		return true;
+	}
+	return false;
+}
+
+void GeometryArena::releaseRange(const Range& range) {
+	Range merged = range;
+	auto it = std::lower_bound(_free.begin(), _free.end(), merged, [](const Range& a, const Range& b) { return a.offset < b.offset; });
+	if (it != _free.end() && merged.offset + merged.count == it->offset) {
+		merged.count += it->count;
+		it = _free.erase(it);
+	}
+	if (it != _free.begin() && (it - 1)->offset + (it - 1)->count == merged.offset) {
+		(it - 1)->count += merged.count;
+	} else {
+		_free.insert(it, merged);
+	}
+}
+
+bool GeometryArena::reallocate(unsigned capacity) {
+	BufferResources buffer;
+	if (MemoryAllocator::CreateBuffer(_dev_id, (VkDeviceSize)capacity * _element_size, _usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, buffer, true) == false) {
+		printf("failed to create geometry arena buffer\n");
+		return false;
+	}
+
+	// live ranges keep their order and are packed at the start of the new buffer
+	std::vector<unsigned> order;
+	for (unsigned i = 0; i < _ranges.size(); i++) {
+		if (_ranges[i].count) {
+			order.push_back(i);
+		}
+	}
+	std::sort(order.begin(), order.end(), [this](unsigned a, unsigned b) { return _ranges[a].offset < _ranges[b].offset; });
+
+	std::vector<VkBufferCopy> regions;
+	unsigned offset = 0;
+	for (unsigned handle : order) {
+		Range& range = _ranges[handle];
+		VkBufferCopy region{};
+		region.srcOffset = (VkDeviceSize)range.offset * _element_size;
+		region.dstOffset = (VkDeviceSize)offset * _element_size;
+		region.size = (VkDeviceSize)range.count * _element_size;
+		// ranges that were already adjacent are copied as one region
+		if (regions.size() && regions.back().srcOffset + regions.back().size == region.srcOffset) {
+			regions.back().size += region.size;
+		} else {
+			regions.push_back(region);
+		}
+		range.offset = offset;
+		offset += range.count;
+	}
+	if (regions.size() && DeviceManager::CopyBuffer(_dev_id, _buffer.vkBuffer, buffer.vkBuffer, regions) == false) {
+		MemoryAllocator::DestroyBuffer(_dev_id, buffer);
+		return false;
+	}
+
+	MemoryAllocator::DestroyBuffer(_dev_id, _buffer);
+	_buffer = buffer;
+	_capacity = capacity;
+	_free.clear();
+	if (offset < _capacity) {
+		_free.push_back({ offset, _capacity - offset });
+	}
+	return true;
+}
+
+bool GeometryArena::upload(const void* data, unsigned count, unsigned offset) {
+	VkDeviceSize size = (VkDeviceSize)count * _element_size;
+	BufferResources staging;
+	if (MemoryAllocator::CreateBuffer(_dev_id, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, staging) == false) {
+		printf("failed to create geometry arena staging buffer\n");
+		return false;
+	}
+	memcpy(staging.memory.mapped, data, size);
+
+	VkBufferCopy region{};
+	region.srcOffset = 0;
+	region.dstOffset = (VkDeviceSize)offset * _element_size;
+	region.size = size;
+	bool ret = DeviceManager::CopyBuffer(_dev_id, staging.vkBuffer, _buffer.vkBuffer, std::vector<VkBufferCopy>{ region });
+	MemoryAllocator::DestroyBuffer(_dev_id, staging);
+	return ret;
+}
+
+
+MeshArenas::MeshArenas()
+	:
+	_enabled(false),
+	_vertex_arenas(),
+	_index_arenas(),
+	_dev_id(0)
+{}
+
+void MeshArenas::Initialize(unsigned dev) {
+	_dev_id = dev;
+}
+
+void MeshArenas::Cleanup() {
+	_vertex_arenas.clear();
+	for (auto& arena : _index_arenas) {
+		arena.reset();
+	}
+}
+
+void MeshArenas::SetEnabled(bool enable) {
+	_enabled = enable;
+}
+
+bool MeshArenas::IsEnabled() const {
+	return _enabled;
+}
+
+GeometryArena* MeshArenas::GetVertexArena(unsigned stride, unsigned& arenaIdx) {
+	for (unsigned i = 0; i < _vertex_arenas.size(); i++) {
+		if (_vertex_arenas[i]->GetElementSize() == stride) {
+			arenaIdx = i;
+			return _vertex_arenas[i].get();
+		}
+	}
+	auto arena = std::make_unique<GeometryArena>();
+	if (arena->Initialize(_dev_id, stride, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, vertex_arena_capacity) == false) {
+		return nullptr;
+	}
+	arenaIdx = _vertex_arenas.size();
+	_vertex_arenas.push_back(std::move(arena));
+	return _vertex_arenas.back().get();
+}
+
+GeometryArena* MeshArenas::GetIndexArena(unsigned indexSize) {
+	std::unique_ptr<GeometryArena>& indexArena = _index_arenas[indexSize == sizeof(uint16_t) ? 0 : 1];
+	if (indexArena == nullptr) {
+		auto arena = std::make_unique<GeometryArena>();
+		if (arena->Initialize(_dev_id, indexSize == sizeof(uint16_t) ? sizeof(uint16_t) : sizeof(uint32_t), VK_BUFFER_USAGE_INDEX_BUFFER_BIT, index_arena_capacity) == false) {
+			return nullptr;
+		}
+		indexArena = std::move(arena);
+	}
+	return indexArena.get();
+}
+
+GeometryArena* MeshArenas::FindVertexArena(unsigned arenaIdx) const {
+	return arenaIdx < _vertex_arenas.size() ? _vertex_arenas[arenaIdx].get() : nullptr;
+}
+
+GeometryArena* MeshArenas::FindIndexArena(unsigned indexSize) const {
+	return _index_arenas[indexSize == sizeof(uint16_t) ? 0 : 1].get();
+}
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "util.h"
+
+
+namespace RenderingFramework3D {
+
+// device local buffer shared by many static meshes, ranges are counted in elements of a fixed size so draws can
+// address them with vertexOffset/firstIndex. Ranges are referred to by handle, growing and compacting the arena moves them
+class GeometryArena
+{
+public:
+	GeometryArena();
+	~GeometryArena();
+
+	bool Initialize(unsigned dev, unsigned elementSize, VkBufferUsageFlags usage, unsigned initialCapacity);
+	void Cleanup();
+
+	// uploads count elements, grows the buffer (waiting for the device) if no free range fits
+	bool Allocate(const void* data, unsigned count, unsigned& handle);
+	// same without uploading, the range is filled later by an asynchronous upload
+	bool Reserve(unsigned count, unsigned& handle);
+	// the device must be idle, compacts the arena once most of its free space is scattered between ranges
+	void Free(unsigned handle);
+	// frees without compacting, the buffer stays in place for frames in flight. For ranges given up right after
+	// Allocate or Reserve
+	void Release(unsigned handle);
+
+	VkBuffer GetBuffer() const;
+	unsigned GetOffset(unsigned handle) const;
+	unsigned GetElementSize() const;
+
+private:
+	struct Range {
+		unsigned offset;
+		unsigned count;
+	};
+	bool findRange(unsigned count, unsigned& offset);
+	void releaseRange(const Range& range);
+	// moves every live range to the start of a new buffer of the given capacity
+	bool reallocate(unsigned capacity);
+	bool upload(const void* data, unsigned count, unsigned offset);
+
+private:
+	BufferResources _buffer;
+	VkBufferUsageFlags _usage;
+	unsigned _element_size;
+	unsigned _capacity;
+	unsigned _min_capacity;
+	unsigned _used;
+
+	// free ranges sorted by offset, neighbours are always merged
+	std::vector<Range> _free;
+	// live ranges by handle, count 0 if the handle is unused
+	std::vector<Range> _ranges;
+	std::vector<unsigned> _free_handles;
+
+	unsigned _dev_id;
+};
+
+// the renderer's shared geometry: one vertex arena per vertex stride and one index arena per index size (16 and 32 bit)
+class MeshArenas
+{
+public:
+	MeshArenas();
+
+	void Initialize(unsigned dev);
+	void Cleanup();
+
+	// static meshes loaded while enabled are placed in the arenas, meshes already loaded keep their buffers
+	void SetEnabled(bool enable);
+	bool IsEnabled() const;
+
+	// created on first use
+	GeometryArena* GetVertexArena(unsigned stride, unsigned& arenaIdx);
+	GeometryArena* GetIndexArena(unsigned indexSize);
+	// nullptr if the arena doesn't exist (anymore)
+	GeometryArena* FindVertexArena(unsigned arenaIdx) const;
+	GeometryArena* FindIndexArena(unsigned indexSize) const;
+
+private:
+	bool _enabled;
+	std::vector<std::unique_ptr<GeometryArena>> _vertex_arenas;
+	std::unique_ptr<GeometryArena> _index_arenas[2];
+	unsigned _dev_id;
+};
+}
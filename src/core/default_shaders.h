@@ -1,33 +1,44 @@
 #pragma once
 #include <vector>
 
+// generated from the shaders in defaultshaders by defaultshaders/embed_shaders.cmake, do not edit
+
 namespace RenderingFramework3D {
-//Lit Vertex shader code
+//Lit vertex shader
+
 //#version 450
 //
 //layout(location = 0) in vec4 inPosition;
-//layout(location = 1) in vec3 inNormal;
+////float xyz, or packed as selected by normalEncoding
+//layout(location = 1) in vec4 inNormal;
 //
-//layout(location = 1) out vec4 outPosition;
-//layout(location = 2) out vec3 outNormal;
-//layout(location = 3) out vec3 outLightDir;
-//layout(location = 4) out vec3 outCamPosition;
+////0 = float xyz, 1 = unorm xyz (10:10:10:2), 2 = octahedral xy (snorm 2x16), see VertexNormalFormat
+//layout(constant_id = 0) const int normalEncoding = 0;
+//
+//layout(location = 0) out vec4 outPosition;
+//layout(location = 1) out vec3 outNormal;
 //
 //layout(set = 0, binding = 0) uniform TransformUniformBufferObject {
-//    mat4 objToWorld;
-////	mat4 worldToCam;
-////	mat4 CamToScreen;
-//	mat4 objToScreen;
+//    mat4 objToWorld;	//enable uniformShaderInputLayout.ObjectInputs.useObjToWorldTransform in pipeline configuration
+////	mat4 worldToCam;	//enable uniformShaderInputLayout.ObjectInputs.useWorldToCamTransform in pipeline configuration
+////	mat4 CamToScreen;	//enable uniformShaderInputLayout.ObjectInputs.useCamToScreenTransform in pipeline configuration
+//	mat4 objToScreen;	//enable uniformShaderInputLayout.ObjectInputs.useObjToScreenTransform in pipeline configuration
 //	vec4 objectScale;
 //};
 //
-//layout(set = 0, binding = 2) uniform CameraUniformBufferObject {
-//	mat4 camTransform;
-//};
 //
-//layout(set = 1, binding = 0) uniform LightUniformBufferObject {
-//	vec3 inLightDir;
-//};
+//vec3 decodeNormal() {
+//	vec3 normal = inNormal.xyz;
+//	if (normalEncoding == 1) {
+//		normal = normal * 2.0 - 1.0;
+//	} else if (normalEncoding == 2) {
+//		normal = vec3(inNormal.xy, 1.0 - abs(inNormal.x) - abs(inNormal.y));
+//		float t = max(-normal.z, 0.0);
+//		normal.xy += mix(vec2(t), vec2(-t), greaterThanEqual(normal.xy, vec2(0.0)));
+//		normal = normalize(normal);
+//	}
+//	return normal;
+//}
 //
 //void main() {
 //	vec4 scaledPosition = objectScale * inPosition;
@@ -35,130 +46,166 @@ namespace RenderingFramework3D {
 //
 //	mat3 objToWorld3d = mat3(objToWorld[0].xyz, objToWorld[1].xyz, objToWorld[2].xyz);
 //	outPosition = objToWorld * scaledPosition;
-//	outNormal = objToWorld3d * inNormal;
-//	outLightDir = inLightDir;
-//	outCamPosition = camTransform[3].xyz;
+//	outNormal = objToWorld3d * decodeNormal();
 //}
 std::vector<uint8_t> litVertShaderBin = {
-    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x4e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,
-    0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,0x2e,
-    0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x1,
-    0x0,0x0,0x0,0xf,0x0,0xa,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,
-    0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x48,0x0,0x0,0x0,0x4b,
-    0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,0x47,
-    0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,0x6c,
-    0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,0x47,
-    0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,0x72,
-    0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,
-    0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x9,0x0,0x0,0x0,0x73,0x63,0x61,0x6c,0x65,0x64,0x50,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0xa,0x0,0xb,0x0,0x0,0x0,0x54,0x72,0x61,0x6e,0x73,
-    0x66,0x6f,0x72,0x6d,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,
-    0x65,0x63,0x74,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,
-    0x62,0x6a,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x0,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x1,
-    0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x53,0x63,0x72,0x65,0x65,0x6e,0x0,0x6,0x0,0x6,0x0,0xb,
-    0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x6f,0x62,0x6a,0x65,0x63,0x74,0x53,0x63,0x61,0x6c,0x65,0x0,0x5,
-    0x0,0x3,0x0,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x14,0x0,0x0,0x0,0x69,
-    0x6e,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x67,
-    0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x1a,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x6,
-    0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,
-    0x69,0x7a,0x65,0x0,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,
-    0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x0,0x6,0x0,0x7,0x0,0x1a,
-    0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,
-    0x63,0x65,0x0,0x5,0x0,0x3,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x29,
-    0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x33,0x64,0x0,0x0,0x0,0x0,0x5,
-    0x0,0x5,0x0,0x42,0x0,0x0,0x0,0x6f,0x75,0x74,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x5,
-    0x0,0x5,0x0,0x48,0x0,0x0,0x0,0x6f,0x75,0x74,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x5,
-    0x0,0x5,0x0,0x4b,0x0,0x0,0x0,0x69,0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x0,0x48,
-    0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0xb,
-    0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x1,
-    0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x1,
-    0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x2,
-    0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0xb,0x0,0x0,0x0,0x2,
-    0x0,0x0,0x0,0x47,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,
-    0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x14,
-    0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x1,
-    0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x2,
-    0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x3,
-    0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x1a,0x0,0x0,0x0,0x2,
-    0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x42,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,
-    0x0,0x4,0x0,0x48,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x4b,
-    0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,0x21,
-    0x0,0x3,0x0,0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,0x20,
-    0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x20,
-    0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0xa,
-    0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1e,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0xa,
-    0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0x2,
-    0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x2,
-    0x0,0x0,0x0,0x15,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,
-    0x0,0x4,0x0,0xe,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x10,
-    0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x1,
-    0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1,
-    0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,
-    0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1c,0x0,0x4,0x0,0x19,
-    0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x7,
-    0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x1b,
-    0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,0x1c,
-    0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x20,
-    0x0,0x4,0x0,0x1f,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x24,
-    0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x6,
-    0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x3,
-    0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x28,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x2b,
-    0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x2b,0x0,0x4,0x0,0x6,
-    0x0,0x0,0x0,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x24,0x0,0x0,0x0,0x42,
-    0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x47,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x26,
-    0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x47,0x0,0x0,0x0,0x48,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,
-    0x0,0x4,0x0,0x4a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x4a,
-    0x0,0x0,0x0,0x4b,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x36,0x0,0x5,0x0,0x2,0x0,0x0,0x0,0x4,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5,0x0,0x0,0x0,0x3b,
-    0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x28,
-    0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x11,
-    0x0,0x0,0x0,0xd,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x12,
-    0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x14,
-    0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x15,
-    0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x1f,
-    0x0,0x0,0x0,0x20,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xa,
-    0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x22,
-    0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x21,
-    0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x24,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x1c,
-    0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x25,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x41,
-    0x0,0x6,0x0,0x10,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x1d,
-    0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x4f,
-    0x0,0x8,0x0,0x26,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x41,0x0,0x6,0x0,0x10,0x0,0x0,0x0,0x2d,
-    0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,
-    0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,0x4f,0x0,0x8,0x0,0x26,0x0,0x0,0x0,0x2f,
-    0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,
-    0x0,0x0,0x0,0x41,0x0,0x6,0x0,0x10,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,
-    0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x30,
-    0x0,0x0,0x0,0x4f,0x0,0x8,0x0,0x26,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x31,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,
-    0x0,0x0,0x0,0x35,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,
-    0x0,0x0,0x0,0x36,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,
-    0x0,0x0,0x0,0x37,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,
-    0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,
-    0x0,0x0,0x0,0x39,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,
-    0x0,0x0,0x0,0x3a,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,
-    0x0,0x0,0x0,0x3b,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,
-    0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,
-    0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x26,
-    0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0x35,0x0,0x0,0x0,0x36,0x0,0x0,0x0,0x37,0x0,0x0,0x0,0x50,
-    0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x39,0x0,0x0,0x0,0x3a,
-    0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3b,0x0,0x0,0x0,0x3c,
-    0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x27,0x0,0x0,0x0,0x41,0x0,0x0,0x0,0x3e,
-    0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x29,0x0,0x0,0x0,0x41,
-    0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x1f,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,
-    0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0x3d,
-    0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x7,
-    0x0,0x0,0x0,0x46,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x42,
-    0x0,0x0,0x0,0x46,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x49,0x0,0x0,0x0,0x29,
-    0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0x4b,0x0,0x0,0x0,0x91,
-    0x0,0x5,0x0,0x26,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,0x49,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0x3e,
-    0x0,0x3,0x0,0x48,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x72,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0xa,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x48,0x0,0x0,0x0,
+    0x4b,0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,
+    0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,
+    0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,
+    0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,
+    0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x9,0x0,0x0,0x0,0x73,0x63,0x61,0x6c,0x65,0x64,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0xa,0x0,0xb,0x0,0x0,0x0,0x54,0x72,0x61,0x6e,
+    0x73,0x66,0x6f,0x72,0x6d,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,
+    0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x6f,0x62,0x6a,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x0,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x53,0x63,0x72,0x65,0x65,0x6e,0x0,0x6,0x0,0x6,0x0,
+    0xb,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x6f,0x62,0x6a,0x65,0x63,0x74,0x53,0x63,0x61,0x6c,0x65,0x0,
+    0x5,0x0,0x3,0x0,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x14,0x0,0x0,0x0,
+    0x69,0x6e,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,
+    0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,
+    0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,
+    0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x0,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x0,0x6,0x0,0x7,0x0,
+    0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x0,0x5,0x0,0x3,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,
+    0x29,0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x33,0x64,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x5,0x0,0x42,0x0,0x0,0x0,0x6f,0x75,0x74,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,
+    0x5,0x0,0x5,0x0,0x48,0x0,0x0,0x0,0x6f,0x75,0x74,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,
+    0x5,0x0,0x5,0x0,0x4b,0x0,0x0,0x0,0x69,0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x0,
+    0x48,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x4,0x0,
+    0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0xb,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x14,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x1a,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x42,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x48,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x4b,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x51,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,
+    0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x8,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0xa,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1e,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x15,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0xe,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x10,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x15,0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x17,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1c,0x0,0x4,0x0,0x19,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x1f,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x24,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x28,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x24,0x0,0x0,0x0,0x42,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x47,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x26,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x47,0x0,0x0,0x0,0x48,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x4a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x14,0x0,0x2,0x0,0x4e,0x0,0x0,0x0,
+    0x17,0x0,0x4,0x0,0x4f,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x50,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x32,0x0,0x4,0x0,0xe,0x0,0x0,0x0,
+    0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x52,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x54,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x56,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2c,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x57,0x0,0x0,0x0,
+    0x55,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x50,0x0,0x0,0x0,
+    0x4b,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x36,0x0,0x5,0x0,0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x28,0x0,0x0,0x0,
+    0x29,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x12,0x0,0x0,0x0,
+    0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x14,0x0,0x0,0x0,
+    0x85,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x15,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x1f,0x0,0x0,0x0,
+    0x20,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xa,0x0,0x0,0x0,
+    0x21,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x22,0x0,0x0,0x0,
+    0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x21,0x0,0x0,0x0,
+    0x22,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x24,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,
+    0x1d,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x25,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x41,0x0,0x6,0x0,
+    0x10,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x4f,0x0,0x8,0x0,
+    0x26,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x41,0x0,0x6,0x0,0x10,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,
+    0x2e,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,0x4f,0x0,0x8,0x0,0x26,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,
+    0x2e,0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x41,0x0,0x6,0x0,0x10,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0xf,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x30,0x0,0x0,0x0,
+    0x4f,0x0,0x8,0x0,0x26,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x31,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x35,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x36,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x37,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x38,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x39,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x3a,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x3b,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x3c,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x3d,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x26,0x0,0x0,0x0,
+    0x3e,0x0,0x0,0x0,0x35,0x0,0x0,0x0,0x36,0x0,0x0,0x0,0x37,0x0,0x0,0x0,0x50,0x0,0x6,0x0,
+    0x26,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x39,0x0,0x0,0x0,0x3a,0x0,0x0,0x0,
+    0x50,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3b,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,
+    0x3d,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x27,0x0,0x0,0x0,0x41,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,
+    0x3f,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x29,0x0,0x0,0x0,0x41,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x1f,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x7,0x0,0x0,0x0,
+    0x46,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x42,0x0,0x0,0x0,
+    0x46,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x49,0x0,0x0,0x0,0x29,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x4b,0x0,0x0,0x0,0x4f,0x0,0x8,0x0,
+    0x26,0x0,0x0,0x0,0x59,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x8e,0x0,0x5,0x0,0x26,0x0,0x0,0x0,0x5a,0x0,0x0,0x0,
+    0x59,0x0,0x0,0x0,0x56,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x26,0x0,0x0,0x0,0x5b,0x0,0x0,0x0,
+    0x5a,0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,
+    0x58,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,
+    0x58,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x6,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x6,0x0,0x0,0x0,
+    0x5f,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x81,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0x83,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x61,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x7f,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x62,0x0,0x0,0x0,0x61,0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,
+    0x63,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x62,0x0,0x0,0x0,0x54,0x0,0x0,0x0,
+    0x7f,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x63,0x0,0x0,0x0,0xbe,0x0,0x5,0x0,
+    0x4e,0x0,0x0,0x0,0x65,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,0x54,0x0,0x0,0x0,0xa9,0x0,0x6,0x0,
+    0x6,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x65,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x63,0x0,0x0,0x0,
+    0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,0x66,0x0,0x0,0x0,
+    0xbe,0x0,0x5,0x0,0x4e,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x54,0x0,0x0,0x0,
+    0xa9,0x0,0x6,0x0,0x6,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x64,0x0,0x0,0x0,
+    0x63,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,
+    0x69,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x67,0x0,0x0,0x0,
+    0x6a,0x0,0x0,0x0,0x61,0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x6c,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0xaa,0x0,0x5,0x0,0x4e,0x0,0x0,0x0,
+    0x6d,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0xaa,0x0,0x5,0x0,0x4e,0x0,0x0,0x0,
+    0x6e,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x4f,0x0,0x0,0x0,
+    0x6f,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x50,0x0,0x6,0x0,
+    0x4f,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x6e,0x0,0x0,0x0,0x6e,0x0,0x0,0x0,0x6e,0x0,0x0,0x0,
+    0xa9,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x71,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x5b,0x0,0x0,0x0,
+    0x59,0x0,0x0,0x0,0xa9,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0x6f,0x0,0x0,0x0,
+    0x6c,0x0,0x0,0x0,0x71,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x26,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,
+    0x49,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,
+    0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,
 };
 
 //Lit fragment shader
@@ -166,28 +213,120 @@ std::vector<uint8_t> litVertShaderBin = {
 //#version 450
 //
 //
-//layout(location = 1) in vec4 inPosition;
-//layout(location = 2) in vec3 inNormal;
-//layout(location = 3) in vec3 inLightDir;
-//layout(location = 4) in vec3 inCamPosition;
+//layout(location = 0) in vec4 inPosition;
+//layout(location = 1) in vec3 inNormal;
 //
 //
 //layout(location = 0) out vec4 outColour;
 //
 //
-//layout(set = 0, binding = 1) uniform CameraUniformBufferObject {
+////enable uniformShaderInputLayout.ObjectInputs.useMaterialData in pipeline configuration
+//layout(set = 0, binding = 1) uniform materialUniformBufferObject {
 //	vec4 objColour;
-//	float ambientConstant;
 //	float diffuseConstant;
 //	float specularConstant;
 //	float shininess;
 //};
 //
+////enable uniformShaderInputLayout.ObjectInputs.useCamTransform in pipeline configuration
+//layout(set = 0, binding = 2) uniform CameraUniformBufferObject {
+//	mat4 camTransform;
+//};
+//
+////enable uniformShaderInputLayout.GlobalInputs.useDirectionalLight in pipeline configuration
+//layout(set = 1, binding = 0) uniform LightUniformBufferObject {
+//	vec4 lightColour;
+//	vec3 lightDirection;
+//	float lightIntensity;
+//	float ambientLightIntensity;
+//};
+//
+//
+//vec4 rgb_to_hsv(vec4 rgb) { 
+//  
+//    // R, G, B values are divided by 255 
+//    // to change the range from 0..255 to 0..1 
+//	
+//
+//    // h, s, v = hue, saturation, value 
+//    float cmax = max(rgb.r, max(rgb.g, rgb.b)); // maximum of r, g, b 
+//    float cmin = min(rgb.r, min(rgb.g, rgb.b)); // minimum of r, g, b 
+//    float diff = cmax - cmin; // diff of cmax and cmin. 
+//	
+//	vec4 hsv = rgb;
+//    // if cmax and cmax are equal then h = 0 
+//    if (cmax == cmin) {
+//        hsv[0] = 0; 
+//	}
+//  
+//    // if cmax equal r then compute h 
+//    else if (cmax == rgb.r) 
+//        hsv[0] = mod(60 * ((rgb.g - rgb.b) / diff) + 360, 360); 
+//  
+//    // if cmax equal g then compute h 
+//    else if (cmax == rgb.g) 
+//        hsv[0] = mod(60 * ((rgb.b - rgb.r) / diff) + 120, 360); 
+//  
+//    // if cmax equal b then compute h 
+//    else if (cmax == rgb.b) 
+//        hsv[0] = mod(60 * ((rgb.r - rgb.g) / diff) + 240, 360); 
+//  
+//    // if cmax equal zero 
+//    if (cmax == 0) 
+//        hsv[1] = 0; 
+//    else
+//        hsv[1] = (diff / cmax); 
+//  
+//    // compute v 
+//    hsv[2] = cmax; 
+//
+//	return hsv;
+//} 
+//
+//vec4 hsv_to_rgb(vec4 hsv) {
+//    // Normalize H to [0, 360]
+//    while (hsv[0] < 0) hsv[0] += 360.0f;
+//    while (hsv[0] >= 360) hsv[0] -= 360.0f;
+//
+//    vec4 rgb = hsv;
+//
+//    if (hsv[1] <= 0.0f) {
+//        // If saturation is 0, color is grayscale
+//        rgb[0] = hsv[2];
+//        rgb[1] = hsv[2];
+//        rgb[2] = hsv[2];
+//    } else {
+//        float C = hsv[2] * hsv[1];            // Chroma
+//        float X = C * (1.0f - abs(mod(hsv[0] / 60.0f, 2) - 1.0f)); // Second largest component
+//        float m = hsv[2] - C;
+//
+//        if (hsv[0] < 60) {
+//            rgb[0] = C; rgb[1] = X; rgb[2] = 0;
+//        } else if (hsv[0] < 120) {
+//            rgb[0] = X; rgb[1] = C; rgb[2] = 0;
+//        } else if (hsv[0] < 180) {
+//            rgb[0] = 0; rgb[1] = C; rgb[2] = X;
+//        } else if (hsv[0] < 240) {
+//            rgb[0] = 0; rgb[1] = X; rgb[2] = C;
+//        } else if (hsv[0] < 300) {
+//            rgb[0] = X; rgb[1] = 0; rgb[2] = C;
+//        } else {
+//            rgb[0] = C; rgb[1] = 0; rgb[2] = X;
+//        }
+//
+//        // Add the adjustment factor (m) to bring the RGB values to the correct range
+//        rgb[0] += m;
+//        rgb[1] += m;
+//        rgb[2] += m;
+//    }
+//
+//    return rgb;
+//}
 //
 //void main() {
-//	vec3 to_light = -inLightDir;
+//	vec3 to_light = -lightDirection;
 //	vec3 reflection = 2.0 * dot(inNormal,to_light) * inNormal - to_light;
-//	vec3 to_camera = inCamPosition - inPosition.xyz;
+//	vec3 to_camera = camTransform[3].xyz - inPosition.xyz;
 //
 //	reflection = normalize( reflection );
 //	to_camera = normalize( to_camera );
@@ -196,475 +335,486 @@ std::vector<uint8_t> litVertShaderBin = {
 //	cos_angle = clamp(cos_angle, 0.0, 1.0);
 //	cos_angle = pow(cos_angle, shininess);
 //
+//	outColour = vec4(lightColour.xyz*objColour.xyz,objColour.w); 
+//	
 //	float specular_scale = specularConstant*cos_angle;
-//	float ambient_scale = ambientConstant;
 //	float diffuse_scale = diffuseConstant*clamp(dot(to_light, inNormal),0,1);
 //
-//	outColour = vec4((ambient_scale+diffuse_scale+specular_scale)/3 * objColour.xyz, objColour.w);
+//    float intensity = specular_scale + diffuse_scale;
+//    intensity = intensity+ambientLightIntensity;
+//
+//	float perscieved_intensity = log(1+intensity)/log(1+lightIntensity);
+//	if (perscieved_intensity > 1.0) {
+//		perscieved_intensity = 1.0;
+//	} else if (perscieved_intensity < 0) {
+//		perscieved_intensity = 0;
+//	}
+//
+//    vec4 outColour_hsv = rgb_to_hsv(outColour);
+//    outColour_hsv.z = perscieved_intensity;
+//    outColour = hsv_to_rgb(outColour_hsv);
 //}
 std::vector<uint8_t> litFragShaderBin = {
-0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x7b,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x11,
-0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,0x2e,
-0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x1,
-0x0,0x0,0x0,0xf,0x0,0x8,0x0,0x4,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,
-0x0,0x0,0x0,0x1c,0x1,0x0,0x0,0x31,0x1,0x0,0x0,0x48,0x1,0x0,0x0,0x10,0x0,0x3,0x0,0x4,
-0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,
-0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,
-0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,
-0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
-0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,
-0x61,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x72,0x67,0x62,0x5f,0x74,
-0x6f,0x5f,0x68,0x73,0x76,0x28,0x76,0x66,0x34,0x3b,0x0,0x5,0x0,0x3,0x0,0xa,0x0,0x0,0x0,0x72,
-0x67,0x62,0x0,0x5,0x0,0x6,0x0,0xe,0x0,0x0,0x0,0x68,0x73,0x76,0x5f,0x74,0x6f,0x5f,0x72,0x67,
-0x62,0x28,0x76,0x66,0x34,0x3b,0x0,0x5,0x0,0x3,0x0,0xd,0x0,0x0,0x0,0x68,0x73,0x76,0x0,0x5,
-0x0,0x4,0x0,0x11,0x0,0x0,0x0,0x63,0x6d,0x61,0x78,0x0,0x0,0x0,0x0,0x5,0x0,0x4,0x0,0x1e,
-0x0,0x0,0x0,0x63,0x6d,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x64,
-0x69,0x66,0x66,0x0,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0x2b,0x0,0x0,0x0,0x68,0x73,0x76,0x0,0x5,
-0x0,0x3,0x0,0x96,0x0,0x0,0x0,0x72,0x67,0x62,0x0,0x5,0x0,0x3,0x0,0xa7,0x0,0x0,0x0,0x43,
-0x0,0x0,0x0,0x5,0x0,0x3,0x0,0xad,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0xb9,
-0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x10,0x1,0x0,0x0,0x74,0x6f,0x5f,0x6c,0x69,
-0x67,0x68,0x74,0x0,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x11,0x1,0x0,0x0,0x4c,0x69,0x67,0x68,0x74,
-0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,
-0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x11,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x6c,0x69,0x67,0x68,0x74,
-0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x6,0x0,0x7,0x0,0x11,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x6c,
-0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x0,0x0,0x6,0x0,0x7,0x0,0x11,
-0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x6c,0x69,0x67,0x68,0x74,0x49,0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,
-0x79,0x0,0x0,0x6,0x0,0x9,0x0,0x11,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x61,0x6d,0x62,0x69,0x65,
-0x6e,0x74,0x4c,0x69,0x67,0x68,0x74,0x49,0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,0x79,0x0,0x0,0x0,0x5,
-0x0,0x3,0x0,0x13,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x1a,0x1,0x0,0x0,0x72,
-0x65,0x66,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x5,0x0,0x1c,0x1,0x0,0x0,0x69,
-0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x25,0x1,0x0,0x0,0x74,
-0x6f,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x27,0x1,0x0,0x0,0x43,
-0x61,0x6d,0x65,0x72,0x61,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,
-0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x63,
-0x61,0x6d,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x0,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0x29,
-0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x31,0x1,0x0,0x0,0x69,0x6e,0x50,0x6f,0x73,
-0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x5,0x0,0x39,0x1,0x0,0x0,0x63,0x6f,0x73,0x5f,0x61,
-0x6e,0x67,0x6c,0x65,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x40,0x1,0x0,0x0,0x6d,0x61,0x74,0x65,0x72,
-0x69,0x61,0x6c,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,
-0x63,0x74,0x0,0x6,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x43,0x6f,
-0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x40,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x64,
-0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x6,0x0,0x8,0x0,0x40,
-0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6e,0x73,0x74,
-0x61,0x6e,0x74,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x73,
-0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0x42,0x1,0x0,0x0,0x0,
-0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x48,0x1,0x0,0x0,0x6f,0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,
-0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x57,0x1,0x0,0x0,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x5f,
-0x73,0x63,0x61,0x6c,0x65,0x0,0x0,0x5,0x0,0x6,0x0,0x5d,0x1,0x0,0x0,0x64,0x69,0x66,0x66,0x75,
-0x73,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x65,0x1,0x0,0x0,0x69,
-0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,0x79,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x72,0x1,0x0,0x0,0x6f,
-0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x5f,0x68,0x73,0x76,0x0,0x0,0x0,0x5,0x0,0x4,0x0,0x73,
-0x1,0x0,0x0,0x70,0x61,0x72,0x61,0x6d,0x0,0x0,0x0,0x5,0x0,0x4,0x0,0x78,0x1,0x0,0x0,0x70,
-0x61,0x72,0x61,0x6d,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x23,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x23,
-0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x23,
-0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x23,
-0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x11,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x47,
-0x0,0x4,0x0,0x13,0x1,0x0,0x0,0x22,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x13,
-0x1,0x0,0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x1c,0x1,0x0,0x0,0x1e,
-0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x5,
-0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,
-0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x27,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x29,
-0x1,0x0,0x0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x29,0x1,0x0,0x0,0x21,
-0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x31,0x1,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x10,
-0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x14,
-0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x18,
-0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x40,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x42,
-0x1,0x0,0x0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x42,0x1,0x0,0x0,0x21,
-0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x48,0x1,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,0x2,
-0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x7,
-0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x7,
-0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x21,0x0,0x4,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x8,
-0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x15,
-0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x12,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x16,
-0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x2,
-0x0,0x0,0x0,0x14,0x0,0x2,0x0,0x2f,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x33,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x0,
-0x0,0x70,0x42,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x0,0x0,0xb4,0x43,0x2b,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x0,0x0,0xf0,0x42,0x2b,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x0,0x0,0x70,0x43,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xaf,
-0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xb3,0x0,0x0,0x0,0x0,
-0x0,0x0,0x40,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xd6,0x0,0x0,0x0,0x0,0x0,0x34,0x43,0x2b,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xed,0x0,0x0,0x0,0x0,0x0,0x96,0x43,0x17,0x0,0x4,0x0,0xe,
-0x1,0x0,0x0,0x6,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xf,0x1,0x0,0x0,0x7,
-0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x1e,0x0,0x6,0x0,0x11,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0xe,
-0x1,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x12,0x1,0x0,0x0,0x2,
-0x0,0x0,0x0,0x11,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x12,0x1,0x0,0x0,0x13,0x1,0x0,0x0,0x2,
-0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,
-0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x15,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x16,
-0x1,0x0,0x0,0x2,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x20,0x0,0x4,0x0,0x1b,0x1,0x0,0x0,0x1,
-0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x1b,0x1,0x0,0x0,0x1c,0x1,0x0,0x0,0x1,
-0x0,0x0,0x0,0x18,0x0,0x4,0x0,0x26,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1e,
-0x0,0x3,0x0,0x27,0x1,0x0,0x0,0x26,0x1,0x0,0x0,0x20,0x0,0x4,0x0,0x28,0x1,0x0,0x0,0x2,
-0x0,0x0,0x0,0x27,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x28,0x1,0x0,0x0,0x29,0x1,0x0,0x0,0x2,
-0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,
-0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x2c,
-0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x30,0x1,0x0,0x0,0x1,
-0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x30,0x1,0x0,0x0,0x31,0x1,0x0,0x0,0x1,
-0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x6,
-0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x41,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x40,
-0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x41,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x20,
-0x0,0x4,0x0,0x43,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x47,
-0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x47,0x1,0x0,0x0,0x48,
-0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x3,
-0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x58,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x2b,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x66,0x1,0x0,0x0,0x0,0x0,0x20,0x41,0x36,0x0,0x5,0x0,0x2,
-0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5,
-0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xf,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,
-0x0,0x4,0x0,0xf,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xf,
-0x1,0x0,0x0,0x25,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x39,
-0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x57,0x1,0x0,0x0,0x7,
-0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x5d,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,
-0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x65,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,
-0x0,0x0,0x0,0x72,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x73,
-0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x78,0x1,0x0,0x0,0x7,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x16,0x1,0x0,0x0,0x17,0x1,0x0,0x0,0x13,0x1,0x0,0x0,0x15,
-0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x18,0x1,0x0,0x0,0x17,0x1,0x0,0x0,0x7f,
-0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x19,0x1,0x0,0x0,0x18,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x10,
-0x1,0x0,0x0,0x19,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x1d,0x1,0x0,0x0,0x1c,
-0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x1e,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x94,
-0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x1f,0x1,0x0,0x0,0x1d,0x1,0x0,0x0,0x1e,0x1,0x0,0x0,0x85,
-0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0xb3,0x0,0x0,0x0,0x1f,0x1,0x0,0x0,0x3d,
-0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x21,0x1,0x0,0x0,0x1c,0x1,0x0,0x0,0x8e,0x0,0x5,0x0,0xe,
-0x1,0x0,0x0,0x22,0x1,0x0,0x0,0x21,0x1,0x0,0x0,0x20,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,
-0x1,0x0,0x0,0x23,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x83,0x0,0x5,0x0,0xe,0x1,0x0,0x0,0x24,
-0x1,0x0,0x0,0x22,0x1,0x0,0x0,0x23,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x1a,0x1,0x0,0x0,0x24,
-0x1,0x0,0x0,0x41,0x0,0x6,0x0,0x2c,0x1,0x0,0x0,0x2d,0x1,0x0,0x0,0x29,0x1,0x0,0x0,0x2a,
-0x1,0x0,0x0,0x2b,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2e,0x1,0x0,0x0,0x2d,
-0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x2f,0x1,0x0,0x0,0x2e,0x1,0x0,0x0,0x2e,
-0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,
-0x0,0x0,0x0,0x32,0x1,0x0,0x0,0x31,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x33,
-0x1,0x0,0x0,0x32,0x1,0x0,0x0,0x32,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,
-0x0,0x0,0x0,0x83,0x0,0x5,0x0,0xe,0x1,0x0,0x0,0x34,0x1,0x0,0x0,0x2f,0x1,0x0,0x0,0x33,
-0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x25,0x1,0x0,0x0,0x34,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,
-0x1,0x0,0x0,0x35,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0xc,0x0,0x6,0x0,0xe,0x1,0x0,0x0,0x36,
-0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x35,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x1a,
-0x1,0x0,0x0,0x36,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x37,0x1,0x0,0x0,0x25,
-0x1,0x0,0x0,0xc,0x0,0x6,0x0,0xe,0x1,0x0,0x0,0x38,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x45,
-0x0,0x0,0x0,0x37,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x25,0x1,0x0,0x0,0x38,0x1,0x0,0x0,0x3d,
-0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x3a,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,
-0x1,0x0,0x0,0x3b,0x1,0x0,0x0,0x25,0x1,0x0,0x0,0x94,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x3c,
-0x1,0x0,0x0,0x3a,0x1,0x0,0x0,0x3b,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,0x3c,
-0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3d,0x1,0x0,0x0,0x39,0x1,0x0,0x0,0xc,
-0x0,0x8,0x0,0x6,0x0,0x0,0x0,0x3e,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x3d,
-0x1,0x0,0x0,0x33,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,0x3e,
-0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3f,0x1,0x0,0x0,0x39,0x1,0x0,0x0,0x41,
-0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x44,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x45,0x1,0x0,0x0,0x44,0x1,0x0,0x0,0xc,0x0,0x7,0x0,0x6,
-0x0,0x0,0x0,0x46,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0x3f,0x1,0x0,0x0,0x45,
-0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,0x46,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x2c,
-0x1,0x0,0x0,0x49,0x1,0x0,0x0,0x13,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,
-0x0,0x0,0x0,0x4a,0x1,0x0,0x0,0x49,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x4b,
-0x1,0x0,0x0,0x4a,0x1,0x0,0x0,0x4a,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x2c,0x1,0x0,0x0,0x4c,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x2a,
-0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x4d,0x1,0x0,0x0,0x4c,0x1,0x0,0x0,0x4f,
-0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x4e,0x1,0x0,0x0,0x4d,0x1,0x0,0x0,0x4d,0x1,0x0,0x0,0x0,
-0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0xe,0x1,0x0,0x0,0x4f,
-0x1,0x0,0x0,0x4b,0x1,0x0,0x0,0x4e,0x1,0x0,0x0,0x41,0x0,0x6,0x0,0x43,0x1,0x0,0x0,0x51,
-0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,0x50,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x52,0x1,0x0,0x0,0x51,0x1,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x53,
-0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x54,
-0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x55,
-0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x50,0x0,0x7,0x0,0x7,0x0,0x0,0x0,0x56,
-0x1,0x0,0x0,0x53,0x1,0x0,0x0,0x54,0x1,0x0,0x0,0x55,0x1,0x0,0x0,0x52,0x1,0x0,0x0,0x3e,
-0x0,0x3,0x0,0x48,0x1,0x0,0x0,0x56,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x59,
-0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x58,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x5a,
-0x1,0x0,0x0,0x59,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x5b,0x1,0x0,0x0,0x39,
-0x1,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x5c,0x1,0x0,0x0,0x5a,0x1,0x0,0x0,0x5b,
-0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x57,0x1,0x0,0x0,0x5c,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x43,
-0x1,0x0,0x0,0x5e,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x15,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x5f,0x1,0x0,0x0,0x5e,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x60,
-0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x61,0x1,0x0,0x0,0x1c,
-0x1,0x0,0x0,0x94,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x62,0x1,0x0,0x0,0x60,0x1,0x0,0x0,0x61,
-0x1,0x0,0x0,0xc,0x0,0x8,0x0,0x6,0x0,0x0,0x0,0x63,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,
-0x0,0x0,0x0,0x62,0x1,0x0,0x0,0x33,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,
-0x0,0x0,0x0,0x64,0x1,0x0,0x0,0x5f,0x1,0x0,0x0,0x63,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x5d,
-0x1,0x0,0x0,0x64,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x67,0x1,0x0,0x0,0x13,
-0x1,0x0,0x0,0x58,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x68,0x1,0x0,0x0,0x67,
-0x1,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x69,0x1,0x0,0x0,0x66,0x1,0x0,0x0,0x68,
-0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6a,0x1,0x0,0x0,0x57,0x1,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6b,0x1,0x0,0x0,0x5d,0x1,0x0,0x0,0x81,0x0,0x5,0x0,0x6,
-0x0,0x0,0x0,0x6c,0x1,0x0,0x0,0x6a,0x1,0x0,0x0,0x6b,0x1,0x0,0x0,0x85,0x0,0x5,0x0,0x6,
-0x0,0x0,0x0,0x6d,0x1,0x0,0x0,0x69,0x1,0x0,0x0,0x6c,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x65,
-0x1,0x0,0x0,0x6d,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6e,0x1,0x0,0x0,0x65,
-0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x6f,0x1,0x0,0x0,0x13,0x1,0x0,0x0,0x2b,
-0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x6f,0x1,0x0,0x0,0x81,
-0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x71,0x1,0x0,0x0,0x6e,0x1,0x0,0x0,0x70,0x1,0x0,0x0,0x3e,
-0x0,0x3,0x0,0x65,0x1,0x0,0x0,0x71,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x74,
-0x1,0x0,0x0,0x48,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x73,0x1,0x0,0x0,0x74,0x1,0x0,0x0,0x39,
-0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x75,0x1,0x0,0x0,0xb,0x0,0x0,0x0,0x73,0x1,0x0,0x0,0x3e,
-0x0,0x3,0x0,0x72,0x1,0x0,0x0,0x75,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x76,
-0x1,0x0,0x0,0x65,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x77,0x1,0x0,0x0,0x72,
-0x1,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x77,0x1,0x0,0x0,0x76,0x1,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x79,0x1,0x0,0x0,0x72,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x78,
-0x1,0x0,0x0,0x79,0x1,0x0,0x0,0x39,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x7a,0x1,0x0,0x0,0xe,
-0x0,0x0,0x0,0x78,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x1,0x0,0x0,0x7a,0x1,0x0,0x0,0xfd,
-0x0,0x1,0x0,0x38,0x0,0x1,0x0,0x36,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x37,0x0,0x3,0x0,0x8,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0xc,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x7,
-0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,
-0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,
-0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x14,
-0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x15,
-0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x17,0x0,0x0,0x0,0xa,
-0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x17,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x1b,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0xc,
-0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x18,
-0x0,0x0,0x0,0x1b,0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x1,
-0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x11,
-0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,0xa,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1f,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x24,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,
-0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x24,
-0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x25,
-0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x1e,0x0,0x0,0x0,0x26,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,
-0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x27,
-0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0xa,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x2b,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x2d,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x2e,
-0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x2d,
-0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,
-0x0,0x4,0x0,0x30,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x35,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x31,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x34,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x13,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x34,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x32,
-0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x35,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x36,
-0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x37,0x0,0x0,0x0,0xa,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x37,
-0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x39,0x0,0x0,0x0,0x36,0x0,0x0,0x0,0x38,
-0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x3b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x39,
-0x0,0x0,0x0,0x3a,0x0,0x0,0x0,0x49,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x3a,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x41,
-0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x42,
-0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0x41,
-0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0x3c,
-0x0,0x0,0x0,0x43,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x46,0x0,0x0,0x0,0x44,
-0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x47,0x0,0x0,0x0,0x46,
-0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x0,0x0,0x2b,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x0,0x0,0x0,0x47,0x0,0x0,0x0,0xf9,
-0x0,0x2,0x0,0x3b,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x49,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x4a,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x4b,
-0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x4c,
-0x0,0x0,0x0,0x4b,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,0x4a,
-0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x4f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,
-0x0,0x4,0x0,0x4d,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x4e,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,
-0x0,0x0,0x0,0x54,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x56,
-0x0,0x0,0x0,0x54,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x57,
-0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x56,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x59,
-0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x5a,
-0x0,0x0,0x0,0x59,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x5b,
-0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x5b,0x0,0x0,0x0,0x5a,
-0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5c,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x60,
-0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x62,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x60,0x0,0x0,0x0,0x61,0x0,0x0,0x0,0x62,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0x61,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x63,0x0,0x0,0x0,0xa,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x63,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x65,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x65,0x0,0x0,0x0,0x83,
-0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,
-0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,
-0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,
-0x0,0x0,0x0,0x6c,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,
-0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x6c,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0x6e,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x6e,
-0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x62,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x62,
-0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,0xf9,
-0x0,0x2,0x0,0x3b,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x3b,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x32,
-0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x32,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6f,
-0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x6f,
-0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x72,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,
-0x0,0x4,0x0,0x70,0x0,0x0,0x0,0x71,0x0,0x0,0x0,0x74,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x71,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x73,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x16,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x73,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x72,
-0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x74,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x75,
-0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x76,0x0,0x0,0x0,0x11,
-0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x76,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x16,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x78,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x72,
-0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x72,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x79,
-0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x7a,0x0,0x0,0x0,0x2b,
-0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x7a,0x0,0x0,0x0,0x79,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x7b,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0xfe,0x0,0x2,0x0,0x7b,
-0x0,0x0,0x0,0x38,0x0,0x1,0x0,0x36,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x37,0x0,0x3,0x0,0x8,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0xf,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x7,
-0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,
-0x0,0x4,0x0,0x10,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,
-0x0,0x0,0x0,0xb9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x7e,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0x7e,0x0,0x0,0x0,0xf6,0x0,0x4,0x0,0x80,0x0,0x0,0x0,0x81,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x82,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x82,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x83,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x84,0x0,0x0,0x0,0x83,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,
-0x0,0x0,0x0,0x85,0x0,0x0,0x0,0x84,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x85,
-0x0,0x0,0x0,0x7f,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x7f,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x86,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x87,0x0,0x0,0x0,0x86,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,
-0x0,0x0,0x0,0x88,0x0,0x0,0x0,0x87,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0x89,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x89,
-0x0,0x0,0x0,0x88,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x81,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x81,
-0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x7e,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x80,0x0,0x0,0x0,0xf9,
-0x0,0x2,0x0,0x8a,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x8a,0x0,0x0,0x0,0xf6,0x0,0x4,0x0,0x8c,
-0x0,0x0,0x0,0x8d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x8e,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0x8e,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x8f,0x0,0x0,0x0,0xd,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x8f,
-0x0,0x0,0x0,0xbe,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x91,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x45,
-0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x91,0x0,0x0,0x0,0x8b,0x0,0x0,0x0,0x8c,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0x8b,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x92,0x0,0x0,0x0,0xd,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x93,0x0,0x0,0x0,0x92,
-0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x94,0x0,0x0,0x0,0x93,0x0,0x0,0x0,0x45,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x95,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x95,0x0,0x0,0x0,0x94,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x8d,
-0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x8d,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x8a,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0x8c,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x97,0x0,0x0,0x0,0xd,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x96,0x0,0x0,0x0,0x97,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0x98,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x99,0x0,0x0,0x0,0x98,0x0,0x0,0x0,0xbc,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x9a,
-0x0,0x0,0x0,0x99,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x9c,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x9a,0x0,0x0,0x0,0x9b,0x0,0x0,0x0,0xa6,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0x9b,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x9d,0x0,0x0,0x0,0xd,
-0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x9e,0x0,0x0,0x0,0x9d,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x9f,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9f,0x0,0x0,0x0,0x9e,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0xa1,0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa2,
-0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xa2,0x0,0x0,0x0,0xa1,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa3,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x19,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xa4,0x0,0x0,0x0,0xa3,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,
-0x0,0x3,0x0,0xa5,0x0,0x0,0x0,0xa4,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0xa6,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa8,0x0,0x0,0x0,0xd,
-0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xa9,0x0,0x0,0x0,0xa8,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xaa,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x16,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xab,0x0,0x0,0x0,0xaa,0x0,0x0,0x0,0x85,
-0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xac,0x0,0x0,0x0,0xa9,0x0,0x0,0x0,0xab,0x0,0x0,0x0,0x3e,
-0x0,0x3,0x0,0xa7,0x0,0x0,0x0,0xac,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xae,
-0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xb0,0x0,0x0,0x0,0xd,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xb1,0x0,0x0,0x0,0xb0,
-0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb2,0x0,0x0,0x0,0xb1,0x0,0x0,0x0,0x3c,
-0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb4,0x0,0x0,0x0,0xb2,0x0,0x0,0x0,0xb3,
-0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb5,0x0,0x0,0x0,0xb4,0x0,0x0,0x0,0xaf,
-0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x6,0x0,0x0,0x0,0xb6,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x4,
-0x0,0x0,0x0,0xb5,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb7,0x0,0x0,0x0,0xaf,
-0x0,0x0,0x0,0xb6,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb8,0x0,0x0,0x0,0xae,
-0x0,0x0,0x0,0xb7,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xad,0x0,0x0,0x0,0xb8,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xba,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xbb,0x0,0x0,0x0,0xba,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0xbc,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xbd,
-0x0,0x0,0x0,0xbb,0x0,0x0,0x0,0xbc,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xb9,0x0,0x0,0x0,0xbd,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xbe,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xbf,0x0,0x0,0x0,0xbe,0x0,0x0,0x0,0xb8,
-0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xc0,0x0,0x0,0x0,0xbf,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0xf7,
-0x0,0x3,0x0,0xc2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xc0,0x0,0x0,0x0,0xc1,
-0x0,0x0,0x0,0xc8,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc1,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0xc3,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xc4,
-0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xc4,0x0,0x0,0x0,0xc3,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xc5,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xc6,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,
-0x0,0x3,0x0,0xc6,0x0,0x0,0x0,0xc5,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xc7,
-0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xc7,0x0,0x0,0x0,0x33,
-0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xc2,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc8,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xc9,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xca,0x0,0x0,0x0,0xc9,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,
-0x0,0x0,0x0,0xcb,0x0,0x0,0x0,0xca,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xcd,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xcb,0x0,0x0,0x0,0xcc,0x0,0x0,0x0,0xd3,
-0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xcc,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xce,
-0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xcf,0x0,0x0,0x0,0x96,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xcf,0x0,0x0,0x0,0xce,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xd0,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0xd1,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xd1,
-0x0,0x0,0x0,0xd0,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xd2,0x0,0x0,0x0,0x96,
-0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xd2,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf9,
-0x0,0x2,0x0,0xcd,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xd3,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0xd4,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0xd5,0x0,0x0,0x0,0xd4,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xd7,
-0x0,0x0,0x0,0xd5,0x0,0x0,0x0,0xd6,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xd9,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xd7,0x0,0x0,0x0,0xd8,0x0,0x0,0x0,0xdf,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0xd8,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xda,0x0,0x0,0x0,0x96,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xda,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xdb,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0xdc,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xdc,
-0x0,0x0,0x0,0xdb,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xdd,0x0,0x0,0x0,0xad,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xde,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xde,0x0,0x0,0x0,0xdd,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xd9,
-0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xdf,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe0,
-0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xe1,
-0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xe2,0x0,0x0,0x0,0xe1,
-0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xe4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,
-0x0,0x4,0x0,0xe2,0x0,0x0,0x0,0xe3,0x0,0x0,0x0,0xea,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xe3,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xe5,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0xe6,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe7,
-0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xe7,0x0,0x0,0x0,0xe6,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xe8,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe9,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,
-0x0,0x3,0x0,0xe9,0x0,0x0,0x0,0xe8,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xe4,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0xea,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xeb,0x0,0x0,0x0,0xd,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xec,0x0,0x0,0x0,0xeb,
-0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xee,0x0,0x0,0x0,0xec,0x0,0x0,0x0,0xed,
-0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xf0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xee,
-0x0,0x0,0x0,0xef,0x0,0x0,0x0,0xf6,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xef,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xf1,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0xf2,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf2,
-0x0,0x0,0x0,0xf1,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xf3,0x0,0x0,0x0,0x96,
-0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf3,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xf4,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0xf5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf5,
-0x0,0x0,0x0,0xf4,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xf0,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xf6,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xf7,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xf8,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,
-0x0,0x3,0x0,0xf8,0x0,0x0,0x0,0xf7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xf9,
-0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf9,0x0,0x0,0x0,0x33,
-0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xfa,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,
-0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xfb,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,
-0x0,0x3,0x0,0xfb,0x0,0x0,0x0,0xfa,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xf0,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0xf0,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xe4,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xe4,
-0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xd9,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xd9,0x0,0x0,0x0,0xf9,
-0x0,0x2,0x0,0xcd,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xcd,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xc2,
-0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc2,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xfc,
-0x0,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xfd,0x0,0x0,0x0,0x96,
-0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xfe,0x0,0x0,0x0,0xfd,
-0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xff,0x0,0x0,0x0,0xfe,0x0,0x0,0x0,0xfc,
-0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x13,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x0,0x1,0x0,0x0,0xff,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x1,0x1,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x2,
-0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3,
-0x1,0x0,0x0,0x2,0x1,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x4,0x1,0x0,0x0,0x3,
-0x1,0x0,0x0,0x1,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x5,0x1,0x0,0x0,0x96,
-0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x5,0x1,0x0,0x0,0x4,0x1,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6,0x1,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,
-0x0,0x0,0x0,0x7,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,
-0x0,0x0,0x0,0x8,0x1,0x0,0x0,0x7,0x1,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x9,
-0x1,0x0,0x0,0x8,0x1,0x0,0x0,0x6,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa,
-0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xa,0x1,0x0,0x0,0x9,
-0x1,0x0,0x0,0xf9,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,0x3d,
-0x0,0x4,0x0,0x7,0x0,0x0,0x0,0xb,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0xfe,0x0,0x2,0x0,0xb,
-0x1,0x0,0x0,0x38,0x0,0x1,0x0,
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x7b,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0x8,0x0,0x4,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x1c,0x1,0x0,0x0,0x31,0x1,0x0,0x0,0x48,0x1,0x0,0x0,0x10,0x0,0x3,0x0,
+    0x4,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,
+    0x4,0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,
+    0x79,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,
+    0x4,0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,
+    0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x72,0x67,0x62,0x5f,
+    0x74,0x6f,0x5f,0x68,0x73,0x76,0x28,0x76,0x66,0x34,0x3b,0x0,0x5,0x0,0x3,0x0,0xa,0x0,0x0,0x0,
+    0x72,0x67,0x62,0x0,0x5,0x0,0x6,0x0,0xe,0x0,0x0,0x0,0x68,0x73,0x76,0x5f,0x74,0x6f,0x5f,0x72,
+    0x67,0x62,0x28,0x76,0x66,0x34,0x3b,0x0,0x5,0x0,0x3,0x0,0xd,0x0,0x0,0x0,0x68,0x73,0x76,0x0,
+    0x5,0x0,0x4,0x0,0x11,0x0,0x0,0x0,0x63,0x6d,0x61,0x78,0x0,0x0,0x0,0x0,0x5,0x0,0x4,0x0,
+    0x1e,0x0,0x0,0x0,0x63,0x6d,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x4,0x0,0x27,0x0,0x0,0x0,
+    0x64,0x69,0x66,0x66,0x0,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0x2b,0x0,0x0,0x0,0x68,0x73,0x76,0x0,
+    0x5,0x0,0x3,0x0,0x96,0x0,0x0,0x0,0x72,0x67,0x62,0x0,0x5,0x0,0x3,0x0,0xa7,0x0,0x0,0x0,
+    0x43,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0xad,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x5,0x0,0x3,0x0,
+    0xb9,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x10,0x1,0x0,0x0,0x74,0x6f,0x5f,0x6c,
+    0x69,0x67,0x68,0x74,0x0,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x11,0x1,0x0,0x0,0x4c,0x69,0x67,0x68,
+    0x74,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,
+    0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x11,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x6c,0x69,0x67,0x68,
+    0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x6,0x0,0x7,0x0,0x11,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x0,0x0,0x6,0x0,0x7,0x0,
+    0x11,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x6c,0x69,0x67,0x68,0x74,0x49,0x6e,0x74,0x65,0x6e,0x73,0x69,
+    0x74,0x79,0x0,0x0,0x6,0x0,0x9,0x0,0x11,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x61,0x6d,0x62,0x69,
+    0x65,0x6e,0x74,0x4c,0x69,0x67,0x68,0x74,0x49,0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,0x79,0x0,0x0,0x0,
+    0x5,0x0,0x3,0x0,0x13,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x1a,0x1,0x0,0x0,
+    0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x5,0x0,0x1c,0x1,0x0,0x0,
+    0x69,0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x25,0x1,0x0,0x0,
+    0x74,0x6f,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x27,0x1,0x0,0x0,
+    0x43,0x61,0x6d,0x65,0x72,0x61,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,
+    0x62,0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x63,0x61,0x6d,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x0,0x0,0x0,0x0,0x5,0x0,0x3,0x0,
+    0x29,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x31,0x1,0x0,0x0,0x69,0x6e,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x5,0x0,0x39,0x1,0x0,0x0,0x63,0x6f,0x73,0x5f,
+    0x61,0x6e,0x67,0x6c,0x65,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x40,0x1,0x0,0x0,0x6d,0x61,0x74,0x65,
+    0x72,0x69,0x61,0x6c,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,
+    0x65,0x63,0x74,0x0,0x6,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x43,
+    0x6f,0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x40,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x6,0x0,0x8,0x0,
+    0x40,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0x42,0x1,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x48,0x1,0x0,0x0,0x6f,0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,
+    0x72,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x57,0x1,0x0,0x0,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x5f,0x73,0x63,0x61,0x6c,0x65,0x0,0x0,0x5,0x0,0x6,0x0,0x5d,0x1,0x0,0x0,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x65,0x1,0x0,0x0,
+    0x69,0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,0x79,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x72,0x1,0x0,0x0,
+    0x6f,0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x5f,0x68,0x73,0x76,0x0,0x0,0x0,0x5,0x0,0x4,0x0,
+    0x73,0x1,0x0,0x0,0x70,0x61,0x72,0x61,0x6d,0x0,0x0,0x0,0x5,0x0,0x4,0x0,0x78,0x1,0x0,0x0,
+    0x70,0x61,0x72,0x61,0x6d,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x11,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x13,0x1,0x0,0x0,0x22,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x13,0x1,0x0,0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x1c,0x1,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x10,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x27,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x29,0x1,0x0,0x0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x29,0x1,0x0,0x0,
+    0x21,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x31,0x1,0x0,0x0,0x1e,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0x14,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0x18,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x40,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x42,0x1,0x0,0x0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x42,0x1,0x0,0x0,
+    0x21,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x48,0x1,0x0,0x0,0x1e,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x21,0x0,0x4,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x8,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x15,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x12,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x14,0x0,0x2,0x0,0x2f,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x33,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,
+    0x0,0x0,0x70,0x42,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x0,0x0,0xb4,0x43,
+    0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x0,0x0,0xf0,0x42,0x2b,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x0,0x0,0x70,0x43,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xaf,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xb3,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x40,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xd6,0x0,0x0,0x0,0x0,0x0,0x34,0x43,
+    0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xed,0x0,0x0,0x0,0x0,0x0,0x96,0x43,0x17,0x0,0x4,0x0,
+    0xe,0x1,0x0,0x0,0x6,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xf,0x1,0x0,0x0,
+    0x7,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x1e,0x0,0x6,0x0,0x11,0x1,0x0,0x0,0x7,0x0,0x0,0x0,
+    0xe,0x1,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x12,0x1,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x11,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x12,0x1,0x0,0x0,0x13,0x1,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x15,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x16,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x20,0x0,0x4,0x0,0x1b,0x1,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x1b,0x1,0x0,0x0,0x1c,0x1,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0x26,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,
+    0x1e,0x0,0x3,0x0,0x27,0x1,0x0,0x0,0x26,0x1,0x0,0x0,0x20,0x0,0x4,0x0,0x28,0x1,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x27,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x28,0x1,0x0,0x0,0x29,0x1,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x2c,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x30,0x1,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x30,0x1,0x0,0x0,0x31,0x1,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x41,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x40,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x41,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x43,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x47,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x47,0x1,0x0,0x0,
+    0x48,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x50,0x1,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x58,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x66,0x1,0x0,0x0,0x0,0x0,0x20,0x41,0x36,0x0,0x5,0x0,
+    0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x5,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xf,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0xf,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0xf,0x1,0x0,0x0,0x25,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,
+    0x39,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x57,0x1,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x5d,0x1,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x65,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x8,0x0,0x0,0x0,0x72,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,
+    0x73,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x78,0x1,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x16,0x1,0x0,0x0,0x17,0x1,0x0,0x0,0x13,0x1,0x0,0x0,
+    0x15,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x18,0x1,0x0,0x0,0x17,0x1,0x0,0x0,
+    0x7f,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x19,0x1,0x0,0x0,0x18,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x10,0x1,0x0,0x0,0x19,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x1d,0x1,0x0,0x0,
+    0x1c,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x1e,0x1,0x0,0x0,0x10,0x1,0x0,0x0,
+    0x94,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x1f,0x1,0x0,0x0,0x1d,0x1,0x0,0x0,0x1e,0x1,0x0,0x0,
+    0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0xb3,0x0,0x0,0x0,0x1f,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x21,0x1,0x0,0x0,0x1c,0x1,0x0,0x0,0x8e,0x0,0x5,0x0,
+    0xe,0x1,0x0,0x0,0x22,0x1,0x0,0x0,0x21,0x1,0x0,0x0,0x20,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0xe,0x1,0x0,0x0,0x23,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x83,0x0,0x5,0x0,0xe,0x1,0x0,0x0,
+    0x24,0x1,0x0,0x0,0x22,0x1,0x0,0x0,0x23,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x1a,0x1,0x0,0x0,
+    0x24,0x1,0x0,0x0,0x41,0x0,0x6,0x0,0x2c,0x1,0x0,0x0,0x2d,0x1,0x0,0x0,0x29,0x1,0x0,0x0,
+    0x2a,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2e,0x1,0x0,0x0,
+    0x2d,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x2f,0x1,0x0,0x0,0x2e,0x1,0x0,0x0,
+    0x2e,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x32,0x1,0x0,0x0,0x31,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,
+    0x33,0x1,0x0,0x0,0x32,0x1,0x0,0x0,0x32,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0xe,0x1,0x0,0x0,0x34,0x1,0x0,0x0,0x2f,0x1,0x0,0x0,
+    0x33,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x25,0x1,0x0,0x0,0x34,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0xe,0x1,0x0,0x0,0x35,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0xc,0x0,0x6,0x0,0xe,0x1,0x0,0x0,
+    0x36,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x35,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x1a,0x1,0x0,0x0,0x36,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x37,0x1,0x0,0x0,
+    0x25,0x1,0x0,0x0,0xc,0x0,0x6,0x0,0xe,0x1,0x0,0x0,0x38,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x45,0x0,0x0,0x0,0x37,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x25,0x1,0x0,0x0,0x38,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x3a,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0xe,0x1,0x0,0x0,0x3b,0x1,0x0,0x0,0x25,0x1,0x0,0x0,0x94,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x3c,0x1,0x0,0x0,0x3a,0x1,0x0,0x0,0x3b,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,
+    0x3c,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3d,0x1,0x0,0x0,0x39,0x1,0x0,0x0,
+    0xc,0x0,0x8,0x0,0x6,0x0,0x0,0x0,0x3e,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x3d,0x1,0x0,0x0,0x33,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,
+    0x3e,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3f,0x1,0x0,0x0,0x39,0x1,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x44,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x45,0x1,0x0,0x0,0x44,0x1,0x0,0x0,0xc,0x0,0x7,0x0,
+    0x6,0x0,0x0,0x0,0x46,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0x3f,0x1,0x0,0x0,
+    0x45,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,0x46,0x1,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x2c,0x1,0x0,0x0,0x49,0x1,0x0,0x0,0x13,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x4a,0x1,0x0,0x0,0x49,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,
+    0x4b,0x1,0x0,0x0,0x4a,0x1,0x0,0x0,0x4a,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x2c,0x1,0x0,0x0,0x4c,0x1,0x0,0x0,0x42,0x1,0x0,0x0,
+    0x2a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x4d,0x1,0x0,0x0,0x4c,0x1,0x0,0x0,
+    0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x4e,0x1,0x0,0x0,0x4d,0x1,0x0,0x0,0x4d,0x1,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0xe,0x1,0x0,0x0,
+    0x4f,0x1,0x0,0x0,0x4b,0x1,0x0,0x0,0x4e,0x1,0x0,0x0,0x41,0x0,0x6,0x0,0x43,0x1,0x0,0x0,
+    0x51,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,0x50,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x52,0x1,0x0,0x0,0x51,0x1,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x53,0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x54,0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x55,0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x50,0x0,0x7,0x0,0x7,0x0,0x0,0x0,
+    0x56,0x1,0x0,0x0,0x53,0x1,0x0,0x0,0x54,0x1,0x0,0x0,0x55,0x1,0x0,0x0,0x52,0x1,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x48,0x1,0x0,0x0,0x56,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,
+    0x59,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x58,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x5a,0x1,0x0,0x0,0x59,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x5b,0x1,0x0,0x0,
+    0x39,0x1,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x5c,0x1,0x0,0x0,0x5a,0x1,0x0,0x0,
+    0x5b,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x57,0x1,0x0,0x0,0x5c,0x1,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x43,0x1,0x0,0x0,0x5e,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x15,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x5f,0x1,0x0,0x0,0x5e,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,
+    0x60,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x61,0x1,0x0,0x0,
+    0x1c,0x1,0x0,0x0,0x94,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x62,0x1,0x0,0x0,0x60,0x1,0x0,0x0,
+    0x61,0x1,0x0,0x0,0xc,0x0,0x8,0x0,0x6,0x0,0x0,0x0,0x63,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2b,0x0,0x0,0x0,0x62,0x1,0x0,0x0,0x33,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,0x85,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x64,0x1,0x0,0x0,0x5f,0x1,0x0,0x0,0x63,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x5d,0x1,0x0,0x0,0x64,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x67,0x1,0x0,0x0,
+    0x13,0x1,0x0,0x0,0x58,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x68,0x1,0x0,0x0,
+    0x67,0x1,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x69,0x1,0x0,0x0,0x66,0x1,0x0,0x0,
+    0x68,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6a,0x1,0x0,0x0,0x57,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6b,0x1,0x0,0x0,0x5d,0x1,0x0,0x0,0x81,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x6c,0x1,0x0,0x0,0x6a,0x1,0x0,0x0,0x6b,0x1,0x0,0x0,0x85,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x6d,0x1,0x0,0x0,0x69,0x1,0x0,0x0,0x6c,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x65,0x1,0x0,0x0,0x6d,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6e,0x1,0x0,0x0,
+    0x65,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x6f,0x1,0x0,0x0,0x13,0x1,0x0,0x0,
+    0x2b,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x6f,0x1,0x0,0x0,
+    0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x71,0x1,0x0,0x0,0x6e,0x1,0x0,0x0,0x70,0x1,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x65,0x1,0x0,0x0,0x71,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,
+    0x74,0x1,0x0,0x0,0x48,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x73,0x1,0x0,0x0,0x74,0x1,0x0,0x0,
+    0x39,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x75,0x1,0x0,0x0,0xb,0x0,0x0,0x0,0x73,0x1,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x72,0x1,0x0,0x0,0x75,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x76,0x1,0x0,0x0,0x65,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x77,0x1,0x0,0x0,
+    0x72,0x1,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x77,0x1,0x0,0x0,0x76,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x79,0x1,0x0,0x0,0x72,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x78,0x1,0x0,0x0,0x79,0x1,0x0,0x0,0x39,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x7a,0x1,0x0,0x0,
+    0xe,0x0,0x0,0x0,0x78,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x1,0x0,0x0,0x7a,0x1,0x0,0x0,
+    0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,0x36,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0xb,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x37,0x0,0x3,0x0,0x8,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xc,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x8,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x14,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x15,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x17,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x18,0x0,0x0,0x0,
+    0x17,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x1b,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,
+    0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x28,0x0,0x0,0x0,
+    0x18,0x0,0x0,0x0,0x1b,0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x11,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x1f,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x21,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x24,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0xc,0x0,0x7,0x0,
+    0x6,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x22,0x0,0x0,0x0,
+    0x24,0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x25,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x1e,0x0,0x0,0x0,
+    0x26,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x83,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x27,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x2b,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x2e,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x30,0x0,0x0,0x0,
+    0x2d,0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0x30,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x35,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x31,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x34,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x34,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x32,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x35,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x36,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x37,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x38,0x0,0x0,0x0,
+    0x37,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x39,0x0,0x0,0x0,0x36,0x0,0x0,0x0,
+    0x38,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x3b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,
+    0x39,0x0,0x0,0x0,0x3a,0x0,0x0,0x0,0x49,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x3a,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x41,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x42,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x43,0x0,0x0,0x0,
+    0x41,0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x44,0x0,0x0,0x0,
+    0x3c,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x46,0x0,0x0,0x0,
+    0x44,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x47,0x0,0x0,0x0,
+    0x46,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x0,0x0,
+    0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x0,0x0,0x0,0x47,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x3b,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x49,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x4a,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x4b,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x4c,0x0,0x0,0x0,0x4b,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,
+    0x4a,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x4f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0x4d,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x4e,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x50,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0x83,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x54,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x56,0x0,0x0,0x0,0x54,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x57,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x56,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x59,0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x5a,0x0,0x0,0x0,0x59,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x5b,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x5b,0x0,0x0,0x0,
+    0x5a,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5c,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,
+    0x60,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x62,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x60,0x0,0x0,0x0,0x61,0x0,0x0,0x0,0x62,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x61,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x63,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x64,0x0,0x0,0x0,
+    0x63,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x65,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x65,0x0,0x0,0x0,
+    0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x66,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x85,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x81,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x6c,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x6c,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x6e,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x6e,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x62,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x62,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x3b,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x3b,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x32,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x32,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x6f,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x70,0x0,0x0,0x0,
+    0x6f,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x72,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0x70,0x0,0x0,0x0,0x71,0x0,0x0,0x0,0x74,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x71,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x73,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x73,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x72,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x74,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x75,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x76,0x0,0x0,0x0,
+    0x11,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0x75,0x0,0x0,0x0,
+    0x76,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x78,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x72,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x72,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x79,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x7a,0x0,0x0,0x0,
+    0x2b,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x7a,0x0,0x0,0x0,0x79,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x7b,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0xfe,0x0,0x2,0x0,
+    0x7b,0x0,0x0,0x0,0x38,0x0,0x1,0x0,0x36,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0xe,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x37,0x0,0x3,0x0,0x8,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xf,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x10,0x0,0x0,0x0,0xb9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x7e,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x7e,0x0,0x0,0x0,0xf6,0x0,0x4,0x0,0x80,0x0,0x0,0x0,0x81,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x82,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x82,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x83,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x84,0x0,0x0,0x0,0x83,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,
+    0x2f,0x0,0x0,0x0,0x85,0x0,0x0,0x0,0x84,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,
+    0x85,0x0,0x0,0x0,0x7f,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x7f,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x86,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x87,0x0,0x0,0x0,0x86,0x0,0x0,0x0,0x81,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x88,0x0,0x0,0x0,0x87,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x89,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x89,0x0,0x0,0x0,0x88,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x81,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x81,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x7e,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x80,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x8a,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x8a,0x0,0x0,0x0,0xf6,0x0,0x4,0x0,
+    0x8c,0x0,0x0,0x0,0x8d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x8e,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x8e,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x8f,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x90,0x0,0x0,0x0,
+    0x8f,0x0,0x0,0x0,0xbe,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x91,0x0,0x0,0x0,0x90,0x0,0x0,0x0,
+    0x45,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x91,0x0,0x0,0x0,0x8b,0x0,0x0,0x0,0x8c,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x8b,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x92,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x93,0x0,0x0,0x0,
+    0x92,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x94,0x0,0x0,0x0,0x93,0x0,0x0,0x0,
+    0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x95,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x95,0x0,0x0,0x0,0x94,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x8d,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x8d,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x8a,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x8c,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x97,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x96,0x0,0x0,0x0,0x97,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x98,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x99,0x0,0x0,0x0,0x98,0x0,0x0,0x0,0xbc,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,
+    0x9a,0x0,0x0,0x0,0x99,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x9c,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x9a,0x0,0x0,0x0,0x9b,0x0,0x0,0x0,0xa6,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x9b,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x9d,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x9e,0x0,0x0,0x0,
+    0x9d,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x9f,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9f,0x0,0x0,0x0,0x9e,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xa1,0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xa2,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xa2,0x0,0x0,0x0,
+    0xa1,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa3,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xa4,0x0,0x0,0x0,0xa3,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xa5,0x0,0x0,0x0,0xa4,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xa6,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa8,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xa9,0x0,0x0,0x0,
+    0xa8,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xaa,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xab,0x0,0x0,0x0,0xaa,0x0,0x0,0x0,
+    0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xac,0x0,0x0,0x0,0xa9,0x0,0x0,0x0,0xab,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xa7,0x0,0x0,0x0,0xac,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xae,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xb0,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xb1,0x0,0x0,0x0,
+    0xb0,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb2,0x0,0x0,0x0,0xb1,0x0,0x0,0x0,
+    0x3c,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb4,0x0,0x0,0x0,0xb2,0x0,0x0,0x0,
+    0xb3,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb5,0x0,0x0,0x0,0xb4,0x0,0x0,0x0,
+    0xaf,0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x6,0x0,0x0,0x0,0xb6,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x4,0x0,0x0,0x0,0xb5,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb7,0x0,0x0,0x0,
+    0xaf,0x0,0x0,0x0,0xb6,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb8,0x0,0x0,0x0,
+    0xae,0x0,0x0,0x0,0xb7,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xad,0x0,0x0,0x0,0xb8,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xba,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xbb,0x0,0x0,0x0,0xba,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xbc,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0xbd,0x0,0x0,0x0,0xbb,0x0,0x0,0x0,0xbc,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xb9,0x0,0x0,0x0,
+    0xbd,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xbe,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xbf,0x0,0x0,0x0,0xbe,0x0,0x0,0x0,
+    0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xc0,0x0,0x0,0x0,0xbf,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,
+    0xf7,0x0,0x3,0x0,0xc2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xc0,0x0,0x0,0x0,
+    0xc1,0x0,0x0,0x0,0xc8,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc1,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xc3,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xc4,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xc4,0x0,0x0,0x0,
+    0xc3,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xc5,0x0,0x0,0x0,0xad,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xc6,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xc6,0x0,0x0,0x0,0xc5,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xc7,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xc7,0x0,0x0,0x0,
+    0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xc2,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc8,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xc9,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xca,0x0,0x0,0x0,0xc9,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,
+    0x2f,0x0,0x0,0x0,0xcb,0x0,0x0,0x0,0xca,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,
+    0xcd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xcb,0x0,0x0,0x0,0xcc,0x0,0x0,0x0,
+    0xd3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xcc,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xce,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xcf,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xcf,0x0,0x0,0x0,0xce,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xd0,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xd1,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xd1,0x0,0x0,0x0,0xd0,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xd2,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xd2,0x0,0x0,0x0,0x33,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0xcd,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xd3,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xd4,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xd5,0x0,0x0,0x0,0xd4,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,
+    0xd7,0x0,0x0,0x0,0xd5,0x0,0x0,0x0,0xd6,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xd9,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xd7,0x0,0x0,0x0,0xd8,0x0,0x0,0x0,0xdf,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xd8,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xda,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xda,0x0,0x0,0x0,0x33,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xdb,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xdc,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xdc,0x0,0x0,0x0,0xdb,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xdd,0x0,0x0,0x0,
+    0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xde,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xde,0x0,0x0,0x0,0xdd,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0xd9,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xdf,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xe0,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xe1,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xe2,0x0,0x0,0x0,
+    0xe1,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xe4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0xe2,0x0,0x0,0x0,0xe3,0x0,0x0,0x0,0xea,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xe3,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xe5,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xe6,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xe7,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xe7,0x0,0x0,0x0,
+    0xe6,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xe8,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe9,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xe9,0x0,0x0,0x0,0xe8,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xe4,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xea,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xeb,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xec,0x0,0x0,0x0,
+    0xeb,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xee,0x0,0x0,0x0,0xec,0x0,0x0,0x0,
+    0xed,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xf0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,
+    0xee,0x0,0x0,0x0,0xef,0x0,0x0,0x0,0xf6,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xef,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xf1,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xf2,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xf2,0x0,0x0,0x0,0xf1,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xf3,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf3,0x0,0x0,0x0,0x33,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xf4,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xf5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xf5,0x0,0x0,0x0,0xf4,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xf0,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xf6,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xf7,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xf8,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xf8,0x0,0x0,0x0,0xf7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xf9,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf9,0x0,0x0,0x0,
+    0x33,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xfa,0x0,0x0,0x0,0xad,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xfb,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xfb,0x0,0x0,0x0,0xfa,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xf0,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xf0,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xe4,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xe4,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xd9,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xd9,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0xcd,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xcd,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0xc2,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc2,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xfc,0x0,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xfd,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xfe,0x0,0x0,0x0,
+    0xfd,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xff,0x0,0x0,0x0,0xfe,0x0,0x0,0x0,
+    0xfc,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x0,0x1,0x0,0x0,0xff,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x1,0x1,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x2,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x3,0x1,0x0,0x0,0x2,0x1,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x4,0x1,0x0,0x0,
+    0x3,0x1,0x0,0x0,0x1,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x5,0x1,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x5,0x1,0x0,0x0,0x4,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6,0x1,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x7,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x8,0x1,0x0,0x0,0x7,0x1,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x9,0x1,0x0,0x0,0x8,0x1,0x0,0x0,0x6,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xa,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xa,0x1,0x0,0x0,
+    0x9,0x1,0x0,0x0,0xf9,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0xb,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0xfe,0x0,0x2,0x0,
+    0xb,0x1,0x0,0x0,0x38,0x0,0x1,0x0,
 };
 
-
-
 //Unlit vertex shader
 
 //#version 450
@@ -685,81 +835,79 @@ std::vector<uint8_t> litFragShaderBin = {
 //	vec4 scaledPosition = objectScale * inPosition;
 //    gl_Position = objToScreen * scaledPosition;
 //}
-
 std::vector<uint8_t> unlitVertShaderBin = {
-    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x28,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,
-    0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,0x2e,
-    0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x1,
-    0x0,0x0,0x0,0xf,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,
-    0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,
-    0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,
-    0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,
-    0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,
-    0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,
-    0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x9,
-    0x0,0x0,0x0,0x73,0x63,0x61,0x6c,0x65,0x64,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,
-    0x0,0xa,0x0,0xb,0x0,0x0,0x0,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x55,0x6e,0x69,0x66,
-    0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x0,0x6,
-    0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x53,0x63,0x72,0x65,
-    0x65,0x6e,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x53,0x63,0x61,0x6c,0x65,0x0,0x5,0x0,0x3,0x0,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,
-    0x0,0x5,0x0,0x14,0x0,0x0,0x0,0x69,0x6e,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,
-    0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,0x0,
-    0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x6f,
-    0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x67,
-    0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x0,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x1a,
-    0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,0x6e,
-    0x63,0x65,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,0x75,
-    0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x0,0x5,0x0,0x3,0x0,0x1c,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x27,0x0,0x0,0x0,0x69,0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,
-    0x0,0x0,0x0,0x48,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x48,
-    0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,
-    0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,
-    0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x47,
-    0x0,0x3,0x0,0xb,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x22,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x14,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,
-    0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,
-    0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,
-    0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x48,
-    0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x47,
-    0x0,0x3,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x1e,
-    0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,0x3,
-    0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x17,
-    0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x8,
-    0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x7,
-    0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1e,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x7,
-    0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x3b,
-    0x0,0x4,0x0,0xc,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0xe,
-    0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0xf,
-    0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x7,
-    0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,
-    0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x17,
-    0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x18,
-    0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1c,0x0,0x4,0x0,0x19,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x18,
-    0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x19,
-    0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x1a,
-    0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x2b,
-    0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x1e,
-    0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x23,0x0,0x0,0x0,0x3,
-    0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x25,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x3,
-    0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x3b,
-    0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x36,0x0,0x5,0x0,0x2,
-    0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5,
-    0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x41,
-    0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x3d,
-    0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,
-    0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x16,
-    0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,0x16,
-    0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x1e,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,
-    0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,0x3d,
-    0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x7,
-    0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x23,
-    0x0,0x0,0x0,0x24,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x24,
-    0x0,0x0,0x0,0x22,0x0,0x0,0x0,0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x28,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x3,0x0,0x3,0x0,
+    0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,
+    0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,
+    0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,
+    0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,
+    0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,
+    0x9,0x0,0x0,0x0,0x73,0x63,0x61,0x6c,0x65,0x64,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,
+    0x5,0x0,0xa,0x0,0xb,0x0,0x0,0x0,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x55,0x6e,0x69,
+    0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x0,
+    0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x53,0x63,0x72,
+    0x65,0x65,0x6e,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x6f,0x62,0x6a,0x65,
+    0x63,0x74,0x53,0x63,0x61,0x6c,0x65,0x0,0x5,0x0,0x3,0x0,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x5,0x0,0x14,0x0,0x0,0x0,0x69,0x6e,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,
+    0x5,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,
+    0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x0,0x0,0x0,0x0,0x6,0x0,0x7,0x0,
+    0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,
+    0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x0,0x5,0x0,0x3,0x0,0x1c,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x27,0x0,0x0,0x0,0x69,0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x0,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+    0x47,0x0,0x3,0x0,0xb,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0xd,0x0,0x0,0x0,
+    0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x21,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x14,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x4,0x0,0x0,0x0,
+    0x47,0x0,0x3,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x27,0x0,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,
+    0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x8,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0xa,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1e,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xb,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x15,0x0,0x4,0x0,
+    0xe,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,
+    0xf,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x15,0x0,0x4,0x0,
+    0x17,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x17,0x0,0x0,0x0,
+    0x18,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1c,0x0,0x4,0x0,0x19,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x18,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x1a,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x1e,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x23,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x25,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x25,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x36,0x0,0x5,0x0,
+    0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x5,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0xf,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x7,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x1e,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x1d,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,
+    0x7,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x23,0x0,0x0,0x0,0x24,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x24,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,
 };
 
-
 //Unlit fragment shader
 
 //#version 450
@@ -771,7 +919,6 @@ std::vector<uint8_t> unlitVertShaderBin = {
 ////enable uniformShaderInputLayout.ObjectInputs.useMaterialData in pipeline configuration
 //layout(set = 0, binding = 1) uniform materialUniformBufferObject {
 //	vec4 objColour;
-//	float ambientConstant;
 //	float diffuseConstant;
 //	float specularConstant;
 //	float shininess;
@@ -783,46 +930,2091 @@ std::vector<uint8_t> unlitVertShaderBin = {
 //    outColour = objColour;
 //}
 std::vector<uint8_t> unlitFragShaderBin = {
-0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,
-0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,0x2e,
-0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x1,
-0x0,0x0,0x0,0xf,0x0,0x6,0x0,0x4,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,
-0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x10,0x0,0x3,0x0,0x4,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3,
-0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,0x4f,
-0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,0x5f,
-0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,0x4f,
-0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
-0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,
-0x0,0x5,0x0,0x9,0x0,0x0,0x0,0x6f,0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,0x5,
-0x0,0x9,0x0,0xa,0x0,0x0,0x0,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x55,0x6e,0x69,0x66,0x6f,
-0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,0x6,0x0,0x6,0x0,0xa,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,0x6,
-0x0,0x7,0x0,0xa,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,
-0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x6,0x0,0x8,0x0,0xa,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x73,
-0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x0,0x0,0x0,0x6,
-0x0,0x6,0x0,0xa,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,
-0x0,0x0,0x0,0x5,0x0,0x3,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x9,
-0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,0x1,
-0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,0x2,
-0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,0x3,
-0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0xa,0x0,0x0,0x0,0x2,
-0x0,0x0,0x0,0x47,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,
-0x0,0x4,0x0,0xc,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,
-0x0,0x0,0x0,0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,
-0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,
-0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,
-0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0xa,
-0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,
-0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xb,
-0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x20,
-0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xf,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x36,
-0x0,0x5,0x0,0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,
-0x0,0x2,0x0,0x5,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0xf,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0xc,
-0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x10,
-0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xfd,0x0,0x1,0x0,0x38,
-0x0,0x1,0x0,
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0x6,0x0,0x4,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x10,0x0,0x3,0x0,0x4,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,
+    0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,
+    0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,
+    0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,
+    0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x5,0x0,0x9,0x0,0x0,0x0,0x6f,0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,
+    0x5,0x0,0x9,0x0,0xa,0x0,0x0,0x0,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x55,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,0x6,0x0,0x6,0x0,
+    0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,
+    0x6,0x0,0x7,0x0,0xa,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x6,0x0,0x8,0x0,0xa,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x0,0x0,0x0,
+    0x6,0x0,0x6,0x0,0xa,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,
+    0x73,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x9,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0xa,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x13,0x0,0x2,0x0,
+    0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,
+    0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,
+    0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0xb,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0xd,0x0,0x0,0x0,
+    0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0xe,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xf,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x36,0x0,0x5,0x0,0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x5,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0xf,0x0,0x0,0x0,0x10,0x0,0x0,0x0,
+    0xc,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0x10,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xfd,0x0,0x1,0x0,
+    0x38,0x0,0x1,0x0,
+};
+
+//Lit vertex shader (push constants)
+
+//#version 450
+//
+//layout(location = 0) in vec4 inPosition;
+////float xyz, or packed as selected by normalEncoding
+//layout(location = 1) in vec4 inNormal;
+//
+////0 = float xyz, 1 = unorm xyz (10:10:10:2), 2 = octahedral xy (snorm 2x16), see VertexNormalFormat
+//layout(constant_id = 0) const int normalEncoding = 0;
+//
+//layout(location = 0) out vec4 outPosition;
+//layout(location = 1) out vec3 outNormal;
+//
+////enable uniformShaderInputLayout.ObjectInputs.usePushConstants in pipeline configuration, the transform data
+////comes first in the push constant range, the material data directly after it
+//layout(push_constant) uniform TransformUniformBufferObject {
+//    mat4 objToWorld;
+//	mat4 objToScreen;
+//	vec4 objectScale;
+//};
+//
+//
+//vec3 decodeNormal() {
+//	vec3 normal = inNormal.xyz;
+//	if (normalEncoding == 1) {
+//		normal = normal * 2.0 - 1.0;
+//	} else if (normalEncoding == 2) {
+//		normal = vec3(inNormal.xy, 1.0 - abs(inNormal.x) - abs(inNormal.y));
+//		float t = max(-normal.z, 0.0);
+//		normal.xy += mix(vec2(t), vec2(-t), greaterThanEqual(normal.xy, vec2(0.0)));
+//		normal = normalize(normal);
+//	}
+//	return normal;
+//}
+//
+//void main() {
+//	vec4 scaledPosition = objectScale * inPosition;
+//    gl_Position = objToScreen * scaledPosition;
+//
+//	mat3 objToWorld3d = mat3(objToWorld[0].xyz, objToWorld[1].xyz, objToWorld[2].xyz);
+//	outPosition = objToWorld * scaledPosition;
+//	outNormal = objToWorld3d * decodeNormal();
+//}
+std::vector<uint8_t> litVertPushShaderBin = {
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x74,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0xa,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x48,0x0,0x0,0x0,
+    0x4b,0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,
+    0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,
+    0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,
+    0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,
+    0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x9,0x0,0x0,0x0,0x73,0x63,0x61,0x6c,0x65,0x64,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0xa,0x0,0xb,0x0,0x0,0x0,0x54,0x72,0x61,0x6e,
+    0x73,0x66,0x6f,0x72,0x6d,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,
+    0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x6f,0x62,0x6a,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x0,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x53,0x63,0x72,0x65,0x65,0x6e,0x0,0x6,0x0,0x6,0x0,
+    0xb,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x6f,0x62,0x6a,0x65,0x63,0x74,0x53,0x63,0x61,0x6c,0x65,0x0,
+    0x5,0x0,0x3,0x0,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x14,0x0,0x0,0x0,
+    0x69,0x6e,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,
+    0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,
+    0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,
+    0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x0,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x0,0x6,0x0,0x7,0x0,
+    0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x0,0x5,0x0,0x3,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,
+    0x29,0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x33,0x64,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x5,0x0,0x42,0x0,0x0,0x0,0x6f,0x75,0x74,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,
+    0x5,0x0,0x5,0x0,0x48,0x0,0x0,0x0,0x6f,0x75,0x74,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,
+    0x5,0x0,0x5,0x0,0x4b,0x0,0x0,0x0,0x69,0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x0,
+    0x48,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x4,0x0,
+    0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0xb,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x14,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x4,0x0,0x0,0x0,
+    0x47,0x0,0x3,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x42,0x0,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x48,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x4b,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x53,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x2,0x0,
+    0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,
+    0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x18,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1e,0x0,0x5,0x0,
+    0xb,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0xc,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xc,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x4e,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x13,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x14,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1c,0x0,0x4,0x0,
+    0x19,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x1b,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,
+    0x1c,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x1f,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x4f,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x24,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x28,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x24,0x0,0x0,0x0,0x42,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x47,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x26,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x47,0x0,0x0,0x0,0x48,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x4a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x14,0x0,0x2,0x0,0x50,0x0,0x0,0x0,
+    0x17,0x0,0x4,0x0,0x51,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x52,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x32,0x0,0x4,0x0,0xe,0x0,0x0,0x0,
+    0x53,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x54,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x56,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x58,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2c,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x59,0x0,0x0,0x0,
+    0x57,0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x52,0x0,0x0,0x0,
+    0x4b,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x36,0x0,0x5,0x0,0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x28,0x0,0x0,0x0,
+    0x29,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x4e,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x12,0x0,0x0,0x0,
+    0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x14,0x0,0x0,0x0,
+    0x85,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x15,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x4f,0x0,0x0,0x0,
+    0x20,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xa,0x0,0x0,0x0,
+    0x21,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x22,0x0,0x0,0x0,
+    0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x21,0x0,0x0,0x0,
+    0x22,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x24,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,
+    0x1d,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x25,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x41,0x0,0x6,0x0,
+    0x4e,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x4f,0x0,0x8,0x0,
+    0x26,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x41,0x0,0x6,0x0,0x4e,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,
+    0x2e,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,0x4f,0x0,0x8,0x0,0x26,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,
+    0x2e,0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x41,0x0,0x6,0x0,0x4e,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0xf,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x30,0x0,0x0,0x0,
+    0x4f,0x0,0x8,0x0,0x26,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x31,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x35,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x36,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x37,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x38,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x39,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x3a,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x3b,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x3c,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x3d,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x26,0x0,0x0,0x0,
+    0x3e,0x0,0x0,0x0,0x35,0x0,0x0,0x0,0x36,0x0,0x0,0x0,0x37,0x0,0x0,0x0,0x50,0x0,0x6,0x0,
+    0x26,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x39,0x0,0x0,0x0,0x3a,0x0,0x0,0x0,
+    0x50,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3b,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,
+    0x3d,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x27,0x0,0x0,0x0,0x41,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,
+    0x3f,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x29,0x0,0x0,0x0,0x41,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x4f,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x7,0x0,0x0,0x0,
+    0x46,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x42,0x0,0x0,0x0,
+    0x46,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x49,0x0,0x0,0x0,0x29,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x5a,0x0,0x0,0x0,0x4b,0x0,0x0,0x0,0x4f,0x0,0x8,0x0,
+    0x26,0x0,0x0,0x0,0x5b,0x0,0x0,0x0,0x5a,0x0,0x0,0x0,0x5a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x8e,0x0,0x5,0x0,0x26,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,
+    0x5b,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x26,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,
+    0x5c,0x0,0x0,0x0,0x59,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,
+    0x5a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,
+    0x5a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x6,0x0,0x0,0x0,0x60,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x6,0x0,0x0,0x0,
+    0x61,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0x81,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x62,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x61,0x0,0x0,0x0,0x83,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x63,0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x62,0x0,0x0,0x0,0x7f,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x63,0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,
+    0x65,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x56,0x0,0x0,0x0,
+    0x7f,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x65,0x0,0x0,0x0,0xbe,0x0,0x5,0x0,
+    0x50,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0x56,0x0,0x0,0x0,0xa9,0x0,0x6,0x0,
+    0x6,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x65,0x0,0x0,0x0,
+    0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0x68,0x0,0x0,0x0,
+    0xbe,0x0,0x5,0x0,0x50,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0x56,0x0,0x0,0x0,
+    0xa9,0x0,0x6,0x0,0x6,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x66,0x0,0x0,0x0,
+    0x65,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x6c,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,
+    0x6b,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x69,0x0,0x0,0x0,
+    0x6c,0x0,0x0,0x0,0x63,0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x6e,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0xaa,0x0,0x5,0x0,0x50,0x0,0x0,0x0,
+    0x6f,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0xaa,0x0,0x5,0x0,0x50,0x0,0x0,0x0,
+    0x70,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x54,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x51,0x0,0x0,0x0,
+    0x71,0x0,0x0,0x0,0x6f,0x0,0x0,0x0,0x6f,0x0,0x0,0x0,0x6f,0x0,0x0,0x0,0x50,0x0,0x6,0x0,
+    0x51,0x0,0x0,0x0,0x72,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x70,0x0,0x0,0x0,
+    0xa9,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x73,0x0,0x0,0x0,0x72,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,
+    0x5b,0x0,0x0,0x0,0xa9,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0x71,0x0,0x0,0x0,
+    0x6e,0x0,0x0,0x0,0x73,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x26,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,
+    0x49,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,
+    0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,
+};
+
+//Lit fragment shader (push constants)
+
+//#version 450
+//
+//
+//layout(location = 0) in vec4 inPosition;
+//layout(location = 1) in vec3 inNormal;
+//
+//
+//layout(location = 0) out vec4 outColour;
+//
+//
+////enable uniformShaderInputLayout.ObjectInputs.usePushConstants in pipeline configuration, the material data
+////follows the transform data of the vertex shader (144 bytes) in the push constant range
+//layout(push_constant) uniform materialUniformBufferObject {
+//	layout(offset = 144) vec4 objColour;
+//	float diffuseConstant;
+//	float specularConstant;
+//	float shininess;
+//};
+//
+////enable uniformShaderInputLayout.ObjectInputs.useCamTransform in pipeline configuration
+//layout(set = 0, binding = 2) uniform CameraUniformBufferObject {
+//	mat4 camTransform;
+//};
+//
+////enable uniformShaderInputLayout.GlobalInputs.useDirectionalLight in pipeline configuration
+//layout(set = 1, binding = 0) uniform LightUniformBufferObject {
+//	vec4 lightColour;
+//	vec3 lightDirection;
+//	float lightIntensity;
+//	float ambientLightIntensity;
+//};
+//
+//
+//vec4 rgb_to_hsv(vec4 rgb) { 
+//  
+//    // R, G, B values are divided by 255 
+//    // to change the range from 0..255 to 0..1 
+//	
+//
+//    // h, s, v = hue, saturation, value 
+//    float cmax = max(rgb.r, max(rgb.g, rgb.b)); // maximum of r, g, b 
+//    float cmin = min(rgb.r, min(rgb.g, rgb.b)); // minimum of r, g, b 
+//    float diff = cmax - cmin; // diff of cmax and cmin. 
+//	
+//	vec4 hsv = rgb;
+//    // if cmax and cmax are equal then h = 0 
+//    if (cmax == cmin) {
+//        hsv[0] = 0; 
+//	}
+//  
+//    // if cmax equal r then compute h 
+//    else if (cmax == rgb.r) 
+//        hsv[0] = mod(60 * ((rgb.g - rgb.b) / diff) + 360, 360); 
+//  
+//    // if cmax equal g then compute h 
+//    else if (cmax == rgb.g) 
+//        hsv[0] = mod(60 * ((rgb.b - rgb.r) / diff) + 120, 360); 
+//  
+//    // if cmax equal b then compute h 
+//    else if (cmax == rgb.b) 
+//        hsv[0] = mod(60 * ((rgb.r - rgb.g) / diff) + 240, 360); 
+//  
+//    // if cmax equal zero 
+//    if (cmax == 0) 
+//        hsv[1] = 0; 
+//    else
+//        hsv[1] = (diff / cmax); 
+//  
+//    // compute v 
+//    hsv[2] = cmax; 
+//
+//	return hsv;
+//} 
+//
+//vec4 hsv_to_rgb(vec4 hsv) {
+//    // Normalize H to [0, 360]
+//    while (hsv[0] < 0) hsv[0] += 360.0f;
+//    while (hsv[0] >= 360) hsv[0] -= 360.0f;
+//
+//    vec4 rgb = hsv;
+//
+//    if (hsv[1] <= 0.0f) {
+//        // If saturation is 0, color is grayscale
+//        rgb[0] = hsv[2];
+//        rgb[1] = hsv[2];
+//        rgb[2] = hsv[2];
+//    } else {
+//        float C = hsv[2] * hsv[1];            // Chroma
+//        float X = C * (1.0f - abs(mod(hsv[0] / 60.0f, 2) - 1.0f)); // Second largest component
+//        float m = hsv[2] - C;
+//
+//        if (hsv[0] < 60) {
+//            rgb[0] = C; rgb[1] = X; rgb[2] = 0;
+//        } else if (hsv[0] < 120) {
+//            rgb[0] = X; rgb[1] = C; rgb[2] = 0;
+//        } else if (hsv[0] < 180) {
+//            rgb[0] = 0; rgb[1] = C; rgb[2] = X;
+//        } else if (hsv[0] < 240) {
+//            rgb[0] = 0; rgb[1] = X; rgb[2] = C;
+//        } else if (hsv[0] < 300) {
+//            rgb[0] = X; rgb[1] = 0; rgb[2] = C;
+//        } else {
+//            rgb[0] = C; rgb[1] = 0; rgb[2] = X;
+//        }
+//
+//        // Add the adjustment factor (m) to bring the RGB values to the correct range
+//        rgb[0] += m;
+//        rgb[1] += m;
+//        rgb[2] += m;
+//    }
+//
+//    return rgb;
+//}
+//
+//void main() {
+//	vec3 to_light = -lightDirection;
+//	vec3 reflection = 2.0 * dot(inNormal,to_light) * inNormal - to_light;
+//	vec3 to_camera = camTransform[3].xyz - inPosition.xyz;
+//
+//	reflection = normalize( reflection );
+//	to_camera = normalize( to_camera );
+//
+//	float cos_angle = dot(reflection, to_camera);
+//	cos_angle = clamp(cos_angle, 0.0, 1.0);
+//	cos_angle = pow(cos_angle, shininess);
+//
+//	outColour = vec4(lightColour.xyz*objColour.xyz,objColour.w); 
+//	
+//	float specular_scale = specularConstant*cos_angle;
+//	float diffuse_scale = diffuseConstant*clamp(dot(to_light, inNormal),0,1);
+//
+//    float intensity = specular_scale + diffuse_scale;
+//    intensity = intensity+ambientLightIntensity;
+//
+//	float perscieved_intensity = log(1+intensity)/log(1+lightIntensity);
+//	if (perscieved_intensity > 1.0) {
+//		perscieved_intensity = 1.0;
+//	} else if (perscieved_intensity < 0) {
+//		perscieved_intensity = 0;
+//	}
+//
+//    vec4 outColour_hsv = rgb_to_hsv(outColour);
+//    outColour_hsv.z = perscieved_intensity;
+//    outColour = hsv_to_rgb(outColour_hsv);
+//}
+std::vector<uint8_t> litFragPushShaderBin = {
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x7d,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0x8,0x0,0x4,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x1c,0x1,0x0,0x0,0x31,0x1,0x0,0x0,0x48,0x1,0x0,0x0,0x10,0x0,0x3,0x0,
+    0x4,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,
+    0x4,0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,
+    0x79,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,
+    0x4,0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,
+    0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x72,0x67,0x62,0x5f,
+    0x74,0x6f,0x5f,0x68,0x73,0x76,0x28,0x76,0x66,0x34,0x3b,0x0,0x5,0x0,0x3,0x0,0xa,0x0,0x0,0x0,
+    0x72,0x67,0x62,0x0,0x5,0x0,0x6,0x0,0xe,0x0,0x0,0x0,0x68,0x73,0x76,0x5f,0x74,0x6f,0x5f,0x72,
+    0x67,0x62,0x28,0x76,0x66,0x34,0x3b,0x0,0x5,0x0,0x3,0x0,0xd,0x0,0x0,0x0,0x68,0x73,0x76,0x0,
+    0x5,0x0,0x4,0x0,0x11,0x0,0x0,0x0,0x63,0x6d,0x61,0x78,0x0,0x0,0x0,0x0,0x5,0x0,0x4,0x0,
+    0x1e,0x0,0x0,0x0,0x63,0x6d,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x4,0x0,0x27,0x0,0x0,0x0,
+    0x64,0x69,0x66,0x66,0x0,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0x2b,0x0,0x0,0x0,0x68,0x73,0x76,0x0,
+    0x5,0x0,0x3,0x0,0x96,0x0,0x0,0x0,0x72,0x67,0x62,0x0,0x5,0x0,0x3,0x0,0xa7,0x0,0x0,0x0,
+    0x43,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0xad,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x5,0x0,0x3,0x0,
+    0xb9,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x10,0x1,0x0,0x0,0x74,0x6f,0x5f,0x6c,
+    0x69,0x67,0x68,0x74,0x0,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x11,0x1,0x0,0x0,0x4c,0x69,0x67,0x68,
+    0x74,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,
+    0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x11,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x6c,0x69,0x67,0x68,
+    0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x6,0x0,0x7,0x0,0x11,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x0,0x0,0x6,0x0,0x7,0x0,
+    0x11,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x6c,0x69,0x67,0x68,0x74,0x49,0x6e,0x74,0x65,0x6e,0x73,0x69,
+    0x74,0x79,0x0,0x0,0x6,0x0,0x9,0x0,0x11,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x61,0x6d,0x62,0x69,
+    0x65,0x6e,0x74,0x4c,0x69,0x67,0x68,0x74,0x49,0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,0x79,0x0,0x0,0x0,
+    0x5,0x0,0x3,0x0,0x13,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x1a,0x1,0x0,0x0,
+    0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x5,0x0,0x1c,0x1,0x0,0x0,
+    0x69,0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x25,0x1,0x0,0x0,
+    0x74,0x6f,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x27,0x1,0x0,0x0,
+    0x43,0x61,0x6d,0x65,0x72,0x61,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,
+    0x62,0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x63,0x61,0x6d,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x0,0x0,0x0,0x0,0x5,0x0,0x3,0x0,
+    0x29,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x31,0x1,0x0,0x0,0x69,0x6e,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x5,0x0,0x39,0x1,0x0,0x0,0x63,0x6f,0x73,0x5f,
+    0x61,0x6e,0x67,0x6c,0x65,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x40,0x1,0x0,0x0,0x6d,0x61,0x74,0x65,
+    0x72,0x69,0x61,0x6c,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,
+    0x65,0x63,0x74,0x0,0x6,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x43,
+    0x6f,0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x40,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x6,0x0,0x8,0x0,
+    0x40,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0x42,0x1,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x48,0x1,0x0,0x0,0x6f,0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,
+    0x72,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x57,0x1,0x0,0x0,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x5f,0x73,0x63,0x61,0x6c,0x65,0x0,0x0,0x5,0x0,0x6,0x0,0x5d,0x1,0x0,0x0,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x65,0x1,0x0,0x0,
+    0x69,0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,0x79,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x72,0x1,0x0,0x0,
+    0x6f,0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x5f,0x68,0x73,0x76,0x0,0x0,0x0,0x5,0x0,0x4,0x0,
+    0x73,0x1,0x0,0x0,0x70,0x61,0x72,0x61,0x6d,0x0,0x0,0x0,0x5,0x0,0x4,0x0,0x78,0x1,0x0,0x0,
+    0x70,0x61,0x72,0x61,0x6d,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x11,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x13,0x1,0x0,0x0,0x22,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x13,0x1,0x0,0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x1c,0x1,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x10,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x27,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x29,0x1,0x0,0x0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x29,0x1,0x0,0x0,
+    0x21,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x31,0x1,0x0,0x0,0x1e,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0x90,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0xa0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0xa4,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0xa8,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x40,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x48,0x1,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,
+    0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,
+    0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x21,0x0,0x4,0x0,
+    0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x10,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x12,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x14,0x0,0x2,0x0,0x2f,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x0,0x0,0x70,0x42,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x45,0x0,0x0,0x0,0x0,0x0,0xb4,0x43,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x58,0x0,0x0,0x0,
+    0x0,0x0,0xf0,0x42,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x0,0x0,0x70,0x43,
+    0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x2b,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xb3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xd6,0x0,0x0,0x0,0x0,0x0,0x34,0x43,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xed,0x0,0x0,0x0,
+    0x0,0x0,0x96,0x43,0x17,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x6,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0xf,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x1e,0x0,0x6,0x0,
+    0x11,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x12,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x11,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x12,0x1,0x0,0x0,0x13,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x14,0x1,0x0,0x0,
+    0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x15,0x1,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x16,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0xe,0x1,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x1b,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x1b,0x1,0x0,0x0,0x1c,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0x26,0x1,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1e,0x0,0x3,0x0,0x27,0x1,0x0,0x0,0x26,0x1,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x28,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x27,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x28,0x1,0x0,0x0,0x29,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,
+    0x2a,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x2c,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x7c,0x1,0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x30,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x30,0x1,0x0,0x0,
+    0x31,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x41,0x1,0x0,0x0,
+    0x9,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x41,0x1,0x0,0x0,0x42,0x1,0x0,0x0,
+    0x9,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x43,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x7b,0x1,0x0,0x0,0x9,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x47,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x47,0x1,0x0,0x0,
+    0x48,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x50,0x1,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x58,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x66,0x1,0x0,0x0,0x0,0x0,0x20,0x41,0x36,0x0,0x5,0x0,
+    0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x5,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xf,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0xf,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0xf,0x1,0x0,0x0,0x25,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,
+    0x39,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x57,0x1,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x5d,0x1,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x65,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x8,0x0,0x0,0x0,0x72,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,
+    0x73,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x78,0x1,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x16,0x1,0x0,0x0,0x17,0x1,0x0,0x0,0x13,0x1,0x0,0x0,
+    0x15,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x18,0x1,0x0,0x0,0x17,0x1,0x0,0x0,
+    0x7f,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x19,0x1,0x0,0x0,0x18,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x10,0x1,0x0,0x0,0x19,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x1d,0x1,0x0,0x0,
+    0x1c,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x1e,0x1,0x0,0x0,0x10,0x1,0x0,0x0,
+    0x94,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x1f,0x1,0x0,0x0,0x1d,0x1,0x0,0x0,0x1e,0x1,0x0,0x0,
+    0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0xb3,0x0,0x0,0x0,0x1f,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x21,0x1,0x0,0x0,0x1c,0x1,0x0,0x0,0x8e,0x0,0x5,0x0,
+    0xe,0x1,0x0,0x0,0x22,0x1,0x0,0x0,0x21,0x1,0x0,0x0,0x20,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0xe,0x1,0x0,0x0,0x23,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x83,0x0,0x5,0x0,0xe,0x1,0x0,0x0,
+    0x24,0x1,0x0,0x0,0x22,0x1,0x0,0x0,0x23,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x1a,0x1,0x0,0x0,
+    0x24,0x1,0x0,0x0,0x41,0x0,0x6,0x0,0x2c,0x1,0x0,0x0,0x2d,0x1,0x0,0x0,0x29,0x1,0x0,0x0,
+    0x2a,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2e,0x1,0x0,0x0,
+    0x2d,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x2f,0x1,0x0,0x0,0x2e,0x1,0x0,0x0,
+    0x2e,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x32,0x1,0x0,0x0,0x31,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,
+    0x33,0x1,0x0,0x0,0x32,0x1,0x0,0x0,0x32,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0xe,0x1,0x0,0x0,0x34,0x1,0x0,0x0,0x2f,0x1,0x0,0x0,
+    0x33,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x25,0x1,0x0,0x0,0x34,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0xe,0x1,0x0,0x0,0x35,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0xc,0x0,0x6,0x0,0xe,0x1,0x0,0x0,
+    0x36,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x35,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x1a,0x1,0x0,0x0,0x36,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x37,0x1,0x0,0x0,
+    0x25,0x1,0x0,0x0,0xc,0x0,0x6,0x0,0xe,0x1,0x0,0x0,0x38,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x45,0x0,0x0,0x0,0x37,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x25,0x1,0x0,0x0,0x38,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x3a,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0xe,0x1,0x0,0x0,0x3b,0x1,0x0,0x0,0x25,0x1,0x0,0x0,0x94,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x3c,0x1,0x0,0x0,0x3a,0x1,0x0,0x0,0x3b,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,
+    0x3c,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3d,0x1,0x0,0x0,0x39,0x1,0x0,0x0,
+    0xc,0x0,0x8,0x0,0x6,0x0,0x0,0x0,0x3e,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x3d,0x1,0x0,0x0,0x33,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,
+    0x3e,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3f,0x1,0x0,0x0,0x39,0x1,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x7b,0x1,0x0,0x0,0x44,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x45,0x1,0x0,0x0,0x44,0x1,0x0,0x0,0xc,0x0,0x7,0x0,
+    0x6,0x0,0x0,0x0,0x46,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0x3f,0x1,0x0,0x0,
+    0x45,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,0x46,0x1,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x2c,0x1,0x0,0x0,0x49,0x1,0x0,0x0,0x13,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x4a,0x1,0x0,0x0,0x49,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,
+    0x4b,0x1,0x0,0x0,0x4a,0x1,0x0,0x0,0x4a,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x7c,0x1,0x0,0x0,0x4c,0x1,0x0,0x0,0x42,0x1,0x0,0x0,
+    0x2a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x4d,0x1,0x0,0x0,0x4c,0x1,0x0,0x0,
+    0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x4e,0x1,0x0,0x0,0x4d,0x1,0x0,0x0,0x4d,0x1,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0xe,0x1,0x0,0x0,
+    0x4f,0x1,0x0,0x0,0x4b,0x1,0x0,0x0,0x4e,0x1,0x0,0x0,0x41,0x0,0x6,0x0,0x7b,0x1,0x0,0x0,
+    0x51,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,0x50,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x52,0x1,0x0,0x0,0x51,0x1,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x53,0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x54,0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x55,0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x50,0x0,0x7,0x0,0x7,0x0,0x0,0x0,
+    0x56,0x1,0x0,0x0,0x53,0x1,0x0,0x0,0x54,0x1,0x0,0x0,0x55,0x1,0x0,0x0,0x52,0x1,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x48,0x1,0x0,0x0,0x56,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x7b,0x1,0x0,0x0,
+    0x59,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x58,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x5a,0x1,0x0,0x0,0x59,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x5b,0x1,0x0,0x0,
+    0x39,0x1,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x5c,0x1,0x0,0x0,0x5a,0x1,0x0,0x0,
+    0x5b,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x57,0x1,0x0,0x0,0x5c,0x1,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x7b,0x1,0x0,0x0,0x5e,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x15,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x5f,0x1,0x0,0x0,0x5e,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,
+    0x60,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x61,0x1,0x0,0x0,
+    0x1c,0x1,0x0,0x0,0x94,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x62,0x1,0x0,0x0,0x60,0x1,0x0,0x0,
+    0x61,0x1,0x0,0x0,0xc,0x0,0x8,0x0,0x6,0x0,0x0,0x0,0x63,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2b,0x0,0x0,0x0,0x62,0x1,0x0,0x0,0x33,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,0x85,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x64,0x1,0x0,0x0,0x5f,0x1,0x0,0x0,0x63,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x5d,0x1,0x0,0x0,0x64,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x67,0x1,0x0,0x0,
+    0x13,0x1,0x0,0x0,0x58,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x68,0x1,0x0,0x0,
+    0x67,0x1,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x69,0x1,0x0,0x0,0x66,0x1,0x0,0x0,
+    0x68,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6a,0x1,0x0,0x0,0x57,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6b,0x1,0x0,0x0,0x5d,0x1,0x0,0x0,0x81,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x6c,0x1,0x0,0x0,0x6a,0x1,0x0,0x0,0x6b,0x1,0x0,0x0,0x85,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x6d,0x1,0x0,0x0,0x69,0x1,0x0,0x0,0x6c,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x65,0x1,0x0,0x0,0x6d,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6e,0x1,0x0,0x0,
+    0x65,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x6f,0x1,0x0,0x0,0x13,0x1,0x0,0x0,
+    0x2b,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x6f,0x1,0x0,0x0,
+    0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x71,0x1,0x0,0x0,0x6e,0x1,0x0,0x0,0x70,0x1,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x65,0x1,0x0,0x0,0x71,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,
+    0x74,0x1,0x0,0x0,0x48,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x73,0x1,0x0,0x0,0x74,0x1,0x0,0x0,
+    0x39,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x75,0x1,0x0,0x0,0xb,0x0,0x0,0x0,0x73,0x1,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x72,0x1,0x0,0x0,0x75,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x76,0x1,0x0,0x0,0x65,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x77,0x1,0x0,0x0,
+    0x72,0x1,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x77,0x1,0x0,0x0,0x76,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x79,0x1,0x0,0x0,0x72,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x78,0x1,0x0,0x0,0x79,0x1,0x0,0x0,0x39,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x7a,0x1,0x0,0x0,
+    0xe,0x0,0x0,0x0,0x78,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x1,0x0,0x0,0x7a,0x1,0x0,0x0,
+    0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,0x36,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0xb,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x37,0x0,0x3,0x0,0x8,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xc,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x8,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x14,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x15,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x17,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x18,0x0,0x0,0x0,
+    0x17,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x1b,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,
+    0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x28,0x0,0x0,0x0,
+    0x18,0x0,0x0,0x0,0x1b,0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x11,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x1f,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x21,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x24,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0xc,0x0,0x7,0x0,
+    0x6,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x22,0x0,0x0,0x0,
+    0x24,0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x25,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x1e,0x0,0x0,0x0,
+    0x26,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x83,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x27,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x2b,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x2e,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x30,0x0,0x0,0x0,
+    0x2d,0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0x30,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x35,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x31,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x34,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x34,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x32,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x35,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x36,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x37,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x38,0x0,0x0,0x0,
+    0x37,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x39,0x0,0x0,0x0,0x36,0x0,0x0,0x0,
+    0x38,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x3b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,
+    0x39,0x0,0x0,0x0,0x3a,0x0,0x0,0x0,0x49,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x3a,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x41,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x42,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x43,0x0,0x0,0x0,
+    0x41,0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x44,0x0,0x0,0x0,
+    0x3c,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x46,0x0,0x0,0x0,
+    0x44,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x47,0x0,0x0,0x0,
+    0x46,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x0,0x0,
+    0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x0,0x0,0x0,0x47,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x3b,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x49,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x4a,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x4b,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x4c,0x0,0x0,0x0,0x4b,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,
+    0x4a,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x4f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0x4d,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x4e,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x50,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0x83,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x54,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x56,0x0,0x0,0x0,0x54,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x57,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x56,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x59,0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x5a,0x0,0x0,0x0,0x59,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x5b,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x5b,0x0,0x0,0x0,
+    0x5a,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5c,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,
+    0x60,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x62,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x60,0x0,0x0,0x0,0x61,0x0,0x0,0x0,0x62,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x61,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x63,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x64,0x0,0x0,0x0,
+    0x63,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x65,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x65,0x0,0x0,0x0,
+    0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x66,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x85,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x81,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x6c,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x6c,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x6e,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x6e,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x62,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x62,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x3b,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x3b,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x32,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x32,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x6f,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x70,0x0,0x0,0x0,
+    0x6f,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x72,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0x70,0x0,0x0,0x0,0x71,0x0,0x0,0x0,0x74,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x71,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x73,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x73,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x72,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x74,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x75,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x76,0x0,0x0,0x0,
+    0x11,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0x75,0x0,0x0,0x0,
+    0x76,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x78,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x72,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x72,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x79,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x7a,0x0,0x0,0x0,
+    0x2b,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x7a,0x0,0x0,0x0,0x79,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x7b,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0xfe,0x0,0x2,0x0,
+    0x7b,0x0,0x0,0x0,0x38,0x0,0x1,0x0,0x36,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0xe,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x37,0x0,0x3,0x0,0x8,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xf,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x10,0x0,0x0,0x0,0xb9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x7e,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x7e,0x0,0x0,0x0,0xf6,0x0,0x4,0x0,0x80,0x0,0x0,0x0,0x81,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x82,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x82,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x83,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x84,0x0,0x0,0x0,0x83,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,
+    0x2f,0x0,0x0,0x0,0x85,0x0,0x0,0x0,0x84,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,
+    0x85,0x0,0x0,0x0,0x7f,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x7f,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x86,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x87,0x0,0x0,0x0,0x86,0x0,0x0,0x0,0x81,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x88,0x0,0x0,0x0,0x87,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x89,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x89,0x0,0x0,0x0,0x88,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x81,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x81,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x7e,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x80,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x8a,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x8a,0x0,0x0,0x0,0xf6,0x0,0x4,0x0,
+    0x8c,0x0,0x0,0x0,0x8d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x8e,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x8e,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x8f,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x90,0x0,0x0,0x0,
+    0x8f,0x0,0x0,0x0,0xbe,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x91,0x0,0x0,0x0,0x90,0x0,0x0,0x0,
+    0x45,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x91,0x0,0x0,0x0,0x8b,0x0,0x0,0x0,0x8c,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x8b,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x92,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x93,0x0,0x0,0x0,
+    0x92,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x94,0x0,0x0,0x0,0x93,0x0,0x0,0x0,
+    0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x95,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x95,0x0,0x0,0x0,0x94,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x8d,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x8d,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x8a,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x8c,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x97,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x96,0x0,0x0,0x0,0x97,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x98,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x99,0x0,0x0,0x0,0x98,0x0,0x0,0x0,0xbc,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,
+    0x9a,0x0,0x0,0x0,0x99,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x9c,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x9a,0x0,0x0,0x0,0x9b,0x0,0x0,0x0,0xa6,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x9b,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x9d,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x9e,0x0,0x0,0x0,
+    0x9d,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x9f,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9f,0x0,0x0,0x0,0x9e,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xa1,0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xa2,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xa2,0x0,0x0,0x0,
+    0xa1,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa3,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xa4,0x0,0x0,0x0,0xa3,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xa5,0x0,0x0,0x0,0xa4,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xa6,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa8,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xa9,0x0,0x0,0x0,
+    0xa8,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xaa,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xab,0x0,0x0,0x0,0xaa,0x0,0x0,0x0,
+    0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xac,0x0,0x0,0x0,0xa9,0x0,0x0,0x0,0xab,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xa7,0x0,0x0,0x0,0xac,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xae,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xb0,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xb1,0x0,0x0,0x0,
+    0xb0,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb2,0x0,0x0,0x0,0xb1,0x0,0x0,0x0,
+    0x3c,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb4,0x0,0x0,0x0,0xb2,0x0,0x0,0x0,
+    0xb3,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb5,0x0,0x0,0x0,0xb4,0x0,0x0,0x0,
+    0xaf,0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x6,0x0,0x0,0x0,0xb6,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x4,0x0,0x0,0x0,0xb5,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb7,0x0,0x0,0x0,
+    0xaf,0x0,0x0,0x0,0xb6,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb8,0x0,0x0,0x0,
+    0xae,0x0,0x0,0x0,0xb7,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xad,0x0,0x0,0x0,0xb8,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xba,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xbb,0x0,0x0,0x0,0xba,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xbc,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0xbd,0x0,0x0,0x0,0xbb,0x0,0x0,0x0,0xbc,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xb9,0x0,0x0,0x0,
+    0xbd,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xbe,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xbf,0x0,0x0,0x0,0xbe,0x0,0x0,0x0,
+    0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xc0,0x0,0x0,0x0,0xbf,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,
+    0xf7,0x0,0x3,0x0,0xc2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xc0,0x0,0x0,0x0,
+    0xc1,0x0,0x0,0x0,0xc8,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc1,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xc3,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xc4,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xc4,0x0,0x0,0x0,
+    0xc3,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xc5,0x0,0x0,0x0,0xad,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xc6,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xc6,0x0,0x0,0x0,0xc5,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xc7,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xc7,0x0,0x0,0x0,
+    0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xc2,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc8,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xc9,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xca,0x0,0x0,0x0,0xc9,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,
+    0x2f,0x0,0x0,0x0,0xcb,0x0,0x0,0x0,0xca,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,
+    0xcd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xcb,0x0,0x0,0x0,0xcc,0x0,0x0,0x0,
+    0xd3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xcc,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xce,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xcf,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xcf,0x0,0x0,0x0,0xce,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xd0,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xd1,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xd1,0x0,0x0,0x0,0xd0,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xd2,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xd2,0x0,0x0,0x0,0x33,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0xcd,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xd3,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xd4,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xd5,0x0,0x0,0x0,0xd4,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,
+    0xd7,0x0,0x0,0x0,0xd5,0x0,0x0,0x0,0xd6,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xd9,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xd7,0x0,0x0,0x0,0xd8,0x0,0x0,0x0,0xdf,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xd8,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xda,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xda,0x0,0x0,0x0,0x33,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xdb,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xdc,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xdc,0x0,0x0,0x0,0xdb,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xdd,0x0,0x0,0x0,
+    0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xde,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xde,0x0,0x0,0x0,0xdd,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0xd9,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xdf,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xe0,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xe1,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xe2,0x0,0x0,0x0,
+    0xe1,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xe4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0xe2,0x0,0x0,0x0,0xe3,0x0,0x0,0x0,0xea,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xe3,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xe5,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xe6,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xe7,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xe7,0x0,0x0,0x0,
+    0xe6,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xe8,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe9,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xe9,0x0,0x0,0x0,0xe8,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xe4,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xea,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xeb,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xec,0x0,0x0,0x0,
+    0xeb,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xee,0x0,0x0,0x0,0xec,0x0,0x0,0x0,
+    0xed,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xf0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,
+    0xee,0x0,0x0,0x0,0xef,0x0,0x0,0x0,0xf6,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xef,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xf1,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xf2,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xf2,0x0,0x0,0x0,0xf1,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xf3,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf3,0x0,0x0,0x0,0x33,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xf4,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xf5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xf5,0x0,0x0,0x0,0xf4,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xf0,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xf6,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xf7,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xf8,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xf8,0x0,0x0,0x0,0xf7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xf9,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf9,0x0,0x0,0x0,
+    0x33,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xfa,0x0,0x0,0x0,0xad,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xfb,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xfb,0x0,0x0,0x0,0xfa,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xf0,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xf0,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xe4,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xe4,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xd9,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xd9,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0xcd,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xcd,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0xc2,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc2,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xfc,0x0,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xfd,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xfe,0x0,0x0,0x0,
+    0xfd,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xff,0x0,0x0,0x0,0xfe,0x0,0x0,0x0,
+    0xfc,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x0,0x1,0x0,0x0,0xff,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x1,0x1,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x2,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x3,0x1,0x0,0x0,0x2,0x1,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x4,0x1,0x0,0x0,
+    0x3,0x1,0x0,0x0,0x1,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x5,0x1,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x5,0x1,0x0,0x0,0x4,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6,0x1,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x7,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x8,0x1,0x0,0x0,0x7,0x1,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x9,0x1,0x0,0x0,0x8,0x1,0x0,0x0,0x6,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xa,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xa,0x1,0x0,0x0,
+    0x9,0x1,0x0,0x0,0xf9,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0xb,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0xfe,0x0,0x2,0x0,
+    0xb,0x1,0x0,0x0,0x38,0x0,0x1,0x0,
+};
+
+//Unlit vertex shader (push constants)
+
+//#version 450
+//
+//layout(location = 0) in vec4 inPosition;
+//layout(location = 1) in vec3 inNormal;
+//
+////enable uniformShaderInputLayout.ObjectInputs.usePushConstants in pipeline configuration, the transform data
+////comes first in the push constant range, the material data directly after it
+//layout(push_constant) uniform TransformUniformBufferObject {
+//	mat4 objToScreen;
+//	vec4 objectScale;
+//};
+//
+//
+//void main() {
+//	vec4 scaledPosition = objectScale * inPosition;
+//    gl_Position = objToScreen * scaledPosition;
+//}
+std::vector<uint8_t> unlitVertPushShaderBin = {
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x3,0x0,0x3,0x0,
+    0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,
+    0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,
+    0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,
+    0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,
+    0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,
+    0x9,0x0,0x0,0x0,0x73,0x63,0x61,0x6c,0x65,0x64,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,
+    0x5,0x0,0xa,0x0,0xb,0x0,0x0,0x0,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x55,0x6e,0x69,
+    0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x0,
+    0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x53,0x63,0x72,
+    0x65,0x65,0x6e,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x6f,0x62,0x6a,0x65,
+    0x63,0x74,0x53,0x63,0x61,0x6c,0x65,0x0,0x5,0x0,0x3,0x0,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x5,0x0,0x14,0x0,0x0,0x0,0x69,0x6e,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,
+    0x5,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,
+    0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x0,0x0,0x0,0x0,0x6,0x0,0x7,0x0,
+    0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,
+    0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x0,0x5,0x0,0x3,0x0,0x1c,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x27,0x0,0x0,0x0,0x69,0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x0,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+    0x47,0x0,0x3,0x0,0xb,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x14,0x0,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x13,0x0,0x2,0x0,
+    0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,
+    0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x18,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1e,0x0,0x4,0x0,
+    0xb,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xc,0x0,0x0,0x0,
+    0x9,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x9,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x10,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x28,0x0,0x0,0x0,
+    0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x15,0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x17,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1c,0x0,0x4,0x0,0x19,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x1e,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x29,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x23,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x25,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x25,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x36,0x0,0x5,0x0,
+    0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x5,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x28,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0xf,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x7,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x29,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x1d,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,
+    0x7,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x23,0x0,0x0,0x0,0x24,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x24,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,
+};
+
+//Unlit fragment shader (push constants)
+
+//#version 450
+//
+//
+//layout(location = 0) out vec4 outColour;
+//
+//
+////enable uniformShaderInputLayout.ObjectInputs.usePushConstants in pipeline configuration, the material data
+////follows the transform data of the vertex shader (80 bytes) in the push constant range
+//layout(push_constant) uniform materialUniformBufferObject {
+//	layout(offset = 80) vec4 objColour;
+//	float diffuseConstant;
+//	float specularConstant;
+//	float shininess;
+//};
+//
+//
+//
+//void main() {
+//    outColour = objColour;
+//}
+std::vector<uint8_t> unlitFragPushShaderBin = {
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0x6,0x0,0x4,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x10,0x0,0x3,0x0,0x4,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,
+    0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,
+    0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,
+    0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,
+    0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x5,0x0,0x9,0x0,0x0,0x0,0x6f,0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,
+    0x5,0x0,0x9,0x0,0xa,0x0,0x0,0x0,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x55,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,0x6,0x0,0x6,0x0,
+    0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,
+    0x6,0x0,0x7,0x0,0xa,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x6,0x0,0x8,0x0,0xa,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x0,0x0,0x0,
+    0x6,0x0,0x6,0x0,0xa,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,
+    0x73,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x9,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xa,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0xa,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x9,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x9,0x0,0x0,0x0,
+    0x15,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0xd,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xf,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x9,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x36,0x0,0x5,0x0,0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x12,0x0,0x0,0x0,
+    0x10,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,
+    0x11,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,
+};
+
+//Lit vertex shader (instanced)
+
+//#version 450
+//
+//layout(location = 0) in vec4 inPosition;
+////float xyz, or packed as selected by normalEncoding
+//layout(location = 1) in vec4 inNormal;
+//
+////0 = float xyz, 1 = unorm xyz (10:10:10:2), 2 = octahedral xy (snorm 2x16), see VertexNormalFormat
+//layout(constant_id = 0) const int normalEncoding = 0;
+//
+//layout(location = 0) out vec4 outPosition;
+//layout(location = 1) out vec3 outNormal;
+////the fragment shader reads the instance's material
+//layout(location = 2) flat out int outInstance;
+//
+//struct InstanceData {
+//    mat4 objToWorld;
+//	mat4 objToScreen;
+//	vec4 objectScale;
+//	vec4 objColour;
+//	float diffuseConstant;
+//	float specularConstant;
+//	float shininess;
+//};
+//
+////instanced draws, the transform and material data of each instance is read from the instance buffer
+//layout(set = 2, binding = 0) readonly buffer InstanceBufferObject {
+//	InstanceData instances[];
+//};
+//
+//
+//vec3 decodeNormal() {
+//	vec3 normal = inNormal.xyz;
+//	if (normalEncoding == 1) {
+//		normal = normal * 2.0 - 1.0;
+//	} else if (normalEncoding == 2) {
+//		normal = vec3(inNormal.xy, 1.0 - abs(inNormal.x) - abs(inNormal.y));
+//		float t = max(-normal.z, 0.0);
+//		normal.xy += mix(vec2(t), vec2(-t), greaterThanEqual(normal.xy, vec2(0.0)));
+//		normal = normalize(normal);
+//	}
+//	return normal;
+//}
+//
+//void main() {
+//	InstanceData instance = instances[gl_InstanceIndex];
+//	outInstance = gl_InstanceIndex;
+//	vec4 scaledPosition = instance.objectScale * inPosition;
+//    gl_Position = instance.objToScreen * scaledPosition;
+//
+//	mat3 objToWorld3d = mat3(instance.objToWorld[0].xyz, instance.objToWorld[1].xyz, instance.objToWorld[2].xyz);
+//	outPosition = instance.objToWorld * scaledPosition;
+//	outNormal = objToWorld3d * decodeNormal();
+//}
+std::vector<uint8_t> litVertInstancedShaderBin = {
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x7a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x48,0x0,0x0,0x0,
+    0x4b,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x79,0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,
+    0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,
+    0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
+    0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,
+    0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,
+    0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x9,0x0,0x0,0x0,
+    0x73,0x63,0x61,0x6c,0x65,0x64,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0xa,0x0,
+    0xb,0x0,0x0,0x0,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,
+    0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x57,0x6f,0x72,0x6c,0x64,0x0,0x0,
+    0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x53,0x63,0x72,
+    0x65,0x65,0x6e,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x6f,0x62,0x6a,0x65,
+    0x63,0x74,0x53,0x63,0x61,0x6c,0x65,0x0,0x5,0x0,0x3,0x0,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x5,0x0,0x14,0x0,0x0,0x0,0x69,0x6e,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,
+    0x5,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,
+    0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x0,0x0,0x0,0x0,0x6,0x0,0x7,0x0,
+    0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,
+    0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x0,0x5,0x0,0x3,0x0,0x1c,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x29,0x0,0x0,0x0,0x6f,0x62,0x6a,0x54,0x6f,0x57,0x6f,0x72,
+    0x6c,0x64,0x33,0x64,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x42,0x0,0x0,0x0,0x6f,0x75,0x74,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x5,0x0,0x5,0x0,0x48,0x0,0x0,0x0,0x6f,0x75,0x74,0x4e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x4b,0x0,0x0,0x0,0x69,0x6e,0x4e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x10,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x5,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x80,0x0,0x0,0x0,
+    0x47,0x0,0x3,0x0,0x52,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x52,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0x52,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x51,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0xb0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x50,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0xd,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x14,0x0,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x42,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x48,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x4b,0x0,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x57,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x79,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x47,0x0,0x3,0x0,0x79,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,
+    0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,
+    0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x18,0x0,0x4,0x0,
+    0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1e,0x0,0x5,0x0,0xb,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x1d,0x0,0x3,0x0,0x51,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x1e,0x0,0x3,0x0,0x52,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0xc,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xc,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x13,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x13,0x0,0x0,0x0,
+    0x14,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x1c,0x0,0x4,0x0,0x19,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,
+    0x1a,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x1b,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,
+    0x1d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x1f,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x24,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x17,0x0,0x4,0x0,
+    0x26,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0x27,0x0,0x0,0x0,
+    0x26,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x28,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x27,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,
+    0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x34,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x24,0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x47,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x47,0x0,0x0,0x0,0x48,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x4a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x26,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x4f,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x4f,0x0,0x0,0x0,
+    0x50,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x14,0x0,0x2,0x0,0x54,0x0,0x0,0x0,0x17,0x0,0x4,0x0,
+    0x55,0x0,0x0,0x0,0x54,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x56,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x32,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x57,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x59,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x5a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x5b,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x40,0x2c,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x5b,0x0,0x0,0x0,
+    0x5b,0x0,0x0,0x0,0x5b,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x56,0x0,0x0,0x0,0x4b,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x78,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xe,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x78,0x0,0x0,0x0,0x79,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x36,0x0,0x5,0x0,
+    0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x5,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x28,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0xe,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x79,0x0,0x0,0x0,
+    0x53,0x0,0x0,0x0,0x41,0x0,0x7,0x0,0x10,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x4e,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,
+    0x12,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x15,0x0,0x0,0x0,
+    0x14,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x12,0x0,0x0,0x0,
+    0x15,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x41,0x0,0x7,0x0,
+    0x1f,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x53,0x0,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,
+    0x7,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x24,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x25,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x41,0x0,0x8,0x0,0x10,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x4f,0x0,0x8,0x0,
+    0x26,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x41,0x0,0x8,0x0,0x10,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,0x4f,0x0,0x8,0x0,
+    0x26,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x41,0x0,0x8,0x0,0x10,0x0,0x0,0x0,0x30,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0xf,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x4f,0x0,0x8,0x0,
+    0x26,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x35,0x0,0x0,0x0,
+    0x2c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x36,0x0,0x0,0x0,
+    0x2c,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x37,0x0,0x0,0x0,
+    0x2c,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x38,0x0,0x0,0x0,
+    0x2f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x39,0x0,0x0,0x0,
+    0x2f,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x3a,0x0,0x0,0x0,
+    0x2f,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x3b,0x0,0x0,0x0,
+    0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,
+    0x32,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,
+    0x32,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,
+    0x35,0x0,0x0,0x0,0x36,0x0,0x0,0x0,0x37,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x26,0x0,0x0,0x0,
+    0x3f,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x39,0x0,0x0,0x0,0x3a,0x0,0x0,0x0,0x50,0x0,0x6,0x0,
+    0x26,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3b,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,
+    0x50,0x0,0x6,0x0,0x27,0x0,0x0,0x0,0x41,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,
+    0x40,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x29,0x0,0x0,0x0,0x41,0x0,0x0,0x0,0x41,0x0,0x7,0x0,
+    0x1f,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x53,0x0,0x0,0x0,
+    0x1d,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xa,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0x43,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,
+    0x7,0x0,0x0,0x0,0x46,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x42,0x0,0x0,0x0,0x46,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x49,0x0,0x0,0x0,
+    0x29,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0x4b,0x0,0x0,0x0,
+    0x4f,0x0,0x8,0x0,0x26,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x8e,0x0,0x5,0x0,0x26,0x0,0x0,0x0,
+    0x60,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x26,0x0,0x0,0x0,
+    0x61,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x62,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x63,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x6,0x0,0x0,0x0,
+    0x64,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x62,0x0,0x0,0x0,0xc,0x0,0x6,0x0,
+    0x6,0x0,0x0,0x0,0x65,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x63,0x0,0x0,0x0,
+    0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x65,0x0,0x0,0x0,
+    0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x5b,0x0,0x0,0x0,0x66,0x0,0x0,0x0,
+    0x7f,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0xc,0x0,0x7,0x0,
+    0x6,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x68,0x0,0x0,0x0,
+    0x5a,0x0,0x0,0x0,0x7f,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x69,0x0,0x0,0x0,
+    0xbe,0x0,0x5,0x0,0x54,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x62,0x0,0x0,0x0,0x5a,0x0,0x0,0x0,
+    0xa9,0x0,0x6,0x0,0x6,0x0,0x0,0x0,0x6c,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,
+    0x69,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x62,0x0,0x0,0x0,
+    0x6c,0x0,0x0,0x0,0xbe,0x0,0x5,0x0,0x54,0x0,0x0,0x0,0x6e,0x0,0x0,0x0,0x63,0x0,0x0,0x0,
+    0x5a,0x0,0x0,0x0,0xa9,0x0,0x6,0x0,0x6,0x0,0x0,0x0,0x6f,0x0,0x0,0x0,0x6e,0x0,0x0,0x0,
+    0x6a,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x70,0x0,0x0,0x0,
+    0x63,0x0,0x0,0x0,0x6f,0x0,0x0,0x0,0x50,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x71,0x0,0x0,0x0,
+    0x6d,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0xc,0x0,0x6,0x0,0x26,0x0,0x0,0x0,
+    0x72,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x71,0x0,0x0,0x0,0xaa,0x0,0x5,0x0,
+    0x54,0x0,0x0,0x0,0x73,0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x59,0x0,0x0,0x0,0xaa,0x0,0x5,0x0,
+    0x54,0x0,0x0,0x0,0x74,0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x50,0x0,0x6,0x0,
+    0x55,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x73,0x0,0x0,0x0,0x73,0x0,0x0,0x0,0x73,0x0,0x0,0x0,
+    0x50,0x0,0x6,0x0,0x55,0x0,0x0,0x0,0x76,0x0,0x0,0x0,0x74,0x0,0x0,0x0,0x74,0x0,0x0,0x0,
+    0x74,0x0,0x0,0x0,0xa9,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0x76,0x0,0x0,0x0,
+    0x61,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0xa9,0x0,0x6,0x0,0x26,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,
+    0x75,0x0,0x0,0x0,0x72,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x26,0x0,0x0,0x0,
+    0x4d,0x0,0x0,0x0,0x49,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x0,0x0,0x0,
+    0x4d,0x0,0x0,0x0,0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,
+};
+
+//Unlit vertex shader (instanced)
+
+//#version 450
+//
+//layout(location = 0) in vec4 inPosition;
+//layout(location = 1) in vec3 inNormal;
+//
+////the fragment shader reads the instance's material
+//layout(location = 2) flat out int outInstance;
+//
+//struct InstanceData {
+//	mat4 objToScreen;
+//	vec4 objectScale;
+//	vec4 objColour;
+//	float diffuseConstant;
+//	float specularConstant;
+//	float shininess;
+//};
+//
+////instanced draws, the transform and material data of each instance is read from the instance buffer
+//layout(set = 2, binding = 0) readonly buffer InstanceBufferObject {
+//	InstanceData instances[];
+//};
+//
+//
+//void main() {
+//	InstanceData instance = instances[gl_InstanceIndex];
+//	outInstance = gl_InstanceIndex;
+//	vec4 scaledPosition = instance.objectScale * inPosition;
+//    gl_Position = instance.objToScreen * scaledPosition;
+//}
+std::vector<uint8_t> unlitVertInstancedShaderBin = {
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0xa,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,
+    0x2f,0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,
+    0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,
+    0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,
+    0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,
+    0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x9,0x0,0x0,0x0,0x73,0x63,0x61,0x6c,0x65,0x64,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0xa,0x0,0xb,0x0,0x0,0x0,0x54,0x72,0x61,0x6e,
+    0x73,0x66,0x6f,0x72,0x6d,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,
+    0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x6f,0x62,0x6a,0x54,0x6f,0x53,0x63,0x72,0x65,0x65,0x6e,0x0,0x6,0x0,0x6,0x0,0xb,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x6f,0x62,0x6a,0x65,0x63,0x74,0x53,0x63,0x61,0x6c,0x65,0x0,0x5,0x0,0x3,0x0,
+    0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x14,0x0,0x0,0x0,0x69,0x6e,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,
+    0x65,0x72,0x56,0x65,0x72,0x74,0x65,0x78,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x6,0x0,0x7,0x0,
+    0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,
+    0x0,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,
+    0x6c,0x69,0x70,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x0,0x6,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x67,0x6c,0x5f,0x43,0x75,0x6c,0x6c,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x0,
+    0x5,0x0,0x3,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x27,0x0,0x0,0x0,
+    0x69,0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0xb,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x2c,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0x2c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x48,0x0,0x4,0x0,0x2c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x2b,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x2a,0x0,0x0,0x0,
+    0xb,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x22,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x14,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0x1a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0x1a,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x47,0x0,0x3,0x0,
+    0x1a,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x27,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x2f,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x47,0x0,0x3,0x0,0x2f,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,
+    0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,
+    0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x18,0x0,0x4,0x0,
+    0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1e,0x0,0x4,0x0,0xb,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x1d,0x0,0x3,0x0,0x2b,0x0,0x0,0x0,0xb,0x0,0x0,0x0,
+    0x1e,0x0,0x3,0x0,0x2c,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xc,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0xf,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x10,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x13,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x14,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x17,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1c,0x0,0x4,0x0,
+    0x19,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x1a,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x1b,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x1b,0x0,0x0,0x0,
+    0x1c,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x1e,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x23,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x17,0x0,0x4,0x0,
+    0x25,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x26,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x26,0x0,0x0,0x0,0x27,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x29,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x29,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x2e,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x2e,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x36,0x0,0x5,0x0,0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,
+    0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,
+    0x2a,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x2f,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,0x41,0x0,0x7,0x0,
+    0x10,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,
+    0xf,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x85,0x0,0x5,0x0,
+    0x7,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x9,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x41,0x0,0x7,0x0,0x1e,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0xa,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,
+    0x21,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x91,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x22,0x0,0x0,0x0,
+    0x20,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x23,0x0,0x0,0x0,0x24,0x0,0x0,0x0,
+    0x1c,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x24,0x0,0x0,0x0,0x22,0x0,0x0,0x0,
+    0xfd,0x0,0x1,0x0,0x38,0x0,0x1,0x0,
+};
+
+//Lit fragment shader (instanced)
+
+//#version 450
+//
+//
+//layout(location = 0) in vec4 inPosition;
+//layout(location = 1) in vec3 inNormal;
+//
+//
+//layout(location = 0) out vec4 outColour;
+//
+//
+//struct InstanceData {
+//    mat4 objToWorld;
+//	mat4 objToScreen;
+//	vec4 objectScale;
+//	vec4 objColour;
+//	float diffuseConstant;
+//	float specularConstant;
+//	float shininess;
+//};
+//
+////instanced draws, the material data of each instance follows its transform data in the instance buffer
+//layout(set = 2, binding = 0) readonly buffer InstanceBufferObject {
+//	InstanceData instances[];
+//};
+//
+//layout(location = 2) flat in int inInstance;
+//
+//vec4 objColour;
+//float diffuseConstant;
+//float specularConstant;
+//float shininess;
+//
+////enable uniformShaderInputLayout.ObjectInputs.useCamTransform in pipeline configuration
+//layout(set = 0, binding = 2) uniform CameraUniformBufferObject {
+//	mat4 camTransform;
+//};
+//
+////enable uniformShaderInputLayout.GlobalInputs.useDirectionalLight in pipeline configuration
+//layout(set = 1, binding = 0) uniform LightUniformBufferObject {
+//	vec4 lightColour;
+//	vec3 lightDirection;
+//	float lightIntensity;
+//	float ambientLightIntensity;
+//};
+//
+//
+//vec4 rgb_to_hsv(vec4 rgb) { 
+//  
+//    // R, G, B values are divided by 255 
+//    // to change the range from 0..255 to 0..1 
+//	
+//
+//    // h, s, v = hue, saturation, value 
+//    float cmax = max(rgb.r, max(rgb.g, rgb.b)); // maximum of r, g, b 
+//    float cmin = min(rgb.r, min(rgb.g, rgb.b)); // minimum of r, g, b 
+//    float diff = cmax - cmin; // diff of cmax and cmin. 
+//	
+//	vec4 hsv = rgb;
+//    // if cmax and cmax are equal then h = 0 
+//    if (cmax == cmin) {
+//        hsv[0] = 0; 
+//	}
+//  
+//    // if cmax equal r then compute h 
+//    else if (cmax == rgb.r) 
+//        hsv[0] = mod(60 * ((rgb.g - rgb.b) / diff) + 360, 360); 
+//  
+//    // if cmax equal g then compute h 
+//    else if (cmax == rgb.g) 
+//        hsv[0] = mod(60 * ((rgb.b - rgb.r) / diff) + 120, 360); 
+//  
+//    // if cmax equal b then compute h 
+//    else if (cmax == rgb.b) 
+//        hsv[0] = mod(60 * ((rgb.r - rgb.g) / diff) + 240, 360); 
+//  
+//    // if cmax equal zero 
+//    if (cmax == 0) 
+//        hsv[1] = 0; 
+//    else
+//        hsv[1] = (diff / cmax); 
+//  
+//    // compute v 
+//    hsv[2] = cmax; 
+//
+//	return hsv;
+//} 
+//
+//vec4 hsv_to_rgb(vec4 hsv) {
+//    // Normalize H to [0, 360]
+//    while (hsv[0] < 0) hsv[0] += 360.0f;
+//    while (hsv[0] >= 360) hsv[0] -= 360.0f;
+//
+//    vec4 rgb = hsv;
+//
+//    if (hsv[1] <= 0.0f) {
+//        // If saturation is 0, color is grayscale
+//        rgb[0] = hsv[2];
+//        rgb[1] = hsv[2];
+//        rgb[2] = hsv[2];
+//    } else {
+//        float C = hsv[2] * hsv[1];            // Chroma
+//        float X = C * (1.0f - abs(mod(hsv[0] / 60.0f, 2) - 1.0f)); // Second largest component
+//        float m = hsv[2] - C;
+//
+//        if (hsv[0] < 60) {
+//            rgb[0] = C; rgb[1] = X; rgb[2] = 0;
+//        } else if (hsv[0] < 120) {
+//            rgb[0] = X; rgb[1] = C; rgb[2] = 0;
+//        } else if (hsv[0] < 180) {
+//            rgb[0] = 0; rgb[1] = C; rgb[2] = X;
+//        } else if (hsv[0] < 240) {
+//            rgb[0] = 0; rgb[1] = X; rgb[2] = C;
+//        } else if (hsv[0] < 300) {
+//            rgb[0] = X; rgb[1] = 0; rgb[2] = C;
+//        } else {
+//            rgb[0] = C; rgb[1] = 0; rgb[2] = X;
+//        }
+//
+//        // Add the adjustment factor (m) to bring the RGB values to the correct range
+//        rgb[0] += m;
+//        rgb[1] += m;
+//        rgb[2] += m;
+//    }
+//
+//    return rgb;
+//}
+//
+//void main() {
+//	objColour = instances[inInstance].objColour;
+//	diffuseConstant = instances[inInstance].diffuseConstant;
+//	specularConstant = instances[inInstance].specularConstant;
+//	shininess = instances[inInstance].shininess;
+//
+//	vec3 to_light = -lightDirection;
+//	vec3 reflection = 2.0 * dot(inNormal,to_light) * inNormal - to_light;
+//	vec3 to_camera = camTransform[3].xyz - inPosition.xyz;
+//
+//	reflection = normalize( reflection );
+//	to_camera = normalize( to_camera );
+//
+//	float cos_angle = dot(reflection, to_camera);
+//	cos_angle = clamp(cos_angle, 0.0, 1.0);
+//	cos_angle = pow(cos_angle, shininess);
+//
+//	outColour = vec4(lightColour.xyz*objColour.xyz,objColour.w); 
+//	
+//	float specular_scale = specularConstant*cos_angle;
+//	float diffuse_scale = diffuseConstant*clamp(dot(to_light, inNormal),0,1);
+//
+//    float intensity = specular_scale + diffuse_scale;
+//    intensity = intensity+ambientLightIntensity;
+//
+//	float perscieved_intensity = log(1+intensity)/log(1+lightIntensity);
+//	if (perscieved_intensity > 1.0) {
+//		perscieved_intensity = 1.0;
+//	} else if (perscieved_intensity < 0) {
+//		perscieved_intensity = 0;
+//	}
+//
+//    vec4 outColour_hsv = rgb_to_hsv(outColour);
+//    outColour_hsv.z = perscieved_intensity;
+//    outColour = hsv_to_rgb(outColour_hsv);
+//}
+std::vector<uint8_t> litFragInstancedShaderBin = {
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x85,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0x9,0x0,0x4,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x1c,0x1,0x0,0x0,0x31,0x1,0x0,0x0,0x48,0x1,0x0,0x0,0x7d,0x1,0x0,0x0,
+    0x10,0x0,0x3,0x0,0x4,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,
+    0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,
+    0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
+    0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,
+    0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,
+    0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0xb,0x0,0x0,0x0,
+    0x72,0x67,0x62,0x5f,0x74,0x6f,0x5f,0x68,0x73,0x76,0x28,0x76,0x66,0x34,0x3b,0x0,0x5,0x0,0x3,0x0,
+    0xa,0x0,0x0,0x0,0x72,0x67,0x62,0x0,0x5,0x0,0x6,0x0,0xe,0x0,0x0,0x0,0x68,0x73,0x76,0x5f,
+    0x74,0x6f,0x5f,0x72,0x67,0x62,0x28,0x76,0x66,0x34,0x3b,0x0,0x5,0x0,0x3,0x0,0xd,0x0,0x0,0x0,
+    0x68,0x73,0x76,0x0,0x5,0x0,0x4,0x0,0x11,0x0,0x0,0x0,0x63,0x6d,0x61,0x78,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x4,0x0,0x1e,0x0,0x0,0x0,0x63,0x6d,0x69,0x6e,0x0,0x0,0x0,0x0,0x5,0x0,0x4,0x0,
+    0x27,0x0,0x0,0x0,0x64,0x69,0x66,0x66,0x0,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0x2b,0x0,0x0,0x0,
+    0x68,0x73,0x76,0x0,0x5,0x0,0x3,0x0,0x96,0x0,0x0,0x0,0x72,0x67,0x62,0x0,0x5,0x0,0x3,0x0,
+    0xa7,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0xad,0x0,0x0,0x0,0x58,0x0,0x0,0x0,
+    0x5,0x0,0x3,0x0,0xb9,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x10,0x1,0x0,0x0,
+    0x74,0x6f,0x5f,0x6c,0x69,0x67,0x68,0x74,0x0,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x11,0x1,0x0,0x0,
+    0x4c,0x69,0x67,0x68,0x74,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,
+    0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x11,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x6c,0x69,0x67,0x68,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x6,0x0,0x7,0x0,0x11,0x1,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x0,0x0,
+    0x6,0x0,0x7,0x0,0x11,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x6c,0x69,0x67,0x68,0x74,0x49,0x6e,0x74,
+    0x65,0x6e,0x73,0x69,0x74,0x79,0x0,0x0,0x6,0x0,0x9,0x0,0x11,0x1,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x4c,0x69,0x67,0x68,0x74,0x49,0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,
+    0x79,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0x13,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,
+    0x1a,0x1,0x0,0x0,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x5,0x0,
+    0x1c,0x1,0x0,0x0,0x69,0x6e,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,
+    0x25,0x1,0x0,0x0,0x74,0x6f,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x0,0x0,0x0,0x5,0x0,0x9,0x0,
+    0x27,0x1,0x0,0x0,0x43,0x61,0x6d,0x65,0x72,0x61,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,
+    0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x27,0x1,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x63,0x61,0x6d,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x0,0x0,0x0,0x0,
+    0x5,0x0,0x3,0x0,0x29,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x31,0x1,0x0,0x0,
+    0x69,0x6e,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x0,0x0,0x5,0x0,0x5,0x0,0x39,0x1,0x0,0x0,
+    0x63,0x6f,0x73,0x5f,0x61,0x6e,0x67,0x6c,0x65,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0x40,0x1,0x0,0x0,
+    0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,
+    0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,0x6,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x6f,0x62,0x6a,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0x40,0x1,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,
+    0x6,0x0,0x8,0x0,0x40,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+    0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0x40,0x1,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x0,0x0,0x0,0x5,0x0,0x3,0x0,
+    0x42,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x48,0x1,0x0,0x0,0x6f,0x75,0x74,0x43,
+    0x6f,0x6c,0x6f,0x75,0x72,0x0,0x0,0x0,0x5,0x0,0x6,0x0,0x57,0x1,0x0,0x0,0x73,0x70,0x65,0x63,
+    0x75,0x6c,0x61,0x72,0x5f,0x73,0x63,0x61,0x6c,0x65,0x0,0x0,0x5,0x0,0x6,0x0,0x5d,0x1,0x0,0x0,
+    0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x0,0x0,0x0,0x5,0x0,0x5,0x0,
+    0x65,0x1,0x0,0x0,0x69,0x6e,0x74,0x65,0x6e,0x73,0x69,0x74,0x79,0x0,0x0,0x0,0x5,0x0,0x6,0x0,
+    0x72,0x1,0x0,0x0,0x6f,0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,0x72,0x5f,0x68,0x73,0x76,0x0,0x0,0x0,
+    0x5,0x0,0x4,0x0,0x73,0x1,0x0,0x0,0x70,0x61,0x72,0x61,0x6d,0x0,0x0,0x0,0x5,0x0,0x4,0x0,
+    0x78,0x1,0x0,0x0,0x70,0x61,0x72,0x61,0x6d,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x11,0x1,0x0,0x0,
+    0x3,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x11,0x1,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x13,0x1,0x0,0x0,0x22,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x13,0x1,0x0,0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x1c,0x1,0x0,0x0,0x1e,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0x27,0x1,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x27,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x27,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x29,0x1,0x0,0x0,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x29,0x1,0x0,0x0,0x21,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x31,0x1,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0xa4,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x40,0x1,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0xa8,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x7f,0x1,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x48,0x0,0x5,0x0,0x7f,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x48,0x0,0x4,0x0,0x7f,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0x7e,0x1,0x0,0x0,0x6,0x0,0x0,0x0,0xb0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x42,0x1,0x0,0x0,
+    0x22,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x42,0x1,0x0,0x0,0x21,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x48,0x1,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x7d,0x1,0x0,0x0,0x1e,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x3,0x0,
+    0x7d,0x1,0x0,0x0,0xe,0x0,0x0,0x0,0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,
+    0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x8,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x21,0x0,0x4,0x0,0x9,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x12,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x12,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x14,0x0,0x2,0x0,0x2f,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x3c,0x0,0x0,0x0,0x0,0x0,0x70,0x42,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x45,0x0,0x0,0x0,
+    0x0,0x0,0xb4,0x43,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x0,0x0,0xf0,0x42,
+    0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x0,0x0,0x70,0x43,0x2b,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xb3,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xd6,0x0,0x0,0x0,
+    0x0,0x0,0x34,0x43,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xed,0x0,0x0,0x0,0x0,0x0,0x96,0x43,
+    0x17,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x6,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0xf,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x1e,0x0,0x6,0x0,0x11,0x1,0x0,0x0,
+    0x7,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x12,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x11,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x12,0x1,0x0,0x0,
+    0x13,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x15,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x20,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x15,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x16,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x1b,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0xe,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x1b,0x1,0x0,0x0,
+    0x1c,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x18,0x0,0x4,0x0,0x26,0x1,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x4,0x0,0x0,0x0,0x1e,0x0,0x3,0x0,0x27,0x1,0x0,0x0,0x26,0x1,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x28,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x27,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x28,0x1,0x0,0x0,
+    0x29,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x2c,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x30,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x30,0x1,0x0,0x0,
+    0x31,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x1e,0x0,0x6,0x0,0x40,0x1,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x1d,0x0,0x3,0x0,0x7e,0x1,0x0,0x0,
+    0x40,0x1,0x0,0x0,0x1e,0x0,0x3,0x0,0x7f,0x1,0x0,0x0,0x7e,0x1,0x0,0x0,0x20,0x0,0x4,0x0,
+    0x41,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x7f,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,0x41,0x1,0x0,0x0,
+    0x42,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x43,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x47,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x47,0x1,0x0,0x0,0x48,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0x12,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x3,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,
+    0x58,0x1,0x0,0x0,0x2,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x66,0x1,0x0,0x0,
+    0x0,0x0,0x20,0x41,0x2b,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x7b,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x20,0x0,0x4,0x0,0x7c,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x14,0x1,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x7c,0x1,0x0,0x0,0x7d,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x36,0x0,0x5,0x0,0x2,0x0,0x0,0x0,
+    0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0xf,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0xf,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xf,0x1,0x0,0x0,
+    0x25,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x39,0x1,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x57,0x1,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x5d,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x10,0x0,0x0,0x0,0x65,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,
+    0x72,0x1,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x73,0x1,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x78,0x1,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x16,0x1,0x0,0x0,0x17,0x1,0x0,0x0,0x13,0x1,0x0,0x0,0x15,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x18,0x1,0x0,0x0,0x17,0x1,0x0,0x0,0x7f,0x0,0x4,0x0,
+    0xe,0x1,0x0,0x0,0x19,0x1,0x0,0x0,0x18,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x10,0x1,0x0,0x0,
+    0x19,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x1d,0x1,0x0,0x0,0x1c,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x1e,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x94,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x1f,0x1,0x0,0x0,0x1d,0x1,0x0,0x0,0x1e,0x1,0x0,0x0,0x85,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x20,0x1,0x0,0x0,0xb3,0x0,0x0,0x0,0x1f,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0xe,0x1,0x0,0x0,0x21,0x1,0x0,0x0,0x1c,0x1,0x0,0x0,0x8e,0x0,0x5,0x0,0xe,0x1,0x0,0x0,
+    0x22,0x1,0x0,0x0,0x21,0x1,0x0,0x0,0x20,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,
+    0x23,0x1,0x0,0x0,0x10,0x1,0x0,0x0,0x83,0x0,0x5,0x0,0xe,0x1,0x0,0x0,0x24,0x1,0x0,0x0,
+    0x22,0x1,0x0,0x0,0x23,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x1a,0x1,0x0,0x0,0x24,0x1,0x0,0x0,
+    0x41,0x0,0x6,0x0,0x2c,0x1,0x0,0x0,0x2d,0x1,0x0,0x0,0x29,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,
+    0x2b,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2e,0x1,0x0,0x0,0x2d,0x1,0x0,0x0,
+    0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x2f,0x1,0x0,0x0,0x2e,0x1,0x0,0x0,0x2e,0x1,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,
+    0x32,0x1,0x0,0x0,0x31,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x33,0x1,0x0,0x0,
+    0x32,0x1,0x0,0x0,0x32,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x83,0x0,0x5,0x0,0xe,0x1,0x0,0x0,0x34,0x1,0x0,0x0,0x2f,0x1,0x0,0x0,0x33,0x1,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x25,0x1,0x0,0x0,0x34,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,
+    0x35,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0xc,0x0,0x6,0x0,0xe,0x1,0x0,0x0,0x36,0x1,0x0,0x0,
+    0x1,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x35,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x1a,0x1,0x0,0x0,
+    0x36,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x37,0x1,0x0,0x0,0x25,0x1,0x0,0x0,
+    0xc,0x0,0x6,0x0,0xe,0x1,0x0,0x0,0x38,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x45,0x0,0x0,0x0,
+    0x37,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x25,0x1,0x0,0x0,0x38,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0xe,0x1,0x0,0x0,0x3a,0x1,0x0,0x0,0x1a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,
+    0x3b,0x1,0x0,0x0,0x25,0x1,0x0,0x0,0x94,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x3c,0x1,0x0,0x0,
+    0x3a,0x1,0x0,0x0,0x3b,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,0x3c,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3d,0x1,0x0,0x0,0x39,0x1,0x0,0x0,0xc,0x0,0x8,0x0,
+    0x6,0x0,0x0,0x0,0x3e,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x3d,0x1,0x0,0x0,
+    0x33,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,0x3e,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3f,0x1,0x0,0x0,0x39,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x14,0x1,0x0,0x0,0x80,0x1,0x0,0x0,0x7d,0x1,0x0,0x0,0x41,0x0,0x7,0x0,0x43,0x1,0x0,0x0,
+    0x44,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x7b,0x1,0x0,0x0,0x80,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x45,0x1,0x0,0x0,0x44,0x1,0x0,0x0,0xc,0x0,0x7,0x0,
+    0x6,0x0,0x0,0x0,0x46,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0x3f,0x1,0x0,0x0,
+    0x45,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x39,0x1,0x0,0x0,0x46,0x1,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x2c,0x1,0x0,0x0,0x49,0x1,0x0,0x0,0x13,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x4a,0x1,0x0,0x0,0x49,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,
+    0x4b,0x1,0x0,0x0,0x4a,0x1,0x0,0x0,0x4a,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x81,0x1,0x0,0x0,0x7d,0x1,0x0,0x0,
+    0x41,0x0,0x7,0x0,0x2c,0x1,0x0,0x0,0x4c,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x7b,0x1,0x0,0x0,
+    0x81,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x4d,0x1,0x0,0x0,
+    0x4c,0x1,0x0,0x0,0x4f,0x0,0x8,0x0,0xe,0x1,0x0,0x0,0x4e,0x1,0x0,0x0,0x4d,0x1,0x0,0x0,
+    0x4d,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x85,0x0,0x5,0x0,
+    0xe,0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x4b,0x1,0x0,0x0,0x4e,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x14,0x1,0x0,0x0,0x82,0x1,0x0,0x0,0x7d,0x1,0x0,0x0,0x41,0x0,0x8,0x0,0x43,0x1,0x0,0x0,
+    0x51,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x7b,0x1,0x0,0x0,0x82,0x1,0x0,0x0,0x2a,0x1,0x0,0x0,
+    0x50,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x52,0x1,0x0,0x0,0x51,0x1,0x0,0x0,
+    0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x53,0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x54,0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x51,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x55,0x1,0x0,0x0,0x4f,0x1,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x50,0x0,0x7,0x0,0x7,0x0,0x0,0x0,0x56,0x1,0x0,0x0,0x53,0x1,0x0,0x0,0x54,0x1,0x0,0x0,
+    0x55,0x1,0x0,0x0,0x52,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x1,0x0,0x0,0x56,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x83,0x1,0x0,0x0,0x7d,0x1,0x0,0x0,0x41,0x0,0x7,0x0,
+    0x43,0x1,0x0,0x0,0x59,0x1,0x0,0x0,0x42,0x1,0x0,0x0,0x7b,0x1,0x0,0x0,0x83,0x1,0x0,0x0,
+    0x58,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x5a,0x1,0x0,0x0,0x59,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x5b,0x1,0x0,0x0,0x39,0x1,0x0,0x0,0x85,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x5c,0x1,0x0,0x0,0x5a,0x1,0x0,0x0,0x5b,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x57,0x1,0x0,0x0,0x5c,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x14,0x1,0x0,0x0,0x84,0x1,0x0,0x0,
+    0x7d,0x1,0x0,0x0,0x41,0x0,0x7,0x0,0x43,0x1,0x0,0x0,0x5e,0x1,0x0,0x0,0x42,0x1,0x0,0x0,
+    0x7b,0x1,0x0,0x0,0x84,0x1,0x0,0x0,0x15,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x5f,0x1,0x0,0x0,0x5e,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x60,0x1,0x0,0x0,
+    0x10,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0xe,0x1,0x0,0x0,0x61,0x1,0x0,0x0,0x1c,0x1,0x0,0x0,
+    0x94,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x62,0x1,0x0,0x0,0x60,0x1,0x0,0x0,0x61,0x1,0x0,0x0,
+    0xc,0x0,0x8,0x0,0x6,0x0,0x0,0x0,0x63,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x62,0x1,0x0,0x0,0x33,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x64,0x1,0x0,0x0,0x5f,0x1,0x0,0x0,0x63,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x5d,0x1,0x0,0x0,
+    0x64,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x67,0x1,0x0,0x0,0x13,0x1,0x0,0x0,
+    0x58,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x68,0x1,0x0,0x0,0x67,0x1,0x0,0x0,
+    0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x69,0x1,0x0,0x0,0x66,0x1,0x0,0x0,0x68,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6a,0x1,0x0,0x0,0x57,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x6b,0x1,0x0,0x0,0x5d,0x1,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x6c,0x1,0x0,0x0,0x6a,0x1,0x0,0x0,0x6b,0x1,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x6d,0x1,0x0,0x0,0x69,0x1,0x0,0x0,0x6c,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x65,0x1,0x0,0x0,
+    0x6d,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6e,0x1,0x0,0x0,0x65,0x1,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x43,0x1,0x0,0x0,0x6f,0x1,0x0,0x0,0x13,0x1,0x0,0x0,0x2b,0x1,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x70,0x1,0x0,0x0,0x6f,0x1,0x0,0x0,0x81,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x71,0x1,0x0,0x0,0x6e,0x1,0x0,0x0,0x70,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x65,0x1,0x0,0x0,0x71,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x74,0x1,0x0,0x0,
+    0x48,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x73,0x1,0x0,0x0,0x74,0x1,0x0,0x0,0x39,0x0,0x5,0x0,
+    0x7,0x0,0x0,0x0,0x75,0x1,0x0,0x0,0xb,0x0,0x0,0x0,0x73,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0x72,0x1,0x0,0x0,0x75,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x76,0x1,0x0,0x0,
+    0x65,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x77,0x1,0x0,0x0,0x72,0x1,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x77,0x1,0x0,0x0,0x76,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x79,0x1,0x0,0x0,0x72,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x78,0x1,0x0,0x0,
+    0x79,0x1,0x0,0x0,0x39,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0x7a,0x1,0x0,0x0,0xe,0x0,0x0,0x0,
+    0x78,0x1,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x1,0x0,0x0,0x7a,0x1,0x0,0x0,0xfd,0x0,0x1,0x0,
+    0x38,0x0,0x1,0x0,0x36,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x9,0x0,0x0,0x0,0x37,0x0,0x3,0x0,0x8,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xc,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x10,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,
+    0x2b,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x14,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x15,0x0,0x0,0x0,
+    0x14,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x17,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x17,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x1b,0x0,0x0,0x0,0x1a,0x0,0x0,0x0,0xc,0x0,0x7,0x0,
+    0x6,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x18,0x0,0x0,0x0,
+    0x1b,0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x1d,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+    0x28,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x11,0x0,0x0,0x0,
+    0x1d,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1f,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x24,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,
+    0x25,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x24,0x0,0x0,0x0,
+    0xc,0x0,0x7,0x0,0x6,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x25,0x0,0x0,0x0,
+    0x20,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x1e,0x0,0x0,0x0,0x26,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x2a,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x27,0x0,0x0,0x0,
+    0x2a,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x2b,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x2d,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x2e,0x0,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,
+    0x2e,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,
+    0x30,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0x35,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x31,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x34,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x34,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x32,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x35,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x36,0x0,0x0,0x0,
+    0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x37,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x37,0x0,0x0,0x0,
+    0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x39,0x0,0x0,0x0,0x36,0x0,0x0,0x0,0x38,0x0,0x0,0x0,
+    0xf7,0x0,0x3,0x0,0x3b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x39,0x0,0x0,0x0,
+    0x3a,0x0,0x0,0x0,0x49,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x3a,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x3f,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x40,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x41,0x0,0x0,0x0,
+    0x3e,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x42,0x0,0x0,0x0,
+    0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0x41,0x0,0x0,0x0,
+    0x42,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,
+    0x43,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x46,0x0,0x0,0x0,0x44,0x0,0x0,0x0,
+    0x45,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x47,0x0,0x0,0x0,0x46,0x0,0x0,0x0,
+    0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x48,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x48,0x0,0x0,0x0,0x47,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x3b,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x49,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x4a,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x4b,0x0,0x0,0x0,
+    0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x4c,0x0,0x0,0x0,
+    0x4b,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,0x4a,0x0,0x0,0x0,
+    0x4c,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x4f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,
+    0x4d,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x4e,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x54,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x55,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x56,0x0,0x0,0x0,
+    0x54,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x57,0x0,0x0,0x0,
+    0x3c,0x0,0x0,0x0,0x56,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x59,0x0,0x0,0x0,
+    0x57,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x5a,0x0,0x0,0x0,
+    0x59,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x5b,0x0,0x0,0x0,
+    0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x5b,0x0,0x0,0x0,0x5a,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x5c,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x5e,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x5f,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x60,0x0,0x0,0x0,
+    0x5d,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0x60,0x0,0x0,0x0,0x61,0x0,0x0,0x0,0x62,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x61,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x63,0x0,0x0,0x0,0xa,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x63,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x65,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x16,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x65,0x0,0x0,0x0,0x83,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x69,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x6a,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x6c,0x0,0x0,0x0,0x6a,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x6d,0x0,0x0,0x0,0x6c,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x6e,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x6e,0x0,0x0,0x0,
+    0x6d,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x62,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x62,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x4f,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x3b,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x3b,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x32,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x32,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x6f,0x0,0x0,0x0,
+    0x11,0x0,0x0,0x0,0xb4,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x6f,0x0,0x0,0x0,
+    0x33,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x72,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,
+    0x70,0x0,0x0,0x0,0x71,0x0,0x0,0x0,0x74,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x71,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x73,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x16,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x73,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x72,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x74,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x75,0x0,0x0,0x0,
+    0x27,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x76,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x76,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x16,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x78,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x72,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x72,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x79,0x0,0x0,0x0,
+    0x11,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x7a,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x7a,0x0,0x0,0x0,0x79,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0x7b,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0xfe,0x0,0x2,0x0,0x7b,0x0,0x0,0x0,
+    0x38,0x0,0x1,0x0,0x36,0x0,0x5,0x0,0x7,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x9,0x0,0x0,0x0,0x37,0x0,0x3,0x0,0x8,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xf,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,
+    0x10,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x10,0x0,0x0,0x0,
+    0xb9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x7e,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x7e,0x0,0x0,0x0,0xf6,0x0,0x4,0x0,0x80,0x0,0x0,0x0,0x81,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x82,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x82,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x83,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x84,0x0,0x0,0x0,0x83,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,
+    0x85,0x0,0x0,0x0,0x84,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0x85,0x0,0x0,0x0,
+    0x7f,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x7f,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0x86,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x87,0x0,0x0,0x0,0x86,0x0,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,
+    0x88,0x0,0x0,0x0,0x87,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x89,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x89,0x0,0x0,0x0,
+    0x88,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x81,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x81,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x7e,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x80,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0x8a,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x8a,0x0,0x0,0x0,0xf6,0x0,0x4,0x0,0x8c,0x0,0x0,0x0,
+    0x8d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x8e,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x8e,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x8f,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x8f,0x0,0x0,0x0,
+    0xbe,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x91,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x45,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0x91,0x0,0x0,0x0,0x8b,0x0,0x0,0x0,0x8c,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x8b,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x92,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x93,0x0,0x0,0x0,0x92,0x0,0x0,0x0,
+    0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x94,0x0,0x0,0x0,0x93,0x0,0x0,0x0,0x45,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x95,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x95,0x0,0x0,0x0,0x94,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x8d,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0x8d,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x8a,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x8c,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x97,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x96,0x0,0x0,0x0,0x97,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x98,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x99,0x0,0x0,0x0,0x98,0x0,0x0,0x0,0xbc,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0x9a,0x0,0x0,0x0,
+    0x99,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0x9c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0x9a,0x0,0x0,0x0,0x9b,0x0,0x0,0x0,0xa6,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x9b,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x9d,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x9e,0x0,0x0,0x0,0x9d,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x9f,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x9f,0x0,0x0,0x0,0x9e,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xa0,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xa1,0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa2,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xa2,0x0,0x0,0x0,0xa1,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa3,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xa4,0x0,0x0,0x0,0xa3,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xa5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xa5,0x0,0x0,0x0,0xa4,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xa6,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa8,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xa9,0x0,0x0,0x0,0xa8,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xaa,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x16,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xab,0x0,0x0,0x0,0xaa,0x0,0x0,0x0,0x85,0x0,0x5,0x0,
+    0x6,0x0,0x0,0x0,0xac,0x0,0x0,0x0,0xa9,0x0,0x0,0x0,0xab,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xa7,0x0,0x0,0x0,0xac,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xae,0x0,0x0,0x0,
+    0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xb0,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xb1,0x0,0x0,0x0,0xb0,0x0,0x0,0x0,
+    0x88,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb2,0x0,0x0,0x0,0xb1,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,
+    0x8d,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb4,0x0,0x0,0x0,0xb2,0x0,0x0,0x0,0xb3,0x0,0x0,0x0,
+    0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb5,0x0,0x0,0x0,0xb4,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,
+    0xc,0x0,0x6,0x0,0x6,0x0,0x0,0x0,0xb6,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x4,0x0,0x0,0x0,
+    0xb5,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb7,0x0,0x0,0x0,0xaf,0x0,0x0,0x0,
+    0xb6,0x0,0x0,0x0,0x85,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xb8,0x0,0x0,0x0,0xae,0x0,0x0,0x0,
+    0xb7,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xad,0x0,0x0,0x0,0xb8,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xba,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xbb,0x0,0x0,0x0,0xba,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xbc,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x83,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xbd,0x0,0x0,0x0,
+    0xbb,0x0,0x0,0x0,0xbc,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xb9,0x0,0x0,0x0,0xbd,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xbe,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xbf,0x0,0x0,0x0,0xbe,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,
+    0x2f,0x0,0x0,0x0,0xc0,0x0,0x0,0x0,0xbf,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,
+    0xc2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xc0,0x0,0x0,0x0,0xc1,0x0,0x0,0x0,
+    0xc8,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc1,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xc3,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xc4,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xc4,0x0,0x0,0x0,0xc3,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xc5,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xc6,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xc6,0x0,0x0,0x0,0xc5,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xc7,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xc7,0x0,0x0,0x0,0x33,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0xc2,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xc8,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xc9,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xca,0x0,0x0,0x0,0xc9,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,
+    0xcb,0x0,0x0,0x0,0xca,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xcd,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xcb,0x0,0x0,0x0,0xcc,0x0,0x0,0x0,0xd3,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xcc,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xce,0x0,0x0,0x0,
+    0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xcf,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xcf,0x0,0x0,0x0,0xce,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xd0,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xd1,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xd1,0x0,0x0,0x0,
+    0xd0,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xd2,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xd2,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0xcd,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xd3,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xd4,0x0,0x0,0x0,0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xd5,0x0,0x0,0x0,0xd4,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xd7,0x0,0x0,0x0,
+    0xd5,0x0,0x0,0x0,0xd6,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xd9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0xfa,0x0,0x4,0x0,0xd7,0x0,0x0,0x0,0xd8,0x0,0x0,0x0,0xdf,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xd8,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xda,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xda,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xdb,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xdc,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xdc,0x0,0x0,0x0,
+    0xdb,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xdd,0x0,0x0,0x0,0xad,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xde,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xde,0x0,0x0,0x0,0xdd,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xd9,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xdf,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,
+    0xd,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xe1,0x0,0x0,0x0,
+    0xe0,0x0,0x0,0x0,0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xe2,0x0,0x0,0x0,0xe1,0x0,0x0,0x0,
+    0x6b,0x0,0x0,0x0,0xf7,0x0,0x3,0x0,0xe4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,
+    0xe2,0x0,0x0,0x0,0xe3,0x0,0x0,0x0,0xea,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xe3,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0xe5,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0xe6,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xe7,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xe7,0x0,0x0,0x0,0xe6,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xe8,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xe9,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xe9,0x0,0x0,0x0,0xe8,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xe4,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xea,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xeb,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xec,0x0,0x0,0x0,0xeb,0x0,0x0,0x0,
+    0xb8,0x0,0x5,0x0,0x2f,0x0,0x0,0x0,0xee,0x0,0x0,0x0,0xec,0x0,0x0,0x0,0xed,0x0,0x0,0x0,
+    0xf7,0x0,0x3,0x0,0xf0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfa,0x0,0x4,0x0,0xee,0x0,0x0,0x0,
+    0xef,0x0,0x0,0x0,0xf6,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xef,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xf1,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xf2,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf2,0x0,0x0,0x0,
+    0xf1,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xf3,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf3,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0xf4,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0xf5,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf5,0x0,0x0,0x0,
+    0xf4,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xf0,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xf6,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xf7,0x0,0x0,0x0,0xa7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xf8,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xf8,0x0,0x0,0x0,0xf7,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xf9,0x0,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xf9,0x0,0x0,0x0,0x33,0x0,0x0,0x0,
+    0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xfa,0x0,0x0,0x0,0xad,0x0,0x0,0x0,0x41,0x0,0x5,0x0,
+    0x10,0x0,0x0,0x0,0xfb,0x0,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,
+    0xfb,0x0,0x0,0x0,0xfa,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xf0,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0xf0,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xe4,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xe4,0x0,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0xd9,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xd9,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,
+    0xcd,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0xcd,0x0,0x0,0x0,0xf9,0x0,0x2,0x0,0xc2,0x0,0x0,0x0,
+    0xf8,0x0,0x2,0x0,0xc2,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xfc,0x0,0x0,0x0,
+    0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xfd,0x0,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x13,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0xfe,0x0,0x0,0x0,0xfd,0x0,0x0,0x0,
+    0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0xff,0x0,0x0,0x0,0xfe,0x0,0x0,0x0,0xfc,0x0,0x0,0x0,
+    0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x13,0x0,0x0,0x0,
+    0x3e,0x0,0x3,0x0,0x0,0x1,0x0,0x0,0xff,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x1,0x1,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x2,0x1,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,0x3,0x1,0x0,0x0,
+    0x2,0x1,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x4,0x1,0x0,0x0,0x3,0x1,0x0,0x0,
+    0x1,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0x5,0x1,0x0,0x0,0x96,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x5,0x1,0x0,0x0,0x4,0x1,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x6,0x0,0x0,0x0,0x6,0x1,0x0,0x0,0xb9,0x0,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,
+    0x7,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x6,0x0,0x0,0x0,
+    0x8,0x1,0x0,0x0,0x7,0x1,0x0,0x0,0x81,0x0,0x5,0x0,0x6,0x0,0x0,0x0,0x9,0x1,0x0,0x0,
+    0x8,0x1,0x0,0x0,0x6,0x1,0x0,0x0,0x41,0x0,0x5,0x0,0x10,0x0,0x0,0x0,0xa,0x1,0x0,0x0,
+    0x96,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0xa,0x1,0x0,0x0,0x9,0x1,0x0,0x0,
+    0xf9,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,0x9c,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,
+    0x7,0x0,0x0,0x0,0xb,0x1,0x0,0x0,0x96,0x0,0x0,0x0,0xfe,0x0,0x2,0x0,0xb,0x1,0x0,0x0,
+    0x38,0x0,0x1,0x0,
+};
+
+//Unlit fragment shader (instanced)
+
+//#version 450
+//
+//
+//layout(location = 0) out vec4 outColour;
+//
+//
+//struct InstanceData {
+//	mat4 objToScreen;
+//	vec4 objectScale;
+//	vec4 objColour;
+//	float diffuseConstant;
+//	float specularConstant;
+//	float shininess;
+//};
+//
+////instanced draws, the material data of each instance follows its transform data in the instance buffer
+//layout(set = 2, binding = 0) readonly buffer InstanceBufferObject {
+//	InstanceData instances[];
+//};
+//
+//layout(location = 2) flat in int inInstance;
+//
+//vec4 objColour;
+//float diffuseConstant;
+//float specularConstant;
+//float shininess;
+//
+//
+//
+//void main() {
+//	objColour = instances[inInstance].objColour;
+//	diffuseConstant = instances[inInstance].diffuseConstant;
+//	specularConstant = instances[inInstance].specularConstant;
+//	shininess = instances[inInstance].shininess;
+//
+//    outColour = objColour;
+//}
+std::vector<uint8_t> unlitFragInstancedShaderBin = {
+    0x3,0x2,0x23,0x7,0x0,0x0,0x1,0x0,0xb,0x0,0xd,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x11,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0xb,0x0,0x6,0x0,0x1,0x0,0x0,0x0,0x47,0x4c,0x53,0x4c,
+    0x2e,0x73,0x74,0x64,0x2e,0x34,0x35,0x30,0x0,0x0,0x0,0x0,0xe,0x0,0x3,0x0,0x0,0x0,0x0,0x0,
+    0x1,0x0,0x0,0x0,0xf,0x0,0x7,0x0,0x4,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x10,0x0,0x3,0x0,0x4,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3,0x0,0x3,0x0,0x2,0x0,0x0,0x0,0xc2,0x1,0x0,0x0,0x4,0x0,0xa,0x0,
+    0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x63,0x70,0x70,0x5f,0x73,0x74,0x79,0x6c,0x65,0x5f,
+    0x6c,0x69,0x6e,0x65,0x5f,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x0,0x4,0x0,0x8,0x0,
+    0x47,0x4c,0x5f,0x47,0x4f,0x4f,0x47,0x4c,0x45,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x5f,0x64,0x69,
+    0x72,0x65,0x63,0x74,0x69,0x76,0x65,0x0,0x5,0x0,0x4,0x0,0x4,0x0,0x0,0x0,0x6d,0x61,0x69,0x6e,
+    0x0,0x0,0x0,0x0,0x5,0x0,0x5,0x0,0x9,0x0,0x0,0x0,0x6f,0x75,0x74,0x43,0x6f,0x6c,0x6f,0x75,
+    0x72,0x0,0x0,0x0,0x5,0x0,0x9,0x0,0xa,0x0,0x0,0x0,0x6d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+    0x55,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x42,0x75,0x66,0x66,0x65,0x72,0x4f,0x62,0x6a,0x65,0x63,0x74,0x0,
+    0x6,0x0,0x6,0x0,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6f,0x62,0x6a,0x43,0x6f,0x6c,0x6f,0x75,
+    0x72,0x0,0x0,0x0,0x6,0x0,0x7,0x0,0xa,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x64,0x69,0x66,0x66,
+    0x75,0x73,0x65,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x0,0x6,0x0,0x8,0x0,0xa,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,
+    0x0,0x0,0x0,0x0,0x6,0x0,0x6,0x0,0xa,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x73,0x68,0x69,0x6e,
+    0x69,0x6e,0x65,0x73,0x73,0x0,0x0,0x0,0x5,0x0,0x3,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0x9,0x0,0x0,0x0,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0xa,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0xa,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x48,0x0,0x5,0x0,
+    0xa,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x47,0x0,0x3,0x0,
+    0x16,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x48,0x0,0x5,0x0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x0,0x4,0x0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+    0x18,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x15,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x70,0x0,0x0,0x0,
+    0x47,0x0,0x4,0x0,0xc,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x4,0x0,
+    0xc,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x0,0x4,0x0,0x14,0x0,0x0,0x0,
+    0x1e,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x47,0x0,0x3,0x0,0x14,0x0,0x0,0x0,0xe,0x0,0x0,0x0,
+    0x13,0x0,0x2,0x0,0x2,0x0,0x0,0x0,0x21,0x0,0x3,0x0,0x3,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x16,0x0,0x3,0x0,0x6,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x17,0x0,0x4,0x0,0x7,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x7,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0x8,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+    0x1e,0x0,0x6,0x0,0xa,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+    0x6,0x0,0x0,0x0,0x1d,0x0,0x3,0x0,0x15,0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x1e,0x0,0x3,0x0,
+    0x16,0x0,0x0,0x0,0x15,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x16,0x0,0x0,0x0,0x3b,0x0,0x4,0x0,0xb,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x2,0x0,0x0,0x0,
+    0x15,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,
+    0xd,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0xf,0x0,0x0,0x0,
+    0x2,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x2b,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x12,0x0,0x0,0x0,
+    0x0,0x0,0x0,0x0,0x20,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0xd,0x0,0x0,0x0,
+    0x3b,0x0,0x4,0x0,0x13,0x0,0x0,0x0,0x14,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x36,0x0,0x5,0x0,
+    0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0xf8,0x0,0x2,0x0,
+    0x5,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0xd,0x0,0x0,0x0,0x17,0x0,0x0,0x0,0x14,0x0,0x0,0x0,
+    0x41,0x0,0x7,0x0,0xf,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x12,0x0,0x0,0x0,
+    0x17,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x3d,0x0,0x4,0x0,0x7,0x0,0x0,0x0,0x11,0x0,0x0,0x0,
+    0x10,0x0,0x0,0x0,0x3e,0x0,0x3,0x0,0x9,0x0,0x0,0x0,0x11,0x0,0x0,0x0,0xfd,0x0,0x1,0x0,
+    0x38,0x0,0x1,0x0,
 };
 
 }
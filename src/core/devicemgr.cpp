@@ -1,5 +1,6 @@
 #include <iostream>
 #include "devicemgr.h"
+#include "memalloc.h"
 
 
 namespace RenderingFramework3D {
@@ -21,8 +22,10 @@ DeviceManager::DeviceManager()
 }
 
 DeviceManager::~DeviceManager() {
-    for (auto& dev : _devices) {
+    for (unsigned idx = 0; idx < _devices.size(); idx++) {
+        auto& dev = _devices[idx];
         if (dev.logicalDev != VK_NULL_HANDLE) {
+            MemoryAllocator::ReleaseDevice(idx);
             for (auto& queue : dev.queues) {
                 queue.vkqueue = VK_NULL_HANDLE;
                 if (queue.cmdpool != VK_NULL_HANDLE) vkDestroyCommandPool(dev.logicalDev, queue.cmdpool, nullptr);
@@ -50,6 +53,7 @@ bool DeviceManager::Initialize() {
 void DeviceManager::Cleanup() {
     if (_init && _instance) {
         delete _instance;
+        _instance = nullptr;
         _init = false;
     }
 }
@@ -79,7 +83,17 @@ bool DeviceManager::GetQueueIdx(unsigned devID, QueueType queue, unsigned& idx)
             return false;
         }
 
-        idx = _instance->_devices[devID].gfxQueueIdx;
+        switch(queue) {
+            case QUEUE_TYPE_GRAPHICS:
+                idx = _instance->_devices[devID].gfxQueueIdx;
+                break;
+            case QUEUE_TYPE_PRESENT:
+                idx = _instance->_devices[devID].presentQueueIdx;
+                break;
+            case QUEUE_TYPE_TRANSFER:
+                idx = _instance->_devices[devID].transferQueueIdx;
+                break;
+        }
 
         return true;
     }
@@ -97,6 +111,9 @@ VkQueue DeviceManager::GetVkQueue(unsigned devID, QueueType queue) {
             case QUEUE_TYPE_PRESENT:
                 idx = _instance->_devices[devID].presentQueueIdx;
                 break;
+            case QUEUE_TYPE_TRANSFER:
+                idx = _instance->_devices[devID].transferQueueIdx;
+                break;
         }
 
         return _instance->_devices[devID].queues[idx].vkqueue;
@@ -118,6 +135,9 @@ bool DeviceManager::CreateCommandBuffer(unsigned id, QueueType queueType, bool p
             case QUEUE_TYPE_PRESENT:
                 queue = _instance->_devices[id].presentQueueIdx;
                 break;
+            case QUEUE_TYPE_TRANSFER:
+                queue = _instance->_devices[id].transferQueueIdx;
+                break;
         }
 
         if (primary) {
@@ -138,6 +158,59 @@ bool DeviceManager::CreateCommandBuffer(unsigned id, QueueType queueType, bool p
     return false;
 }
 
+bool DeviceManager::CreateCommandPool(unsigned id, QueueType queueType, bool primary, VkCommandPool& pool) {
+    if (_instance) {
+        if (id >= _instance->_devices.size() || _instance->_devices[id].logicalDev == VK_NULL_HANDLE) {
+            return false;
+        }
+
+        unsigned queue = -1;
+        switch(queueType) {
+            case QUEUE_TYPE_GRAPHICS:
+                queue = _instance->_devices[id].gfxQueueIdx;
+                break;
+            case QUEUE_TYPE_PRESENT:
+                queue = _instance->_devices[id].presentQueueIdx;
+                break;
+            case QUEUE_TYPE_TRANSFER:
+                queue = _instance->_devices[id].transferQueueIdx;
+                break;
+        }
+
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        if (primary == false) poolInfo.flags |= VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = queue;
+
+        if (vkCreateCommandPool(_instance->_devices[id].logicalDev, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool DeviceManager::CreateCommandBuffer(unsigned id, VkCommandPool pool, bool primary, VkCommandBuffer& buffer) {
+    if (_instance) {
+        if (id >= _instance->_devices.size() || _instance->_devices[id].logicalDev == VK_NULL_HANDLE) {
+            return false;
+        }
+
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = pool;
+        allocInfo.level = primary ? VK_COMMAND_BUFFER_LEVEL_PRIMARY : VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocInfo.commandBufferCount = 1;
+
+        if (vkAllocateCommandBuffers(_instance->_devices[id].logicalDev, &allocInfo, &buffer) != VK_SUCCESS) {
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
 bool DeviceManager::CheckQueueReady(unsigned id, QueueType queueType, bool& ready) {
     ready = false;
     if (_instance) {
@@ -153,6 +226,9 @@ bool DeviceManager::CheckQueueReady(unsigned id, QueueType queueType, bool& read
             case QUEUE_TYPE_PRESENT:
                 queue = _instance->_devices[id].presentQueueIdx;
                 break;
+            case QUEUE_TYPE_TRANSFER:
+                queue = _instance->_devices[id].transferQueueIdx;
+                break;
         }
         auto ret = vkGetFenceStatus(_instance->_devices[id].logicalDev, _instance->_devices[id].queues[queue].fence);
 
@@ -178,6 +254,9 @@ bool DeviceManager::WaitForQueue(unsigned id, QueueType queueType) {
             case QUEUE_TYPE_PRESENT:
                 queue = _instance->_devices[id].presentQueueIdx;
                 break;
+            case QUEUE_TYPE_TRANSFER:
+                queue = _instance->_devices[id].transferQueueIdx;
+                break;
         }
 
         if (vkWaitForFences(_instance->_devices[id].logicalDev, 1, &_instance->_devices[id].queues[queue].fence, VK_TRUE, UINT64_MAX) != VK_SUCCESS) {
@@ -203,6 +282,9 @@ bool DeviceManager::SubmitCommandBuffer(unsigned id, QueueType queueType, VkComm
             case QUEUE_TYPE_PRESENT:
                 queue = _instance->_devices[id].presentQueueIdx;
                 break;
+            case QUEUE_TYPE_TRANSFER:
+                queue = _instance->_devices[id].transferQueueIdx;
+                break;
         }
 
         bool ready = false;
@@ -243,6 +325,80 @@ bool DeviceManager::SubmitCommandBuffer(unsigned id, QueueType queueType, VkComm
     return false;
 }
 
+bool DeviceManager::SubmitCommandBuffer(unsigned id, QueueType queueType, VkCommandBuffer buffer, VkSemaphore waitSem, VkPipelineStageFlags waitStage, VkSemaphore signalSem, VkFence fence) {
+    if (_instance) {
+
+        if (id >= _instance->_devices.size() || _instance->_devices[id].logicalDev == VK_NULL_HANDLE) {
+            return false;
+        }
+
+        unsigned queue = -1;
+        switch(queueType) {
+            case QUEUE_TYPE_GRAPHICS:
+                queue = _instance->_devices[id].gfxQueueIdx;
+                break;
+            case QUEUE_TYPE_PRESENT:
+                queue = _instance->_devices[id].presentQueueIdx;
+                break;
+            case QUEUE_TYPE_TRANSFER:
+                queue = _instance->_devices[id].transferQueueIdx;
+                break;
+        }
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &buffer;
+
+        if (waitSem != VK_NULL_HANDLE) {
+            submitInfo.waitSemaphoreCount = 1;
+            submitInfo.pWaitDstStageMask = &waitStage;
+            submitInfo.pWaitSemaphores = &waitSem;
+        }
+        if (signalSem != VK_NULL_HANDLE) {
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores = &signalSem;
+        }
+        if (vkQueueSubmit(_instance->_devices[id].queues[queue].vkqueue, 1, &submitInfo, fence) != VK_SUCCESS) {
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool DeviceManager::WaitIdle(unsigned id) {
+    if (_instance) {
+        if (id >= _instance->_devices.size() || _instance->_devices[id].logicalDev == VK_NULL_HANDLE) {
+            return false;
+        }
+        return vkDeviceWaitIdle(_instance->_devices[id].logicalDev) == VK_SUCCESS;
+    }
+    return false;
+}
+
+bool DeviceManager::GetTimestampPeriod(unsigned id, float& period) {
+    period = 0;
+    if (_instance) {
+        if (id >= _instance->_devices.size() || _instance->_devices[id].logicalDev == VK_NULL_HANDLE) {
+            return false;
+        }
+        period = _instance->_devices[id].timestampPeriod;
+        return period > 0;
+    }
+    return false;
+}
+
+bool DeviceManager::HasMultiDrawIndirect(unsigned id) {
+    if (_instance) {
+        if (id >= _instance->_devices.size() || _instance->_devices[id].logicalDev == VK_NULL_HANDLE) {
+            return false;
+        }
+        return _instance->_devices[id].multiDrawIndirect;
+    }
+    return false;
+}
+
 bool DeviceManager::CreateVkSurface(GLFWwindow* window, VkSurfaceKHR& surface) {
     if (_instance) {
         if (glfwCreateWindowSurface(_instance->_vk_instance, window, nullptr, &surface) != VK_SUCCESS) {
@@ -260,19 +416,41 @@ bool DeviceManager::FindSuitableDevice(VkSurfaceKHR surface, unsigned& id,  Swap
             unsigned numQueueFamily;
             SwapChainSupportDetails swDetails;
             if (isDeviceSuitable(dev.physDev, surface, dev.gfxQueueIdx, dev.presentQueueIdx, numQueueFamily, swDetails)) {
-                if (dev.logicalDev == VK_NULL_HANDLE && _instance->createLogicalDevice(idx, numQueueFamily) == false) {
+                if (dev.logicalDev == VK_NULL_HANDLE && _instance->createLogicalDevice(idx, numQueueFamily, true) == false) {
                     return false;
                 }
-
-                if(_instance->createCommandPool(idx, dev.gfxQueueIdx, false)==false) {
+                if (_instance->setupDevice(idx) == false) {
                     return false;
                 }
 
-                if(_instance->createCommandBuffer(idx, dev.gfxQueueIdx, false, dev.loadCmdBuffer) == false) {
+                swapchainSupport = swDetails;
+                id = idx;
+                return true;
+            }
+            idx++;
+        }
+    }
+    return false;
+}
+
+bool DeviceManager::FindHeadlessDevice(unsigned& id) {
+    if (_instance) {
+        unsigned idx = 0;
+        for (auto& dev : _instance->_devices) {
+            unsigned numQueueFamily;
+            // a device already created for a window keeps its queues
+            unsigned gfxQueueIdx = dev.gfxQueueIdx;
+            if (dev.logicalDev != VK_NULL_HANDLE || findGraphicsQueue(dev.physDev, gfxQueueIdx, numQueueFamily)) {
+                if (dev.logicalDev == VK_NULL_HANDLE) {
+                    dev.gfxQueueIdx = gfxQueueIdx;
+                    dev.presentQueueIdx = gfxQueueIdx;
+                    if (_instance->createLogicalDevice(idx, numQueueFamily, false) == false) {
+                        return false;
+                    }
+                }
+                if (_instance->setupDevice(idx) == false) {
                     return false;
                 }
-
-                swapchainSupport = swDetails;
                 id = idx;
                 return true;
             }
@@ -282,13 +460,53 @@ bool DeviceManager::FindSuitableDevice(VkSurfaceKHR surface, unsigned& id,  Swap
     return false;
 }
 
+bool DeviceManager::setupDevice(unsigned devIdx) {
+    Device& dev = _devices[devIdx];
+    // submitted directly to the queue, so it has to be a primary command buffer
+    if (dev.loadCmdBuffer == VK_NULL_HANDLE) {
+        if (dev.queues[dev.gfxQueueIdx].cmdpool == VK_NULL_HANDLE && createCommandPool(devIdx, dev.gfxQueueIdx, true) == false) {
+            return false;
+        }
+        if (createCommandBuffer(devIdx, dev.gfxQueueIdx, true, dev.loadCmdBuffer) == false) {
+            return false;
+        }
+    }
+
+    dev.timestampPeriod = 0;
+    unsigned count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(dev.physDev, &count, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(count);
+    vkGetPhysicalDeviceQueueFamilyProperties(dev.physDev, &count, queueFamilies.data());
+    // a transfer only family usually maps to the DMA engines, copies there run alongside rendering
+    dev.transferQueueIdx = dev.gfxQueueIdx;
+    for (unsigned i = 0; i < count && i < dev.queues.size(); i++) {
+        if ((queueFamilies[i].queueFlags & VK_QUEUE_TRANSFER_BIT) && (queueFamilies[i].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0) {
+            dev.transferQueueIdx = i;
+            break;
+        }
+    }
+    if (dev.gfxQueueIdx < count && queueFamilies[dev.gfxQueueIdx].timestampValidBits > 0) {
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(dev.physDev, &properties);
+        dev.timestampPeriod = properties.limits.timestampPeriod;
+    }
+    return true;
+}
 
 bool DeviceManager::CopyBuffer(unsigned devID, VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size) {
+	VkBufferCopy copyRegion{};
+	copyRegion.srcOffset = 0;
+	copyRegion.dstOffset = 0;
+	copyRegion.size = size;
+	return CopyBuffer(devID, srcBuffer, dstBuffer, std::vector<VkBufferCopy>{ copyRegion });
+}
+
+bool DeviceManager::CopyBuffer(unsigned devID, VkBuffer srcBuffer, VkBuffer dstBuffer, const std::vector<VkBufferCopy>& regions) {
 	if(_instance == nullptr) {
         return false;
     }
 
-    if (devID > _instance->_devices.size() || srcBuffer == VK_NULL_HANDLE || dstBuffer == VK_NULL_HANDLE) {
+    if (devID > _instance->_devices.size() || srcBuffer == VK_NULL_HANDLE || dstBuffer == VK_NULL_HANDLE || regions.empty()) {
 		return false;
 	}
 
@@ -306,11 +524,7 @@ bool DeviceManager::CopyBuffer(unsigned devID, VkBuffer srcBuffer, VkBuffer dstB
 		return false;
 	}
 
-	VkBufferCopy copyRegion{};
-	copyRegion.srcOffset = 0;
-	copyRegion.dstOffset = 0;
-	copyRegion.size = size;
-	vkCmdCopyBuffer(_instance->_devices[devID].loadCmdBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+	vkCmdCopyBuffer(_instance->_devices[devID].loadCmdBuffer, srcBuffer, dstBuffer, regions.size(), regions.data());
 	if (vkEndCommandBuffer(_instance->_devices[devID].loadCmdBuffer) != VK_SUCCESS) {
 		return false;
 	}
@@ -341,7 +555,11 @@ bool DeviceManager::createVKInstance() {
     uint32_t glfwExtensionCount = 0;
     const char** glfwExtensions;
 
+    // without a display (or before the first window) glfw reports no extensions, only offscreen rendering is possible then
     glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+    if (glfwExtensions == nullptr) {
+        glfwExtensionCount = 0;
+    }
 
     createInfo.enabledExtensionCount = glfwExtensionCount;
     createInfo.ppEnabledExtensionNames = glfwExtensions;
@@ -362,11 +580,17 @@ bool DeviceManager::enlistPhysicalDevices() {
     for (unsigned i = 0; i < count; i++) {
         _devices[i].physDev = physDevs[i];
         _devices[i].logicalDev = VK_NULL_HANDLE;
+        _devices[i].timestampPeriod = 0;
+        _devices[i].multiDrawIndirect = false;
+        _devices[i].loadCmdBuffer = VK_NULL_HANDLE;
+        _devices[i].gfxQueueIdx = 0;
+        _devices[i].presentQueueIdx = 0;
+        _devices[i].transferQueueIdx = 0;
     }
     return true;
 }
 
-bool DeviceManager::createLogicalDevice(unsigned devIdx, unsigned numIdx) {
+bool DeviceManager::createLogicalDevice(unsigned devIdx, unsigned numIdx, bool presentation) {
     if (devIdx >= _devices.size()) {
         return false;
     }
@@ -382,14 +606,20 @@ bool DeviceManager::createLogicalDevice(unsigned devIdx, unsigned numIdx) {
         queues[i] = queueInfo;
     }
 
+    // indirect draws of several commands starting at any instance, used by cluster culling when available
+    VkPhysicalDeviceFeatures supportedFeatures;
+    vkGetPhysicalDeviceFeatures(_devices[devIdx].physDev, &supportedFeatures);
     VkPhysicalDeviceFeatures deviceFeatures = {};
+    _devices[devIdx].multiDrawIndirect = supportedFeatures.multiDrawIndirect && supportedFeatures.drawIndirectFirstInstance;
+    deviceFeatures.multiDrawIndirect = _devices[devIdx].multiDrawIndirect;
+    deviceFeatures.drawIndirectFirstInstance = _devices[devIdx].multiDrawIndirect;
     VkDeviceCreateInfo deviceCreateInfo = {};
     deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     deviceCreateInfo.queueCreateInfoCount = queues.size();
     deviceCreateInfo.pQueueCreateInfos = queues.data();
     deviceCreateInfo.pEnabledFeatures = &deviceFeatures;
-    deviceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
-    deviceCreateInfo.ppEnabledExtensionNames = deviceExtensions.data();
+    deviceCreateInfo.enabledExtensionCount = presentation ? static_cast<uint32_t>(deviceExtensions.size()) : 0;
+    deviceCreateInfo.ppEnabledExtensionNames = presentation ? deviceExtensions.data() : nullptr;
 
     VkResult result;
     if ((result=vkCreateDevice(_devices[devIdx].physDev, &deviceCreateInfo, nullptr, &_devices[devIdx].logicalDev)) != VK_SUCCESS) {
@@ -462,6 +692,22 @@ bool DeviceManager::createCommandBuffer(unsigned devIdx, unsigned queueIdx, bool
 }
 
 
+bool DeviceManager::findGraphicsQueue(VkPhysicalDevice device, unsigned& gfxQueueIndex, unsigned& numIdx) {
+    unsigned count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(device, &count, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(count);
+    vkGetPhysicalDeviceQueueFamilyProperties(device, &count, queueFamilies.data());
+    numIdx = count;
+
+    for (unsigned i = 0; i < count; i++) {
+        if (queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+            gfxQueueIndex = i;
+            return true;
+        }
+    }
+    return false;
+}
+
 bool DeviceManager::isDeviceSuitable(VkPhysicalDevice device, VkSurfaceKHR surface, unsigned& gfxQueueIndex, unsigned& presentQueueIndex, unsigned& numIdx, SwapChainSupportDetails& swapchainSupport) {
     bool gfxqfound = false, presqfound = false;
     unsigned count = 0;
@@ -9,6 +9,8 @@ public:
 	enum QueueType {
 		QUEUE_TYPE_GRAPHICS,
 		QUEUE_TYPE_PRESENT,
+		// dedicated transfer queue family if the device has one, the graphics queue otherwise
+		QUEUE_TYPE_TRANSFER,
 	}; 
 
 public:
@@ -22,15 +24,29 @@ public:
 	static bool GetQueueIdx(unsigned devID, QueueType queue, unsigned& idx);
 	static VkQueue GetVkQueue(unsigned devID, QueueType queue);
 	static bool CreateCommandBuffer(unsigned  devID, QueueType queue, bool primary, VkCommandBuffer& buffer);
+	// caller owned pools, command pools are externally synchronized so each recording thread needs its own
+	static bool CreateCommandPool(unsigned devID, QueueType queue, bool primary, VkCommandPool& pool);
+	static bool CreateCommandBuffer(unsigned devID, VkCommandPool pool, bool primary, VkCommandBuffer& buffer);
 	
 	static bool CheckQueueReady(unsigned  devID, QueueType queue, bool& ready);
 	static bool WaitForQueue(unsigned  devID, QueueType queue);
 	static bool SubmitCommandBuffer(unsigned  devID, QueueType queueType, VkCommandBuffer buffer, VkSemaphore waitSem, VkPipelineStageFlags waitStage, VkSemaphore signalSem, bool block=true);
+	// submit signalling a caller owned fence instead of the queue fence, never blocks
+	static bool SubmitCommandBuffer(unsigned  devID, QueueType queueType, VkCommandBuffer buffer, VkSemaphore waitSem, VkPipelineStageFlags waitStage, VkSemaphore signalSem, VkFence fence);
+	static bool WaitIdle(unsigned devID);
+
+	// nanoseconds per timestamp tick, false if the graphics queue does not support timestamps
+	static bool GetTimestampPeriod(unsigned devID, float& period);
+	// multiDrawIndirect and drawIndirectFirstInstance, enabled when the device supports both
+	static bool HasMultiDrawIndirect(unsigned devID);
 
 	static bool CreateVkSurface(GLFWwindow* window, VkSurfaceKHR& surface);
 	static bool FindSuitableDevice(VkSurfaceKHR surface, unsigned & devID, SwapChainSupportDetails& swapchainSupport);
+	// first device with a graphics queue, no surface or swapchain support required
+	static bool FindHeadlessDevice(unsigned& devID);
 	
 	static bool CopyBuffer(unsigned devID, VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
+	static bool CopyBuffer(unsigned devID, VkBuffer srcBuffer, VkBuffer dstBuffer, const std::vector<VkBufferCopy>& regions);
 
 private:
 	DeviceManager();
@@ -38,11 +54,13 @@ private:
 
 	bool createVKInstance();
 	bool enlistPhysicalDevices();
-	bool createLogicalDevice(unsigned devIdx, unsigned numIdx);
+	bool createLogicalDevice(unsigned devIdx, unsigned numIdx, bool presentation);
+	bool setupDevice(unsigned devIdx);
 	bool createCommandPool(unsigned devIdx, unsigned queueIdx, bool primary);
 	bool createCommandBuffer(unsigned devIdx, unsigned queueIdx, bool primary, VkCommandBuffer& buffer);
 
 	static bool isDeviceSuitable(VkPhysicalDevice device, VkSurfaceKHR surface, unsigned& gfxQueueIndex, unsigned& presentQueueIndex, unsigned& numIdx, SwapChainSupportDetails& swapchainSupport);
+	static bool findGraphicsQueue(VkPhysicalDevice device, unsigned& gfxQueueIndex, unsigned& numIdx);
 
 private:
 	struct DeviceQueue {
@@ -59,6 +77,9 @@ private:
 		VkCommandBuffer loadCmdBuffer;
 		unsigned gfxQueueIdx;
 		unsigned presentQueueIdx;
+		unsigned transferQueueIdx;
+		float timestampPeriod;
+		bool multiDrawIndirect;
 	};
 
 	std::vector<Device> _devices;
@@ -0,0 +1,502 @@
+#include <algorithm>
+#include "memalloc.h"
+#include "devicemgr.h"
+
+
+namespace RenderingFramework3D {
+
+static constexpr VkDeviceSize default_block_size = 64ull << 20;
+
+static VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) {
+	return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+}
+
+class MemoryAllocator::DeviceAllocator {
+public:
+	DeviceAllocator(unsigned devID);
+	~DeviceAllocator();
+
+	bool Allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, bool linear, MemoryAllocation& allocation);
+	void Free(MemoryAllocation& allocation);
+	bool GetMappedRange(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size, VkMappedMemoryRange& range) const;
+	void GetStats(MemoryStats& stats);
+
+private:
+	struct Range {
+		VkDeviceSize offset;
+		VkDeviceSize size;
+	};
+	struct Block {
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkDeviceSize size = 0;
+		uint8_t* mapped = nullptr;
+		// free ranges sorted by offset, neighbours are always merged
+		std::vector<Range> free;
+		unsigned allocations = 0;
+	};
+	// one pool per memory type and resource kind, released blocks keep their index so allocations stay valid
+	struct Pool {
+		unsigned memoryType = 0;
+		std::vector<Block> blocks;
+	};
+
+	bool allocateMemory(unsigned memoryType, VkDeviceSize size, VkDeviceMemory& memory, uint8_t** mapped);
+	bool allocateFromPool(Pool& pool, VkDeviceSize size, VkDeviceSize alignment, unsigned& blockIdx, VkDeviceSize& offset);
+	void releaseBlock(Block& block);
+
+private:
+	VkDevice _dev;
+	VkPhysicalDeviceMemoryProperties _mem_props;
+	VkDeviceSize _non_coherent_atom;
+	std::vector<VkDeviceSize> _block_size;
+	std::vector<Pool> _pools;
+
+	unsigned _dedicated_count;
+	unsigned _allocation_count;
+	VkDeviceSize _dedicated_bytes;
+	VkDeviceSize _used_bytes;
+
+	std::mutex _mutex;
+};
+
+MemoryAllocator::DeviceAllocator::DeviceAllocator(unsigned devID)
+	:
+	_dev(DeviceManager::GetVkDevice(devID)),
+	_mem_props(),
+	_non_coherent_atom(1),
+	_block_size(),
+	_pools(),
+	_dedicated_count(0),
+	_allocation_count(0),
+	_dedicated_bytes(0),
+	_used_bytes(0),
+	_mutex()
+{
+	VkPhysicalDevice physdev = DeviceManager::GetVkPhyDevice(devID);
+	vkGetPhysicalDeviceMemoryProperties(physdev, &_mem_props);
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(physdev, &properties);
+	_non_coherent_atom = std::max<VkDeviceSize>(properties.limits.nonCoherentAtomSize, 1);
+
+	// small heaps (e.g. host visible device local memory) get smaller blocks
+	_block_size.resize(_mem_props.memoryHeapCount);
+	for (unsigned i = 0; i < _mem_props.memoryHeapCount; i++) {
+		_block_size[i] = std::min(default_block_size, alignUp(_mem_props.memoryHeaps[i].size / 8, 1 << 20));
+	}
+
+	_pools.resize(_mem_props.memoryTypeCount * 2);
+	for (unsigned i = 0; i < _pools.size(); i++) {
+		_pools[i].memoryType = i / 2;
+	}
+}
+
+MemoryAllocator::DeviceAllocator::~DeviceAllocator() {
+	for (auto& pool : _pools) {
+		for (auto& block : pool.blocks) {
+			releaseBlock(block);
+		}
+	}
+}
+
+bool MemoryAllocator::DeviceAllocator::Allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, bool linear, MemoryAllocation& allocation) {
+	unsigned memoryType;
+	if (findMemoryType(_mem_props, requirements.memoryTypeBits, properties, memoryType) == false) {
+		return false;
+	}
+	VkMemoryPropertyFlags typeFlags = _mem_props.memoryTypes[memoryType].propertyFlags;
+	VkDeviceSize alignment = std::max<VkDeviceSize>(requirements.alignment, 1);
+	VkDeviceSize size = requirements.size;
+	// flushed and invalidated ranges must not touch neighbouring allocations
+	if ((typeFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && (typeFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0) {
+		alignment = std::max(alignment, _non_coherent_atom);
+		size = alignUp(size, _non_coherent_atom);
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	allocation = MemoryAllocation();
+	allocation.properties = typeFlags;
+	allocation.size = size;
+
+	VkDeviceSize blockSize = _block_size[_mem_props.memoryTypes[memoryType].heapIndex];
+	if (size > blockSize / 2) {
+		if (allocateMemory(memoryType, size, allocation.memory, &allocation.mapped) == false) {
+			return false;
+		}
+		_dedicated_count++;
+		_dedicated_bytes += size;
+	} else {
+		unsigned poolIdx = memoryType * 2 + (linear ? 0 : 1);
+		Pool& pool = _pools[poolIdx];
+		unsigned blockIdx;
+		VkDeviceSize offset;
+		if (allocateFromPool(pool, size, alignment, blockIdx, offset) == false) {
+			return false;
+		}
+		Block& block = pool.blocks[blockIdx];
+		block.allocations++;
+		allocation.memory = block.memory;
+		allocation.offset = offset;
+		allocation.mapped = block.mapped ? block.mapped + offset : nullptr;
+		allocation.pool = poolIdx;
+		allocation.block = blockIdx;
+	}
+	_allocation_count++;
+	_used_bytes += size;
+	return true;
+}
+
+void MemoryAllocator::DeviceAllocator::Free(MemoryAllocation& allocation) {
+	if (allocation.memory == VK_NULL_HANDLE) {
+		return;
+	}
+	std::lock_guard<std::mutex> lock(_mutex);
+	_allocation_count--;
+	_used_bytes -= allocation.size;
+
+	if (allocation.pool == ~0u) {
+		if (allocation.mapped) vkUnmapMemory(_dev, allocation.memory);
+		vkFreeMemory(_dev, allocation.memory, nullptr);
+		_dedicated_count--;
+		_dedicated_bytes -= allocation.size;
+		allocation = MemoryAllocation();
+		return;
+	}
+
+	Pool& pool = _pools[allocation.pool];
+	Block& block = pool.blocks[allocation.block];
+	Range range = { allocation.offset, allocation.size };
+	auto it = std::lower_bound(block.free.begin(), block.free.end(), range, [](const Range& a, const Range& b) { return a.offset < b.offset; });
+	// merge with the following and the preceding free range
+	if (it != block.free.end() && range.offset + range.size == it->offset) {
+		range.size += it->size;
+		it = block.free.erase(it);
+	}
+	if (it != block.free.begin() && (it - 1)->offset + (it - 1)->size == range.offset) {
+		(it - 1)->size += range.size;
+	} else {
+		block.free.insert(it, range);
+	}
+	block.allocations--;
+
+	// keep one empty block per pool so allocating and freeing a single resource doesn't thrash
+	if (block.allocations == 0) {
+		for (auto& other : pool.blocks) {
+			if (&other != &block && other.memory != VK_NULL_HANDLE) {
+				releaseBlock(block);
+				break;
+			}
+		}
+	}
+	allocation = MemoryAllocation();
+}
+
+bool MemoryAllocator::DeviceAllocator::GetMappedRange(const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size, VkMappedMemoryRange& range) const {
+	if (allocation.memory == VK_NULL_HANDLE || allocation.mapped == nullptr || offset >= allocation.size) {
+		return false;
+	}
+	if (size == VK_WHOLE_SIZE || offset + size > allocation.size) {
+		size = allocation.size - offset;
+	}
+	// non coherent allocations are aligned to the atom size, so the rounded range stays inside the allocation
+	VkDeviceSize begin = (allocation.offset + offset) / _non_coherent_atom * _non_coherent_atom;
+	VkDeviceSize end = std::min(alignUp(allocation.offset + offset + size, _non_coherent_atom), allocation.offset + allocation.size);
+	range = {};
+	range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+	range.memory = allocation.memory;
+	range.offset = begin;
+	range.size = end - begin;
+	return true;
+}
+
+void MemoryAllocator::DeviceAllocator::GetStats(MemoryStats& stats) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	stats = MemoryStats();
+	VkDeviceSize freeBytes = 0, scatteredBytes = 0;
+	for (auto& pool : _pools) {
+		for (auto& block : pool.blocks) {
+			if (block.memory == VK_NULL_HANDLE) {
+				continue;
+			}
+			stats.blockCount++;
+			stats.reservedBytes += block.size;
+			VkDeviceSize blockFree = 0, largestFree = 0;
+			for (auto& range : block.free) {
+				blockFree += range.size;
+				largestFree = std::max(largestFree, range.size);
+			}
+			freeBytes += blockFree;
+			scatteredBytes += blockFree - largestFree;
+		}
+	}
+	stats.reservedBytes += _dedicated_bytes;
+	stats.usedBytes = _used_bytes;
+	stats.dedicatedCount = _dedicated_count;
+	stats.allocationCount = _allocation_count;
+	stats.fragmentation = freeBytes ? (double)scatteredBytes / freeBytes : 0;
+}
+
+bool MemoryAllocator::DeviceAllocator::allocateMemory(unsigned memoryType, VkDeviceSize size, VkDeviceMemory& memory, uint8_t** mapped) {
+	VkMemoryAllocateInfo allocInfo{};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = size;
+	allocInfo.memoryTypeIndex = memoryType;
+	if (vkAllocateMemory(_dev, &allocInfo, nullptr, &memory) != VK_SUCCESS) {
+		printf("failed to allocate %llu bytes of device memory\n", (unsigned long long)size);
+		return false;
+	}
+
+	*mapped = nullptr;
+	if (_mem_props.memoryTypes[memoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+		if (vkMapMemory(_dev, memory, 0, VK_WHOLE_SIZE, 0, (void**)mapped) != VK_SUCCESS) {
+			vkFreeMemory(_dev, memory, nullptr);
+			memory = VK_NULL_HANDLE;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool MemoryAllocator::DeviceAllocator::allocateFromPool(Pool& pool, VkDeviceSize size, VkDeviceSize alignment, unsigned& blockIdx, VkDeviceSize& offset) {
+	// best fit over the free ranges of every block
+	unsigned bestBlock = ~0u, bestRange = 0;
+	VkDeviceSize bestWaste = ~0ull;
+	for (unsigned b = 0; b < pool.blocks.size(); b++) {
+		const Block& block = pool.blocks[b];
+		for (unsigned r = 0; r < block.free.size(); r++) {
+			const Range& range = block.free[r];
+			VkDeviceSize start = alignUp(range.offset, alignment);
+			if (start + size > range.offset + range.size) {
+				continue;
+			}
+			VkDeviceSize waste = range.size - size;
+			if (waste < bestWaste) {
+				bestWaste = waste;
+				bestBlock = b;
+				bestRange = r;
+			}
+		}
+	}
+
+	if (bestBlock == ~0u) {
+		bestBlock = pool.blocks.size();
+		for (unsigned b = 0; b < pool.blocks.size(); b++) {
+			if (pool.blocks[b].memory == VK_NULL_HANDLE) {
+				bestBlock = b;
+				break;
+			}
+		}
+		if (bestBlock == pool.blocks.size()) {
+			pool.blocks.push_back(Block());
+		}
+		Block& block = pool.blocks[bestBlock];
+		block.size = _block_size[_mem_props.memoryTypes[pool.memoryType].heapIndex];
+		if (allocateMemory(pool.memoryType, block.size, block.memory, &block.mapped) == false) {
+			block = Block();
+			return false;
+		}
+		block.free = { { 0, block.size } };
+		block.allocations = 0;
+		bestRange = 0;
+	}
+
+	// split the range, the alignment padding in front stays free
+	Block& block = pool.blocks[bestBlock];
+	Range range = block.free[bestRange];
+	VkDeviceSize start = alignUp(range.offset, alignment);
+	VkDeviceSize end = start + size;
+	block.free.erase(block.free.begin() + bestRange);
+	if (end < range.offset + range.size) {
+		block.free.insert(block.free.begin() + bestRange, { end, range.offset + range.size - end });
+	}
+	if (start > range.offset) {
+		block.free.insert(block.free.begin() + bestRange, { range.offset, start - range.offset });
+	}
+
+	blockIdx = bestBlock;
+	offset = start;
+	return true;
+}
+
+void MemoryAllocator::DeviceAllocator::releaseBlock(Block& block) {
+	if (block.memory == VK_NULL_HANDLE) {
+		return;
+	}
+	if (block.mapped) vkUnmapMemory(_dev, block.memory);
+	vkFreeMemory(_dev, block.memory, nullptr);
+	block = Block();
+}
+
+
+static std::mutex _allocators_mutex;
+std::vector<std::unique_ptr<MemoryAllocator::DeviceAllocator>>& MemoryAllocator::allocators() {
+	static std::vector<std::unique_ptr<DeviceAllocator>> list;
+	return list;
+}
+
+MemoryAllocator::DeviceAllocator* MemoryAllocator::getAllocator(unsigned devID) {
+	std::lock_guard<std::mutex> lock(_allocators_mutex);
+	auto& list = allocators();
+	if (devID >= list.size()) {
+		list.resize(devID + 1);
+	}
+	if (list[devID] == nullptr) {
+		if (DeviceManager::GetVkDevice(devID) == VK_NULL_HANDLE) {
+			return nullptr;
+		}
+		list[devID] = std::make_unique<DeviceAllocator>(devID);
+	}
+	return list[devID].get();
+}
+
+void MemoryAllocator::ReleaseDevice(unsigned devID) {
+	std::lock_guard<std::mutex> lock(_allocators_mutex);
+	auto& list = allocators();
+	if (devID < list.size()) {
+		list[devID].reset();
+	}
+}
+
+bool MemoryAllocator::Allocate(unsigned devID, const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, bool linear, MemoryAllocation& allocation) {
+	DeviceAllocator* allocator = getAllocator(devID);
+	if (allocator == nullptr) {
+		return false;
+	}
+	return allocator->Allocate(requirements, properties, linear, allocation);
+}
+
+void MemoryAllocator::Free(unsigned devID, MemoryAllocation& allocation) {
+	if (allocation.memory == VK_NULL_HANDLE) {
+		return;
+	}
+	DeviceAllocator* allocator = getAllocator(devID);
+	if (allocator == nullptr) {
+		return;
+	}
+	allocator->Free(allocation);
+}
+
+bool MemoryAllocator::FlushRange(unsigned devID, const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) {
+	if (allocation.properties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) {
+		return true;
+	}
+	DeviceAllocator* allocator = getAllocator(devID);
+	VkMappedMemoryRange range;
+	if (allocator == nullptr || allocator->GetMappedRange(allocation, offset, size, range) == false) {
+		return false;
+	}
+	return vkFlushMappedMemoryRanges(DeviceManager::GetVkDevice(devID), 1, &range) == VK_SUCCESS;
+}
+
+bool MemoryAllocator::InvalidateRange(unsigned devID, const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size) {
+	if (allocation.properties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) {
+		return true;
+	}
+	DeviceAllocator* allocator = getAllocator(devID);
+	VkMappedMemoryRange range;
+	if (allocator == nullptr || allocator->GetMappedRange(allocation, offset, size, range) == false) {
+		return false;
+	}
+	return vkInvalidateMappedMemoryRanges(DeviceManager::GetVkDevice(devID), 1, &range) == VK_SUCCESS;
+}
+
+bool MemoryAllocator::GetStats(unsigned devID, MemoryStats& stats) {
+	DeviceAllocator* allocator = getAllocator(devID);
+	if (allocator == nullptr) {
+		return false;
+	}
+	allocator->GetStats(stats);
+	return true;
+}
+
+bool MemoryAllocator::CreateBuffer(unsigned devID, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, BufferResources& buffer, bool transferQueueAccess) {
+	VkDevice dev = DeviceManager::GetVkDevice(devID);
+	if (dev == VK_NULL_HANDLE) {
+		return false;
+	}
+	buffer = BufferResources();
+
+	VkBufferCreateInfo bufferInfo{};
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.size = size;
+	bufferInfo.usage = usage;
+	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	uint32_t queueFamilies[2] = { 0, 0 };
+	if (transferQueueAccess &&
+		DeviceManager::GetQueueIdx(devID, DeviceManager::QUEUE_TYPE_GRAPHICS, queueFamilies[0]) &&
+		DeviceManager::GetQueueIdx(devID, DeviceManager::QUEUE_TYPE_TRANSFER, queueFamilies[1]) &&
+		queueFamilies[0] != queueFamilies[1]) {
+		bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+		bufferInfo.queueFamilyIndexCount = 2;
+		bufferInfo.pQueueFamilyIndices = queueFamilies;
+	}
+	if (vkCreateBuffer(dev, &bufferInfo, nullptr, &buffer.vkBuffer) != VK_SUCCESS) {
+		buffer.vkBuffer = VK_NULL_HANDLE;
+		return false;
+	}
+
+	VkMemoryRequirements memRequirements;
+	vkGetBufferMemoryRequirements(dev, buffer.vkBuffer, &memRequirements);
+	if (Allocate(devID, memRequirements, properties, true, buffer.memory) == false ||
+		vkBindBufferMemory(dev, buffer.vkBuffer, buffer.memory.memory, buffer.memory.offset) != VK_SUCCESS) {
+		DestroyBuffer(devID, buffer);
+		return false;
+	}
+	return true;
+}
+
+void MemoryAllocator::DestroyBuffer(unsigned devID, BufferResources& buffer) {
+	VkDevice dev = DeviceManager::GetVkDevice(devID);
+	if (dev == VK_NULL_HANDLE) {
+		return;
+	}
+	if (buffer.vkBuffer != VK_NULL_HANDLE) vkDestroyBuffer(dev, buffer.vkBuffer, nullptr);
+	Free(devID, buffer.memory);
+	buffer = BufferResources();
+}
+
+bool MemoryAllocator::CreateImage(unsigned devID, uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, ImageResources& image) {
+	VkDevice dev = DeviceManager::GetVkDevice(devID);
+	if (dev == VK_NULL_HANDLE) {
+		return false;
+	}
+	image = ImageResources();
+
+	VkImageCreateInfo imageInfo{};
+	imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	imageInfo.imageType = VK_IMAGE_TYPE_2D;
+	imageInfo.extent.width = width;
+	imageInfo.extent.height = height;
+	imageInfo.extent.depth = 1;
+	imageInfo.mipLevels = 1;
+	imageInfo.arrayLayers = 1;
+	imageInfo.format = format;
+	imageInfo.tiling = tiling;
+	imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	imageInfo.usage = usage;
+	imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+	imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	if (vkCreateImage(dev, &imageInfo, nullptr, &image.vkImage) != VK_SUCCESS) {
+		image.vkImage = VK_NULL_HANDLE;
+		return false;
+	}
+
+	VkMemoryRequirements memRequirements;
+	vkGetImageMemoryRequirements(dev, image.vkImage, &memRequirements);
+	if (Allocate(devID, memRequirements, properties, tiling == VK_IMAGE_TILING_LINEAR, image.memory) == false ||
+		vkBindImageMemory(dev, image.vkImage, image.memory.memory, image.memory.offset) != VK_SUCCESS) {
+		DestroyImage(devID, image);
+		return false;
+	}
+	return true;
+}
+
+void MemoryAllocator::DestroyImage(unsigned devID, ImageResources& image) {
+	VkDevice dev = DeviceManager::GetVkDevice(devID);
+	if (dev == VK_NULL_HANDLE) {
+		return;
+	}
+	if (image.vkImage != VK_NULL_HANDLE) vkDestroyImage(dev, image.vkImage, nullptr);
+	Free(devID, image.memory);
+	image = ImageResources();
+}
+}
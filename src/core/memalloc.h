@@ -0,0 +1,39 @@
+#pragma once
+#include <memory>
+#include <mutex>
+#include "util.h"
+
+
+namespace RenderingFramework3D {
+
+// device memory allocator: small resources are suballocated from large blocks per memory type
+// (best fit free list with coalescing), large ones get a dedicated allocation. Host visible memory
+// stays mapped for the lifetime of its block. Thread safe.
+class MemoryAllocator
+{
+public:
+	// transferQueueAccess: the buffer is also written by the transfer queue, shared between the queue families if they differ
+	static bool CreateBuffer(unsigned devID, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, BufferResources& buffer, bool transferQueueAccess=false);
+	static void DestroyBuffer(unsigned devID, BufferResources& buffer);
+	static bool CreateImage(unsigned devID, uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, ImageResources& image);
+	static void DestroyImage(unsigned devID, ImageResources& image);
+
+	// linear: buffers and linear images, kept apart from optimal tiling images (bufferImageGranularity)
+	static bool Allocate(unsigned devID, const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, bool linear, MemoryAllocation& allocation);
+	static void Free(unsigned devID, MemoryAllocation& allocation);
+
+	// host access to non coherent memory, offset and size relative to the allocation
+	static bool FlushRange(unsigned devID, const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size);
+	static bool InvalidateRange(unsigned devID, const MemoryAllocation& allocation, VkDeviceSize offset, VkDeviceSize size);
+
+	static bool GetStats(unsigned devID, MemoryStats& stats);
+
+	// frees every block of the device, called before the device is destroyed
+	static void ReleaseDevice(unsigned devID);
+
+private:
+	class DeviceAllocator;
+	static DeviceAllocator* getAllocator(unsigned devID);
+	static std::vector<std::unique_ptr<DeviceAllocator>>& allocators();
+};
+}
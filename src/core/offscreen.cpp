@@ -0,0 +1,146 @@
+#include "offscreen.h"
+#include "devicemgr.h"
+#include "memalloc.h"
+
+
+namespace RenderingFramework3D {
+
+OffscreenTarget::OffscreenTarget()
+    :
+    _init(false),
+    _extent(),
+    _format(VK_FORMAT_UNDEFINED),
+    _color_image(),
+    _color_imageview(VK_NULL_HANDLE),
+    _depth_image(),
+    _depth_imageview(VK_NULL_HANDLE),
+    _render_pass(VK_NULL_HANDLE),
+    _framebuffer(VK_NULL_HANDLE),
+    _dev_id(0)
+{}
+
+bool OffscreenTarget::Initialize(unsigned dev, VkExtent2D extent, VkFormat format) {
+    _dev_id = dev;
+    _extent = extent;
+    _format = format;
+
+    VkDevice vkdev = DeviceManager::GetVkDevice(_dev_id);
+    if (vkdev == VK_NULL_HANDLE || _extent.width == 0 || _extent.height == 0 || _format == VK_FORMAT_UNDEFINED) {
+        return false;
+    }
+
+    _init = true;
+    _init = _init && createImages();
+    _init = _init && createRenderPass(vkdev, _format, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, _render_pass);
+    _init = _init && createFrameBuffer();
+
+    return _init;
+}
+
+bool OffscreenTarget::Cleanup() {
+    VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+    if (dev == VK_NULL_HANDLE) {
+        return false;
+    }
+    if (_framebuffer != VK_NULL_HANDLE) vkDestroyFramebuffer(dev, _framebuffer, nullptr);
+    if (_render_pass != VK_NULL_HANDLE) vkDestroyRenderPass(dev, _render_pass, nullptr);
+    if (_color_imageview != VK_NULL_HANDLE) vkDestroyImageView(dev, _color_imageview, nullptr);
+    if (_depth_imageview != VK_NULL_HANDLE) vkDestroyImageView(dev, _depth_imageview, nullptr);
+    MemoryAllocator::DestroyImage(_dev_id, _color_image);
+    MemoryAllocator::DestroyImage(_dev_id, _depth_image);
+
+    _framebuffer = VK_NULL_HANDLE;
+    _render_pass = VK_NULL_HANDLE;
+    _color_imageview = VK_NULL_HANDLE;
+    _depth_imageview = VK_NULL_HANDLE;
+    _color_image = ImageResources();
+    _depth_image = ImageResources();
+    _init = false;
+    return true;
+}
+
+VkRenderPass OffscreenTarget::GetRenderPass() {
+    return _render_pass;
+}
+
+VkExtent2D OffscreenTarget::GetExtent() const {
+    return _extent;
+}
+
+VkFormat OffscreenTarget::GetFormat() const {
+    return _format;
+}
+
+VkImage OffscreenTarget::GetColorImage() const {
+    return _color_image.vkImage;
+}
+
+bool OffscreenTarget::AddCommandBindRenderpass(VkCommandBuffer cmdBuffer, bool secondaryContents) {
+    if (_init) {
+        VkRenderPassBeginInfo renderPassInfo{};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        renderPassInfo.renderPass = _render_pass;
+        renderPassInfo.framebuffer = _framebuffer;
+        renderPassInfo.renderArea.offset = { 0, 0 };
+        renderPassInfo.renderArea.extent = _extent;
+
+        std::vector<VkClearValue> clearValues(2);
+        clearValues[0].color = {{0.0f, 0.0f, 0.0f, 1.0f}};
+        clearValues[1].depthStencil = { 1.0f,0 };
+
+        renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
+        renderPassInfo.pClearValues = clearValues.data();
+        vkCmdBeginRenderPass(cmdBuffer, &renderPassInfo, secondaryContents ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
+        return true;
+    }
+    return false;
+}
+
+bool OffscreenTarget::createImages() {
+    auto dev = DeviceManager::GetVkDevice(_dev_id);
+    if (dev == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    if (MemoryAllocator::CreateImage(_dev_id, _extent.width, _extent.height, _format, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, _color_image) == false) {
+        printf("failed to create offscreen colour image\n");
+        return false;
+    }
+    if (createImageView(dev, _color_image.vkImage, _format, VK_IMAGE_ASPECT_COLOR_BIT, _color_imageview) == false) {
+        return false;
+    }
+    if (MemoryAllocator::CreateImage(_dev_id, _extent.width, _extent.height, VK_FORMAT_D32_SFLOAT, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, _depth_image) == false) {
+        return false;
+    }
+    if (createImageView(dev, _depth_image.vkImage, VK_FORMAT_D32_SFLOAT, VK_IMAGE_ASPECT_DEPTH_BIT, _depth_imageview) == false) {
+        return false;
+    }
+    return true;
+}
+
+bool OffscreenTarget::createFrameBuffer() {
+    auto dev = DeviceManager::GetVkDevice(_dev_id);
+    if (dev == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    std::vector<VkImageView> attachments = {
+        _color_imageview,
+        _depth_imageview
+    };
+
+    VkFramebufferCreateInfo framebufferInfo{};
+    framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebufferInfo.renderPass = _render_pass;
+    framebufferInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
+    framebufferInfo.pAttachments = attachments.data();
+    framebufferInfo.width = _extent.width;
+    framebufferInfo.height = _extent.height;
+    framebufferInfo.layers = 1;
+
+    if (vkCreateFramebuffer(dev, &framebufferInfo, nullptr, &_framebuffer) != VK_SUCCESS) {
+        return false;
+    }
+    return true;
+}
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "util.h"
+#include "devicemgr.h"
+
+
+namespace RenderingFramework3D {
+
+// device owned colour and depth images rendered to instead of a swapchain, for rendering without a display
+class OffscreenTarget
+{
+public:
+	OffscreenTarget();
+
+	bool Initialize(unsigned dev, VkExtent2D extent, VkFormat format);
+	bool Cleanup();
+
+	VkRenderPass GetRenderPass();
+	VkExtent2D GetExtent() const;
+	VkFormat GetFormat() const;
+	// the colour image is in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL after the render pass
+	VkImage GetColorImage() const;
+
+	// secondaryContents: the pass is recorded in secondary command buffers executed with vkCmdExecuteCommands
+	bool AddCommandBindRenderpass(VkCommandBuffer cmdBuffer, bool secondaryContents=false);
+
+private:
+	bool createImages();
+	bool createFrameBuffer();
+
+private:
+	bool _init;
+
+	VkExtent2D _extent;
+	VkFormat _format;
+
+	ImageResources _color_image;
+	VkImageView _color_imageview;
+	ImageResources _depth_image;
+	VkImageView _depth_imageview;
+
+	VkRenderPass _render_pass;
+	VkFramebuffer _framebuffer;
+
+	unsigned _dev_id;
+};
+}
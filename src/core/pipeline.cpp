@@ -1,5 +1,6 @@
 #include <algorithm>
 #include "pipeline.h"
+#include "memalloc.h"
 #include "default_shaders.h"
 
 
@@ -13,18 +14,107 @@ Pipeline::Pipeline()
     _pipelinelayout(VK_NULL_HANDLE),
     _graphics_pipeline(VK_NULL_HANDLE),
     _uniform_shader_input_layout(),
-    _ubo_allocator(),
+    _allocator_layout(),
+    _frames_in_flight(1),
+    _frame_idx(0),
+    _dirlight_data(),
+    _custom_global_data(),
+    _push_transform_size(0),
+    _push_material_offset(0),
+    _push_transform_stages(0),
+    _push_material_stages(0),
+    _push_data_size(0),
+    _instance_set_layout(VK_NULL_HANDLE),
+    _instance_stride(0),
+    _contexts(),
     _dev_id(0)
 {}
 
 Pipeline::~Pipeline() {}
 
-bool Pipeline::Initialize(unsigned devID, const PipelineConfig& config, VkRenderPass renderPass) {
+bool Pipeline::Initialize(unsigned devID, const PipelineConfig& config, VkRenderPass renderPass, unsigned framesInFlight) {
     _dev_id = devID;
     _uniform_shader_input_layout = { config.uniformShaderInputLayout, VK_NULL_HANDLE };
+
+    // every binding of the layout gets a buffer written to its descriptor, an empty one would stay unwritten
+    for (const auto* inputs : { &config.uniformShaderInputLayout.ObjectInputs.CustomUniformShaderInput,
+        &config.uniformShaderInputLayout.GlobalInputs.CustomUniformShaderInput }) {
+        for (const auto& desc : *inputs) {
+            if (desc.size == 0) {
+                printf("custom uniform input at binding %u has size 0\n", desc.bindSlot);
+                return false;
+            }
+        }
+    }
+
+    // the non uniform dequantization scale of quantized positions has to stay out of the transform, which also transforms normals
+    if (config.useDefaultVertData == false && config.vertDataLayout.useVertBuffer &&
+        config.vertDataLayout.vertFormat == VERTEX_POSITION_SNORM16 && config.uniformShaderInputLayout.ObjectInputs.useObjectScale == false) {
+        printf("VERTEX_POSITION_SNORM16 positions require useObjectScale\n");
+        return false;
+    }
+
+    // instances can only pass their transform to the vertex shader
+    auto& objectInputs = _uniform_shader_input_layout.layout.ObjectInputs;
+    if (objectInputs.useInstancing && (objectInputs.transformFragInput || getTransformDataSize() == 0)) {
+        if (config.useDefaultShaders == false) {
+            printf("instancing requires transform data read by the vertex shader only\n");
+            return false;
+        }
+        objectInputs.useInstancing = false;
+    }
+    // instances read their transform and material data from the instance buffer, nothing is left to push
+    if (objectInputs.useInstancing && objectInputs.usePushConstants) {
+        if (config.useDefaultShaders == false) {
+            printf("instancing reads the object data from the instance buffer and cannot be combined with push constants\n");
+            return false;
+        }
+        objectInputs.usePushConstants = false;
+    }
+    if (setupPushConstants(config) == false) {
+        return false;
+    }
+    _frames_in_flight = framesInFlight > 0 ? framesInFlight : 1;
+    // instance records: the transform data followed by the material data, padded to a multiple of 16 bytes
+    _instance_stride = 0;
+    if (objectInputs.useInstancing) {
+        _instance_stride = getTransformDataSize() + (objectInputs.useMaterialData ? sizeof(float) * 8 : 0);
+        VkDescriptorSetLayoutBinding binding{};
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        binding.descriptorCount = 1;
+        binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        if (objectInputs.useMaterialData && objectInputs.materialFragInput) binding.stageFlags |= VK_SHADER_STAGE_FRAGMENT_BIT;
+        binding.pImmutableSamplers = nullptr;
+        if (createDescriptorSetLayout(DeviceManager::GetVkDevice(_dev_id), { binding }, _instance_set_layout) == false) {
+            return false;
+        }
+    }
 	
     bool ret = createPipeline(config, renderPass);
-    ret = ret && _ubo_allocator.Initialize(devID, _uniform_shader_input_layout);
+
+    // data sent as push constants or instance data has no place in the object uniform buffer sets
+    _allocator_layout = _uniform_shader_input_layout;
+    if (objectInputs.usePushConstants || objectInputs.useInstancing) {
+        _allocator_layout.layout.ObjectInputs.useObjToWorldTransform = false;
+        _allocator_layout.layout.ObjectInputs.useWorldToCamTransform = false;
+        _allocator_layout.layout.ObjectInputs.useCamToScreenTransform = false;
+        _allocator_layout.layout.ObjectInputs.useObjToScreenTransform = false;
+        _allocator_layout.layout.ObjectInputs.useObjectScale = false;
+        _allocator_layout.layout.ObjectInputs.useMaterialData = false;
+    }
+
+    _contexts.clear();
+    _contexts.resize(1);
+    ret = ret && initContext(_contexts[0]);
+    _frame_idx = 0;
+
+    if (_uniform_shader_input_layout.layout.GlobalInputs.useDirectionalLight) {
+        _dirlight_data.assign(36, 0.0f);
+    }
+    for (const auto& desc : _uniform_shader_input_layout.layout.GlobalInputs.CustomUniformShaderInput) {
+        _custom_global_data[desc.bindSlot] = std::vector<uint8_t>(desc.size, 0);
+    }
     _init = ret;
     return ret;
 }
@@ -36,8 +126,14 @@ bool Pipeline::Cleanup() {
         if (dev == VK_NULL_HANDLE) {
             return false;
         }
-        if (_ubo_allocator.Cleanup() == false) {
-            return false;
+        for (auto& context : _contexts) {
+            destroyContext(context);
+        }
+        _contexts.clear();
+        _custom_global_data.clear();
+        if (_instance_set_layout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(dev, _instance_set_layout, nullptr);
+            _instance_set_layout = VK_NULL_HANDLE;
         }
 
         vkDestroyPipeline(dev, _graphics_pipeline, nullptr);
@@ -50,77 +146,66 @@ bool Pipeline::Cleanup() {
     return false;
 }
 
+bool Pipeline::ReserveContexts(unsigned count) {
+    if (_init == false) {
+        return false;
+    }
+    while (_contexts.size() < count) {
+        _contexts.emplace_back();
+        if (initContext(_contexts.back()) == false || beginContextFrame(_contexts.back()) == false) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool Pipeline::IsReady() {
     return _init;
 }
 
 bool Pipeline::SetLightDir(const Vec<3>& lightDir) {
     if (_uniform_shader_input_layout.layout.GlobalInputs.useDirectionalLight) {
-        unsigned size;
-        void* dst = _ubo_allocator.GetGlobalUniformBuffer(GLOB_UB_TYPE_DIRLIGHT, size);
-        float* dst_f = (float*)dst;
-        dst_f += 4;
-
-        if (dst == nullptr) {
+        if (_dirlight_data.size() < 8) {
             return false;
         }
-
-        lightDir.Normalized().CopyRaw(dst_f);
+        lightDir.Normalized().CopyRaw(&_dirlight_data[4]);
     }
     return true;
 }
 bool Pipeline::SetLightColour(const MathUtil::Vec<4>& lightColour) {
     if (_uniform_shader_input_layout.layout.GlobalInputs.useDirectionalLight) {
-        unsigned size;
-        void* dst = _ubo_allocator.GetGlobalUniformBuffer(GLOB_UB_TYPE_DIRLIGHT, size);
-        float* dst_f = (float*)dst;
-
-        if (dst == nullptr) {
+        if (_dirlight_data.size() < 4) {
             return false;
         }
-
-        lightColour.CopyRaw(dst_f);
+        lightColour.CopyRaw(&_dirlight_data[0]);
     }
     return true;
 }
 
 bool Pipeline::SetLightIntensity(float intensity) {
     if (_uniform_shader_input_layout.layout.GlobalInputs.useDirectionalLight) {
-        unsigned size;
-        void* dst = _ubo_allocator.GetGlobalUniformBuffer(GLOB_UB_TYPE_DIRLIGHT, size);
-        float* dst_f = (float*)dst;
-        dst_f += 7;
-
-        if (dst == nullptr) {
+        if (_dirlight_data.size() < 8) {
             return false;
         }
-
-        memcpy(dst_f, &intensity, sizeof(float));
+        _dirlight_data[7] = intensity;
     }
     return true;
 }
 
 bool Pipeline::SetAmbientLightIntensity(float intensity) {
     if (_uniform_shader_input_layout.layout.GlobalInputs.useDirectionalLight) {
-        unsigned size;
-        void* dst = _ubo_allocator.GetGlobalUniformBuffer(GLOB_UB_TYPE_DIRLIGHT, size);
-        float* dst_f = (float*)dst;
-        dst_f += 8;
-
-        if (dst == nullptr) {
+        if (_dirlight_data.size() < 9) {
             return false;
         }
-
-        memcpy(dst_f, &intensity, sizeof(float));
+        _dirlight_data[8] = intensity;
     }
     return true;
 }
 
 bool Pipeline::SetCustomGlobalData(unsigned binding, void* data, unsigned size, unsigned offset) {
-    unsigned retsize;
-    void* dst = _ubo_allocator.GetGlobalUniformBuffer(GLOB_UB_TYPE_CUSTOM, retsize, binding);
-    if (dst && (size+offset <= retsize)) {
-        memcpy(dst, data, size);
+    auto it = _custom_global_data.find(binding);
+    if (it != _custom_global_data.end() && (size+offset <= it->second.size())) {
+        memcpy(it->second.data() + offset, data, size);
         return true;
     }
     return false;
@@ -130,113 +215,513 @@ const UniformShaderInputLayout& Pipeline::GetUniformBufferSetLayout() const {
     return _uniform_shader_input_layout.layout;
 }
 
-bool Pipeline::AddCommandBindPipeline(VkCommandBuffer cmdBuffer) {
-    if (_init) {
+bool Pipeline::AddCommandBindPipeline(VkCommandBuffer cmdBuffer, unsigned ctx) {
+    if (_init && ctx < _contexts.size()) {
+        RecordContext& context = _contexts[ctx];
         vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _graphics_pipeline);
+        context.boundUboId = ~0u;
+        if (context.instanceBuffers.size() && context.instanceBuffers[_frame_idx].capacity) {
+            vkCmdBindDescriptorSets(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _pipelinelayout, 2, 1, &context.instanceBuffers[_frame_idx].vkdesc, 0, nullptr);
+        }
         return true;
     }
     return false;
 }
 
-bool Pipeline::AddCommandBindUniformBufferSet(VkCommandBuffer cmdBuffer, const WorldObject& obj, Camera& cam) {
-    if (_init == false) {
+bool Pipeline::PrepareObjectData(const WorldObject& obj, Camera& cam, const PositionDequantization* dequant, ObjectDrawData& data, std::vector<float>& pushData, unsigned ctx, ScreenTransformBatch* screenTransforms) {
+    if (_init == false || ctx >= _contexts.size()) {
+        return false;
+    }
+    RecordContext& context = _contexts[ctx];
+    data = {};
+    const auto& objectInputs = _uniform_shader_input_layout.layout.ObjectInputs;
+    if (dequant && objectInputs.useObjectScale == false) {
+        printf("quantized mesh drawn by a pipeline without object scale\n");
+        return false;
+    }
+    if (objectInputs.useInstancing) {
+        data.instanceDataOffset = pushData.size();
+        pushData.resize(pushData.size() + _instance_stride / sizeof(float));
+        writeTransformData(pushData.data() + data.instanceDataOffset, obj, cam, dequant, screenTransforms, data.instanceDataOffset);
+        if (objectInputs.useMaterialData) {
+            writeMaterialData(pushData.data() + data.instanceDataOffset + getTransformDataSize() / sizeof(float), obj);
+        }
+        context.preparedInstances++;
+    }
+    if (objectInputs.usePushConstants) {
+        data.pushDataOffset = pushData.size();
+        pushData.resize(pushData.size() + _push_data_size / sizeof(float));
+        float* dst = pushData.data() + data.pushDataOffset;
+        if (_push_transform_stages) {
+            writeTransformData(dst, obj, cam, dequant, screenTransforms, data.pushDataOffset);
+        }
+        if (objectInputs.useMaterialData) {
+            writeMaterialData(dst + _push_material_offset / sizeof(float), obj);
+        }
+    }
+    if (objectInputs.usePushConstants == false && objectInputs.useInstancing == false) {
+        return prepareDescriptorSet(obj, cam, dequant, data.uboId, context, screenTransforms);
+    }
+
+    // without the transform and material the set only holds the camera, it is replaced when the camera changes
+    bool shareable = objectInputs.CustomUniformShaderInput.empty();
+    if (shareable) {
+        std::vector<float>& setData = context.setData;
+        setData.clear();
+        if (objectInputs.useCamTransform) {
+            setData.resize(setData.size() + 16);
+            cam.GetTransform().CopyRaw(setData.data() + setData.size() - 16);
+        }
+        data.batchable = objectInputs.useInstancing;
+        if (context.preparedUboId != ~0u && setData == context.preparedSetData) {
+            data.uboId = context.preparedUboId;
+            return true;
+        }
+    }
+    if (prepareDescriptorSet(obj, cam, dequant, data.uboId, context, screenTransforms) == false) {
+        return false;
+    }
+    if (shareable) {
+        context.preparedUboId = data.uboId;
+        context.preparedSetData.swap(context.setData);
+    }
+    return true;
+}
+
+bool Pipeline::AddCommandBindObjectData(VkCommandBuffer cmdBuffer, const ObjectDrawData& data, const std::vector<float>& pushData, unsigned ctx) {
+    if (_init == false || ctx >= _contexts.size()) {
+        return false;
+    }
+    RecordContext& context = _contexts[ctx];
+    if (_uniform_shader_input_layout.layout.ObjectInputs.usePushConstants) {
+        if (data.pushDataOffset + _push_data_size / sizeof(float) > pushData.size()) {
+            return false;
+        }
+        const float* src = pushData.data() + data.pushDataOffset;
+        if (_push_transform_size && _push_transform_stages) {
+            vkCmdPushConstants(cmdBuffer, _pipelinelayout, _push_transform_stages, 0, _push_transform_size, src);
+        }
+        if (_uniform_shader_input_layout.layout.ObjectInputs.useMaterialData && _push_material_stages) {
+            vkCmdPushConstants(cmdBuffer, _pipelinelayout, _push_material_stages, _push_material_offset, sizeof(float) * 8, src + _push_material_offset / sizeof(float));
+        }
+    }
+
+    if (data.uboId != context.boundUboId) {
+        if (context.uboAllocators[_frame_idx].AddCommandBindUniformBufferSet(data.uboId, _pipelinelayout, cmdBuffer) == false) {
+            return false;
+        }
+        context.boundUboId = data.uboId;
+    }
+    return true;
+}
+
+bool Pipeline::IsInstanced() const {
+    return _init && _uniform_shader_input_layout.layout.ObjectInputs.useInstancing;
+}
+
+bool Pipeline::CanBatch(const ObjectDrawData& first, const ObjectDrawData& other) const {
+    return first.batchable && other.batchable && first.uboId == other.uboId;
+}
+
+bool Pipeline::ReserveInstances(unsigned ctx) {
+    if (_init == false || ctx >= _contexts.size()) {
+        return false;
+    }
+    RecordContext& context = _contexts[ctx];
+    context.writtenInstances = 0;
+    if (context.instanceBuffers.empty() || context.preparedInstances <= context.instanceBuffers[_frame_idx].capacity) {
+        return true;
+    }
+    VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+    if (dev == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    // the frame slot is no longer in use by the GPU and nothing has been recorded with it yet
+    InstanceBuffer& instances = context.instanceBuffers[_frame_idx];
+    if (instances.buffer.vkBuffer != VK_NULL_HANDLE) {
+        MemoryAllocator::DestroyBuffer(_dev_id, instances.buffer);
+        instances.mapped = nullptr;
+        instances.capacity = 0;
+    }
+    unsigned capacity = 64;
+    while (capacity < context.preparedInstances) {
+        capacity *= 2;
+    }
+    VkDeviceSize bufferSize = (VkDeviceSize)_instance_stride * capacity;
+    if (MemoryAllocator::CreateBuffer(_dev_id, bufferSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, instances.buffer) == false) {
+        return false;
+    }
+    instances.mapped = instances.buffer.memory.mapped;
+    instances.capacity = capacity;
+
+    VkDescriptorBufferInfo bufferInfo{};
+    bufferInfo.buffer = instances.buffer.vkBuffer;
+    bufferInfo.offset = 0;
+    bufferInfo.range = bufferSize;
+
+    VkWriteDescriptorSet descriptorWrite{};
+    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptorWrite.dstSet = instances.vkdesc;
+    descriptorWrite.dstBinding = 0;
+    descriptorWrite.dstArrayElement = 0;
+    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descriptorWrite.descriptorCount = 1;
+    descriptorWrite.pBufferInfo = &bufferInfo;
+    vkUpdateDescriptorSets(dev, 1, &descriptorWrite, 0, nullptr);
+    return true;
+}
+
+bool Pipeline::WriteInstance(const ObjectDrawData& data, const std::vector<float>& pushData, unsigned& instanceIdx, unsigned ctx) {
+    if (_init == false || ctx >= _contexts.size() || _contexts[ctx].instanceBuffers.empty()) {
+        return false;
+    }
+    RecordContext& context = _contexts[ctx];
+    InstanceBuffer& instances = context.instanceBuffers[_frame_idx];
+    if (context.writtenInstances >= instances.capacity || data.instanceDataOffset + _instance_stride / sizeof(float) > pushData.size()) {
+        return false;
+    }
+    memcpy(instances.mapped + (size_t)context.writtenInstances * _instance_stride, pushData.data() + data.instanceDataOffset, _instance_stride);
+    instanceIdx = context.writtenInstances++;
+    return true;
+}
+
+bool Pipeline::initContext(RecordContext& context) {
+    VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+    if (dev == VK_NULL_HANDLE) {
+        return false;
+    }
+    context.uboAllocators.resize(_frames_in_flight);
+    for (auto& allocator : context.uboAllocators) {
+        if (allocator.Initialize(_dev_id, _allocator_layout) == false) {
+            return false;
+        }
+    }
+    if (_instance_set_layout == VK_NULL_HANDLE) {
+        return true;
+    }
+
+    VkDescriptorPoolSize descPoolSize{};
+    descPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descPoolSize.descriptorCount = _frames_in_flight;
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &descPoolSize;
+    poolInfo.maxSets = _frames_in_flight;
+    if (vkCreateDescriptorPool(dev, &poolInfo, nullptr, &context.instancePool) != VK_SUCCESS) {
+        return false;
+    }
+
+    // buffers are created by ReserveInstances once the number of draws is known
+    context.instanceBuffers.resize(_frames_in_flight);
+    std::vector<VkDescriptorSetLayout> layouts(_frames_in_flight, _instance_set_layout);
+    std::vector<VkDescriptorSet> sets(_frames_in_flight);
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = context.instancePool;
+    allocInfo.descriptorSetCount = _frames_in_flight;
+    allocInfo.pSetLayouts = layouts.data();
+    if (vkAllocateDescriptorSets(dev, &allocInfo, sets.data()) != VK_SUCCESS) {
         return false;
     }
+    for (unsigned i = 0; i < _frames_in_flight; i++) {
+        context.instanceBuffers[i].vkdesc = sets[i];
+    }
+    return true;
+}
+
+void Pipeline::destroyContext(RecordContext& context) {
+    VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+    if (dev == VK_NULL_HANDLE) {
+        return;
+    }
+    for (auto& allocator : context.uboAllocators) {
+        allocator.Cleanup();
+    }
+    context.uboAllocators.clear();
+    for (auto& instances : context.instanceBuffers) {
+        MemoryAllocator::DestroyBuffer(_dev_id, instances.buffer);
+    }
+    context.instanceBuffers.clear();
+    if (context.instancePool != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(dev, context.instancePool, nullptr);
+        context.instancePool = VK_NULL_HANDLE;
+    }
+}
 
+bool Pipeline::prepareDescriptorSet(const WorldObject& obj, Camera& cam, const PositionDequantization* dequant, unsigned& ubo_id, RecordContext& context, ScreenTransformBatch* screenTransforms) {
     unsigned size;
-    unsigned ubo_id = 0;
     void* dst = nullptr;
-    float* dst_f;
+    bool pushConstants = _uniform_shader_input_layout.layout.ObjectInputs.usePushConstants;
+    bool instancing = _uniform_shader_input_layout.layout.ObjectInputs.useInstancing;
 
-    if (_ubo_allocator.AllocateObjectUniformBufferSet(ubo_id) == false) {
+    UniformBufferAllocator& allocator = context.uboAllocators[_frame_idx];
+    if (allocator.AllocateObjectUniformBufferSet(ubo_id) == false) {
         return false;
     }
     
-    if (_uniform_shader_input_layout.layout.ObjectInputs.useObjToWorldTransform ||
+    if (pushConstants == false && instancing == false && (
+        _uniform_shader_input_layout.layout.ObjectInputs.useObjToWorldTransform ||
         _uniform_shader_input_layout.layout.ObjectInputs.useWorldToCamTransform ||
         _uniform_shader_input_layout.layout.ObjectInputs.useCamToScreenTransform||
-        _uniform_shader_input_layout.layout.ObjectInputs.useObjToScreenTransform) {
-
-        dst = _ubo_allocator.GetObjectUniformBuffer(ubo_id, OBJ_UB_TYPE_TRANSFORM, size);
-        dst_f = (float*)dst;
+        _uniform_shader_input_layout.layout.ObjectInputs.useObjToScreenTransform)) {
 
+        dst = allocator.GetObjectUniformBuffer(ubo_id, OBJ_UB_TYPE_TRANSFORM, size);
         if (dst == nullptr) {
             return false;
         }
+        writeTransformData((float*)dst, obj, cam, dequant, screenTransforms, ~0u);
+    }
 
-        Matrix<4,4> transfrom = obj.GetTransform();
-        // object to world transform
-        if (_uniform_shader_input_layout.layout.ObjectInputs.useObjToWorldTransform) {
-            transfrom.CopyRaw(dst_f);
-            dst_f += 16;
-        }
-        // world to camera transform
-        if (_uniform_shader_input_layout.layout.ObjectInputs.useWorldToCamTransform) {
-            cam.GetWorldToCameraTransform().CopyRaw(dst_f);
-            dst_f += 16;
+    if (pushConstants == false && instancing == false && _uniform_shader_input_layout.layout.ObjectInputs.useMaterialData) {
+        writeMaterialData((float*)allocator.GetObjectUniformBuffer(ubo_id, OBJ_UB_TYPE_MATERIAL, size), obj);
+    }
+
+    if (_uniform_shader_input_layout.layout.ObjectInputs.useCamTransform) {
+        dst = allocator.GetObjectUniformBuffer(ubo_id, OBJ_UB_TYPE_CAM, size);
+        cam.GetTransform().CopyRaw((float*)dst);
+    }
+    
+    for (const auto& input : _uniform_shader_input_layout.layout.ObjectInputs.CustomUniformShaderInput) {
+        dst = allocator.GetObjectUniformBuffer(ubo_id, OBJ_UB_TYPE_CUSTOM, size, input.bindSlot);
+        if (dst && obj.GetCustomData(input.bindSlot).size() >= input.size) {
+            memcpy(dst, obj.GetCustomData(input.bindSlot).data(), input.size);
         }
-        //camera to screen transform
-        if (_uniform_shader_input_layout.layout.ObjectInputs.useCamToScreenTransform) {
-            cam.GetCamToScreenTransform().CopyRaw(dst_f);
-            dst_f += 16;
+    }
+    return true;
+}
+
+void Pipeline::writeTransformData(float* dst_f, const WorldObject& obj, Camera& cam, const PositionDequantization* dequant, ScreenTransformBatch* screenTransforms, unsigned pushDataOffset) const {
+    float* start = dst_f;
+    Matrix<4,4> transfrom = obj.GetTransform();
+    Vec<4> objectScale = obj.GetObjectScale();
+    // quantized positions: the shader computes transform * (objectScale * stored), so the dequantization scale goes
+    // into the object scale, which only positions are multiplied with, and the bias into the transform.
+    // PrepareObjectData rejects quantized meshes on pipelines without object scale
+    if (dequant) {
+        float t[3];
+        for (unsigned c = 0; c < 3; c++) {
+            t[c] = objectScale(c) * dequant->bias[c];
+            objectScale(c) *= dequant->scale[c];
         }
+        transfrom = transfrom * Matrix<4,4>({
+            1, 0, 0, t[0],
+            0, 1, 0, t[1],
+            0, 0, 1, t[2],
+            0, 0, 0, 1 });
+    }
+    // object to world transform
+    if (_uniform_shader_input_layout.layout.ObjectInputs.useObjToWorldTransform) {
+        transfrom.CopyRaw(dst_f);
+        dst_f += 16;
+    }
+    // world to camera transform
+    if (_uniform_shader_input_layout.layout.ObjectInputs.useWorldToCamTransform) {
+        cam.GetWorldToCameraTransform().CopyRaw(dst_f);
+        dst_f += 16;
+    }
+    //camera to screen transform
+    if (_uniform_shader_input_layout.layout.ObjectInputs.useCamToScreenTransform) {
+        cam.GetCamToScreenTransform().CopyRaw(dst_f);
+        dst_f += 16;
+    }
 
-        //cam.GetCamToScreenTransform().Print();
-        //object to screen tranform
-        Matrix<4,4> o_to_s = cam.GetCamToScreenTransform() * cam.GetWorldToCameraTransform() * transfrom;
-        if (_uniform_shader_input_layout.layout.ObjectInputs.useObjToScreenTransform) {
+    //object to screen tranform
+    if (_uniform_shader_input_layout.layout.ObjectInputs.useObjToScreenTransform) {
+        if (screenTransforms) {
+            unsigned offset = pushDataOffset == ~0u ? ~0u : pushDataOffset + (unsigned)(dst_f - start);
+            screenTransforms->Add(cam.GetCamToScreenTransform(), cam.GetWorldToCameraTransform(), transfrom, pushDataOffset == ~0u ? dst_f : nullptr, offset);
+        } else {
+            Matrix<4,4> o_to_s = cam.GetCamToScreenTransform() * cam.GetWorldToCameraTransform() * transfrom;
             o_to_s.CopyRaw(dst_f);
-            dst_f += 16;
-        }
-        //object scales
-        if (_uniform_shader_input_layout.layout.ObjectInputs.useObjectScale) {
-            obj.GetObjectScale().CopyRaw(dst_f);
         }
+        dst_f += 16;
+    }
+    //object scales
+    if (_uniform_shader_input_layout.layout.ObjectInputs.useObjectScale) {
+        objectScale.CopyRaw(dst_f);
     }
+}
 
-    if (_uniform_shader_input_layout.layout.ObjectInputs.useMaterialData) {
-        dst_f = (float*)_ubo_allocator.GetObjectUniformBuffer(ubo_id, OBJ_UB_TYPE_MATERIAL, size);
-        obj.GetMaterial().colour.CopyRaw(dst_f);
-        dst_f += obj.GetMaterial().colour.Size();
+unsigned Pipeline::getTransformDataSize() const {
+    const auto& objectInputs = _uniform_shader_input_layout.layout.ObjectInputs;
+    if (objectInputs.useObjToWorldTransform == false && objectInputs.useWorldToCamTransform == false &&
+        objectInputs.useCamToScreenTransform == false && objectInputs.useObjToScreenTransform == false) {
+        return 0;
+    }
+    unsigned size = 0;
+    size += objectInputs.useObjToWorldTransform ? sizeof(float) * 16 : 0;
+    size += objectInputs.useWorldToCamTransform ? sizeof(float) * 16 : 0;
+    size += objectInputs.useCamToScreenTransform ? sizeof(float) * 16 : 0;
+    size += objectInputs.useObjToScreenTransform ? sizeof(float) * 16 : 0;
+    size += objectInputs.useObjectScale ? sizeof(float) * 4 : 0;
+    return size;
+}
 
-        memcpy(dst_f, &obj.GetMaterial().diffuseConstant, sizeof(float));
-        dst_f++;
+void Pipeline::writeMaterialData(float* dst_f, const WorldObject& obj) const {
+    obj.GetMaterial().colour.CopyRaw(dst_f);
+    dst_f += obj.GetMaterial().colour.Size();
 
-        memcpy(dst_f, &obj.GetMaterial().specularConstant, sizeof(float));
-        dst_f++;
+    memcpy(dst_f, &obj.GetMaterial().diffuseConstant, sizeof(float));
+    dst_f++;
 
-        memcpy(dst_f, &obj.GetMaterial().shininess, sizeof(float));
-        dst_f++;
-    }
+    memcpy(dst_f, &obj.GetMaterial().specularConstant, sizeof(float));
+    dst_f++;
 
-    if (_uniform_shader_input_layout.layout.ObjectInputs.useCamTransform) {
-        dst = _ubo_allocator.GetObjectUniformBuffer(ubo_id, OBJ_UB_TYPE_CAM, size);
-        cam.GetTransform().CopyRaw((float*)dst);
+    memcpy(dst_f, &obj.GetMaterial().shininess, sizeof(float));
+    dst_f++;
+}
+
+bool Pipeline::BeginFrame(unsigned frameIdx) {
+    if (_init == false) {
+        return false;
     }
-    
-    for (const auto& input : _uniform_shader_input_layout.layout.ObjectInputs.CustomUniformShaderInput) {
-        dst = _ubo_allocator.GetObjectUniformBuffer(ubo_id, OBJ_UB_TYPE_CUSTOM, size, input.bindSlot);
-        if (dst && obj.GetCustomData(input.bindSlot).size() >= input.size) {
-            memcpy(dst, obj.GetCustomData(input.bindSlot).data(), input.size);
+    _frame_idx = frameIdx % _frames_in_flight;
+    for (auto& context : _contexts) {
+        if (beginContextFrame(context) == false) {
+            return false;
         }
     }
+    return true;
+}
 
-    
-    if (_ubo_allocator.AddCommandBindUniformBufferSet(ubo_id, _pipelinelayout, cmdBuffer) == false) {
+bool Pipeline::beginContextFrame(RecordContext& context) {
+    UniformBufferAllocator& allocator = context.uboAllocators[_frame_idx];
+    if (allocator.FreeAllObjectUniformBufferSet() == false) {
         return false;
     }
+    context.preparedUboId = ~0u;
+    context.boundUboId = ~0u;
+    context.preparedInstances = 0;
+    context.writtenInstances = 0;
 
+    unsigned size;
+    void* dst = nullptr;
+    if (_uniform_shader_input_layout.layout.GlobalInputs.useDirectionalLight) {
+        dst = allocator.GetGlobalUniformBuffer(GLOB_UB_TYPE_DIRLIGHT, size);
+        if (dst == nullptr) {
+            return false;
+        }
+        memcpy(dst, _dirlight_data.data(), std::min<size_t>(size, _dirlight_data.size() * sizeof(float)));
+    }
+    for (const auto& data : _custom_global_data) {
+        dst = allocator.GetGlobalUniformBuffer(GLOB_UB_TYPE_CUSTOM, size, data.first);
+        if (dst) {
+            memcpy(dst, data.second.data(), std::min<size_t>(size, data.second.size()));
+        }
+    }
     return true;
 }
 
-bool Pipeline::EndRenderPass() {
+void Pipeline::GetUniformBufferStats(UniformBufferStats& stats) const {
+    stats = {};
     if (_init == false) {
+        return;
+    }
+    // contexts are used concurrently, their usage adds up, frame slots are used one after another
+    for (const auto& context : _contexts) {
+        UniformBufferStats contextStats;
+        for (unsigned i = 0; i < context.uboAllocators.size(); i++) {
+            UniformBufferStats allocatorStats;
+            context.uboAllocators[i].GetStats(allocatorStats);
+            if (i == _frame_idx) {
+                contextStats.lastFrameAllocations = allocatorStats.lastFrameAllocations;
+                contextStats.lastFrameBytes = allocatorStats.lastFrameBytes;
+            }
+            contextStats.highWaterAllocations = std::max(contextStats.highWaterAllocations, allocatorStats.highWaterAllocations);
+            contextStats.highWaterBytes = std::max(contextStats.highWaterBytes, allocatorStats.highWaterBytes);
+        }
+        stats.lastFrameAllocations += contextStats.lastFrameAllocations;
+        stats.lastFrameBytes += contextStats.lastFrameBytes;
+        stats.highWaterAllocations += contextStats.highWaterAllocations;
+        stats.highWaterBytes += contextStats.highWaterBytes;
+        for (const auto& allocator : context.uboAllocators) {
+            UniformBufferStats allocatorStats;
+            allocator.GetStats(allocatorStats);
+            stats.capacityAllocations += allocatorStats.capacityAllocations;
+            stats.capacityBytes += allocatorStats.capacityBytes;
+            stats.bufferCount += allocatorStats.bufferCount;
+        }
+    }
+}
+
+void Pipeline::ResetUniformBufferStats() {
+    for (auto& context : _contexts) {
+        for (auto& allocator : context.uboAllocators) {
+            allocator.ResetStats();
+        }
+    }
+}
+
+bool Pipeline::setupPushConstants(const PipelineConfig& config) {
+    auto& objectInputs = _uniform_shader_input_layout.layout.ObjectInputs;
+    _push_transform_size = 0;
+    _push_material_offset = 0;
+    _push_data_size = 0;
+    _push_transform_stages = 0;
+    _push_material_stages = 0;
+    if (objectInputs.usePushConstants == false) {
+        return true;
+    }
+
+    _push_transform_size = getTransformDataSize();
+    if (_push_transform_size) {
+        if (objectInputs.transformVertInput) _push_transform_stages |= VK_SHADER_STAGE_VERTEX_BIT;
+        if (objectInputs.transformFragInput) _push_transform_stages |= VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
+    _push_material_offset = _push_transform_size;
+    unsigned totalSize = _push_transform_size;
+    if (objectInputs.useMaterialData) {
+        totalSize += sizeof(float) * 8;
+        if (objectInputs.materialVertInput) _push_material_stages |= VK_SHADER_STAGE_VERTEX_BIT;
+        if (objectInputs.materialFragInput) _push_material_stages |= VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
+    _push_data_size = totalSize;
+
+    VkPhysicalDevice physdev = DeviceManager::GetVkPhyDevice(_dev_id);
+    if (physdev == VK_NULL_HANDLE) {
         return false;
     }
-    _ubo_allocator.FreeAllObjectUniformBufferSet();
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physdev, &properties);
+    if (totalSize > properties.limits.maxPushConstantsSize) {
+        if (config.useDefaultShaders == false) {
+            printf("push constant data (%u bytes) exceeds device limit (%u bytes)\n", totalSize, properties.limits.maxPushConstantsSize);
+            return false;
+        }
+        printf("push constant data (%u bytes) exceeds device limit (%u bytes), using uniform buffers\n", totalSize, properties.limits.maxPushConstantsSize);
+        objectInputs.usePushConstants = false;
+        _push_transform_size = 0;
+        _push_data_size = 0;
+        _push_transform_stages = 0;
+        _push_material_stages = 0;
+    }
     return true;
 }
 
+void Pipeline::createPushConstantRanges(std::vector<VkPushConstantRange>& ranges) {
+    if (_uniform_shader_input_layout.layout.ObjectInputs.usePushConstants == false) {
+        return;
+    }
+    // a stage may only appear in one range, it covers the blocks read by that stage
+    for (VkShaderStageFlags stage : { VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_FRAGMENT_BIT }) {
+        unsigned begin = ~0u, end = 0;
+        if (_push_transform_size && (_push_transform_stages & stage)) {
+            begin = 0;
+            end = _push_transform_size;
+        }
+        if (_uniform_shader_input_layout.layout.ObjectInputs.useMaterialData && (_push_material_stages & stage)) {
+            begin = std::min<unsigned>(begin, _push_material_offset);
+            end = _push_material_offset + sizeof(float) * 8;
+        }
+        if (end > begin) {
+            ranges.push_back({ stage, begin, end - begin });
+        }
+    }
+}
+
 bool Pipeline::createPipeline(const PipelineConfig& config, VkRenderPass renderPass) {
     VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
     if (dev == VK_NULL_HANDLE) {
@@ -250,22 +735,24 @@ bool Pipeline::createPipeline(const PipelineConfig& config, VkRenderPass renderP
     VkShaderModule fragMod = VK_NULL_HANDLE;
 
     if (config.useDefaultShaders) {
+        bool pushConstants = _uniform_shader_input_layout.layout.ObjectInputs.usePushConstants;
+        bool instancing = _uniform_shader_input_layout.layout.ObjectInputs.useInstancing;
         switch(config.defFragShaderSelect) {
             case DEFAULT_FRAG_SHADER_LIT:
-                fragMod = createShaderModule(dev, litFragShaderBin);
+                fragMod = createShaderModule(dev, instancing ? litFragInstancedShaderBin : pushConstants ? litFragPushShaderBin : litFragShaderBin);
                 break;
             case DEFAULT_FRAG_SHADER_UNLIT:
-                fragMod = createShaderModule(dev, unlitFragShaderBin);
+                fragMod = createShaderModule(dev, instancing ? unlitFragInstancedShaderBin : pushConstants ? unlitFragPushShaderBin : unlitFragShaderBin);
                 break;
             default:
                 return false;
         }
         switch(config.defVertShaderSelect) {
             case DEFAULT_VERT_SHADER_LIT:
-                vertMod = createShaderModule(dev, litVertShaderBin);
+                vertMod = createShaderModule(dev, instancing ? litVertInstancedShaderBin : pushConstants ? litVertPushShaderBin : litVertShaderBin);
                 break;
             case DEFAULT_VERT_SHADER_UNLIT:
-                vertMod = createShaderModule(dev, unlitVertShaderBin);
+                vertMod = createShaderModule(dev, instancing ? unlitVertInstancedShaderBin : pushConstants ? unlitVertPushShaderBin : unlitVertShaderBin);
                 break;
             default:
                 return false;
@@ -284,6 +771,21 @@ bool Pipeline::createPipeline(const PipelineConfig& config, VkRenderPass renderP
     vertShaderStageInfo.module = vertMod;
     vertShaderStageInfo.pName = "main";
 
+    // the default lit vertex shaders decode packed normals, specialization constant 0 selects the encoding
+    int normalEncoding = 0;
+    if (config.useDefaultVertData == false && config.vertDataLayout.useVertNormBuffer) {
+        normalEncoding = config.vertDataLayout.vertNormFormat == VERTEX_NORMAL_UNORM10 ? 1 : config.vertDataLayout.vertNormFormat == VERTEX_NORMAL_OCT16 ? 2 : 0;
+    }
+    VkSpecializationMapEntry normalEncodingEntry = { 0, 0, sizeof(int) };
+    VkSpecializationInfo vertSpecialization{};
+    vertSpecialization.mapEntryCount = 1;
+    vertSpecialization.pMapEntries = &normalEncodingEntry;
+    vertSpecialization.dataSize = sizeof(int);
+    vertSpecialization.pData = &normalEncoding;
+    if (config.useDefaultShaders) {
+        vertShaderStageInfo.pSpecializationInfo = &vertSpecialization;
+    }
+
     VkPipelineShaderStageCreateInfo fragShaderStageInfo{};
     fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -292,15 +794,15 @@ bool Pipeline::createPipeline(const PipelineConfig& config, VkRenderPass renderP
 
     VkPipelineShaderStageCreateInfo shaderStages[] = { vertShaderStageInfo, fragShaderStageInfo };
 
-    VkVertexInputBindingDescription bindingDescription;
+    std::vector<VkVertexInputBindingDescription> bindingDescriptions;
     std::vector<VkVertexInputAttributeDescription> attributeDescriptions;
-    createVertexInputInfo(config, customIpSorted, bindingDescription, attributeDescriptions);
+    createVertexInputInfo(config, customIpSorted, bindingDescriptions, attributeDescriptions);
 
     //vertex input layout
     VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
     vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount = 1;
-    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
+    vertexInputInfo.vertexBindingDescriptionCount = bindingDescriptions.size();
+    vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions.data();
     vertexInputInfo.vertexAttributeDescriptionCount = attributeDescriptions.size();
     vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
 
@@ -418,13 +920,18 @@ bool Pipeline::createPipeline(const PipelineConfig& config, VkRenderPass renderP
     depthStencil.front = {}; // Optional
     depthStencil.back = {}; // Optional
 
-    std::array<VkDescriptorSetLayout, 2> descsets = { _uniform_shader_input_layout.vklayoutobject , _uniform_shader_input_layout.vklayoutglobal };
+    std::vector<VkDescriptorSetLayout> descsets = { _uniform_shader_input_layout.vklayoutobject , _uniform_shader_input_layout.vklayoutglobal };
+    if (_instance_set_layout != VK_NULL_HANDLE) {
+        descsets.push_back(_instance_set_layout);
+    }
     VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
     pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutInfo.setLayoutCount = descsets.size();
     pipelineLayoutInfo.pSetLayouts = descsets.data();
-    pipelineLayoutInfo.pushConstantRangeCount = 0;
-    pipelineLayoutInfo.pPushConstantRanges = nullptr;
+    std::vector<VkPushConstantRange> pushConstantRanges;
+    createPushConstantRanges(pushConstantRanges);
+    pipelineLayoutInfo.pushConstantRangeCount = pushConstantRanges.size();
+    pipelineLayoutInfo.pPushConstantRanges = pushConstantRanges.data();
 
     if (vkCreatePipelineLayout(dev, &pipelineLayoutInfo, nullptr, &_pipelinelayout) != VK_SUCCESS) {
         return false;
@@ -459,94 +966,66 @@ bool Pipeline::createPipeline(const PipelineConfig& config, VkRenderPass renderP
 }
 
 
-void Pipeline::createVertexInputInfo(const PipelineConfig& config, const std::vector<CustomVertInputLayout>& customSorted, VkVertexInputBindingDescription& bindingDescription, std::vector<VkVertexInputAttributeDescription>& attributeDescriptions) {
-    unsigned offset = 0;
+void Pipeline::createVertexInputInfo(const PipelineConfig& config, const std::vector<CustomVertInputLayout>& customSorted, std::vector<VkVertexInputBindingDescription>& bindingDescriptions, std::vector<VkVertexInputAttributeDescription>& attributeDescriptions) {
     bool useVerts = config.vertDataLayout.useVertBuffer || config.useDefaultVertData;
     bool useNorm = config.vertDataLayout.useVertNormBuffer || config.useDefaultVertData;
-    unsigned maxLocation = 0;
     unsigned vertSlot = config.useDefaultVertData ? 0 : config.vertDataLayout.vertInputSlot;
-    unsigned normalSlot = config.useDefaultVertData ? 1 : config.vertDataLayout.useVertNormBuffer;
-    unsigned numInputs = (unsigned)useVerts + (unsigned)useNorm + config.vertDataLayout.customVertInputLayouts.size();
-    
-
-    bindingDescription.binding = 0;
-    bindingDescription.stride = 0;
-    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-
-    if (useVerts) {
-        bindingDescription.stride += sizeof(float) * 4;
-        if (vertSlot > maxLocation) {
-            maxLocation = config.vertDataLayout.vertInputSlot;
-        }
-    }
-    if (useNorm) {
-        bindingDescription.stride += sizeof(float) * 3;
-        if (normalSlot > maxLocation) {
-            maxLocation = config.vertDataLayout.vertNormInputSlot;
-        }
-    }
-    if (config.useDefaultVertData == false) {
-        for (const auto& data : customSorted) {
-            bindingDescription.stride += getVertDataSize(data.type, data.components);
-            if (data.shaderInputSlot > maxLocation) {
-                maxLocation = data.shaderInputSlot;
-            }
+    unsigned normalSlot = config.useDefaultVertData ? 1 : config.vertDataLayout.vertNormInputSlot;
+    // split streams: one binding per attribute in the order position, normal, custom inputs, matching the mesh's vertex buffers
+    bool split = config.useDefaultVertData == false && config.vertDataLayout.splitStreams;
+
+    bindingDescriptions.clear();
+    attributeDescriptions.clear();
+    auto addAttribute = [&](unsigned location, VkFormat format, unsigned size) {
+        if (split || bindingDescriptions.empty()) {
+            VkVertexInputBindingDescription bindingDescription{};
+            bindingDescription.binding = bindingDescriptions.size();
+            bindingDescription.stride = 0;
+            bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+            bindingDescriptions.push_back(bindingDescription);
         }
-    }
+        VkVertexInputAttributeDescription attributeDescription{};
+        attributeDescription.binding = bindingDescriptions.back().binding;
+        attributeDescription.location = location;
+        attributeDescription.format = format;
+        attributeDescription.offset = bindingDescriptions.back().stride;
+        bindingDescriptions.back().stride += size;
+        attributeDescriptions.push_back(attributeDescription);
+    };
 
-    attributeDescriptions.resize(numInputs);
-    
-    unsigned idx = 0;    
     if (useVerts) {
-        VkFormat format = getVkFormat(GLSL_FLOAT, 4);
-        unsigned size = getVertDataSize(GLSL_FLOAT, 4);
-
-        attributeDescriptions[idx].binding = 0;
-        attributeDescriptions[idx].location = vertSlot;
-        attributeDescriptions[idx].format = format;
-        attributeDescriptions[idx].offset = offset;
-        offset += size;
-        idx++;
+        VertexPositionFormat format = config.useDefaultVertData ? VERTEX_POSITION_FLOAT4 : config.vertDataLayout.vertFormat;
+        addAttribute(vertSlot, getVkFormat(format), getVertDataSize(format));
     }
     if (useNorm) {
-        VkFormat format = getVkFormat(GLSL_FLOAT, 3);
-        unsigned size = getVertDataSize(GLSL_FLOAT, 3);
-
-        //printf("colour format %d, size %d\n", format, size);
-        attributeDescriptions[idx].binding = 0;
-        attributeDescriptions[idx].location = normalSlot;
-        attributeDescriptions[idx].format = format;
-        attributeDescriptions[idx].offset = offset;
-        offset += size;
-        idx++;
+        VertexNormalFormat format = config.useDefaultVertData ? VERTEX_NORMAL_FLOAT3 : config.vertDataLayout.vertNormFormat;
+        addAttribute(normalSlot, getVkFormat(format), getVertDataSize(format));
     }
-
     if (config.useDefaultVertData == false) {
-        for (int i = 0; i < customSorted.size(); i++) {
-            VkFormat format = getVkFormat(customSorted[i].type, customSorted[i].components);
-            unsigned size = getVertDataSize(customSorted[i].type, customSorted[i].components);
-
-            printf("custom %d format %d, size %d, offset 0x%0x\n", i, format, size, offset);
-            attributeDescriptions[idx].binding = 0;
-            attributeDescriptions[idx].location = config.vertDataLayout.customVertInputLayouts[i].shaderInputSlot;
-            attributeDescriptions[idx].format = format;
-            attributeDescriptions[idx].offset = offset;
-            offset += size;
-            idx++;
+        for (const auto& data : customSorted) {
+            addAttribute(data.shaderInputSlot, getVkFormat(data.type, data.components), getVertDataSize(data.type, data.components));
         }
     }
 }
 
 void Pipeline::createObjectUniformBufferBindList(std::vector<VkDescriptorSetLayoutBinding>& uboLayoutBindingList) {
+    //dynamic mode: object sets are shared per pool and addressed with dynamic offsets
+    VkDescriptorType objectType = _uniform_shader_input_layout.layout.ObjectInputs.useDynamicUniformBuffers ?
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 
-    if (_uniform_shader_input_layout.layout.ObjectInputs.useObjToScreenTransform ||
+    // transform and material data are push constants in push constant mode, instances read them from set 2
+    bool pushConstants = _uniform_shader_input_layout.layout.ObjectInputs.usePushConstants;
+    bool instancing = _uniform_shader_input_layout.layout.ObjectInputs.useInstancing;
+
+    if (pushConstants == false && instancing == false && (
+        _uniform_shader_input_layout.layout.ObjectInputs.useObjToScreenTransform ||
         _uniform_shader_input_layout.layout.ObjectInputs.useObjToWorldTransform ||
         _uniform_shader_input_layout.layout.ObjectInputs.useWorldToCamTransform ||
-        _uniform_shader_input_layout.layout.ObjectInputs.useCamToScreenTransform ) {
+        _uniform_shader_input_layout.layout.ObjectInputs.useCamToScreenTransform )) {
 
         VkDescriptorSetLayoutBinding uboLayoutBinding{};
         uboLayoutBinding.binding = _uniform_shader_input_layout.layout.ObjectInputs.transformBindSlot;
-        uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        uboLayoutBinding.descriptorType = objectType;
         uboLayoutBinding.descriptorCount = 1;
         if(_uniform_shader_input_layout.layout.ObjectInputs.transformVertInput)uboLayoutBinding.stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
         if(_uniform_shader_input_layout.layout.ObjectInputs.transformFragInput)uboLayoutBinding.stageFlags |= VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -554,10 +1033,10 @@ void Pipeline::createObjectUniformBufferBindList(std::vector<VkDescriptorSetLayo
 
         uboLayoutBindingList.push_back(uboLayoutBinding);
     }
-    if (_uniform_shader_input_layout.layout.ObjectInputs.useMaterialData) {
+    if (pushConstants == false && instancing == false && _uniform_shader_input_layout.layout.ObjectInputs.useMaterialData) {
         VkDescriptorSetLayoutBinding uboLayoutBinding{};
         uboLayoutBinding.binding = _uniform_shader_input_layout.layout.ObjectInputs.materialDataBindSlot;
-        uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        uboLayoutBinding.descriptorType = objectType;
         uboLayoutBinding.descriptorCount = 1;
         if(_uniform_shader_input_layout.layout.ObjectInputs.materialVertInput)uboLayoutBinding.stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
         if(_uniform_shader_input_layout.layout.ObjectInputs.materialFragInput)uboLayoutBinding.stageFlags |= VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -568,7 +1047,7 @@ void Pipeline::createObjectUniformBufferBindList(std::vector<VkDescriptorSetLayo
     if (_uniform_shader_input_layout.layout.ObjectInputs.useCamTransform) {
         VkDescriptorSetLayoutBinding uboLayoutBinding{};
         uboLayoutBinding.binding = _uniform_shader_input_layout.layout.ObjectInputs.camTransformBindSlot;
-        uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        uboLayoutBinding.descriptorType = objectType;
         uboLayoutBinding.descriptorCount = 1;
         if(_uniform_shader_input_layout.layout.ObjectInputs.camTransformVertInput)uboLayoutBinding.stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
         if(_uniform_shader_input_layout.layout.ObjectInputs.camTransformFragInput)uboLayoutBinding.stageFlags |= VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -580,7 +1059,7 @@ void Pipeline::createObjectUniformBufferBindList(std::vector<VkDescriptorSetLayo
     for (auto& desc : _uniform_shader_input_layout.layout.ObjectInputs.CustomUniformShaderInput) {
         VkDescriptorSetLayoutBinding uboLayoutBinding{};
         uboLayoutBinding.binding = desc.bindSlot;
-        uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        uboLayoutBinding.descriptorType = objectType;
         uboLayoutBinding.descriptorCount = 1;
         uboLayoutBinding.stageFlags = 0;
         if (desc.vertInput) uboLayoutBinding.stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
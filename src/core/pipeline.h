@@ -1,5 +1,7 @@
 #pragma once
+#include <array>
 #include <vector>
+#include <unordered_map>
 
 #include "util.h"
 #include "types_internal.h"
@@ -7,6 +9,7 @@
 #include "ubomgr.h"
 #include "camera.h"
 #include "worldobj.h"
+#include "transformbatch.h"
 
 namespace RenderingFramework3D{
 class Pipeline
@@ -15,9 +18,13 @@ public:
 	Pipeline();
 	~Pipeline();
 
-	bool Initialize(unsigned dev, const PipelineConfig& config, VkRenderPass renderPass);
+	bool Initialize(unsigned dev, const PipelineConfig& config, VkRenderPass renderPass, unsigned framesInFlight=1);
 	bool Cleanup();
 
+	// recording state is kept per draw context, context 0 records the renderer's own draw list and the others
+	// may each be used by a different thread at the same time, contexts are created on demand
+	bool ReserveContexts(unsigned count);
+
 	bool IsReady();
 
 	bool SetLightDir(const MathUtil::Vec<3>& lightDir);
@@ -30,17 +37,57 @@ public:
 
 	const UniformShaderInputLayout& GetUniformBufferSetLayout() const;
 	
-	bool AddCommandBindPipeline(VkCommandBuffer cmdBuffer);
-	bool AddCommandBindUniformBufferSet(VkCommandBuffer cmdBuffer, const WorldObject& obj, Camera& cam);
+	bool AddCommandBindPipeline(VkCommandBuffer cmdBuffer, unsigned ctx=0);
+
+	// per draw object data, captured when a draw is submitted and bound when it is recorded
+	struct ObjectDrawData {
+		// object uniform buffer set of the current frame, ~0u if none
+		unsigned uboId = ~0u;
+		// offset in floats of the draw's push constant and instance data in the push data array
+		unsigned pushDataOffset = 0;
+		unsigned instanceDataOffset = 0;
+		// instancing mode: the draw has no per object data besides its instance record
+		bool batchable = false;
+	};
+	// writes the object's uniform data for the current frame, push constant and instance data is appended to pushData.
+	// dequant is the decode of the mesh's quantized positions, folded into the transform data, nullptr if not quantized.
+	// With screenTransforms the object to screen transform is queued there instead, it must be computed before recording
+	bool PrepareObjectData(const WorldObject& obj, Camera& cam, const PositionDequantization* dequant, ObjectDrawData& data, std::vector<float>& pushData, unsigned ctx=0, ScreenTransformBatch* screenTransforms=nullptr);
+	bool AddCommandBindObjectData(VkCommandBuffer cmdBuffer, const ObjectDrawData& data, const std::vector<float>& pushData, unsigned ctx=0);
+
+	// instancing mode: draws binding identical object data can be drawn as instances of one draw
+	bool IsInstanced() const;
+	bool CanBatch(const ObjectDrawData& first, const ObjectDrawData& other) const;
+	// size the current frame's instance buffer for every draw prepared this frame, call before recording
+	bool ReserveInstances(unsigned ctx=0);
+	// copies the draw's transform and material to the current frame's instance buffer, returns its instance index
+	bool WriteInstance(const ObjectDrawData& data, const std::vector<float>& pushData, unsigned& instanceIdx, unsigned ctx=0);
+
+	// switch to the uniform buffers of frame slot frameIdx in every context, the slot must no longer be in use by the GPU
+	bool BeginFrame(unsigned frameIdx);
 
-	bool EndRenderPass();
+	// per draw uniform data usage over all frame slots of this pipeline
+	void GetUniformBufferStats(UniformBufferStats& stats) const;
+	void ResetUniformBufferStats();
 
 private:
 	bool createPipeline(const PipelineConfig& config, VkRenderPass renderPass);
-	void createVertexInputInfo(const PipelineConfig& config, const std::vector<CustomVertInputLayout>& customSorted, VkVertexInputBindingDescription& bindingDescription, std::vector<VkVertexInputAttributeDescription>& attributeDescriptions);
+	void createVertexInputInfo(const PipelineConfig& config, const std::vector<CustomVertInputLayout>& customSorted, std::vector<VkVertexInputBindingDescription>& bindingDescriptions, std::vector<VkVertexInputAttributeDescription>& attributeDescriptions);
 	void createObjectUniformBufferBindList(std::vector<VkDescriptorSetLayoutBinding>& uboLayoutBindingList);
 	void createGlobalUniformBufferBindList(std::vector<VkDescriptorSetLayoutBinding>& uboLayoutBindingList);
 	bool createDescriptorSetLayout(VkDevice dev, const std::vector <VkDescriptorSetLayoutBinding>& bindings, VkDescriptorSetLayout& vkdesclayout);
+	bool setupPushConstants(const PipelineConfig& config);
+	void createPushConstantRanges(std::vector<VkPushConstantRange>& ranges);
+	struct RecordContext;
+	bool prepareDescriptorSet(const WorldObject& obj, Camera& cam, const PositionDequantization* dequant, unsigned& uboId, RecordContext& context, ScreenTransformBatch* screenTransforms);
+	bool initContext(RecordContext& context);
+	void destroyContext(RecordContext& context);
+	bool beginContextFrame(RecordContext& context);
+
+	// pushDataOffset is the offset of dst in the push data array, ~0u if dst is mapped uniform memory
+	void writeTransformData(float* dst, const WorldObject& obj, Camera& cam, const PositionDequantization* dequant, ScreenTransformBatch* screenTransforms, unsigned pushDataOffset) const;
+	void writeMaterialData(float* dst, const WorldObject& obj) const;
+	unsigned getTransformDataSize() const;
 
 private:
 	bool _init;
@@ -48,8 +95,48 @@ private:
 	VkPipeline _graphics_pipeline;
 
 	UniformShaderInputLayoutInternal _uniform_shader_input_layout;
+	// object set layout of the allocators, without the data sent as push constants or instance data
+	UniformShaderInputLayoutInternal _allocator_layout;
+	unsigned _frames_in_flight;
+	unsigned _frame_idx;
+
+	// CPU copies of global uniform data, uploaded to a frame slot's global buffers in BeginFrame
+	std::vector<float> _dirlight_data;
+	std::unordered_map<unsigned, std::vector<uint8_t>> _custom_global_data;
+
+	// push constant mode: size of the transform block (offset 0), offset of the material block and the stages reading them
+	unsigned _push_transform_size;
+	unsigned _push_material_offset;
+	VkShaderStageFlags _push_transform_stages;
+	VkShaderStageFlags _push_material_stages;
+	unsigned _push_data_size;
+
+	// instancing mode: storage buffer of instance transforms and materials, bound as set 2
+	struct InstanceBuffer {
+		BufferResources buffer;
+		uint8_t* mapped = nullptr;
+		unsigned capacity = 0;
+		VkDescriptorSet vkdesc = VK_NULL_HANDLE;
+	};
+	VkDescriptorSetLayout _instance_set_layout;
+	unsigned _instance_stride;
 
-	UniformBufferAllocator _ubo_allocator;
+	struct RecordContext {
+		// one allocator per frame in flight, so uniform data of frames still executing on the GPU is never overwritten
+		std::vector<UniformBufferAllocator> uboAllocators;
+		// instancing mode: one instance buffer per frame in flight
+		std::vector<InstanceBuffer> instanceBuffers;
+		VkDescriptorPool instancePool = VK_NULL_HANDLE;
+		unsigned preparedInstances = 0;
+		unsigned writtenInstances = 0;
+		// push constant and instancing mode: the object set holds no transform, draws share it until its data changes
+		unsigned preparedUboId = ~0u;
+		std::vector<float> preparedSetData;
+		std::vector<float> setData;
+		// set bound in the command buffer since the last pipeline bind, ~0u if none
+		unsigned boundUboId = ~0u;
+	};
+	std::vector<RecordContext> _contexts;
 
 	unsigned _dev_id;
 };
@@ -0,0 +1,233 @@
+#include "readback.h"
+#include "devicemgr.h"
+#include "memalloc.h"
+
+
+namespace RenderingFramework3D {
+
+ReadbackRing::ReadbackRing()
+    :
+    _init(false),
+    _slots(),
+    _requested(~0u),
+    _pending(),
+    _worker(),
+    _mutex(),
+    _cond(),
+    _ready(),
+    _stop(false),
+    _dev_id(0)
+{}
+
+ReadbackRing::~ReadbackRing() {
+    Cleanup();
+}
+
+bool ReadbackRing::Initialize(unsigned dev, unsigned slots) {
+    if (_init) {
+        return true;
+    }
+    _dev_id = dev;
+    _slots = std::vector<Slot>(slots);
+    _requested = ~0u;
+    _stop = false;
+    _worker = std::thread(&ReadbackRing::workerLoop, this);
+    _init = true;
+    return true;
+}
+
+bool ReadbackRing::Cleanup() {
+    if (_init == false) {
+        return true;
+    }
+    Dispatch();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cond.notify_all();
+    _worker.join();
+
+    for (auto& slot : _slots) {
+        destroySlotBuffer(slot);
+    }
+    _slots.clear();
+    _pending.clear();
+    _ready.clear();
+    _requested = ~0u;
+    _init = false;
+    return true;
+}
+
+bool ReadbackRing::Request(const std::function<void(const FrameReadbackData&)>& callback) {
+    if (_init == false || callback == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_requested != ~0u) {
+        _slots[_requested].callback = callback;
+        return true;
+    }
+    for (unsigned i = 0; i < _slots.size(); i++) {
+        if (_slots[i].busy == false) {
+            _slots[i].busy = true;
+            _slots[i].callback = callback;
+            _requested = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ReadbackRing::HasRequest() const {
+    return _requested != ~0u;
+}
+
+bool ReadbackRing::AddCommandCopyImage(VkCommandBuffer cmdBuffer, VkImage image, VkImageLayout layout, VkExtent2D extent, ImageFormat format, VkFence fence, unsigned long long frame) {
+    if (_init == false || _requested == ~0u) {
+        return false;
+    }
+    // the slot is reserved, the worker does not touch it until it is dispatched
+    Slot& slot = _slots[_requested];
+    unsigned rowPitch = extent.width * getImageFormatSize(format);
+    VkDeviceSize size = (VkDeviceSize)rowPitch * extent.height;
+    if (slot.size < size) {
+        destroySlotBuffer(slot);
+        if (createSlotBuffer(slot, size) == false) {
+            printf("failed to create readback buffer\n");
+            // drop the request so the next one can take a slot again
+            std::lock_guard<std::mutex> lock(_mutex);
+            slot.callback = nullptr;
+            slot.busy = false;
+            _requested = ~0u;
+            return false;
+        }
+    }
+
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.layerCount = 1;
+    if (layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL) {
+        barrier.oldLayout = layout;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+
+    VkBufferImageCopy region{};
+    region.bufferOffset = 0;
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset = { 0, 0, 0 };
+    region.imageExtent = { extent.width, extent.height, 1 };
+    vkCmdCopyImageToBuffer(cmdBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot.buffer.vkBuffer, 1, &region);
+
+    // make the copy visible to the host once the fence signals
+    VkBufferMemoryBarrier hostBarrier{};
+    hostBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    hostBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    hostBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    hostBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    hostBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    hostBarrier.buffer = slot.buffer.vkBuffer;
+    hostBarrier.offset = 0;
+    hostBarrier.size = VK_WHOLE_SIZE;
+    vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &hostBarrier, 0, nullptr);
+
+    if (layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL) {
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.newLayout = layout;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.dstAccessMask = 0;
+        vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    } else {
+        // the next frame's render pass must not overwrite the image before the copy read it
+        vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0, 0, nullptr, 0, nullptr, 0, nullptr);
+    }
+
+    slot.data.width = extent.width;
+    slot.data.height = extent.height;
+    slot.data.rowPitch = rowPitch;
+    slot.data.format = format;
+    slot.data.frame = frame;
+    slot.data.data = slot.mapped;
+    slot.fence = fence;
+    _pending.push_back(_requested);
+    _requested = ~0u;
+    return true;
+}
+
+void ReadbackRing::Dispatch() {
+    if (_init == false || _pending.empty()) {
+        return;
+    }
+    VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+    if (dev == VK_NULL_HANDLE) {
+        return;
+    }
+    // frames complete in submission order
+    unsigned count = 0;
+    while (count < _pending.size() && vkGetFenceStatus(dev, _slots[_pending[count]].fence) == VK_SUCCESS) {
+        count++;
+    }
+    if (count == 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _ready.insert(_ready.end(), _pending.begin(), _pending.begin() + count);
+    }
+    _pending.erase(_pending.begin(), _pending.begin() + count);
+    _cond.notify_one();
+}
+
+bool ReadbackRing::createSlotBuffer(Slot& slot, VkDeviceSize size) {
+    // cached memory is much faster to read from the CPU, it may not be coherent
+    if (MemoryAllocator::CreateBuffer(_dev_id, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, slot.buffer) == false) {
+        if (MemoryAllocator::CreateBuffer(_dev_id, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, slot.buffer) == false) {
+            return false;
+        }
+    }
+    slot.mapped = slot.buffer.memory.mapped;
+    slot.size = size;
+    return true;
+}
+
+void ReadbackRing::destroySlotBuffer(Slot& slot) {
+    MemoryAllocator::DestroyBuffer(_dev_id, slot.buffer);
+    slot.mapped = nullptr;
+    slot.size = 0;
+}
+
+void ReadbackRing::workerLoop() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    for (;;) {
+        _cond.wait(lock, [this] { return _stop || _ready.empty() == false; });
+        if (_ready.empty()) {
+            return;
+        }
+        unsigned idx = _ready.front();
+        _ready.pop_front();
+        Slot& slot = _slots[idx];
+        std::function<void(const FrameReadbackData&)> callback = std::move(slot.callback);
+        lock.unlock();
+
+        MemoryAllocator::InvalidateRange(_dev_id, slot.buffer.memory, 0, slot.size);
+        callback(slot.data);
+
+        lock.lock();
+        slot.callback = nullptr;
+        slot.busy = false;
+    }
+}
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include "util.h"
+#include "devicemgr.h"
+
+
+namespace RenderingFramework3D {
+
+// ring of persistently mapped host buffers the colour attachment is copied to, a worker thread runs the
+// callbacks of copies whose frame completed so the render loop never waits for the GPU
+class ReadbackRing
+{
+public:
+	ReadbackRing();
+	~ReadbackRing();
+
+	bool Initialize(unsigned dev, unsigned slots);
+	// waits for the worker to run the callbacks of every submitted copy, the device must be idle
+	bool Cleanup();
+
+	// reserves a slot for the frame being recorded, false if every slot is in use
+	bool Request(const std::function<void(const FrameReadbackData&)>& callback);
+	bool HasRequest() const;
+
+	// records the copy of the requested readback after the render pass, image is in layout and left in it.
+	// fence is the frame's fence, the copy is complete once it signals
+	bool AddCommandCopyImage(VkCommandBuffer cmdBuffer, VkImage image, VkImageLayout layout, VkExtent2D extent, ImageFormat format, VkFence fence, unsigned long long frame);
+
+	// hands copies whose fence signalled to the worker thread, call before a frame's fence is reset, never blocks
+	void Dispatch();
+
+private:
+	struct Slot;
+	bool createSlotBuffer(Slot& slot, VkDeviceSize size);
+	void destroySlotBuffer(Slot& slot);
+	void workerLoop();
+
+private:
+	bool _init;
+
+	struct Slot {
+		BufferResources buffer;
+		VkDeviceSize size = 0;
+		uint8_t* mapped = nullptr;
+
+		std::function<void(const FrameReadbackData&)> callback;
+		FrameReadbackData data{};
+		VkFence fence = VK_NULL_HANDLE;
+		// reserved by Request until the worker ran its callback
+		bool busy = false;
+	};
+	std::vector<Slot> _slots;
+	// slot requested for the frame being recorded, ~0u if none
+	unsigned _requested;
+	// slots recorded in submitted frames, in submission order
+	std::deque<unsigned> _pending;
+
+	std::thread _worker;
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	std::deque<unsigned> _ready;
+	bool _stop;
+
+	unsigned _dev_id;
+};
+}
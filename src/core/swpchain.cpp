@@ -1,5 +1,6 @@
 #include "swpchain.h"
 #include "devicemgr.h"
+#include "memalloc.h"
 
 
 namespace RenderingFramework3D {
@@ -67,6 +68,25 @@ VkRenderPass Swapchain::GetRenderPass() {
     return _render_pass;
 }
 
+VkExtent2D Swapchain::GetExtent() const {
+    return _extent;
+}
+
+VkFormat Swapchain::GetFormat() const {
+    return _surface_format.format;
+}
+
+VkImage Swapchain::GetCurrentImage() const {
+    if (_current_image_index < _swapchain_images.size()) {
+        return _swapchain_images[_current_image_index];
+    }
+    return VK_NULL_HANDLE;
+}
+
+bool Swapchain::SupportsTransferSrc() const {
+    return (_support.capabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT) != 0;
+}
+
 bool Swapchain::UpdateFrameBufferIndex(VkSemaphore imageAvailableSem, bool& needUpdate) {
     if (_init) {
         VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
@@ -89,7 +109,7 @@ bool Swapchain::UpdateFrameBufferIndex(VkSemaphore imageAvailableSem, bool& need
 }
 
 
-bool Swapchain::AddCommandBindRenderpass(VkCommandBuffer cmdBuffer) {
+bool Swapchain::AddCommandBindRenderpass(VkCommandBuffer cmdBuffer, bool secondaryContents) {
     if (_init) {
 
         //if (result == VK_ERROR_OUT_OF_DATE_KHR) {
@@ -114,7 +134,7 @@ bool Swapchain::AddCommandBindRenderpass(VkCommandBuffer cmdBuffer) {
 
         renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
         renderPassInfo.pClearValues = clearValues.data();
-        vkCmdBeginRenderPass(cmdBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdBeginRenderPass(cmdBuffer, &renderPassInfo, secondaryContents ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
         return true;
     }
     return false;
@@ -168,6 +188,9 @@ bool Swapchain::createSwapchain() {
     swapChainCreateInfo.imageExtent = _extent;
     swapChainCreateInfo.imageArrayLayers = 1;
     swapChainCreateInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    if (SupportsTransferSrc()) {
+        swapChainCreateInfo.imageUsage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    }
 
     unsigned presQueue;
     unsigned gfxQueue;
@@ -204,7 +227,7 @@ bool Swapchain::createSwapchain() {
     if (vkGetSwapchainImagesKHR(dev, _swapchain, &count, _swapchain_images.data()) != VK_SUCCESS) {
         return false;
     }
-    if (createImage(physdev, dev, _extent.width, _extent.height, VK_FORMAT_D32_SFLOAT, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, _depth_image.vkImage, _depth_image.vkImgMem) == false) {
+    if (MemoryAllocator::CreateImage(_dev_id, _extent.width, _extent.height, VK_FORMAT_D32_SFLOAT, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, _depth_image) == false) {
         return false;
     }
 
@@ -236,64 +259,7 @@ bool Swapchain::createRenderPass() {
     if (dev == VK_NULL_HANDLE) {
         return false;
     }
-
-    VkAttachmentDescription colorAttachment{};
-    colorAttachment.format = _surface_format.format;
-    colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
-    colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-    colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-    colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-    colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-    colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-
-    VkAttachmentReference colorAttachmentRef{};
-    colorAttachmentRef.attachment = 0;
-    colorAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-
-    VkAttachmentDescription depthAttachment{};
-    depthAttachment.format = VK_FORMAT_D32_SFLOAT;
-    depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
-    depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-    depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-    depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-    depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-    depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-
-    VkAttachmentReference depthAttachmentRef{};
-    depthAttachmentRef.attachment = 1;
-    depthAttachmentRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-
-    std::vector<VkAttachmentDescription> attachments = { colorAttachment, depthAttachment };
-
-    VkSubpassDescription subpass{};
-    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
-    subpass.colorAttachmentCount = 1;
-    subpass.pColorAttachments = &colorAttachmentRef;
-    subpass.pDepthStencilAttachment = &depthAttachmentRef;
-
-    VkSubpassDependency dependency{};
-    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
-    dependency.dstSubpass = 0;
-    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-    dependency.srcAccessMask = 0;
-    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-
-    VkRenderPassCreateInfo renderPassInfo{};
-    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-    renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
-    renderPassInfo.pAttachments = attachments.data();
-    renderPassInfo.subpassCount = 1;
-    renderPassInfo.pSubpasses = &subpass;
-    renderPassInfo.dependencyCount = 1;
-    renderPassInfo.pDependencies = &dependency;
-
-    if (vkCreateRenderPass(dev, &renderPassInfo, nullptr, &_render_pass) != VK_SUCCESS) {
-        return false;
-    }
-    return true;
+    return RenderingFramework3D::createRenderPass(dev, _surface_format.format, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, _render_pass);
 }
 
 bool Swapchain::createFrameBuffers() {
@@ -355,8 +321,7 @@ bool Swapchain::cleanupSwapchain() {
         vkDestroyImageView(dev, imgv, nullptr);
     }
     vkDestroyImageView(dev, _depth_imageview, nullptr);
-    vkDestroyImage(dev, _depth_image.vkImage, nullptr);
-    vkFreeMemory(dev, _depth_image.vkImgMem, nullptr);
+    MemoryAllocator::DestroyImage(_dev_id, _depth_image);
 
     vkDestroySwapchainKHR(dev, _swapchain, nullptr);
 
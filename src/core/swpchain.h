@@ -21,9 +21,16 @@ public:
 	bool UpdateSwapChain(VkExtent2D extent);
 
 	VkRenderPass GetRenderPass();
+	VkExtent2D GetExtent() const;
+	VkFormat GetFormat() const;
+	// image of the current frame, in VK_IMAGE_LAYOUT_PRESENT_SRC_KHR after the render pass
+	VkImage GetCurrentImage() const;
+	// the images can be copied from, required for frame readback
+	bool SupportsTransferSrc() const;
 
 	bool UpdateFrameBufferIndex(VkSemaphore imageAvailableSem, bool& needUpdate);
-	bool AddCommandBindRenderpass(VkCommandBuffer cmdBuffer);
+	// secondaryContents: the pass is recorded in secondary command buffers executed with vkCmdExecuteCommands
+	bool AddCommandBindRenderpass(VkCommandBuffer cmdBuffer, bool secondaryContents=false);
 
 	bool PresentFrame(VkSemaphore waitSem);
 
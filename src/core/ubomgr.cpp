@@ -1,9 +1,10 @@
+#include <algorithm>
 #include "ubomgr.h"
+#include "memalloc.h"
 
 #define DESCRIPTORSET_POOLSIZE 100
 
 
-
 namespace RenderingFramework3D {
 
 UniformBufferAllocator::UniformBufferAllocator(unsigned poolsize) 
@@ -11,19 +12,32 @@ UniformBufferAllocator::UniformBufferAllocator(unsigned poolsize)
 	_init(false),
 	_vk_pool_obj(),
 	_obj_sets(),
+	_pool_first_id(),
 	_pool_size(poolsize),
 	_available(),
 	_vk_pool_global(VK_NULL_HANDLE),
 	_global_set(),
 	_layout(),
-	_dev_id()
+	_dev_id(),
+	_dynamic(false),
+	_pool_buffers(),
+	_dynamic_bindings(),
+	_dynamic_stride(0),
+	_linear_head(0),
+	_capacity(0),
+	_high_water(0),
+	_size_hint(0)
 {}
 
 bool UniformBufferAllocator::Initialize(unsigned dev, const UniformShaderInputLayoutInternal& layout) {
 	if (_init == false) {
 		_dev_id = dev;
 		_layout = layout;
+		_dynamic = layout.layout.ObjectInputs.useDynamicUniformBuffers;
 		_init = true;
+		if (_dynamic) {
+			createDynamicSlotLayout();
+		}
 		if (createGlobalSet() == false) {
 			return false;
 		}
@@ -40,13 +54,45 @@ bool UniformBufferAllocator::Cleanup() {
 			return false;
 		}
 
+		auto freeBuffer = [this](DescriptorSetBufferResources& res) {
+			MemoryAllocator::DestroyBuffer(_dev_id, res.buffer);
+		};
+
+		if (_dynamic) {
+			releaseDynamicPools();
+			_linear_head = 0;
+			_high_water = 0;
+			_size_hint = 0;
+		} else {
+			for (auto& pool : _obj_sets) {
+				for (auto& set : pool) {
+					freeBuffer(set.transformBuffer);
+					freeBuffer(set.materialBuffer);
+					freeBuffer(set.camTransformBuffer);
+					for (auto& custom : set.customBuffers) {
+						freeBuffer(custom.second);
+					}
+				}
+			}
+		}
 		for (auto& pool : _vk_pool_obj) {
 			vkDestroyDescriptorPool(dev, pool, nullptr);
 			pool = VK_NULL_HANDLE;
 		}
 
+		freeBuffer(_global_set.dirlightBuffer);
+		for (auto& custom : _global_set.customBuffers) {
+			freeBuffer(custom.second);
+		}
+		_global_set.customBuffers.clear();
+		if (_vk_pool_global != VK_NULL_HANDLE) {
+			vkDestroyDescriptorPool(dev, _vk_pool_global, nullptr);
+			_vk_pool_global = VK_NULL_HANDLE;
+		}
+
 		_vk_pool_obj.clear();
 		_obj_sets.clear();
+		_pool_first_id.clear();
 		while (_available.size()) {
 			_available.pop();
 		}
@@ -56,31 +102,44 @@ bool UniformBufferAllocator::Cleanup() {
 }
 
 bool UniformBufferAllocator::AllocateObjectUniformBufferSet(unsigned& id) {
+	if (_init && _dynamic) {
+		if (_linear_head == _capacity) {
+			if (addNewPool() == false) {
+				return false;
+			}
+		}
+		id = _linear_head++;
+		return true;
+	}
 	if (_init) {
-		if (_available.size()) {
-			unsigned available_id = _available.top();
-			_available.pop();
-			unsigned pool_idx = available_id / _pool_size;
-			unsigned desc_idx = available_id % _pool_size;
-
-			_obj_sets[pool_idx][desc_idx].used = true;
-			id = available_id;
-		} else {
-			unsigned pool_idx = _vk_pool_obj.size() - 1;
-			id = pool_idx * _pool_size;
+		if (_available.size() == 0) {
 			if (addNewPool() == false) {
 				return false;
 			}
 		}
+		unsigned available_id = _available.top();
+		_available.pop();
+
+		unsigned pool_idx, desc_idx;
+		if (locateSet(available_id, pool_idx, desc_idx) == false) {
+			return false;
+		}
+		_obj_sets[pool_idx][desc_idx].used = true;
+		id = available_id;
 		return true;
 	}
 	return false;
 }
 void UniformBufferAllocator::FreeObjectUniformBufferSet(unsigned id) {
-	if (id < (_pool_size * _obj_sets.size())) {
-		unsigned pool_idx = id / _pool_size;
-		unsigned desc_idx = id % _pool_size;
-
+	if (_dynamic) {
+		//linear allocation, only the most recent set can be given back
+		if (_linear_head && id == _linear_head - 1) {
+			_linear_head--;
+		}
+		return;
+	}
+	unsigned pool_idx, desc_idx;
+	if (locateSet(id, pool_idx, desc_idx)) {
 		if (_obj_sets[pool_idx][desc_idx].used) {
 			_obj_sets[pool_idx][desc_idx].used = false;
 			_available.push(id);
@@ -88,37 +147,63 @@ void UniformBufferAllocator::FreeObjectUniformBufferSet(unsigned id) {
 	}
 }
 
-void UniformBufferAllocator::FreeAllObjectUniformBufferSet() {
-	unsigned pool_size = _pool_size * _obj_sets.size();
-	for (int id = 0; id < _pool_size * _obj_sets.size(); id++) {
-		unsigned pool_idx = id / _pool_size;
-		unsigned desc_idx = id % _pool_size;
-
-		if (_obj_sets[pool_idx][desc_idx].used) {
-			_obj_sets[pool_idx][desc_idx].used = false;
-			_available.push(id);
+bool UniformBufferAllocator::FreeAllObjectUniformBufferSet() {
+	if (_dynamic) {
+		_high_water = std::max(_high_water, _linear_head);
+		_size_hint = std::max(_size_hint, _linear_head);
+		_linear_head = 0;
+
+		//the previous frame outgrew the first buffer, nothing of this frame slot is in use anymore
+		//so replace the chain with a single buffer large enough for the peak
+		if (_init && _obj_sets.size() > 1) {
+			unsigned size = 1;
+			while (size < _size_hint) {
+				size <<= 1;
+			}
+			releaseDynamicPools();
+			return addNewDynamicPool(size);
 		}
-		if (_available.size() >= pool_size) {
-			return;
+		return true;
+	}
+	unsigned id = 0;
+	for (auto& pool : _obj_sets) {
+		for (auto& set : pool) {
+			if (set.used) {
+				set.used = false;
+				_available.push(id);
+			}
+			id++;
 		}
 	}
+	return true;
 }
 
 
 bool UniformBufferAllocator::AddCommandBindUniformBufferSet(unsigned id, VkPipelineLayout pipelineLayout, VkCommandBuffer cmdBuffer) {
 	if (_init) {
-		if (id >= (_pool_size * _obj_sets.size())) {
+		unsigned pool_idx, desc_idx;
+		if (locateSet(id, pool_idx, desc_idx) == false) {
 			return false;
 		}
-		unsigned pool_idx = id / _pool_size;
-		unsigned desc_idx = id % _pool_size;
 
-		if (_obj_sets[pool_idx][desc_idx].used == false) {
+		const ObjectUniformBufferSet& set = _obj_sets[pool_idx][desc_idx];
+		if ((_dynamic ? id < _linear_head : set.used) == false) {
 			return false;
 		}
 
-		std::array<VkDescriptorSet,2> sets = { _obj_sets[pool_idx][desc_idx].vkdesc, _global_set.vkdesc };
-		vkCmdBindDescriptorSets(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, sets.size(), sets.data(), 0, nullptr);
+		std::array<VkDescriptorSet,2> sets = { set.vkdesc, _global_set.vkdesc };
+		if (_dynamic) {
+			//every binding of the slot moves by the same amount, descriptor offsets hold the position inside the slot
+			std::array<uint32_t, 16> offsets;
+			unsigned count = _dynamic_bindings.size();
+			if (count > offsets.size()) {
+				return false;
+			}
+			offsets.fill(set.dynamicOffset);
+			vkCmdBindDescriptorSets(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, sets.size(), sets.data(), count, offsets.data());
+		} else {
+			vkCmdBindDescriptorSets(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, sets.size(), sets.data(), 0, nullptr);
+		}
 		return true;
 	}
 	return false;
@@ -126,12 +211,9 @@ bool UniformBufferAllocator::AddCommandBindUniformBufferSet(unsigned id, VkPipel
 
 void* UniformBufferAllocator::GetObjectUniformBuffer(unsigned id, ObjectUniformBufferType type, unsigned& size, unsigned custom_idx) {
 	size = 0;
-	if (id < (_pool_size * _obj_sets.size())) {
-
-		unsigned pool_idx = id / _pool_size;
-		unsigned desc_idx = id % _pool_size;
-
-		if (_obj_sets[pool_idx][desc_idx].used) {
+	unsigned pool_idx, desc_idx;
+	if (locateSet(id, pool_idx, desc_idx)) {
+		if (_dynamic ? id < _linear_head : _obj_sets[pool_idx][desc_idx].used) {
 			if (type == OBJ_UB_TYPE_TRANSFORM) {
 				size = _obj_sets[pool_idx][desc_idx].transformBuffer.size;
 				return _obj_sets[pool_idx][desc_idx].transformBuffer.mappedBuffer;
@@ -164,11 +246,64 @@ void* UniformBufferAllocator::GetGlobalUniformBuffer(GlobalUniformBufferType typ
 	return nullptr;
 }
 
+void UniformBufferAllocator::GetStats(UniformBufferStats& stats) const {
+	unsigned stride = _dynamic_stride;
+	if (_dynamic == false) {
+		stride = getTransformBufferSize();
+		stride += _layout.layout.ObjectInputs.useMaterialData ? sizeof(float) * 8 : 0;
+		stride += _layout.layout.ObjectInputs.useCamTransform ? sizeof(float) * 16 : 0;
+		for (const auto& desc : _layout.layout.ObjectInputs.CustomUniformShaderInput) {
+			stride += desc.size;
+		}
+	}
+
+	stats = {};
+	unsigned lastFrame = _linear_head;
+	unsigned highWater = std::max(_high_water, _linear_head);
+	if (_dynamic == false) {
+		lastFrame = 0;
+		for (const auto& pool : _obj_sets) {
+			for (const auto& set : pool) {
+				lastFrame += set.used ? 1 : 0;
+			}
+		}
+		highWater = lastFrame;
+	}
+
+	stats.lastFrameAllocations = lastFrame;
+	stats.lastFrameBytes = (unsigned long long)lastFrame * stride;
+	stats.highWaterAllocations = highWater;
+	stats.highWaterBytes = (unsigned long long)highWater * stride;
+
+	unsigned capacity = 0;
+	for (const auto& pool : _obj_sets) {
+		capacity += pool.size();
+	}
+	stats.capacityAllocations = capacity;
+	stats.capacityBytes = (unsigned long long)capacity * stride;
+	if (_dynamic) {
+		stats.bufferCount = _pool_buffers.size();
+	} else {
+		unsigned buffersPerSet = (getTransformBufferSize() ? 1 : 0) + (_layout.layout.ObjectInputs.useMaterialData ? 1 : 0) +
+			(_layout.layout.ObjectInputs.useCamTransform ? 1 : 0) + _layout.layout.ObjectInputs.CustomUniformShaderInput.size();
+		stats.bufferCount = capacity * buffersPerSet;
+	}
+}
+
+void UniformBufferAllocator::ResetStats() {
+	_high_water = 0;
+}
+
 static bool allocateDescriptorBuffer(unsigned devId, VkDescriptorSet descSet, unsigned bindSlot, unsigned bufferSize,
-	VkBuffer& buffer, VkDeviceMemory& bufferMemory, void** bufferMapped);
+	BufferResources& buffer, void** bufferMapped);
 
 bool UniformBufferAllocator::addNewPool() {
 	if (_init) {
+		if (_dynamic) {
+			//double the total capacity
+			unsigned poolSize = _capacity ? _capacity : std::max(_layout.layout.ObjectInputs.dynamicUniformBufferCapacity, 1u);
+			return addNewDynamicPool(poolSize);
+		}
 		unsigned descCount = _layout.layout.ObjectInputs.CustomUniformShaderInput.size() + 3;
 		std::vector<VkDescriptorPoolSize> descPoolSizeList;
 		descPoolSizeList.reserve(descCount);
@@ -222,6 +357,7 @@ bool UniformBufferAllocator::addNewPool() {
 		}
 
 		//allocate vulkan descriptor pool vk_pool
+		_pool_first_id.push_back(_vk_pool_obj.size() * _pool_size);
 		_vk_pool_obj.push_back(pool);
 		_obj_sets.push_back(std::vector<ObjectUniformBufferSet>(_pool_size));
 
@@ -239,84 +375,60 @@ bool UniformBufferAllocator::addNewPool() {
 			}
 
 			//allocate vk buffers and map mapped_buffer
-			unsigned bufferSize = 0;
-			if (_layout.layout.ObjectInputs.useObjToScreenTransform) {
-				bufferSize += sizeof(float) * 16;
-			}
-			if (_layout.layout.ObjectInputs.useObjToWorldTransform) {
-				bufferSize += sizeof(float) * 16;
-			}
-			if (_layout.layout.ObjectInputs.useWorldToCamTransform) {
-				bufferSize += sizeof(float) * 16;
-			}
-			if (_layout.layout.ObjectInputs.useCamToScreenTransform) {
-				bufferSize += sizeof(float) * 16;
-			}
-			if (_layout.layout.ObjectInputs.useObjectScale) {
-				bufferSize += sizeof(float) * 4;
-			}
+			unsigned bufferSize = getTransformBufferSize();
 
-			VkBuffer buffer = VK_NULL_HANDLE;
-			VkDeviceMemory bufferMemory = VK_NULL_HANDLE;
+			BufferResources buffer;
 			void* bufferMapped = nullptr;
 
 			if (bufferSize) {
 				if (allocateDescriptorBuffer(_dev_id, set.vkdesc, _layout.layout.ObjectInputs.transformBindSlot, bufferSize,
-					buffer, bufferMemory, &bufferMapped) == false) {
-					set.transformBuffer.buffer.vkBuffer = VK_NULL_HANDLE;
-					set.transformBuffer.buffer.vkBufferMem = VK_NULL_HANDLE;
+					buffer, &bufferMapped) == false) {
+					set.transformBuffer.buffer = BufferResources();
 					return false;
 				}
 
 				set.transformBuffer.bindSlot = _layout.layout.ObjectInputs.transformBindSlot;
 				set.transformBuffer.size = bufferSize;
-				set.transformBuffer.buffer.vkBuffer = buffer;
-				set.transformBuffer.buffer.vkBufferMem = bufferMemory;
+				set.transformBuffer.buffer = buffer;
 				set.transformBuffer.mappedBuffer = bufferMapped;
 			}
 
 			if (_layout.layout.ObjectInputs.useMaterialData) {
 				bufferSize = sizeof(float) * 8;
 				if (bufferSize && allocateDescriptorBuffer(_dev_id, set.vkdesc, _layout.layout.ObjectInputs.materialDataBindSlot, bufferSize,
-					buffer, bufferMemory, &bufferMapped) == false) {
-					set.materialBuffer.buffer.vkBuffer = VK_NULL_HANDLE;
-					set.materialBuffer.buffer.vkBufferMem = VK_NULL_HANDLE;
+					buffer, &bufferMapped) == false) {
+					set.materialBuffer.buffer = BufferResources();
 					return false;
 				}
 				set.materialBuffer.bindSlot = _layout.layout.ObjectInputs.materialDataBindSlot;
 				set.materialBuffer.size = bufferSize;
-				set.materialBuffer.buffer.vkBuffer = buffer;
-				set.materialBuffer.buffer.vkBufferMem = bufferMemory;
+				set.materialBuffer.buffer = buffer;
 				set.materialBuffer.mappedBuffer = bufferMapped;
 			}
 			if (_layout.layout.ObjectInputs.useCamTransform) {
 				bufferSize = sizeof(float) * 16;
 				if (bufferSize && allocateDescriptorBuffer(_dev_id, set.vkdesc, _layout.layout.ObjectInputs.camTransformBindSlot, bufferSize,
-					buffer, bufferMemory, &bufferMapped) == false) {
-					set.camTransformBuffer.buffer.vkBuffer = VK_NULL_HANDLE;
-					set.camTransformBuffer.buffer.vkBufferMem = VK_NULL_HANDLE;
+					buffer, &bufferMapped) == false) {
+					set.camTransformBuffer.buffer = BufferResources();
 					return false;
 				}
 				set.camTransformBuffer.bindSlot = _layout.layout.ObjectInputs.camTransformBindSlot;
 				set.camTransformBuffer.size = bufferSize;
-				set.camTransformBuffer.buffer.vkBuffer = buffer;
-				set.camTransformBuffer.buffer.vkBufferMem = bufferMemory;
+				set.camTransformBuffer.buffer = buffer;
 				set.camTransformBuffer.mappedBuffer = bufferMapped;
 			}
 
 			if (_layout.layout.ObjectInputs.CustomUniformShaderInput.size()) {
 				for (auto& desc : _layout.layout.ObjectInputs.CustomUniformShaderInput) {
-					buffer = VK_NULL_HANDLE;
-					bufferMemory = VK_NULL_HANDLE;
+					buffer = BufferResources();
 					bufferMapped = nullptr;
 					if (desc.size && allocateDescriptorBuffer(_dev_id, set.vkdesc, desc.bindSlot, desc.size,
-						buffer, bufferMemory, &bufferMapped) == false) {
+						buffer, &bufferMapped) == false) {
 						return false;
 					}
 					set.customBuffers[desc.bindSlot].bindSlot = desc.bindSlot;
 					set.customBuffers[desc.bindSlot].size = bufferSize;
-					set.customBuffers[desc.bindSlot].buffer.vkBufferMem = bufferMemory;
-					set.customBuffers[desc.bindSlot].buffer.vkBuffer = buffer;
+					set.customBuffers[desc.bindSlot].buffer = buffer;
 					set.customBuffers[desc.bindSlot].mappedBuffer = bufferMapped;
 				}
 			}
@@ -330,27 +442,212 @@ bool UniformBufferAllocator::addNewPool() {
 }
 
 
-static bool allocateDescriptorBuffer(unsigned devId, VkDescriptorSet descSet, unsigned bindSlot, unsigned bufferSize,
-							  VkBuffer& buffer, VkDeviceMemory& bufferMemory, void** bufferMapped) {
-	VkDevice dev = DeviceManager::GetVkDevice(devId);
+bool UniformBufferAllocator::addNewDynamicPool(unsigned poolSize) {
+	VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
 	if (dev == VK_NULL_HANDLE) {
 		return false;
 	}
-	VkPhysicalDevice physdev = DeviceManager::GetVkPhyDevice(devId);
+	VkPhysicalDevice physdev = DeviceManager::GetVkPhyDevice(_dev_id);
 	if (physdev == VK_NULL_HANDLE) {
 		return false;
 	}
 
-	if (createBuffer(physdev, dev, bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer, bufferMemory) == false) {
+	VkDescriptorPoolSize descPoolSize{};
+	descPoolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	descPoolSize.descriptorCount = _dynamic_bindings.size() ? _dynamic_bindings.size() : 1;
+
+	VkDescriptorPoolCreateInfo poolInfo{};
+	poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	poolInfo.poolSizeCount = 1;
+	poolInfo.pPoolSizes = &descPoolSize;
+	poolInfo.maxSets = 1;
+
+	VkDescriptorPool pool;
+	if (vkCreateDescriptorPool(dev, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+		return false;
+	}
+	_vk_pool_obj.push_back(pool);
+
+	//one descriptor set shared by every slot of the pool
+	VkDescriptorSet vkdesc;
+	VkDescriptorSetAllocateInfo allocInfo{};
+	allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	allocInfo.descriptorPool = pool;
+	allocInfo.descriptorSetCount = 1;
+	allocInfo.pSetLayouts = &_layout.vklayoutobject;
+	if (vkAllocateDescriptorSets(dev, &allocInfo, &vkdesc) != VK_SUCCESS) {
+		return false;
+	}
+
+	BufferResources buffer;
+	uint8_t* mapped = nullptr;
+	VkDeviceSize bufferSize = (VkDeviceSize)_dynamic_stride * poolSize;
+	if (_dynamic_bindings.size()) {
+		if (MemoryAllocator::CreateBuffer(_dev_id, bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer) == false) {
+			return false;
+		}
+		_pool_buffers.push_back(buffer);
+
+		//persistently mapped for the lifetime of the pool
+		mapped = buffer.memory.mapped;
+
+		std::vector<VkDescriptorBufferInfo> bufferInfos(_dynamic_bindings.size());
+		std::vector<VkWriteDescriptorSet> descriptorWrites(_dynamic_bindings.size());
+		for (unsigned i = 0; i < _dynamic_bindings.size(); i++) {
+			bufferInfos[i].buffer = buffer.vkBuffer;
+			bufferInfos[i].offset = _dynamic_bindings[i].offset;
+			bufferInfos[i].range = _dynamic_bindings[i].size;
+
+			descriptorWrites[i] = {};
+			descriptorWrites[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptorWrites[i].dstSet = vkdesc;
+			descriptorWrites[i].dstBinding = _dynamic_bindings[i].bindSlot;
+			descriptorWrites[i].dstArrayElement = 0;
+			descriptorWrites[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+			descriptorWrites[i].descriptorCount = 1;
+			descriptorWrites[i].pBufferInfo = &bufferInfos[i];
+		}
+		vkUpdateDescriptorSets(dev, descriptorWrites.size(), descriptorWrites.data(), 0, nullptr);
+	}
+
+	unsigned firstId = _capacity;
+	_pool_first_id.push_back(firstId);
+	_capacity += poolSize;
+	_obj_sets.push_back(std::vector<ObjectUniformBufferSet>(poolSize));
+
+	unsigned idx = 0;
+	for (auto& set : _obj_sets.back()) {
+		set.vkdesc = vkdesc;
+		set.dynamicOffset = idx * _dynamic_stride;
+		for (const auto& binding : _dynamic_bindings) {
+			DescriptorSetBufferResources res;
+			res.bindSlot = binding.bindSlot;
+			res.size = binding.size;
+			res.buffer = buffer;
+			res.mappedBuffer = mapped + set.dynamicOffset + binding.offset;
+
+			switch (binding.type) {
+				case OBJ_UB_TYPE_TRANSFORM:
+					set.transformBuffer = res;
+					break;
+				case OBJ_UB_TYPE_MATERIAL:
+					set.materialBuffer = res;
+					break;
+				case OBJ_UB_TYPE_CAM:
+					set.camTransformBuffer = res;
+					break;
+				case OBJ_UB_TYPE_CUSTOM:
+					set.customBuffers[binding.bindSlot] = res;
+					break;
+			}
+		}
+		set.used = false;
+		idx++;
+	}
+	return true;
+}
+
+void UniformBufferAllocator::releaseDynamicPools() {
+	VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+	if (dev == VK_NULL_HANDLE) {
+		return;
+	}
+	for (auto& buffer : _pool_buffers) {
+		MemoryAllocator::DestroyBuffer(_dev_id, buffer);
+	}
+	for (auto& pool : _vk_pool_obj) {
+		vkDestroyDescriptorPool(dev, pool, nullptr);
+	}
+	_pool_buffers.clear();
+	_vk_pool_obj.clear();
+	_obj_sets.clear();
+	_pool_first_id.clear();
+	_capacity = 0;
+}
+
+void UniformBufferAllocator::createDynamicSlotLayout() {
+	VkPhysicalDeviceProperties properties{};
+	VkPhysicalDevice physdev = DeviceManager::GetVkPhyDevice(_dev_id);
+	if (physdev != VK_NULL_HANDLE) {
+		vkGetPhysicalDeviceProperties(physdev, &properties);
+	}
+	unsigned alignment = std::max<unsigned>(properties.limits.minUniformBufferOffsetAlignment, 16);
+
+	_dynamic_bindings.clear();
+	unsigned transformSize = getTransformBufferSize();
+	if (_layout.layout.ObjectInputs.useObjToScreenTransform ||
+		_layout.layout.ObjectInputs.useObjToWorldTransform ||
+		_layout.layout.ObjectInputs.useWorldToCamTransform ||
+		_layout.layout.ObjectInputs.useCamToScreenTransform) {
+		_dynamic_bindings.push_back({ OBJ_UB_TYPE_TRANSFORM, _layout.layout.ObjectInputs.transformBindSlot, 0, transformSize });
+	}
+	if (_layout.layout.ObjectInputs.useMaterialData) {
+		_dynamic_bindings.push_back({ OBJ_UB_TYPE_MATERIAL, _layout.layout.ObjectInputs.materialDataBindSlot, 0, sizeof(float) * 8 });
+	}
+	if (_layout.layout.ObjectInputs.useCamTransform) {
+		_dynamic_bindings.push_back({ OBJ_UB_TYPE_CAM, _layout.layout.ObjectInputs.camTransformBindSlot, 0, sizeof(float) * 16 });
+	}
+	for (const auto& desc : _layout.layout.ObjectInputs.CustomUniformShaderInput) {
+		_dynamic_bindings.push_back({ OBJ_UB_TYPE_CUSTOM, desc.bindSlot, 0, desc.size });
+	}
+	std::sort(_dynamic_bindings.begin(), _dynamic_bindings.end(), [](const DynamicBinding& lhs, const DynamicBinding& rhs) { return lhs.bindSlot < rhs.bindSlot; });
+
+	//every binding starts on an aligned offset, so the slot stride is aligned as well
+	unsigned offset = 0;
+	for (auto& binding : _dynamic_bindings) {
+		binding.offset = offset;
+		offset += (binding.size + alignment - 1) / alignment * alignment;
+	}
+	_dynamic_stride = offset ? offset : alignment;
+}
+
+unsigned UniformBufferAllocator::getTransformBufferSize() const {
+	unsigned bufferSize = 0;
+	if (_layout.layout.ObjectInputs.useObjToScreenTransform) {
+		bufferSize += sizeof(float) * 16;
+	}
+	if (_layout.layout.ObjectInputs.useObjToWorldTransform) {
+		bufferSize += sizeof(float) * 16;
+	}
+	if (_layout.layout.ObjectInputs.useWorldToCamTransform) {
+		bufferSize += sizeof(float) * 16;
+	}
+	if (_layout.layout.ObjectInputs.useCamToScreenTransform) {
+		bufferSize += sizeof(float) * 16;
+	}
+	if (_layout.layout.ObjectInputs.useObjectScale) {
+		bufferSize += sizeof(float) * 4;
+	}
+	return bufferSize;
+}
+
+bool UniformBufferAllocator::locateSet(unsigned id, unsigned& poolIdx, unsigned& setIdx) const {
+	if (_pool_first_id.size() == 0) {
+		return false;
+	}
+	auto it = std::upper_bound(_pool_first_id.begin(), _pool_first_id.end(), id);
+	if (it == _pool_first_id.begin()) {
+		return false;
+	}
+	poolIdx = (it - _pool_first_id.begin()) - 1;
+	setIdx = id - _pool_first_id[poolIdx];
+	return setIdx < _obj_sets[poolIdx].size();
+}
+
+static bool allocateDescriptorBuffer(unsigned devId, VkDescriptorSet descSet, unsigned bindSlot, unsigned bufferSize,
+							  BufferResources& buffer, void** bufferMapped) {
+	VkDevice dev = DeviceManager::GetVkDevice(devId);
+	if (dev == VK_NULL_HANDLE) {
 		return false;
 	}
-	if (vkMapMemory(dev, bufferMemory, 0, bufferSize, 0, bufferMapped) != VK_SUCCESS) {
-		printf("failed to map ubo memory");
+
+	if (MemoryAllocator::CreateBuffer(devId, bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer) == false) {
 		return false;
 	}
+	*bufferMapped = buffer.memory.mapped;
 
 	VkDescriptorBufferInfo bufferInfo{};
-	bufferInfo.buffer = buffer;
+	bufferInfo.buffer = buffer.vkBuffer;
 	bufferInfo.offset = 0;
 	bufferInfo.range = bufferSize;
 
@@ -427,36 +724,31 @@ bool UniformBufferAllocator::createGlobalSet() {
 		bufferSize += sizeof(float)*36;
 	}
 
-	VkBuffer buffer = VK_NULL_HANDLE;
-	VkDeviceMemory bufferMemory = VK_NULL_HANDLE;
+	BufferResources buffer;
 	void* bufferMapped = nullptr;
 
 	if (bufferSize && allocateDescriptorBuffer(_dev_id, _global_set.vkdesc, _layout.layout.GlobalInputs.dirLightBindSlot, bufferSize,
-		buffer, bufferMemory, &bufferMapped) == false) {
-		_global_set.dirlightBuffer.buffer.vkBuffer = VK_NULL_HANDLE;
-		_global_set.dirlightBuffer.buffer.vkBufferMem = VK_NULL_HANDLE;
+		buffer, &bufferMapped) == false) {
+		_global_set.dirlightBuffer.buffer = BufferResources();
 		return false;
 	}
 
 	_global_set.dirlightBuffer.bindSlot = _layout.layout.GlobalInputs.dirLightBindSlot;
 	_global_set.dirlightBuffer.size = bufferSize;
-	_global_set.dirlightBuffer.buffer.vkBuffer = buffer;
-	_global_set.dirlightBuffer.buffer.vkBufferMem = bufferMemory;
+	_global_set.dirlightBuffer.buffer = buffer;
 	_global_set.dirlightBuffer.mappedBuffer = bufferMapped;
 
 
 	for (auto& desc : _layout.layout.GlobalInputs.CustomUniformShaderInput) {
-		buffer = VK_NULL_HANDLE;
-		bufferMemory = VK_NULL_HANDLE;
+		buffer = BufferResources();
 		bufferMapped = nullptr;
 		if (desc.size && allocateDescriptorBuffer(_dev_id, _global_set.vkdesc, desc.bindSlot, desc.size,
-			buffer, bufferMemory, &bufferMapped) == false) {
+			buffer, &bufferMapped) == false) {
 			return false;
 		}
 		_global_set.customBuffers[desc.bindSlot].bindSlot = desc.bindSlot;
 		_global_set.customBuffers[desc.bindSlot].size = desc.size;
-		_global_set.customBuffers[desc.bindSlot].buffer.vkBufferMem = bufferMemory;
-		_global_set.customBuffers[desc.bindSlot].buffer.vkBuffer = buffer;
+		_global_set.customBuffers[desc.bindSlot].buffer = buffer;
 		_global_set.customBuffers[desc.bindSlot].mappedBuffer = bufferMapped;
 	}
 
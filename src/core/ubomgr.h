@@ -29,7 +29,13 @@ public:
 	
 	bool AllocateObjectUniformBufferSet(unsigned& id);
 	void FreeObjectUniformBufferSet(unsigned id);
-	void FreeAllObjectUniformBufferSet();
+	// O(1) in dynamic mode, the sets are handed out linearly and reset as a whole. Fails if the buffer replacing an
+	// outgrown chain cannot be allocated
+	bool FreeAllObjectUniformBufferSet();
+
+	// lastFrame* is the usage of the frame currently/most recently recorded with this allocator
+	void GetStats(UniformBufferStats& stats) const;
+	void ResetStats();
 
 	bool AddCommandBindUniformBufferSet(unsigned id, VkPipelineLayout pipelineLayout, VkCommandBuffer cmdBuffer);
 
@@ -38,7 +44,12 @@ public:
 
 private:
 	bool addNewPool();
+	bool addNewDynamicPool(unsigned poolSize);
+	void releaseDynamicPools();
 	bool createGlobalSet();
+	void createDynamicSlotLayout();
+	bool locateSet(unsigned id, unsigned& poolIdx, unsigned& setIdx) const;
+	unsigned getTransformBufferSize() const;
 
 private:
 	struct DescriptorSetBufferResources {
@@ -55,6 +66,16 @@ private:
 		DescriptorSetBufferResources materialBuffer;
 		DescriptorSetBufferResources camTransformBuffer;
 		std::unordered_map<unsigned, DescriptorSetBufferResources> customBuffers;
+		//dynamic mode: offset of this set's slot in the pool buffer, vkdesc is shared by the pool
+		uint32_t dynamicOffset = 0;
+	};
+
+	// dynamic mode: placement of one binding inside a slot of the pool buffer
+	struct DynamicBinding {
+		ObjectUniformBufferType type;
+		unsigned bindSlot;
+		unsigned offset;
+		unsigned size;
 	};
 
 	struct GlobalUniformBufferSet {
@@ -68,6 +89,8 @@ private:
 	bool _init;
 	std::vector<VkDescriptorPool> _vk_pool_obj;
 	std::vector<std::vector<ObjectUniformBufferSet>> _obj_sets;
+	//id of the first set in each pool, pools grow geometrically in dynamic mode
+	std::vector<unsigned> _pool_first_id;
 	unsigned _pool_size;
 	std::stack<unsigned> _available;
 
@@ -76,5 +99,18 @@ private:
 
 	UniformShaderInputLayoutInternal _layout;
 	unsigned _dev_id;
+
+	bool _dynamic;
+	//one persistently mapped buffer per pool in dynamic mode, per set buffers otherwise
+	std::vector<BufferResources> _pool_buffers;
+	std::vector<DynamicBinding> _dynamic_bindings;
+	unsigned _dynamic_stride;
+
+	//dynamic mode: linear allocation cursor, total slots over all pools and usage peaks in slots
+	unsigned _linear_head;
+	unsigned _capacity;
+	unsigned _high_water;
+	//peak since initialization, used to size the merged buffer, not affected by ResetStats
+	unsigned _size_hint;
 };
 }
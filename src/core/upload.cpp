@@ -0,0 +1,300 @@
+#include "upload.h"
+#include "devicemgr.h"
+#include "memalloc.h"
+
+
+namespace RenderingFramework3D {
+
+static constexpr VkDeviceSize staging_alignment = 16;
+
+UploadQueue::UploadQueue()
+	:
+	_init(false),
+	_ring(),
+	_ring_size(0),
+	_ring_head(0),
+	_ring_tail(0),
+	_ring_used(0),
+	_open(),
+	_pending(),
+	_in_flight(),
+	_completed(0),
+	_cmd_pool(VK_NULL_HANDLE),
+	_free_cmd_buffers(),
+	_dev_id(0)
+{}
+
+UploadQueue::~UploadQueue() {
+	Cleanup();
+}
+
+bool UploadQueue::Initialize(unsigned dev, VkDeviceSize ringSize) {
+	if (_init) {
+		return true;
+	}
+	_dev_id = dev;
+	_ring_size = ringSize;
+	if (DeviceManager::CreateCommandPool(_dev_id, DeviceManager::QUEUE_TYPE_TRANSFER, true, _cmd_pool) == false) {
+		return false;
+	}
+	_open = Batch();
+	_open.id = _completed + 1;
+	_init = true;
+	return true;
+}
+
+void UploadQueue::Cleanup() {
+	if (_init == false) {
+		return;
+	}
+	_init = false;
+	VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+
+	while (_in_flight.size() && retire(true)) {}
+	for (auto& batch : _in_flight) {
+		for (auto& buffer : batch.oversized) {
+			MemoryAllocator::DestroyBuffer(_dev_id, buffer);
+		}
+		batch.promise.set_value(false);
+	}
+	_in_flight.clear();
+	// staged copies that were never submitted
+	for (auto& buffer : _open.oversized) {
+		MemoryAllocator::DestroyBuffer(_dev_id, buffer);
+	}
+	_open.promise.set_value(false);
+	_completed = _open.id;
+	_open = Batch();
+	_pending.clear();
+
+	if (dev != VK_NULL_HANDLE) {
+		for (auto& cmd : _free_cmd_buffers) {
+			vkDestroyFence(dev, cmd.second, nullptr);
+		}
+		// frees the command buffers allocated from it
+		if (_cmd_pool != VK_NULL_HANDLE) vkDestroyCommandPool(dev, _cmd_pool, nullptr);
+	}
+	_free_cmd_buffers.clear();
+	_cmd_pool = VK_NULL_HANDLE;
+
+	MemoryAllocator::DestroyBuffer(_dev_id, _ring);
+	_ring_head = _ring_tail = _ring_used = 0;
+}
+
+bool UploadQueue::Stage(VkDeviceSize size, const Destination& dst, uint8_t*& data, uint64_t& batch) {
+	if (_init == false || size == 0) {
+		return false;
+	}
+	if (_ring.vkBuffer == VK_NULL_HANDLE) {
+		if (MemoryAllocator::CreateBuffer(_dev_id, _ring_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, _ring) == false) {
+			printf("failed to create upload staging ring\n");
+			return false;
+		}
+	}
+
+	PendingCopy copy = { VK_NULL_HANDLE, 0, size, dst };
+	if (size > _ring_size) {
+		BufferResources staging;
+		if (MemoryAllocator::CreateBuffer(_dev_id, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, staging) == false) {
+			return false;
+		}
+		_open.oversized.push_back(staging);
+		copy.src = staging.vkBuffer;
+		data = staging.memory.mapped;
+	} else {
+		// make room by submitting what is staged so far and waiting for the oldest batch
+		while (allocateRing(size, copy.srcOffset) == false) {
+			if (_pending.size()) {
+				if (Submit() == false) {
+					return false;
+				}
+			} else if (_in_flight.empty() || retire(true) == false) {
+				return false;
+			}
+		}
+		copy.src = _ring.vkBuffer;
+		data = _ring.memory.mapped + copy.srcOffset;
+	}
+	_pending.push_back(copy);
+	batch = _open.id;
+	return true;
+}
+
+bool UploadQueue::IsComplete(uint64_t batch) const {
+	return batch <= _completed;
+}
+
+std::shared_future<bool> UploadQueue::GetFuture(uint64_t batch) {
+	Batch* found = nullptr;
+	if (_init && batch == _open.id) {
+		found = &_open;
+	}
+	for (auto& inFlight : _in_flight) {
+		if (inFlight.id == batch) {
+			found = &inFlight;
+		}
+	}
+	if (found == nullptr) {
+		std::promise<bool> done;
+		done.set_value(_init && batch <= _completed);
+		return done.get_future().share();
+	}
+	if (found->future.valid() == false) {
+		found->future = found->promise.get_future().share();
+	}
+	return found->future;
+}
+
+bool UploadQueue::Submit() {
+	if (_init == false) {
+		return false;
+	}
+	if (_pending.empty()) {
+		Poll();
+		return true;
+	}
+	VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+	if (dev == VK_NULL_HANDLE || acquireCommandBuffer(_open.cmdBuffer, _open.fence) == false) {
+		return false;
+	}
+
+	VkCommandBufferBeginInfo beginInfo{};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	if (vkBeginCommandBuffer(_open.cmdBuffer, &beginInfo) != VK_SUCCESS) {
+		return false;
+	}
+	// consecutive copies between the same buffers are recorded as one command
+	std::vector<VkBufferCopy> regions;
+	VkBuffer src = VK_NULL_HANDLE, dst = VK_NULL_HANDLE;
+	for (unsigned i = 0; i <= _pending.size(); i++) {
+		VkBuffer copySrc = VK_NULL_HANDLE, copyDst = VK_NULL_HANDLE;
+		VkBufferCopy region{};
+		if (i < _pending.size()) {
+			const PendingCopy& copy = _pending[i];
+			copySrc = copy.src;
+			copyDst = copy.dst.buffer;
+			region.dstOffset = copy.dst.offset;
+			if (copy.dst.arena) {
+				copyDst = copy.dst.arena->GetBuffer();
+				region.dstOffset += (VkDeviceSize)copy.dst.arena->GetOffset(copy.dst.range) * copy.dst.arena->GetElementSize();
+			}
+			region.srcOffset = copy.srcOffset;
+			region.size = copy.size;
+		}
+		if (regions.size() && (i == _pending.size() || copySrc != src || copyDst != dst)) {
+			vkCmdCopyBuffer(_open.cmdBuffer, src, dst, regions.size(), regions.data());
+			regions.clear();
+		}
+		if (i < _pending.size()) {
+			src = copySrc;
+			dst = copyDst;
+			regions.push_back(region);
+		}
+	}
+	if (vkEndCommandBuffer(_open.cmdBuffer) != VK_SUCCESS) {
+		return false;
+	}
+	if (DeviceManager::SubmitCommandBuffer(_dev_id, DeviceManager::QUEUE_TYPE_TRANSFER, _open.cmdBuffer, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, _open.fence) == false) {
+		return false;
+	}
+
+	uint64_t next = _open.id + 1;
+	_in_flight.push_back(std::move(_open));
+	_open = Batch();
+	_open.id = next;
+	_pending.clear();
+	Poll();
+	return true;
+}
+
+void UploadQueue::Poll() {
+	while (_in_flight.size() && retire(false)) {}
+}
+
+bool UploadQueue::Finish() {
+	if (Submit() == false) {
+		return false;
+	}
+	while (_in_flight.size()) {
+		if (retire(true) == false) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool UploadQueue::allocateRing(VkDeviceSize size, VkDeviceSize& offset) {
+	size = (size + staging_alignment - 1) / staging_alignment * staging_alignment;
+	if (_ring_used == 0) {
+		_ring_head = _ring_tail = 0;
+	}
+	// the free space is [head, end) + [0, tail) while head is ahead of tail, [head, tail) after it wrapped
+	VkDeviceSize skipped = 0;
+	if (_ring_used == 0 || _ring_head > _ring_tail) {
+		if (_ring_size - _ring_head >= size) {
+			offset = _ring_head;
+		} else if (_ring_tail >= size) {
+			skipped = _ring_size - _ring_head;
+			offset = 0;
+		} else {
+			return false;
+		}
+	} else if (_ring_head < _ring_tail && _ring_tail - _ring_head >= size) {
+		offset = _ring_head;
+	} else {
+		return false;
+	}
+	_ring_head = offset + size;
+	_ring_used += size + skipped;
+	_open.ringEnd = _ring_head;
+	_open.ringBytes += size + skipped;
+	return true;
+}
+
+bool UploadQueue::acquireCommandBuffer(VkCommandBuffer& cmdBuffer, VkFence& fence) {
+	if (_free_cmd_buffers.size()) {
+		cmdBuffer = _free_cmd_buffers.back().first;
+		fence = _free_cmd_buffers.back().second;
+		_free_cmd_buffers.pop_back();
+		return true;
+	}
+	VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+	if (DeviceManager::CreateCommandBuffer(_dev_id, _cmd_pool, true, cmdBuffer) == false) {
+		return false;
+	}
+	VkFenceCreateInfo fenceInfo{};
+	fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+	if (vkCreateFence(dev, &fenceInfo, nullptr, &fence) != VK_SUCCESS) {
+		vkFreeCommandBuffers(dev, _cmd_pool, 1, &cmdBuffer);
+		return false;
+	}
+	return true;
+}
+
+bool UploadQueue::retire(bool wait) {
+	VkDevice dev = DeviceManager::GetVkDevice(_dev_id);
+	if (dev == VK_NULL_HANDLE || _in_flight.empty()) {
+		return false;
+	}
+	Batch& batch = _in_flight.front();
+	VkResult result = wait ? vkWaitForFences(dev, 1, &batch.fence, VK_TRUE, UINT64_MAX) : vkGetFenceStatus(dev, batch.fence);
+	if (result != VK_SUCCESS) {
+		return false;
+	}
+
+	if (batch.ringBytes) {
+		_ring_tail = batch.ringEnd;
+		_ring_used -= batch.ringBytes;
+	}
+	for (auto& buffer : batch.oversized) {
+		MemoryAllocator::DestroyBuffer(_dev_id, buffer);
+	}
+	vkResetFences(dev, 1, &batch.fence);
+	_free_cmd_buffers.push_back({ batch.cmdBuffer, batch.fence });
+	_completed = batch.id;
+	batch.promise.set_value(true);
+	_in_flight.pop_front();
+	return true;
+}
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <atomic>
+#include <deque>
+#include <future>
+#include <vector>
+#include "util.h"
+#include "arena.h"
+
+
+namespace RenderingFramework3D {
+
+// batched asynchronous buffer uploads: data is staged in a persistently mapped ring buffer and the copies queued
+// until Submit, which records them into one command buffer on the transfer queue. Completion is polled with fences,
+// batches complete in submission order. Main thread only, except IsComplete
+class UploadQueue
+{
+public:
+	UploadQueue();
+	~UploadQueue();
+
+	bool Initialize(unsigned dev, VkDeviceSize ringSize);
+	// waits for the batches in flight, futures of batches that never completed are set to false
+	void Cleanup();
+
+	// copy destination, arena ranges are resolved when the copy is recorded since growing or compacting the arena moves them
+	struct Destination {
+		VkBuffer buffer = VK_NULL_HANDLE;
+		VkDeviceSize offset = 0;
+		GeometryArena* arena = nullptr;
+		unsigned range = 0;
+	};
+	// reserves size bytes of staging memory for a copy to dst, data must be written before the next call.
+	// batch is the id of the batch the copy is submitted with, staging may submit the open batch if the ring is full
+	bool Stage(VkDeviceSize size, const Destination& dst, uint8_t*& data, uint64_t& batch);
+
+	bool IsComplete(uint64_t batch) const;
+	// set once the batch completed, the result is false if it was dropped by Cleanup
+	std::shared_future<bool> GetFuture(uint64_t batch);
+
+	// submits the copies staged since the last call as one batch and retires completed batches, never blocks
+	bool Submit();
+	void Poll();
+	// submits and waits for every batch
+	bool Finish();
+
+private:
+	struct PendingCopy {
+		VkBuffer src;
+		VkDeviceSize srcOffset;
+		VkDeviceSize size;
+		Destination dst;
+	};
+	struct Batch {
+		uint64_t id = 0;
+		VkCommandBuffer cmdBuffer = VK_NULL_HANDLE;
+		VkFence fence = VK_NULL_HANDLE;
+		// ring bytes released when the batch completes, including the space skipped when it wrapped around
+		VkDeviceSize ringEnd = 0;
+		VkDeviceSize ringBytes = 0;
+		// staging buffers of copies larger than the ring
+		std::vector<BufferResources> oversized;
+		std::promise<bool> promise;
+		std::shared_future<bool> future;
+	};
+
+	bool allocateRing(VkDeviceSize size, VkDeviceSize& offset);
+	bool acquireCommandBuffer(VkCommandBuffer& cmdBuffer, VkFence& fence);
+	// retires the oldest batch in flight, blocking if wait is set
+	bool retire(bool wait);
+
+private:
+	bool _init;
+	BufferResources _ring;
+	VkDeviceSize _ring_size;
+	VkDeviceSize _ring_head;
+	VkDeviceSize _ring_tail;
+	VkDeviceSize _ring_used;
+
+	// the open batch collecting copies, its ring usage and promise
+	Batch _open;
+	std::vector<PendingCopy> _pending;
+	std::deque<Batch> _in_flight;
+	// id of the newest completed batch, read by draw threads
+	std::atomic<uint64_t> _completed;
+
+	VkCommandPool _cmd_pool;
+	// command buffers and fences of retired batches
+	std::vector<std::pair<VkCommandBuffer, VkFence>> _free_cmd_buffers;
+
+	unsigned _dev_id;
+};
+}
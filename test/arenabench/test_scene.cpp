@@ -0,0 +1,164 @@
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "matrix.h"
+#include "renderer.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Mesh arena benchmark: loads nMesh small icospheres, each drawn by one object, with their own buffers and then
+// in the shared vertex/index arenas (Renderer::SetMeshArenas). Every round unloads a random quarter of the meshes
+// and loads them again, so the arenas reuse and compact freed ranges. Reports the time per load and unload, the
+// device allocations and the vertex/index buffer binds per frame, and checks that the last frame of both runs reads
+// back identical. Returns nonzero if it differs
+
+static constexpr unsigned width = 256, height = 256;
+static constexpr unsigned gridSize = 16;
+static constexpr unsigned nMesh = gridSize * gridSize;
+static constexpr unsigned rounds = 20;
+
+struct RunResult {
+    double loadTime = 0;
+    double churnTime = 0;
+    double meshBinds = 0;
+    MemoryStats memory;
+    std::vector<uint8_t> image;
+};
+
+static bool drawFrame(Renderer& renderer, const std::vector<WorldObject>& objList, Camera& camera) {
+    for (const auto& obj : objList) {
+        if (renderer.DrawObject(obj, camera, PIPELINE_UNSHADED) == false) {
+            printf("failed to draw object\n");
+            return false;
+        }
+    }
+    if (renderer.PresentFrame() == false) {
+        printf("present frame failed\n");
+        return false;
+    }
+    return true;
+}
+
+static bool run(bool arenas, RunResult& result) {
+    Renderer renderer;
+    if (renderer.InitializeOffscreen(width, height, IMAGE_FORMAT_R8G8B8A8_UNORM) == false) {
+        printf("failed to initialize renderer\n");
+        return false;
+    }
+    renderer.SetMeshArenas(arenas);
+
+    Camera camera({ 0, 0, width, height });
+    camera.Move(Vec<3>({ 0, 0, -60 }));
+
+//  the same random meshes and rounds in both runs
+    srand(0);
+    std::vector<Mesh> meshes;
+    for (unsigned i = 0; i < nMesh; i++) {
+        meshes.push_back(Mesh::Icosphere(renderer, rand() % 4));
+    }
+    auto start = steady_clock::now();
+    for (auto& mesh : meshes) {
+        if (mesh.LoadMesh() == false) {
+            printf("failed to load mesh to the GPU\n");
+            return false;
+        }
+    }
+    result.loadTime = duration<double, std::milli>(steady_clock::now() - start).count() / nMesh;
+
+    std::vector<WorldObject> objList(nMesh);
+    for (unsigned i = 0; i < nMesh; i++) {
+        objList[i] = WorldObject(meshes[i]);
+        objList[i].SetPosition(Vec<3>({ ((float)(i % gridSize) - gridSize / 2.0f) * 2.5f, ((float)(i / gridSize) - gridSize / 2.0f) * 2.5f, 0 }));
+        objList[i].GetMaterial().colour = Vec<4>({ (i % 3) / 2.0f, (i % 5) / 4.0f, (i % 7) / 6.0f, 1 });
+    }
+
+//  unloads and reloads a random quarter of the meshes per round, a frame drawn in between
+    result.churnTime = 0;
+    for (unsigned r = 0; r < rounds; r++) {
+        std::vector<unsigned> churned(nMesh);
+        for (unsigned i = 0; i < nMesh; i++) {
+            churned[i] = i;
+        }
+        for (unsigned i = 0; i < nMesh / 4; i++) {
+            std::swap(churned[i], churned[i + rand() % (nMesh - i)]);
+        }
+        churned.resize(nMesh / 4);
+        start = steady_clock::now();
+        for (unsigned i : churned) {
+            if (meshes[i].UnloadMesh() == false) {
+                printf("failed to unload mesh\n");
+                return false;
+            }
+        }
+        for (unsigned i : churned) {
+            if (meshes[i].LoadMesh() == false) {
+                printf("failed to load mesh to the GPU\n");
+                return false;
+            }
+        }
+        result.churnTime += duration<double, std::milli>(steady_clock::now() - start).count() / (2 * churned.size());
+        if (drawFrame(renderer, objList, camera) == false) {
+            return false;
+        }
+    }
+    result.churnTime /= rounds;
+
+    renderer.ResetFrameStats();
+    std::atomic<bool> done(false);
+    renderer.RequestFrameReadback([&](const FrameReadbackData& data) {
+        result.image.assign(data.data, data.data + data.height * data.rowPitch);
+        done = true;
+    });
+    // the callback runs once the GPU finished the frame, which the renderer notices while drawing the next ones
+    while (done == false) {
+        if (drawFrame(renderer, objList, camera) == false) {
+            return false;
+        }
+    }
+    // the stats count a frame once the next one begins
+    if (drawFrame(renderer, objList, camera) == false) {
+        return false;
+    }
+    result.meshBinds = renderer.GetFrameStats().meshBinds;
+    result.memory = renderer.GetMemoryStats();
+
+    if (renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return false;
+    }
+    printf("%-13s load %7.3f ms, unload/reload %7.3f ms per mesh, %4u allocations, %6.2f MiB used, %5.1f mesh binds per frame\n",
+        arenas ? "mesh arenas" : "own buffers", result.loadTime, result.churnTime, result.memory.allocationCount,
+        result.memory.usedBytes / 1048576.0, result.meshBinds);
+    return true;
+}
+
+int main() {
+    RunResult ownBuffers, arenas;
+    if (run(false, ownBuffers) == false || run(true, arenas) == false) {
+        return -1;
+    }
+
+//  an image of nothing but the clear colour would match trivially
+    unsigned differing = 0, drawn = 0;
+    for (size_t i = 0; i < ownBuffers.image.size() && i < arenas.image.size(); i++) {
+        differing += ownBuffers.image[i] != arenas.image[i];
+        drawn += ownBuffers.image[i] != ownBuffers.image[i % 4];
+    }
+    if (drawn == 0) {
+        printf("nothing drawn\n");
+        return -1;
+    }
+    if (ownBuffers.image.size() != arenas.image.size() || differing) {
+        printf("IMAGES DIFFER, %u of %zu bytes\n", differing, ownBuffers.image.size());
+        return -1;
+    }
+    printf("images match\n");
+    return 0;
+}
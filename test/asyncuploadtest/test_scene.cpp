@@ -0,0 +1,113 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+#include "matrix.h"
+#include "renderer.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Asynchronous mesh upload test: starts one Mesh::LoadMeshAsync per frame, mesh i in frame i, and draws each
+// icosphere every frame from then on by an object in its own viewport tile, reading back every frame. Checks that
+// an object appears in a frame exactly if its load's future was ready when the frame was drawn, i.e. meshes are
+// only drawn once their copy completed and from then on always, and that every load succeeds. Reports the frame
+// each mesh was first drawn in. Returns nonzero if a check fails
+
+static constexpr unsigned tiles = 4;
+static constexpr unsigned nMesh = tiles * tiles;
+static constexpr unsigned tileSize = 64;
+static constexpr unsigned width = tiles * tileSize, height = tiles * tileSize;
+
+static bool isReady(const std::shared_future<bool>& future) {
+    return future.valid() && future.wait_for(seconds(0)) == std::future_status::ready;
+}
+
+int main() {
+    Renderer renderer;
+    if (renderer.InitializeOffscreen(width, height, IMAGE_FORMAT_R8G8B8A8_UNORM) == false) {
+        printf("failed to initialize renderer\n");
+        return -1;
+    }
+
+//  large meshes so the copies take a while, each in the centre of its tile
+    std::vector<Mesh> meshes;
+    std::vector<WorldObject> objList(nMesh);
+    std::vector<Camera> cameras;
+    for (unsigned i = 0; i < nMesh; i++) {
+        meshes.push_back(Mesh::Icosphere(renderer, 3 + i % 4));
+        cameras.push_back(Camera({ (i % tiles) * tileSize, (i / tiles) * tileSize, tileSize, tileSize }));
+        cameras.back().Move(Vec<3>({ 0, 0, -10 }));
+    }
+    for (unsigned i = 0; i < nMesh; i++) {
+        objList[i] = WorldObject(meshes[i]);
+        objList[i].GetMaterial().colour = Vec<4>({ 1, 1, 1, 1 });
+    }
+
+    std::vector<std::shared_future<bool>> loads(nMesh);
+    std::vector<unsigned> readyFrame(nMesh, ~0u);
+    std::atomic<unsigned> checkedFrames(0), wrongTiles(0);
+    unsigned frame = 0;
+    // a few frames past the last completion show the meshes stay drawn
+    for (unsigned extraFrames = 0; extraFrames < 4; frame++) {
+        if (frame < nMesh) {
+            loads[frame] = meshes[frame].LoadMeshAsync();
+        }
+
+        std::vector<bool> ready(nMesh);
+        bool allReady = true;
+        for (unsigned i = 0; i < nMesh; i++) {
+            ready[i] = isReady(loads[i]);
+            allReady = allReady && ready[i];
+            if (ready[i] && readyFrame[i] == ~0u) {
+                readyFrame[i] = frame;
+            }
+            // objects of meshes still being copied are skipped
+            if (loads[i].valid() && renderer.DrawObject(objList[i], cameras[i], PIPELINE_UNSHADED) == false) {
+                printf("failed to draw object\n");
+                return -1;
+            }
+        }
+        extraFrames += allReady ? 1 : 0;
+
+        // requests are skipped while all readback buffers are busy, the frame is just not checked then
+        renderer.RequestFrameReadback([&, ready](const FrameReadbackData& data) {
+            for (unsigned i = 0; i < nMesh; i++) {
+                unsigned x = (i % tiles) * tileSize + tileSize / 2, y = (i / tiles) * tileSize + tileSize / 2;
+                bool drawn = data.data[y * data.rowPitch + x * 4] != 0;
+                wrongTiles += drawn != ready[i] ? 1 : 0;
+            }
+            checkedFrames++;
+        });
+        if (renderer.PresentFrame() == false) {
+            printf("present frame failed\n");
+            return -1;
+        }
+    }
+
+//  cleanup waits for the callbacks of all frames read back
+    if (renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return -1;
+    }
+
+    int result = 0;
+    for (unsigned i = 0; i < nMesh; i++) {
+        printf("mesh %2u: %5u vertices, loaded in frame %2u, drawn from frame %2u\n", i, meshes[i].GetNumVertices(),
+            i, readyFrame[i]);
+        if (loads[i].get() == false) {
+            printf("load of mesh %u failed\n", i);
+            result = -1;
+        }
+    }
+    printf("%u frames, %u checked: %u tiles wrong\n", frame, checkedFrames.load(), wrongTiles.load());
+    if (checkedFrames == 0 || wrongTiles) {
+        result = -1;
+    }
+    return result;
+}
@@ -208,6 +208,16 @@ static int renderer_test() {
         if (i == 0) {
             profiler.Check("Frame Time", n);
             profiler.Start();
+
+            FrameStats stats = renderer.GetFrameStats();
+            printf("frames in flight: %u, cpu: %.3f ms, gpu: %.3f ms, fence wait: %.3f ms, cpu/gpu overlap: %.2f\n",
+                stats.framesInFlight, stats.cpuTime, stats.gpuTime, stats.fenceWaitTime, stats.overlap);
+            renderer.ResetFrameStats();
+
+            UniformBufferStats uboStats = renderer.GetUniformBufferStats();
+            printf("object uniforms: %llu per frame, peak %llu (%llu bytes), capacity %llu in %u buffers\n",
+                uboStats.lastFrameAllocations, uboStats.highWaterAllocations, uboStats.highWaterBytes,
+                uboStats.capacityAllocations, uboStats.bufferCount);
         }
     }
 
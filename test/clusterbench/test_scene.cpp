@@ -0,0 +1,131 @@
+#include <iostream>
+#include <atomic>
+#include <string>
+#include <vector>
+#include "matrix.h"
+#include "renderer.h"
+
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Cluster culling benchmark: splits an icosphere into clusters (Mesh::BuildClusters) and draws it from known cameras
+// with Renderer::SetClusterCulling on and off: in view head on and from the side, without back face culling, partly
+// and entirely out of view. Reports the clusters tested and culled and the triangles drawn per frame, and checks that
+// - every cluster is tested once per draw with culling on and none with culling off
+// - an object out of view has all of its clusters culled and one without back face culling none while in view,
+//   otherwise some but not all are culled
+// - the frames read back identical with culling on and off, empty only for the object out of view
+// Returns nonzero if a check fails
+
+static constexpr unsigned width = 256, height = 256;
+static constexpr unsigned frames = 8;
+
+struct BenchConfig {
+    std::string name;
+    Vec<3> cameraPosition;
+    Vec<3> objectPosition;
+    bool backFaceCulling;
+};
+
+struct RunResult {
+    FrameStats stats;
+    std::vector<uint8_t> image;
+};
+
+static bool run(Renderer& renderer, const WorldObject& obj, const BenchConfig& bench, bool culling, RunResult& result) {
+    renderer.SetClusterCulling(culling);
+    Camera camera({ 0, 0, width, height });
+    camera.SetPosition(bench.cameraPosition);
+
+    std::atomic<bool> done(false);
+    for (unsigned f = 0; f < frames || done == false; f++) {
+        if (f == 1) {
+            renderer.ResetFrameStats();
+        }
+        if (f == frames - 1) {
+            renderer.RequestFrameReadback([&](const FrameReadbackData& data) {
+                result.image.assign(data.data, data.data + data.height * data.rowPitch);
+                done = true;
+            });
+        }
+        if (renderer.DrawObject(obj, camera, PIPELINE_UNSHADED) == false || renderer.PresentFrame() == false) {
+            printf("failed to render frame\n");
+            return false;
+        }
+        // the stats of the measured frames, before the ones drawn while waiting for the readback
+        if (f == frames - 1) {
+            result.stats = renderer.GetFrameStats();
+        }
+    }
+    return true;
+}
+
+int main() {
+    Renderer renderer;
+    if (renderer.InitializeOffscreen(width, height, IMAGE_FORMAT_R8G8B8A8_UNORM) == false) {
+        printf("failed to initialize renderer\n");
+        return -1;
+    }
+
+    Mesh sphere = Mesh::Icosphere(renderer, 5);
+    if (sphere.BuildClusters() == false || sphere.LoadMesh() == false) {
+        printf("failed to load clustered mesh\n");
+        return -1;
+    }
+    unsigned clusters = sphere.GetClusterCount();
+    printf("%u triangles in %u clusters\n", sphere.GetNumIndices() / 3, clusters);
+
+//  the sphere has radius 20, the camera's view is about 0.43 units wide per unit of depth
+    std::vector<BenchConfig> configs = {
+        { "in view", Vec<3>({ 0, 0, -150 }), Vec<3>({ 0, 0, 0 }), true },
+        { "in view from the side", Vec<3>({ 30, 15, -150 }), Vec<3>({ 0, 0, 0 }), true },
+        { "no back face culling", Vec<3>({ 0, 0, -150 }), Vec<3>({ 0, 0, 0 }), false },
+        { "partly in view", Vec<3>({ 0, 0, -60 }), Vec<3>({ 20, 0, 0 }), true },
+        { "out of view", Vec<3>({ 0, 0, -150 }), Vec<3>({ 300, 0, 0 }), true },
+    };
+    int result = 0;
+    for (const BenchConfig& bench : configs) {
+        WorldObject obj(sphere);
+        obj.SetScale(20, 20, 20);
+        obj.SetPosition(bench.objectPosition);
+        obj.SetBackFaceCulling(bench.backFaceCulling);
+        obj.GetMaterial().colour = Vec<4>({ 0.8f, 0.6f, 0.4f, 1 });
+
+        RunResult culled, unculled;
+        if (run(renderer, obj, bench, true, culled) == false || run(renderer, obj, bench, false, unculled) == false) {
+            return -1;
+        }
+
+        const FrameStats& stats = culled.stats;
+        bool countsCorrect = stats.clusters == clusters && unculled.stats.clusters == 0 && unculled.stats.culledClusters == 0;
+        if (bench.objectPosition(0) >= 300) {
+            countsCorrect = countsCorrect && stats.culledClusters == clusters && stats.triangles == 0;
+        }
+        else if (bench.backFaceCulling == false) {
+            countsCorrect = countsCorrect && stats.culledClusters == 0;
+        }
+        else {
+            countsCorrect = countsCorrect && stats.culledClusters > 0 && stats.culledClusters < clusters &&
+                stats.triangles < unculled.stats.triangles;
+        }
+        // an image of nothing but the clear colour would match trivially, unless the object is out of view
+        bool drawn = false;
+        for (size_t i = 4; i < culled.image.size() && drawn == false; i++) {
+            drawn = culled.image[i] != culled.image[i % 4];
+        }
+        bool imageCorrect = drawn == (bench.objectPosition(0) < 300) && culled.image == unculled.image;
+
+        printf("%-22s %4.0f clusters, %4.0f culled, %6.0f triangles (%6.0f unculled), %s, %s\n", bench.name.c_str(),
+            stats.clusters, stats.culledClusters, stats.triangles, unculled.stats.triangles, countsCorrect ? "counts correct" : "COUNTS WRONG", imageCorrect ? "images match" : "IMAGES DIFFER");
+        if (countsCorrect == false || imageCorrect == false) {
+            result = -1;
+        }
+    }
+
+    if (renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return -1;
+    }
+    return result;
+}
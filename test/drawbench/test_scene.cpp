@@ -0,0 +1,195 @@
+#include <iostream>
+#include <chrono>
+#include <math.h>
+#include <string>
+#include <vector>
+#include "matrix.h"
+#include "window.h"
+#include "renderer.h"
+#include "timeprofiler.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Draw call throughput benchmark: draws nObj cubes per frame and alternates between
+// pipeline configurations every n frames, reporting the CPU time spent in DrawObject calls.
+// Each configuration runs with colours from a small palette and with a colour per object.
+// With --offscreen it renders without a window and exits after one round of all configurations
+
+static int renderer_test(bool offscreen);
+
+int main(int argc, char** argv) {
+    bool offscreen = argc > 1 && std::string(argv[1]) == "--offscreen";
+    return renderer_test(offscreen);
+}
+
+void random_init() {
+    srand(0);
+}
+
+float RandomFloat(float max, float min) {
+    return ((max - min) * rand()) / (float)(RAND_MAX)+min;
+}
+
+struct BenchConfig {
+    std::string name;
+    unsigned pipeline;
+    // every object a different colour instead of one of the palette
+    bool objectColours;
+};
+
+static int renderer_test(bool offscreen) {
+    unsigned windowWidth=1000, windowHeight=800;
+
+    random_init();
+
+//  Create Window
+    Window wnd;
+    if(offscreen == false && wnd.Initialize(false, windowWidth, windowHeight , "Draw Call Benchmark") == false) {
+        printf("failed to initialize window\n");
+        return -1;
+    }
+
+//  Create Renderer
+    Renderer renderer;
+    bool rendererInit = offscreen ? renderer.InitializeOffscreen(windowWidth, windowHeight) : renderer.Initialize(wnd);
+    if(rendererInit==false) {
+        printf("failed to initialize renderer\n");
+        return -1; 
+    }
+
+//  Create benchmarked pipelines, unlit default shaders so the push constant data fits the minimum guaranteed 128 bytes
+    std::vector<BenchConfig> configs;
+    PipelineConfig config;
+    config.uniformShaderInputLayout.ObjectInputs.useObjToWorldTransform = false;
+    config.defFragShaderSelect = DEFAULT_FRAG_SHADER_UNLIT;
+    config.defVertShaderSelect = DEFAULT_VERT_SHADER_UNLIT;
+
+    unsigned pipelineID;
+    config.uniformShaderInputLayout.ObjectInputs.usePushConstants = false;
+    if (renderer.CreateCustomPipeline(config, pipelineID) == false) {
+        printf("failed to create pipeline\n");
+        return -1;
+    }
+    configs.push_back({ "uniform buffers", pipelineID, false });
+    configs.push_back({ "uniform buffers", pipelineID, true });
+
+    config.uniformShaderInputLayout.ObjectInputs.usePushConstants = true;
+    if (renderer.CreateCustomPipeline(config, pipelineID) == false) {
+        printf("failed to create pipeline\n");
+        return -1;
+    }
+    configs.push_back({ "push constants", pipelineID, false });
+    configs.push_back({ "push constants", pipelineID, true });
+
+    config.uniformShaderInputLayout.ObjectInputs.usePushConstants = false;
+    config.uniformShaderInputLayout.ObjectInputs.useInstancing = true;
+    if (renderer.CreateCustomPipeline(config, pipelineID) == false) {
+        printf("failed to create pipeline\n");
+        return -1;
+    }
+    configs.push_back({ "instanced", pipelineID, false });
+    configs.push_back({ "instanced", pipelineID, true });
+
+//  Create Camera
+    Camera mainCamera({ 0,0,windowWidth, windowHeight });
+    mainCamera.Move(Vec<3>({ 0, 0, -400 }));
+
+//  Initialize Objects
+    static constexpr unsigned nObj = 20000;
+    Mesh cubeMesh = Mesh::Cube(renderer);
+    if(cubeMesh.LoadMesh() == false) {
+        printf("failed to load mesh to the GPU\n");
+        return -1;
+    }
+//  a small palette and a colour per object, the material is part of the instance data so both can be instanced
+    std::vector<Vec<4>> palette(8);
+    for (auto& colour : palette) {
+        colour = Vec<4>({ RandomFloat(1, 0), RandomFloat(1, 0), RandomFloat(1, 0), 1 });
+    }
+    std::vector<WorldObject> objList(nObj);
+    std::vector<Vec<4>> paletteColours(nObj), objectColours(nObj);
+    for (unsigned i = 0; i < nObj; i++) {
+        objList[i] = WorldObject(cubeMesh);
+        objList[i].SetPosition(Vec<3>({ RandomFloat(150, -150), RandomFloat(150, -150), RandomFloat(150, -150) }));
+        objList[i].SetScale(1, 1, 1);
+        paletteColours[i] = palette[rand() % palette.size()];
+        objectColours[i] = Vec<4>({ RandomFloat(1, 0), RandomFloat(1, 0), RandomFloat(1, 0), 1 });
+    }
+    auto setColours = [&](const BenchConfig& bench) {
+        for (unsigned i = 0; i < nObj; i++) {
+            objList[i].GetMaterial().colour = bench.objectColours ? objectColours[i] : paletteColours[i];
+        }
+    };
+    setColours(configs[0]);
+
+//  main loop
+    unsigned n = 200;
+    unsigned configIdx = 0;
+    double drawTime = 0;
+    TimeProfiler drawTimer;
+    for (int i = 1;; i++) {
+        drawTimer.Start();
+        for (const auto& obj : objList) {
+            if(renderer.DrawObject(obj, mainCamera, configs[configIdx].pipeline)==false) {
+                printf("failed to draw object\n");
+                return -1;
+            }
+        }
+        drawTime += drawTimer.Check();
+
+    //  Present frame
+        if (renderer.PresentFrame() == false) {
+            printf("present frame failed\n");
+            break;
+        }
+
+        if (offscreen == false) {
+        //  Window Update
+            wnd.Update();
+
+        //  Reset Camera View Port if window resized
+            if (wnd.IsResized()) {
+                mainCamera.SetViewPort({ 0,0,wnd.GetWidth(), wnd.GetHeight() });
+            }
+
+        //  Check Window exit event to exit main loop
+            if (wnd.CheckExit()) {
+                std::cout << "exit" << std::endl;
+                break;
+            }
+        }
+
+    //  Report draw call throughput after "n" frames and switch to the next configuration
+        if (i % n == 0) {
+            FrameStats stats = renderer.GetFrameStats();
+            printf("%-16s %-15s %u draws: DrawObject %.3f ms/frame (%.2f M draws/s), frame %.3f ms, gpu %.3f ms, %.0f draw calls, binds: %.0f pipeline %.0f mesh\n",
+                configs[configIdx].name.c_str(), configs[configIdx].objectColours ? "object colours" : "palette colours", nObj, 1000 * drawTime / n, nObj * n / drawTime / 1e6,
+                stats.frameTime, stats.gpuTime, stats.drawCalls, stats.pipelineBinds, stats.meshBinds);
+            renderer.ResetFrameStats();
+            drawTime = 0;
+            configIdx = (configIdx + 1) % configs.size();
+            setColours(configs[configIdx]);
+            if (offscreen && configIdx == 0) {
+                break;
+            }
+        }
+    }
+
+//  Renderer Cleanup
+    if(renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return -1;
+    }
+
+//  Window Cleanup
+    if(offscreen == false && wnd.Cleanup() == false) {
+        printf("Window Cleanup Failed\n");
+        return -1;
+
+    }
+    return 0;
+}
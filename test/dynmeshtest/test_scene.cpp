@@ -106,6 +106,8 @@ static int renderer_test() {
     planeMesh.SetVertexNormals(planeVertNormals);
     planeMesh.SetIndexBuffer(planeIndices);
     planeMesh.LoadMesh(true);
+//  every vertex is rewritten each frame, nothing has to be carried over to the next copy
+    planeMesh.SetDynamicCopyForward(false);
 
 //  Create plane object
     WorldObject plane(planeMesh);
@@ -185,10 +187,16 @@ static int renderer_test() {
         }
 
         float time = simTimer.Check();
+    //  rewrite every vertex through one mapped range, flushed once on unmap
+        DynamicVertexRange range;
+        if(plane.GetMesh().MapDynamicRange(0, planeVerts.size(), range) == false) {
+            printf("failed to map plane vertices\n");
+            break;
+        }
         for(unsigned z=0; z < planeDivY; z++) {
             for(unsigned x=0; x < planeDivX; x++) {
                 unsigned idx = z*planeDivX + x;
-                auto vert = plane.GetMesh().GetVertices()[idx];
+                auto vert = planeVerts[idx];
                 float cx = 2*PI/waveLengthX*planeSegWidth;
                 float cz = 2*PI/waveLengthZ*planeSegHeight;
                 float ct = 2*PI*waveFreq;
@@ -196,14 +204,15 @@ static int renderer_test() {
                 float sinTheta = std::sin(ct*time+cx*x+cz*z);
                 vert(1) = waveAmplitude*sinTheta;
 
-                plane.GetMesh().SetVertexDynamic(idx, vert);
+                range.positions.Set(idx, vert);
 
                 Vec<3> normal({cx*sinTheta,1,cz*sinTheta});
                 normal.Normalize();
 
-                plane.GetMesh().SetVertexNormalDynamic(idx, normal);
+                range.normals.Set(idx, normal);
             }
         }
+        plane.GetMesh().UnmapDynamicRange();
 
         if(renderer.DrawObject(plane, mainCamera)==false) {
             printf("failed to draw object\n");
@@ -0,0 +1,163 @@
+#include <iostream>
+#include <chrono>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+#include "matrix.h"
+
+
+using namespace std::chrono;
+
+using namespace MathUtil;
+
+// Vector expression microbenchmark: times chained Vec and Matrix arithmetic, evaluated by the expression templates of
+// vec.h and matrix.h in one loop, against the value operators they replaced, which return a full temporary per
+// operator. Reports nanoseconds per evaluated expression and the speedup of the expressions
+
+static constexpr unsigned count = 4096;
+static constexpr unsigned reps = 200;
+static constexpr unsigned trials = 5;
+
+float RandomFloat(float max, float min) {
+    return ((max - min) * rand()) / (float)(RAND_MAX)+min;
+}
+
+// the value operators before the expression templates, a temporary result per operator
+namespace Value {
+template <unsigned size>
+Vec<size> add(const Vec<size>& a, const Vec<size>& b) {
+    Vec<size> result;
+    for (unsigned i = 0; i < size; i++) {
+        result(i) = a(i) + b(i);
+    }
+    return result;
+}
+
+template <unsigned size>
+Vec<size> subtract(const Vec<size>& a, const Vec<size>& b) {
+    Vec<size> result;
+    for (unsigned i = 0; i < size; i++) {
+        result(i) = a(i) - b(i);
+    }
+    return result;
+}
+
+template <unsigned size>
+Vec<size> scale(const Vec<size>& a, float s) {
+    Vec<size> result;
+    for (unsigned i = 0; i < size; i++) {
+        result(i) = a(i) * s;
+    }
+    return result;
+}
+
+template <unsigned rows, unsigned columns>
+Matrix<rows, columns> add(const Matrix<rows, columns>& a, const Matrix<rows, columns>& b) {
+    Matrix<rows, columns> result;
+    for (unsigned r = 0; r < rows; r++) {
+        for (unsigned c = 0; c < columns; c++) {
+            result(r, c) = a(r, c) + b(r, c);
+        }
+    }
+    return result;
+}
+
+template <unsigned rows, unsigned columns>
+Matrix<rows, columns> scale(const Matrix<rows, columns>& a, float s) {
+    Matrix<rows, columns> result;
+    for (unsigned r = 0; r < rows; r++) {
+        for (unsigned c = 0; c < columns; c++) {
+            result(r, c) = a(r, c) * s;
+        }
+    }
+    return result;
+}
+}
+
+// runs step over all items reps times per trial, returns the best trial's nanoseconds per item
+template<typename Step>
+static double timeStep(Step step) {
+    double best = 0;
+    for (unsigned t = 0; t < trials; t++) {
+        auto start = steady_clock::now();
+        for (unsigned r = 0; r < reps; r++) {
+            for (unsigned i = 0; i < count; i++) {
+                step(i);
+            }
+        }
+        double ns = duration<double, std::nano>(steady_clock::now() - start).count() / ((double)reps * count);
+        best = t == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+static void report(const char* name, double value, double expression, float checksumValue, float checksumExpression) {
+    printf("%-28s value %7.2f ns, expression %7.2f ns, speedup %5.2fx (checksums %.4g / %.4g)\n", name, value, expression,
+        value / expression, checksumValue, checksumExpression);
+}
+
+// particle step p += v * dt - n * k on vectors of one size, the positions restart from the same state for both
+template<unsigned size>
+static void benchParticles(const char* name) {
+    std::vector<Vec<size>> p(count), v(count), n(count), start(count);
+    for (unsigned i = 0; i < count; i++) {
+        for (unsigned c = 0; c < size; c++) {
+            start[i](c) = RandomFloat(10, -10);
+            v[i](c) = RandomFloat(1, -1);
+            n[i](c) = RandomFloat(1, -1);
+        }
+    }
+    const float dt = 1.0f / 60, k = 0.01f;
+
+    p = start;
+    double value = timeStep([&](unsigned i) {
+        p[i] = Value::subtract(Value::add(p[i], Value::scale(v[i], dt)), Value::scale(n[i], k));
+    });
+    float checksumValue = 0;
+    for (unsigned i = 0; i < count; i++) {
+        checksumValue += p[i](0);
+    }
+
+    p = start;
+    double expression = timeStep([&](unsigned i) {
+        p[i] = p[i] + v[i] * dt - n[i] * k;
+    });
+    float checksumExpression = 0;
+    for (unsigned i = 0; i < count; i++) {
+        checksumExpression += p[i](0);
+    }
+    report(name, value, expression, checksumValue, checksumExpression);
+}
+
+int main() {
+    srand(0);
+
+    benchParticles<3>("p + v * dt - n * k, Vec<3>");
+    benchParticles<4>("p + v * dt - n * k, Vec<4>");
+    benchParticles<16>("p + v * dt - n * k, Vec<16>");
+    benchParticles<64>("p + v * dt - n * k, Vec<64>");
+
+//  blend of three transforms with weights, as in skinning
+    std::vector<Matrix<4, 4>> a(count), b(count), c(count), out(count);
+    std::vector<Vec<4>> weights(count);
+    for (unsigned i = 0; i < count; i++) {
+        for (unsigned e = 0; e < 16; e++) {
+            a[i](e % 4, e / 4) = RandomFloat(1, -1);
+            b[i](e % 4, e / 4) = RandomFloat(1, -1);
+            c[i](e % 4, e / 4) = RandomFloat(1, -1);
+        }
+        float w0 = RandomFloat(1, 0), w1 = RandomFloat(1, 0);
+        weights[i] = Vec<4>({ w0, w1, std::max(0.0f, 1 - w0 - w1), 0 });
+    }
+    float checksumValue = 0, checksumExpression = 0;
+    double value = timeStep([&](unsigned i) {
+        out[i] = Value::add(Value::add(Value::scale(a[i], weights[i](0)), Value::scale(b[i], weights[i](1))), Value::scale(c[i], weights[i](2)));
+        checksumValue += out[i](2, 1);
+    });
+    double expression = timeStep([&](unsigned i) {
+        out[i] = a[i] * weights[i](0) + b[i] * weights[i](1) + c[i] * weights[i](2);
+        checksumExpression += out[i](2, 1);
+    });
+    report("a * wa + b * wb + c * wc, 4x4", value, expression, checksumValue, checksumExpression);
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include <iostream>
+#include <chrono>
+#include <math.h>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include "worldobj.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Reference frame hierarchy benchmark: rigs of objects attached to each other, every object rotated each frame and
+// every world transform read once afterwards, as the draws of a frame read them. Times the cached world transforms
+// of WorldObject::GetTransform against walking the parents and multiplying the local transforms on every read, the
+// way world transforms were computed before they were cached. Reports nanoseconds per object and frame
+
+static constexpr unsigned object_count = 8192;
+static constexpr unsigned frames = 20;
+static constexpr unsigned trials = 3;
+
+float RandomFloat(float max, float min) {
+    return ((max - min) * rand()) / (float)(RAND_MAX)+min;
+}
+
+struct Rig {
+    std::vector<std::unique_ptr<WorldObject>> objects;
+    // index of each object's parent, -1 for roots
+    std::vector<int> parents;
+    std::vector<Vec<3>> axes;
+
+    void add(int parent) {
+        objects.emplace_back(new WorldObject());
+        objects.back()->SetPosition(Vec<3>({ RandomFloat(5, -5), RandomFloat(5, -5), RandomFloat(5, -5) }));
+        if (parent >= 0) {
+            objects.back()->AttachReferenceFrame(*objects[parent]);
+        }
+        parents.push_back(parent);
+        axes.push_back(Vec<3>({ RandomFloat(1, -1), RandomFloat(1, -1), 1 }));
+    }
+};
+
+// chains of depth objects, each attached to the one before, like the joints of robot arms
+static Rig buildArms(unsigned depth) {
+    Rig rig;
+    for (unsigned i = 0; i < object_count; i++) {
+        rig.add(i % depth == 0 ? -1 : (int)i - 1);
+    }
+    return rig;
+}
+
+// a star with planets, moons and satellites of the moons
+static Rig buildOrbits() {
+    static constexpr unsigned planets = 8, moons = 32, satellites = 31;
+    Rig rig;
+    rig.add(-1);
+    for (unsigned p = 0; p < planets; p++) {
+        int planet = (int)rig.objects.size();
+        rig.add(0);
+        for (unsigned m = 0; m < moons; m++) {
+            int moon = (int)rig.objects.size();
+            rig.add(planet);
+            for (unsigned s = 0; s < satellites; s++) {
+                rig.add(moon);
+            }
+        }
+    }
+    return rig;
+}
+
+// the world transform as it was computed before the cache, one product per ancestor
+static Matrix<4, 4> walkParents(const Rig& rig, unsigned i) {
+    Matrix<4, 4> world = rig.objects[i]->GetLocalTransform();
+    for (int parent = rig.parents[i]; parent >= 0; parent = rig.parents[parent]) {
+        world = rig.objects[parent]->GetLocalTransform() * world;
+    }
+    return world;
+}
+
+// rotates every object and reads every world transform frames times per trial, returns the best trial's nanoseconds
+// per object and frame
+template<typename Read>
+static double timeFrames(Rig& rig, Read read, float& checksum) {
+    double best = 0;
+    for (unsigned t = 0; t < trials; t++) {
+        auto start = steady_clock::now();
+        for (unsigned f = 0; f < frames; f++) {
+            for (unsigned i = 0; i < rig.objects.size(); i++) {
+                rig.objects[i]->Rotate(rig.axes[i], 0.01f);
+            }
+            for (unsigned i = 0; i < rig.objects.size(); i++) {
+                checksum += read(i)(0, 3);
+            }
+        }
+        double ns = duration<double, std::nano>(steady_clock::now() - start).count() / ((double)frames * rig.objects.size());
+        best = t == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+static void run(const char* name, Rig rigs[2]) {
+    float checksumWalk = 0, checksumCached = 0;
+    double walk = timeFrames(rigs[0], [&](unsigned i) { return walkParents(rigs[0], i); }, checksumWalk);
+    double cached = timeFrames(rigs[1], [&](unsigned i) { return rigs[1].objects[i]->GetTransform(); }, checksumCached);
+    printf("%-20s walk %8.2f ns, cached %8.2f ns, speedup %6.2fx (checksums %.4g / %.4g)\n", name, walk, cached, walk / cached,
+        checksumWalk, checksumCached);
+}
+
+int main() {
+    for (unsigned depth : { 1u, 4u, 16u, 64u }) {
+        // the same random rig twice, so both ways of reading rotate identical objects
+        Rig rigs[2];
+        for (Rig& rig : rigs) {
+            srand(depth);
+            rig = buildArms(depth);
+        }
+        std::string name = "arms of depth " + std::to_string(depth);
+        run(name.c_str(), rigs);
+    }
+
+    Rig rigs[2];
+    for (Rig& rig : rigs) {
+        srand(0);
+        rig = buildOrbits();
+    }
+    run("orbits, depth 4", rigs);
+    return 0;
+}
@@ -0,0 +1,195 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "matrix.h"
+#include "renderer.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Level of detail benchmark: generates the LOD chain of an icosphere and draws it from a camera moving away and back,
+// then from a near and a far camera in the same frames. Reports the triangles and error of every level, the time
+// to generate them and the triangles drawn per frame at each distance, and checks that
+// - every level has about half the triangles of the previous one and errors grow with the level within the target
+// - every draw uses one of the levels, finer ones up close, the full mesh nearest and the coarsest level farthest
+// - between the thresholds of two levels a camera keeps the level it came from, also while another camera draws the
+//   object in the same frames from further away
+// - a larger object scale selects a finer level
+// Returns nonzero if a check fails
+
+static constexpr unsigned width = 256, height = 256;
+static constexpr float targetError = 0.05f;
+
+// triangles drawn per frame by the cameras, averaged over a few frames once the selection settled
+static bool drawnTriangles(Renderer& renderer, const WorldObject& obj, std::vector<Camera*> cameras, double& triangles) {
+    for (unsigned f = 0; f < 6; f++) {
+        if (f == 2) {
+            renderer.ResetFrameStats();
+        }
+        for (Camera* camera : cameras) {
+            if (renderer.DrawObject(obj, *camera, PIPELINE_UNSHADED) == false) {
+                printf("failed to draw object\n");
+                return false;
+            }
+        }
+        if (renderer.PresentFrame() == false) {
+            printf("present frame failed\n");
+            return false;
+        }
+    }
+    triangles = renderer.GetFrameStats().triangles;
+    return true;
+}
+
+// the level with the triangle count, -1 if none has it
+static int levelOf(const Mesh& mesh, double triangles) {
+    for (unsigned l = 0; l < mesh.GetLODCount(); l++) {
+        if (mesh.GetLODTriangleCount(l) == triangles) {
+            return l;
+        }
+    }
+    return -1;
+}
+
+int main() {
+    Renderer renderer;
+    if (renderer.InitializeOffscreen(width, height, IMAGE_FORMAT_R8G8B8A8_UNORM) == false) {
+        printf("failed to initialize renderer\n");
+        return -1;
+    }
+    int result = 0;
+
+    Mesh sphere = Mesh::Icosphere(renderer, 5);
+    auto start = steady_clock::now();
+    if (sphere.GenerateLODs(MAX_MESH_LODS - 1, targetError) == false) {
+        printf("failed to generate LODs\n");
+        return -1;
+    }
+    double generateTime = duration<double, std::milli>(steady_clock::now() - start).count();
+    printf("%u levels generated in %.3f ms\n", sphere.GetLODCount(), generateTime);
+
+//  each level halves the previous one, only the last may stop short where the error bound is reached, but no level
+//  keeps more than 90% of the triangles
+    bool levelsCorrect = sphere.GetLODCount() > 1 && sphere.GetLODTriangleCount(0) == sphere.GetNumIndices() / 3;
+    for (unsigned l = 0; l < sphere.GetLODCount(); l++) {
+        unsigned triangles = sphere.GetLODTriangleCount(l);
+        printf("level %u: %6u triangles, error %.5f\n", l, triangles, sphere.GetLODError(l));
+        if (l > 0) {
+            unsigned previous = sphere.GetLODTriangleCount(l - 1);
+            bool last = l + 1 == sphere.GetLODCount();
+            levelsCorrect = levelsCorrect && triangles <= (last ? previous / 10 * 9 : previous / 2) && triangles >= previous / 3 &&
+                sphere.GetLODError(l) >= sphere.GetLODError(l - 1) && sphere.GetLODError(l) <= targetError;
+        }
+    }
+    if (levelsCorrect == false) {
+        printf("LEVELS WRONG\n");
+        result = -1;
+    }
+
+    if (sphere.LoadMesh() == false) {
+        printf("failed to load mesh to the GPU\n");
+        return -1;
+    }
+    WorldObject obj(sphere);
+    obj.SetScale(20, 20, 20);
+
+//  out and back again, the hysteresis may keep finer levels on the way out
+    std::vector<float> distances = { 25, 60, 100, 200, 400, 800, 1600, 800, 400, 200, 100, 60, 25 };
+    Camera camera({ 0, 0, width, height });
+    std::vector<int> levels;
+    bool drawsCorrect = true;
+    for (float distance : distances) {
+        camera.SetPosition(Vec<3>({ 0, 0, -distance }));
+        double triangles;
+        if (drawnTriangles(renderer, obj, { &camera }, triangles) == false) {
+            return -1;
+        }
+        levels.push_back(levelOf(sphere, triangles));
+        printf("distance %6.0f: %6.0f triangles per frame, level %d\n", distance, triangles, levels.back());
+        drawsCorrect = drawsCorrect && levels.back() >= 0;
+    }
+    for (unsigned i = 1; i < levels.size(); i++) {
+        bool outward = distances[i] > distances[i - 1];
+        drawsCorrect = drawsCorrect && (outward ? levels[i] >= levels[i - 1] : levels[i] <= levels[i - 1]);
+    }
+    unsigned farthest = distances.size() / 2;
+    drawsCorrect = drawsCorrect && levels.front() == 0 && levels.back() == 0 && levels[farthest] == (int)sphere.GetLODCount() - 1;
+    if (drawsCorrect == false) {
+        printf("LEVELS DRAWN WRONG\n");
+        result = -1;
+    }
+
+//  a distance within the hysteresis: cameras coming from closer keep a finer level than cameras coming from further
+    float bandDistance = 0;
+    double nearTriangles = 0, farTriangles = 0;
+    for (float distance = 40; distance < 400 && bandDistance == 0; distance *= 1.05f) {
+        Camera fromNear({ 0, 0, width, height });
+        Camera fromFar({ 0, 0, width, height });
+        fromNear.SetPosition(Vec<3>({ 0, 0, -25 }));
+        fromFar.SetPosition(Vec<3>({ 0, 0, -1600 }));
+        if (drawnTriangles(renderer, obj, { &fromNear, &fromFar }, nearTriangles) == false) {
+            return -1;
+        }
+        fromNear.SetPosition(Vec<3>({ 0, 0, -distance }));
+        fromFar.SetPosition(Vec<3>({ 0, 0, -distance }));
+        if (drawnTriangles(renderer, obj, { &fromNear }, nearTriangles) == false ||
+            drawnTriangles(renderer, obj, { &fromFar }, farTriangles) == false) {
+            return -1;
+        }
+        bandDistance = nearTriangles > farTriangles ? distance : 0;
+    }
+
+//  the camera that came from closer keeps its level while a far camera draws the object in the same frames
+    bool camerasCorrect = bandDistance > 0;
+    if (camerasCorrect) {
+        Camera nearCamera({ 0, 0, width, height });
+        Camera farCamera({ 0, 0, width, height });
+        nearCamera.SetPosition(Vec<3>({ 0, 0, -25 }));
+        farCamera.SetPosition(Vec<3>({ 0, 0, -1600 }));
+        double bothTriangles;
+        if (drawnTriangles(renderer, obj, { &nearCamera }, nearTriangles) == false ||
+            drawnTriangles(renderer, obj, { &farCamera }, farTriangles) == false) {
+            return -1;
+        }
+        nearCamera.SetPosition(Vec<3>({ 0, 0, -bandDistance }));
+        if (drawnTriangles(renderer, obj, { &nearCamera }, nearTriangles) == false ||
+            drawnTriangles(renderer, obj, { &nearCamera, &farCamera }, bothTriangles) == false) {
+            return -1;
+        }
+        camerasCorrect = bothTriangles == nearTriangles + farTriangles;
+        printf("distance %.0f within the hysteresis: %.0f triangles per frame, with a far camera %.0f + %.0f = %.0f\n",
+            bandDistance, nearTriangles, nearTriangles, farTriangles, bothTriangles);
+    }
+    printf("%s\n", camerasCorrect ? "levels kept per camera" : "LEVELS NOT KEPT PER CAMERA");
+    if (camerasCorrect == false) {
+        result = -1;
+    }
+
+//  the same distance with twice the scale, from new cameras so the hysteresis doesn't carry over
+    Camera camera1({ 0, 0, width, height }), camera2({ 0, 0, width, height });
+    camera1.SetPosition(Vec<3>({ 0, 0, -200 }));
+    camera2.SetPosition(Vec<3>({ 0, 0, -200 }));
+    WorldObject scaled(sphere);
+    scaled.SetScale(40, 40, 40);
+    double triangles, scaledTriangles;
+    if (drawnTriangles(renderer, obj, { &camera1 }, triangles) == false ||
+        drawnTriangles(renderer, scaled, { &camera2 }, scaledTriangles) == false) {
+        return -1;
+    }
+    bool scaleCorrect = levelOf(sphere, scaledTriangles) < levelOf(sphere, triangles);
+    printf("distance 200: scale 20 %.0f, scale 40 %.0f triangles per frame, %s\n", triangles, scaledTriangles,
+        scaleCorrect ? "finer level" : "LEVEL NOT FINER");
+    if (scaleCorrect == false) {
+        result = -1;
+    }
+
+    if (renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return -1;
+    }
+    return result;
+}
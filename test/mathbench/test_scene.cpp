@@ -0,0 +1,286 @@
+#include <iostream>
+#include <chrono>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "matrix.h"
+#include "batch.h"
+#include "quat.h"
+
+
+using namespace std::chrono;
+
+using namespace MathUtil;
+
+// Matrix kernel microbenchmark: times the 4x4 products, transpose and affine inverse of MathUtil against the
+// generic loops they replaced, over arrays of random matrices so every product loads its operands from memory.
+// Reports nanoseconds per operation and the speedup of the kernels built for this target (see simd.h), then the
+// batch functions of batch.h on structure of arrays copies of the same data against the kernels called per item, and
+// the quaternion rotation of the objects and cameras against the axis angle matrix product it replaced
+
+static constexpr unsigned count = 4096;
+static constexpr unsigned reps = 100;
+static constexpr unsigned trials = 5;
+
+float RandomFloat(float max, float min) {
+    return ((max - min) * rand()) / (float)(RAND_MAX)+min;
+}
+
+// the generic loops Matrix used for every size before the 4x4 kernels
+static Matrix<4, 4> multiplyGeneric(const Matrix<4, 4>& a, const Matrix<4, 4>& b) {
+    Matrix<4, 4> result;
+    for (unsigned i = 0; i < 4; i++) {
+        for (unsigned j = 0; j < 4; j++) {
+            result(i, j) = 0.0f;
+            for (unsigned k = 0; k < 4; k++) {
+                result(i, j) += a(i, k) * b(k, j);
+            }
+        }
+    }
+    return result;
+}
+
+static Vec<4> multiplyGeneric(const Matrix<4, 4>& m, const Vec<4>& v) {
+    Vec<4> result(0);
+    for (unsigned i = 0; i < 4; i++) {
+        for (unsigned k = 0; k < 4; k++) {
+            result(i) += m(i, k) * v(k);
+        }
+    }
+    return result;
+}
+
+static Matrix<4, 4> transposeGeneric(const Matrix<4, 4>& m) {
+    Matrix<4, 4> result;
+    for (unsigned i = 0; i < 4; i++) {
+        for (unsigned j = 0; j < 4; j++) {
+            result(j, i) = m(i, j);
+        }
+    }
+    return result;
+}
+
+// 3x3 inverse by cofactors, translation moved back by it
+static Matrix<4, 4> affineInverseGeneric(const Matrix<4, 4>& m) {
+    Matrix<4, 4> result = GetIdentity<4>();
+    float det = m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0)) +
+        m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+    for (unsigned r = 0; r < 3; r++) {
+        for (unsigned c = 0; c < 3; c++) {
+            unsigned r0 = (c + 1) % 3, r1 = (c + 2) % 3, c0 = (r + 1) % 3, c1 = (r + 2) % 3;
+            result(r, c) = (m(r0, c0) * m(r1, c1) - m(r0, c1) * m(r1, c0)) / det;
+        }
+    }
+    for (unsigned r = 0; r < 3; r++) {
+        result(r, 3) = -(result(r, 0) * m(0, 3) + result(r, 1) * m(1, 3) + result(r, 2) * m(2, 3));
+    }
+    return result;
+}
+
+// rotation by radians about axis multiplied into the rotation of transform, as objects and cameras rotated before
+// they kept a quaternion
+static void rotateGeneric(Matrix<4, 4>& transform, const Vec<3>& axis, float radians) {
+    Vec<3> u = axis.Normalized();
+    Matrix<4, 4> rotation(0.0f);
+    float c = std::cos(radians), s = std::sin(radians);
+    rotation(0, 0) = c + u(0) * u(0) * (1 - c);
+    rotation(1, 0) = u(1) * u(0) * (1 - c) + u(2) * s;
+    rotation(2, 0) = u(2) * u(0) * (1 - c) - u(1) * s;
+    rotation(0, 1) = u(0) * u(1) * (1 - c) - u(2) * s;
+    rotation(1, 1) = c + u(1) * u(1) * (1 - c);
+    rotation(2, 1) = u(2) * u(1) * (1 - c) + u(0) * s;
+    rotation(0, 2) = u(0) * u(2) * (1 - c) + u(1) * s;
+    rotation(1, 2) = u(1) * u(2) * (1 - c) - u(0) * s;
+    rotation(2, 2) = c + u(2) * u(2) * (1 - c);
+    rotation(3, 3) = 1;
+    Vec<4> translation({ transform(0, 3), transform(1, 3), transform(2, 3), 1 });
+    transform = rotation * transform;
+    for (unsigned r = 0; r < 3; r++) {
+        transform(r, 3) = translation(r);
+    }
+}
+
+// largest deviation of R^T R from the identity
+static float orthonormalError(const Matrix<3, 3>& m) {
+    float error = 0;
+    for (unsigned i = 0; i < 3; i++) {
+        for (unsigned j = 0; j < 3; j++) {
+            float dot = m(0, i) * m(0, j) + m(1, i) * m(1, j) + m(2, i) * m(2, j);
+            error = std::max(error, std::fabs(dot - (i == j ? 1.0f : 0.0f)));
+        }
+    }
+    return error;
+}
+
+// runs op over the arrays reps times per trial, returns the best trial's nanoseconds per call and a checksum of the
+// results so the work can't be optimized away
+template<typename Op>
+static double timeOp(Op op, float& checksum) {
+    double best = 0;
+    for (unsigned t = 0; t < trials; t++) {
+        auto start = steady_clock::now();
+        for (unsigned r = 0; r < reps; r++) {
+            for (unsigned i = 0; i < count; i++) {
+                checksum += op(i);
+            }
+        }
+        double ns = duration<double, std::nano>(steady_clock::now() - start).count() / ((double)reps * count);
+        best = t == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+// runs batch over all items reps times per trial, returns the best trial's nanoseconds per item
+template<typename Batch>
+static double timeBatch(Batch batch) {
+    double best = 0;
+    for (unsigned t = 0; t < trials; t++) {
+        auto start = steady_clock::now();
+        for (unsigned r = 0; r < reps; r++) {
+            batch();
+        }
+        double ns = duration<double, std::nano>(steady_clock::now() - start).count() / ((double)reps * count);
+        best = t == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+static void report(const char* name, double generic, double simd, float checksumGeneric, float checksumSimd, const char* labels[2] = nullptr) {
+    static const char* default_labels[2] = { "generic", "simd" };
+    labels = labels ? labels : default_labels;
+    printf("%-20s %s %6.2f ns, %s %6.2f ns, speedup %5.2fx (checksums %.3g / %.3g)\n", name, labels[0], generic, labels[1], simd, generic / simd,
+        checksumGeneric, checksumSimd);
+}
+
+// structure of arrays copy of matrices in the blocked layout of Mat4SoA
+struct Mat4Arrays {
+    std::vector<float> data;
+    Mat4SoA view;
+
+    Mat4Arrays(const std::vector<Matrix<4, 4>>& matrices) : data(GetMat4SoASize(matrices.size())), view({ data.data() }) {
+        for (unsigned i = 0; i < matrices.size(); i++) {
+            StoreMat4SoA(matrices[i], view, i);
+        }
+    }
+
+    float element(unsigned i, unsigned k) const {
+        float raw[16];
+        LoadMat4SoA(view, i, raw);
+        return raw[k];
+    }
+};
+
+int main() {
+    srand(0);
+#if defined(MATHUTIL_SIMD_AVX)
+    printf("kernels: AVX\n");
+#elif defined(MATHUTIL_SIMD_SSE)
+    printf("kernels: SSE\n");
+#elif defined(MATHUTIL_SIMD_NEON)
+    printf("kernels: NEON\n");
+#else
+    printf("kernels: scalar\n");
+#endif
+
+//  Random affine transforms, kept well conditioned for the inverse
+    std::vector<Matrix<4, 4>> a(count), b(count), out(count);
+    std::vector<Vec<4>> v(count), vOut(count);
+    for (unsigned i = 0; i < count; i++) {
+        for (unsigned r = 0; r < 4; r++) {
+            for (unsigned c = 0; c < 4; c++) {
+                a[i](r, c) = RandomFloat(1, -1) + (r == c ? 3 : 0);
+                b[i](r, c) = RandomFloat(1, -1);
+            }
+            v[i](r) = RandomFloat(1, -1);
+        }
+        a[i](3, 0) = a[i](3, 1) = a[i](3, 2) = 0;
+        a[i](3, 3) = 1;
+    }
+
+    float checksumGeneric = 0, checksumSimd = 0;
+    double generic = timeOp([&](unsigned i) { out[i] = multiplyGeneric(a[i], b[i]); return out[i](1, 2); }, checksumGeneric);
+    double simd = timeOp([&](unsigned i) { out[i] = a[i] * b[i]; return out[i](1, 2); }, checksumSimd);
+    report("4x4 * 4x4", generic, simd, checksumGeneric, checksumSimd);
+
+//  object to screen transform of a draw: projection * view * object
+    checksumGeneric = checksumSimd = 0;
+    generic = timeOp([&](unsigned i) { out[i] = multiplyGeneric(multiplyGeneric(b[i], a[i]), a[(i + 1) % count]); return out[i](0, 3); }, checksumGeneric);
+    simd = timeOp([&](unsigned i) { out[i] = b[i] * a[i] * a[(i + 1) % count]; return out[i](0, 3); }, checksumSimd);
+    report("4x4 * 4x4 * 4x4", generic, simd, checksumGeneric, checksumSimd);
+
+    checksumGeneric = checksumSimd = 0;
+    generic = timeOp([&](unsigned i) { vOut[i] = multiplyGeneric(a[i], v[i]); return vOut[i](2); }, checksumGeneric);
+    simd = timeOp([&](unsigned i) { vOut[i] = a[i] * v[i]; return vOut[i](2); }, checksumSimd);
+    report("4x4 * vec4", generic, simd, checksumGeneric, checksumSimd);
+
+    checksumGeneric = checksumSimd = 0;
+    generic = timeOp([&](unsigned i) { out[i] = transposeGeneric(b[i]); return out[i](3, 1); }, checksumGeneric);
+    simd = timeOp([&](unsigned i) { out[i] = b[i].Transpose(); return out[i](3, 1); }, checksumSimd);
+    report("transpose", generic, simd, checksumGeneric, checksumSimd);
+
+    checksumGeneric = checksumSimd = 0;
+    generic = timeOp([&](unsigned i) { out[i] = affineInverseGeneric(a[i]); return out[i](0, 3); }, checksumGeneric);
+    simd = timeOp([&](unsigned i) { out[i] = a[i].AffineInverse(); return out[i](0, 3); }, checksumSimd);
+    report("affine inverse", generic, simd, checksumGeneric, checksumSimd);
+
+//  batches: the same products over every item, per item with the kernels above against structure of arrays batches
+    static const char* batch_labels[2] = { "per item", "batch" };
+    Mat4Arrays aSoA(a), bSoA(b), outSoA(out);
+    std::vector<float> points(3 * count), pointsOut(4 * count);
+    Vec3SoA pointsSoA = { points.data(), points.data() + count, points.data() + 2 * count };
+    Vec4SoA pointsOutSoA = { pointsOut.data(), pointsOut.data() + count, pointsOut.data() + 2 * count, pointsOut.data() + 3 * count };
+    for (unsigned i = 0; i < count; i++) {
+        pointsSoA.x[i] = v[i](0);
+        pointsSoA.y[i] = v[i](1);
+        pointsSoA.z[i] = v[i](2);
+    }
+
+    checksumGeneric = checksumSimd = 0;
+    generic = timeBatch([&]() { for (unsigned i = 0; i < count; i++) out[i] = a[i] * b[i]; checksumGeneric += out[count / 2](1, 2); });
+    simd = timeBatch([&]() { MultiplyBatch(aSoA.view, bSoA.view, outSoA.view, 0, count); checksumSimd += outSoA.element(count / 2, 9); });
+    report("batch a[i] * b[i]", generic, simd, checksumGeneric, checksumSimd, batch_labels);
+
+//  object to screen transforms of the draws of one camera
+    const Matrix<4, 4>& viewProj = b[0];
+    checksumGeneric = checksumSimd = 0;
+    generic = timeBatch([&]() { for (unsigned i = 0; i < count; i++) out[i] = viewProj * a[i]; checksumGeneric += out[count / 2](0, 3); });
+    simd = timeBatch([&]() { MultiplyBatch(viewProj, aSoA.view, outSoA.view, 0, count); checksumSimd += outSoA.element(count / 2, 12); });
+    report("batch m * a[i]", generic, simd, checksumGeneric, checksumSimd, batch_labels);
+
+    checksumGeneric = checksumSimd = 0;
+    generic = timeBatch([&]() { for (unsigned i = 0; i < count; i++) vOut[i] = viewProj * Vec<4>({ v[i](0), v[i](1), v[i](2), 1 }); checksumGeneric += vOut[count / 2](2); });
+    simd = timeBatch([&]() { TransformPointsBatch(viewProj, pointsSoA, pointsOutSoA, 0, count); checksumSimd += pointsOutSoA.z[count / 2]; });
+    report("batch m * point[i]", generic, simd, checksumGeneric, checksumSimd, batch_labels);
+
+//  per frame rotation of every object about its own axis, as matrices against quaternions
+    static const char* rotate_labels[2] = { "matrix", "quat" };
+    std::vector<Vec<3>> axes(count);
+    std::vector<Quat> orientations(count);
+    for (unsigned i = 0; i < count; i++) {
+        axes[i] = Vec<3>({ v[i](0), v[i](1), v[i](2) + 2 }).Normalized();
+        out[i] = GetIdentity<4>();
+    }
+    checksumGeneric = checksumSimd = 0;
+    generic = timeOp([&](unsigned i) { rotateGeneric(out[i], axes[i], 0.01f); return out[i](0, 1); }, checksumGeneric);
+    simd = timeOp([&](unsigned i) {
+        orientations[i] = Quat::FromAxisAngle(axes[i], 0.01f) * orientations[i];
+        orientations[i].Normalize();
+        return orientations[i](2);
+    }, checksumSimd);
+    report("rotate", generic, simd, checksumGeneric, checksumSimd, rotate_labels);
+
+    float matrixError = 0, quatError = 0;
+    for (unsigned i = 0; i < count; i++) {
+        Matrix<3, 3> rotation;
+        for (unsigned r = 0; r < 3; r++) {
+            for (unsigned c = 0; c < 3; c++) {
+                rotation(r, c) = out[i](r, c);
+            }
+        }
+        matrixError = std::max(matrixError, orthonormalError(rotation));
+        quatError = std::max(quatError, orthonormalError(orientations[i].GetRotationMatrix()));
+    }
+    printf("%-20s after %u rotations: matrix %.3g, quat %.3g\n", "orthonormal error", trials * reps, matrixError, quatError);
+    return 0;
+}
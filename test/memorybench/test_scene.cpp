@@ -0,0 +1,141 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "matrix.h"
+#include "renderer.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Device memory benchmark: loads nMesh icospheres of random sizes, static and dynamic, unloads every other one,
+// loads them again into the freed space and finally unloads all of them, drawing a few frames in between. Reports
+// the time per load and the allocator's blocks, used bytes and fragmentation after each step, and checks that the
+// allocations and bytes in use are back to where they were before the meshes were loaded.
+// Returns nonzero if they are not
+
+static constexpr unsigned nMesh = 256;
+
+float RandomFloat(float max, float min) {
+    return ((max - min) * rand()) / (float)(RAND_MAX)+min;
+}
+
+static void printStats(const char* step, const MemoryStats& stats) {
+    printf("%-24s %5u allocations, %8.2f MiB used, %8.2f MiB reserved in %u blocks + %u dedicated, fragmentation %.3f\n",
+        step, stats.allocationCount, stats.usedBytes / 1048576.0, stats.reservedBytes / 1048576.0, stats.blockCount,
+        stats.dedicatedCount, stats.fragmentation);
+}
+
+// draws the cube for frames frames, meshes unloaded before are destroyed once no frame in flight uses them
+static bool drawFrames(Renderer& renderer, const WorldObject& cube, Camera& camera, unsigned frames) {
+    for (unsigned f = 0; f < frames; f++) {
+        if (renderer.DrawObject(cube, camera, PIPELINE_UNSHADED) == false || renderer.PresentFrame() == false) {
+            printf("failed to render frame\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+// loads the meshes whose index is a multiple of step, returns the average milliseconds per load
+static double loadMeshes(std::vector<Mesh>& meshes, const std::vector<bool>& dynamic, unsigned step) {
+    auto start = steady_clock::now();
+    unsigned loaded = 0;
+    for (unsigned i = 0; i < meshes.size(); i += step) {
+        if (meshes[i].LoadMesh(dynamic[i]) == false) {
+            printf("failed to load mesh to the GPU\n");
+            return -1;
+        }
+        loaded++;
+    }
+    return duration<double, std::milli>(steady_clock::now() - start).count() / loaded;
+}
+
+static bool unloadMeshes(std::vector<Mesh>& meshes, unsigned step) {
+    for (unsigned i = 0; i < meshes.size(); i += step) {
+        if (meshes[i].UnloadMesh() == false) {
+            printf("failed to unload mesh\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    srand(0);
+
+    Renderer renderer;
+    if (renderer.InitializeOffscreen(64, 64) == false) {
+        printf("failed to initialize renderer\n");
+        return -1;
+    }
+    unsigned framesInFlight = renderer.GetFrameStats().framesInFlight;
+
+    Camera camera({ 0, 0, 64, 64 });
+    camera.Move(Vec<3>({ 0, 0, -30 }));
+    Mesh cubeMesh = Mesh::Cube(renderer);
+    if (cubeMesh.LoadMesh() == false) {
+        printf("failed to load mesh to the GPU\n");
+        return -1;
+    }
+    WorldObject cube(cubeMesh);
+
+//  the frame resources are created by the first frames, the meshes are measured against the memory in use after them
+    if (drawFrames(renderer, cube, camera, framesInFlight + 1) == false) {
+        return -1;
+    }
+    MemoryStats baseline = renderer.GetMemoryStats();
+    printStats("before loading", baseline);
+
+    std::vector<Mesh> meshes;
+    std::vector<bool> dynamic;
+    for (unsigned i = 0; i < nMesh; i++) {
+        meshes.push_back(Mesh::Icosphere(renderer, rand() % 5));
+        dynamic.push_back(RandomFloat(1, 0) < 0.25f);
+    }
+
+    double loadTime = loadMeshes(meshes, dynamic, 1);
+    if (loadTime < 0 || drawFrames(renderer, cube, camera, framesInFlight + 1) == false) {
+        return -1;
+    }
+    printf("%-24s %8.3f ms per mesh\n", "load", loadTime);
+    printStats("loaded", renderer.GetMemoryStats());
+
+//  the freed ranges are scattered between the meshes still loaded until the reload fills them again
+    if (unloadMeshes(meshes, 2) == false || drawFrames(renderer, cube, camera, framesInFlight + 1) == false) {
+        return -1;
+    }
+    printStats("every other unloaded", renderer.GetMemoryStats());
+
+    double reloadTime = loadMeshes(meshes, dynamic, 2);
+    if (reloadTime < 0 || drawFrames(renderer, cube, camera, framesInFlight + 1) == false) {
+        return -1;
+    }
+    printf("%-24s %8.3f ms per mesh\n", "reload", reloadTime);
+    printStats("reloaded", renderer.GetMemoryStats());
+
+    if (unloadMeshes(meshes, 1) == false || drawFrames(renderer, cube, camera, framesInFlight + 1) == false) {
+        return -1;
+    }
+    MemoryStats unloaded = renderer.GetMemoryStats();
+    printStats("all unloaded", unloaded);
+
+    int result = 0;
+    if (unloaded.allocationCount != baseline.allocationCount || unloaded.usedBytes != baseline.usedBytes) {
+        printf("allocations and frees don't balance: %d allocations and %lld bytes left\n",
+            (int)unloaded.allocationCount - (int)baseline.allocationCount, (long long)(unloaded.usedBytes - baseline.usedBytes));
+        result = -1;
+    }
+    else {
+        printf("allocations and frees balance\n");
+    }
+
+    if (renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return -1;
+    }
+    return result;
+}
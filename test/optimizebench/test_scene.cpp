@@ -0,0 +1,198 @@
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <math.h>
+#include <string>
+#include <vector>
+#include "matrix.h"
+#include "renderer.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Mesh optimization benchmark: runs Mesh::Optimize on icospheres in their generated triangle order and shuffled,
+// each with a triangle's indices appended past the mesh's index count. Reports the ACMR and ATVR before and after
+// and the time taken, and checks that
+// - the reported ACMR before and after match a FIFO cache simulated on the index buffers here
+// - the ACMR improves and the mesh still has the same triangles, wound the same way
+// - the indices past the index count still reference the same vertices after they were renumbered
+// - the optimized mesh reads back identical to the original one
+// Returns nonzero if a check fails
+
+static constexpr unsigned width = 256, height = 256;
+static constexpr unsigned cacheSize = 16;
+
+struct BenchConfig {
+    std::string name;
+    unsigned subdivisions;
+    bool shuffle;
+};
+
+// misses per triangle of a FIFO cache of cacheSize vertices
+static float simulateACMR(const std::vector<unsigned>& indices, unsigned count) {
+    std::deque<unsigned> cache;
+    unsigned misses = 0;
+    for (unsigned i = 0; i < count; i++) {
+        if (std::find(cache.begin(), cache.end(), indices[i]) == cache.end()) {
+            misses++;
+            cache.push_back(indices[i]);
+            if (cache.size() > cacheSize) {
+                cache.pop_front();
+            }
+        }
+    }
+    return (float)misses / (count / 3);
+}
+
+// the positions of every triangle, rotated to start at its lowest vertex so the winding is kept, sorted
+static std::vector<std::array<float, 9>> triangleSet(const Mesh& mesh) {
+    const auto& indices = mesh.GetIndexBuffer();
+    const auto& verts = mesh.GetVertices();
+    std::vector<std::array<float, 9>> triangles;
+    for (unsigned t = 0; t < mesh.GetNumIndices() / 3; t++) {
+        std::array<std::array<float, 3>, 3> corners;
+        for (unsigned c = 0; c < 3; c++) {
+            const Vec<4>& v = verts[indices[t * 3 + c]];
+            corners[c] = { v(0), v(1), v(2) };
+        }
+        std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end()), corners.end());
+        std::array<float, 9> triangle;
+        for (unsigned c = 0; c < 9; c++) {
+            triangle[c] = corners[c / 3][c % 3];
+        }
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+static bool readFrame(Renderer& renderer, Mesh& mesh, std::vector<uint8_t>& image) {
+    if (mesh.LoadMesh() == false) {
+        printf("failed to load mesh to the GPU\n");
+        return false;
+    }
+    Camera camera({ 0, 0, width, height });
+    camera.Move(Vec<3>({ 0, 0, -30 }));
+    WorldObject obj(mesh);
+    obj.SetScale(8, 8, 8);
+    obj.GetMaterial().colour = Vec<4>({ 0.8f, 0.6f, 0.4f, 1 });
+
+    std::atomic<bool> done(false);
+    renderer.RequestFrameReadback([&](const FrameReadbackData& data) {
+        image.assign(data.data, data.data + data.height * data.rowPitch);
+        done = true;
+    });
+    // the callback runs once the GPU finished the frame, which the renderer notices while drawing the next ones
+    while (done == false) {
+        if (renderer.DrawObject(obj, camera, PIPELINE_SHADED) == false || renderer.PresentFrame() == false) {
+            printf("failed to render frame\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool run(Renderer& renderer, const BenchConfig& bench) {
+    Mesh sphere = Mesh::Icosphere(renderer, bench.subdivisions);
+    std::vector<unsigned> indices = sphere.GetIndexBuffer();
+    unsigned numIndices = sphere.GetNumIndices();
+    if (bench.shuffle) {
+        std::vector<unsigned> order(numIndices / 3);
+        for (unsigned t = 0; t < order.size(); t++) {
+            order[t] = t;
+        }
+        for (unsigned t = 0; t + 1 < order.size(); t++) {
+            std::swap(order[t], order[t + rand() % (order.size() - t)]);
+        }
+        std::vector<unsigned> shuffled;
+        for (unsigned t : order) {
+            shuffled.insert(shuffled.end(), indices.begin() + t * 3, indices.begin() + t * 3 + 3);
+        }
+        indices = shuffled;
+    }
+    // not drawn or optimized, but renumbered with the vertices
+    std::vector<unsigned> tail = { indices[numIndices - 1], 0, sphere.GetNumVertices() - 1 };
+    indices.insert(indices.end(), tail.begin(), tail.end());
+
+    std::vector<Mesh> meshes;
+    for (unsigned i = 0; i < 2; i++) {
+        meshes.push_back(Mesh(renderer, sphere.GetNumVertices(), numIndices));
+        meshes.back().SetVertices(sphere.GetVertices());
+        meshes.back().SetVertexNormals(sphere.GetVertexNormals());
+        meshes.back().SetIndexBuffer(indices);
+    }
+    Mesh& original = meshes[0];
+    Mesh& optimized = meshes[1];
+
+    MeshOptimizationStats stats;
+    auto start = steady_clock::now();
+    if (optimized.Optimize(stats, cacheSize) == false) {
+        printf("failed to optimize mesh\n");
+        return false;
+    }
+    double optimizeTime = duration<double, std::milli>(steady_clock::now() - start).count();
+
+    float acmrBefore = simulateACMR(original.GetIndexBuffer(), numIndices);
+    float acmrAfter = simulateACMR(optimized.GetIndexBuffer(), numIndices);
+    bool statsCorrect = fabsf(acmrBefore - stats.acmrBefore) < 1e-4f && fabsf(acmrAfter - stats.acmrAfter) < 1e-4f;
+    bool improved = stats.acmrAfter < stats.acmrBefore && stats.atvrAfter < stats.atvrBefore;
+    bool trianglesKept = triangleSet(original) == triangleSet(optimized);
+    bool tailKept = optimized.GetIndexBuffer().size() == indices.size();
+    for (unsigned i = 0; i < tail.size() && tailKept; i++) {
+        const Vec<4>& before = original.GetVertices()[tail[i]];
+        const Vec<4>& after = optimized.GetVertices()[optimized.GetIndexBuffer()[numIndices + i]];
+        tailKept = before(0) == after(0) && before(1) == after(1) && before(2) == after(2);
+    }
+
+    std::vector<uint8_t> originalImage, optimizedImage;
+    if (readFrame(renderer, original, originalImage) == false || readFrame(renderer, optimized, optimizedImage) == false) {
+        return false;
+    }
+    // an image of nothing but the clear colour would match trivially
+    bool drawn = false;
+    for (size_t i = 4; i < originalImage.size() && drawn == false; i++) {
+        drawn = originalImage[i] != originalImage[i % 4];
+    }
+    bool imageCorrect = drawn && originalImage == optimizedImage;
+
+    printf("%-24s %6u triangles, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, %8.3f ms, %s, %s, %s, %s\n", bench.name.c_str(),
+        numIndices / 3, stats.acmrBefore, stats.acmrAfter, stats.atvrBefore, stats.atvrAfter, optimizeTime,
+        statsCorrect ? (improved ? "stats correct" : "NOT IMPROVED") : "STATS WRONG",
+        trianglesKept ? "triangles kept" : "TRIANGLES CHANGED", tailKept ? "tail remapped" : "TAIL WRONG",
+        imageCorrect ? "image matches" : "IMAGE DIFFERS");
+    return statsCorrect && improved && trianglesKept && tailKept && imageCorrect;
+}
+
+int main() {
+    srand(0);
+
+    Renderer renderer;
+    if (renderer.InitializeOffscreen(width, height, IMAGE_FORMAT_R8G8B8A8_UNORM) == false) {
+        printf("failed to initialize renderer\n");
+        return -1;
+    }
+
+    std::vector<BenchConfig> configs = {
+        { "icosphere 3", 3, false },
+        { "icosphere 5", 5, false },
+        { "icosphere 5 shuffled", 5, true },
+    };
+    int result = 0;
+    for (const BenchConfig& bench : configs) {
+        if (run(renderer, bench) == false) {
+            result = -1;
+        }
+    }
+
+    if (renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return -1;
+    }
+    return result;
+}
@@ -0,0 +1,162 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "matrix.h"
+#include "renderer.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Parallel recording benchmark: draws a grid of nObj cubes offscreen, once recorded on the main thread with
+// Renderer::DrawObject and then split across 2, 4 and 8 threads with BeginParallelDraw. Reports the CPU time of
+// drawing, recording and submitting a frame without the waits for its frame slot, and checks that every parallel
+// frame reads back identical to the single threaded one. Returns nonzero if an image differs
+
+static constexpr unsigned width = 512, height = 512;
+static constexpr unsigned gridSize = 100;
+static constexpr unsigned nObj = gridSize * gridSize;
+static constexpr unsigned frames = 10;
+
+// draws frames frames, the draws of each recorded by draw(), and reads back the last one. frameTime is set to the
+// average milliseconds spent in draw() and PresentFrame per frame minus the fence waits
+template<typename Draw>
+static bool renderFrames(Renderer& renderer, Draw draw, std::vector<uint8_t>& image, double& frameTime) {
+    renderer.ResetFrameStats();
+    std::atomic<bool> done(false);
+    frameTime = 0;
+    for (unsigned f = 0; f < frames; f++) {
+        if (f == frames - 1) {
+            renderer.RequestFrameReadback([&](const FrameReadbackData& data) {
+                image.resize(data.height * data.rowPitch);
+                std::copy(data.data, data.data + image.size(), image.begin());
+                done = true;
+            });
+        }
+        auto start = steady_clock::now();
+        if (draw() == false || renderer.PresentFrame() == false) {
+            return false;
+        }
+        // the stats don't count the fence wait of the first frame, so it isn't timed either
+        if (f > 0) {
+            frameTime += duration<double, std::milli>(steady_clock::now() - start).count();
+        }
+    }
+    FrameStats stats = renderer.GetFrameStats();
+    frameTime = (frameTime - stats.fenceWaitTime * stats.frameCount) / (frames - 1);
+
+    // the callback runs once the GPU finished the frame, which the renderer notices while drawing the next ones
+    while (done == false) {
+        if (draw() == false || renderer.PresentFrame() == false) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    Renderer renderer;
+    if (renderer.InitializeOffscreen(width, height, IMAGE_FORMAT_R8G8B8A8_UNORM) == false) {
+        printf("failed to initialize renderer\n");
+        return -1;
+    }
+
+    Camera camera({ 0, 0, width, height });
+    camera.Move(Vec<3>({ 0, 0, -80 }));
+
+    Mesh cubeMesh = Mesh::Cube(renderer);
+    if (cubeMesh.LoadMesh() == false) {
+        printf("failed to load mesh to the GPU\n");
+        return -1;
+    }
+//  a grid of cubes that don't overlap, so the image doesn't depend on the order of the draws
+    std::vector<WorldObject> objList(nObj);
+    for (unsigned i = 0; i < nObj; i++) {
+        objList[i] = WorldObject(cubeMesh);
+        objList[i].SetPosition(Vec<3>({ ((float)(i % gridSize) - gridSize / 2.0f) * 1.2f, ((float)(i / gridSize) - gridSize / 2.0f) * 1.2f, 0 }));
+        objList[i].Rotate(Vec<3>({ 1, 1, 0 }), i * 0.01f);
+        objList[i].SetScale(0.4f, 0.4f, 0.4f);
+        objList[i].GetMaterial().colour = Vec<4>({ (i % 3) / 2.0f, (i % 5) / 4.0f, (i % 11) / 10.0f, 1 });
+    }
+
+    std::vector<uint8_t> reference;
+    double single;
+    bool rendered = renderFrames(renderer, [&]() {
+        for (const auto& obj : objList) {
+            if (renderer.DrawObject(obj, camera, PIPELINE_SHADED) == false) {
+                return false;
+            }
+        }
+        return true;
+    }, reference, single);
+    if (rendered == false) {
+        printf("failed to render frame\n");
+        return -1;
+    }
+//  an image of nothing but the clear colour would match trivially
+    bool drawn = false;
+    for (size_t i = 4; i < reference.size() && drawn == false; i++) {
+        drawn = reference[i] != reference[i % 4];
+    }
+    if (drawn == false) {
+        printf("nothing drawn\n");
+        return -1;
+    }
+    printf("%u cores, %u draws, 1 thread:  %8.3f ms/frame\n", std::thread::hardware_concurrency(), nObj, single);
+
+    int result = 0;
+    for (unsigned threadCount : { 2u, 4u, 8u }) {
+        std::vector<uint8_t> image;
+        double parallel;
+        rendered = renderFrames(renderer, [&]() {
+            std::vector<Renderer::DrawContext> contexts = renderer.BeginParallelDraw(threadCount);
+            std::vector<std::thread> threads;
+            std::atomic<bool> ok(true);
+            for (unsigned t = 0; t < threadCount; t++) {
+                threads.emplace_back([&, t]() {
+                    // the camera's matrices are updated lazily, every thread uses its own copy
+                    Camera threadCamera = camera;
+                    for (unsigned i = t * nObj / threadCount; i < (t + 1) * nObj / threadCount; i++) {
+                        if (contexts[t].DrawObject(objList[i], threadCamera, PIPELINE_SHADED) == false) {
+                            ok = false;
+                        }
+                    }
+                    if (contexts[t].End() == false) {
+                        ok = false;
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            return ok.load();
+        }, image, parallel);
+        if (rendered == false) {
+            printf("failed to render frame\n");
+            return false;
+        }
+
+        unsigned differing = 0;
+        for (size_t i = 0; i < image.size() && i < reference.size(); i++) {
+            differing += image[i] != reference[i];
+        }
+        bool match = image.size() == reference.size() && differing == 0;
+        printf("%u cores, %u draws, %u threads: %8.3f ms/frame, speedup %5.2fx, %s\n", std::thread::hardware_concurrency(), nObj, threadCount, parallel, single / parallel,
+            match ? "image matches" : "IMAGE DIFFERS");
+        if (match == false) {
+            printf("%u of %zu bytes differ\n", differing, reference.size());
+            result = -1;
+        }
+    }
+
+    if (renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return -1;
+    }
+    return result;
+}
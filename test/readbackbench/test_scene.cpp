@@ -0,0 +1,166 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <mutex>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "matrix.h"
+#include "renderer.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Frame readback benchmark: renders a cube of a known colour offscreen in every colour format and requests a
+// readback of every frame. Checks that each read back frame holds the clear colour (opaque black) in its corner
+// and the cube's colour in its centre, converted to the format, and reports the requests the ring had to skip and
+// the time from the request to the callback. Returns nonzero if a pixel is wrong or a callback is missing
+
+static constexpr unsigned width = 256, height = 256;
+static constexpr unsigned frames = 60;
+
+struct FormatInfo {
+    std::string name;
+    ImageFormat format;
+    // bytes per channel, 1 for the 8 bit formats
+    unsigned channelSize;
+    bool bgra;
+    bool srgb;
+};
+
+static float halfToFloat(uint16_t half) {
+    int exponent = (half >> 10) & 0x1f;
+    float mantissa = (float)(half & 0x3ff);
+    float value = exponent == 0 ? ldexpf(mantissa, -24) : ldexpf(mantissa + 1024, exponent - 25);
+    return half & 0x8000 ? -value : value;
+}
+
+static float linearToSrgb(float c) {
+    return c <= 0.0031308f ? 12.92f * c : 1.055f * powf(c, 1 / 2.4f) - 0.055f;
+}
+
+// the pixel at x, y as linear RGBA floats, 8 bit formats as stored (sRGB encoded for sRGB formats)
+static Vec<4> readPixel(const FormatInfo& info, const FrameReadbackData& data, unsigned x, unsigned y) {
+    const uint8_t* pixel = data.data + y * data.rowPitch + x * 4 * info.channelSize;
+    Vec<4> result;
+    for (unsigned c = 0; c < 4; c++) {
+        unsigned channel = info.bgra && c < 3 ? 2 - c : c;
+        const uint8_t* p = pixel + channel * info.channelSize;
+        if (info.channelSize == 1) {
+            result(c) = *p / 255.0f;
+        }
+        else if (info.channelSize == 2) {
+            uint16_t half;
+            memcpy(&half, p, sizeof(half));
+            result(c) = halfToFloat(half);
+        }
+        else {
+            memcpy(&result(c), p, sizeof(float));
+        }
+    }
+    return result;
+}
+
+static bool pixelMatches(const Vec<4>& pixel, const Vec<4>& expected, float tolerance) {
+    for (unsigned c = 0; c < 4; c++) {
+        if (fabsf(pixel(c) - expected(c)) > tolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool runFormat(const FormatInfo& info) {
+    Renderer renderer;
+    if (renderer.InitializeOffscreen(width, height, info.format) == false) {
+        printf("failed to initialize renderer\n");
+        return false;
+    }
+
+    Camera camera({ 0, 0, width, height });
+    camera.Move(Vec<3>({ 0, 0, -30 }));
+
+    Mesh cubeMesh = Mesh::Cube(renderer);
+    if (cubeMesh.LoadMesh() == false) {
+        printf("failed to load mesh to the GPU\n");
+        return false;
+    }
+    WorldObject cube(cubeMesh);
+    cube.GetMaterial().colour = Vec<4>({ 0.25f, 0.5f, 0.75f, 1 });
+
+//  the colours the unlit pipeline writes, 8 bit channels are off by at most one step
+    Vec<4> clear({ 0, 0, 0, 1 });
+    Vec<4> colour = cube.GetMaterial().colour;
+    if (info.srgb) {
+        for (unsigned c = 0; c < 3; c++) {
+            colour(c) = linearToSrgb(colour(c));
+        }
+    }
+    float tolerance = info.channelSize == 1 ? 1.5f / 255 : 1e-3f;
+
+    std::mutex mutex;
+    unsigned callbacks = 0, wrongFrames = 0;
+    double latency = 0;
+    unsigned requested = 0;
+    for (unsigned f = 0; f < frames; f++) {
+        auto requestTime = steady_clock::now();
+        bool accepted = renderer.RequestFrameReadback([&, requestTime](const FrameReadbackData& data) {
+            bool correct = data.width == width && data.height == height && data.format == info.format &&
+                pixelMatches(readPixel(info, data, 0, 0), clear, tolerance) &&
+                pixelMatches(readPixel(info, data, width / 2, height / 2), colour, tolerance);
+            std::lock_guard<std::mutex> lock(mutex);
+            callbacks++;
+            wrongFrames += correct ? 0 : 1;
+            latency += duration<double, std::milli>(steady_clock::now() - requestTime).count();
+        });
+        requested += accepted ? 1 : 0;
+
+        if (renderer.DrawObject(cube, camera, PIPELINE_UNSHADED) == false) {
+            printf("failed to draw object\n");
+            return false;
+        }
+        if (renderer.PresentFrame() == false) {
+            printf("present frame failed\n");
+            return false;
+        }
+    }
+
+//  cleanup waits for the callbacks of all frames read back
+    if (renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return false;
+    }
+
+    bool passed = callbacks == requested && wrongFrames == 0 && callbacks > 0;
+    printf("%-24s %2u of %u frames read back, %u skipped, latency %6.3f ms, %s\n", info.name.c_str(), callbacks, frames,
+        frames - requested, callbacks ? latency / callbacks : 0.0, passed ? "pixels match" : "PIXELS DIFFER");
+    if (callbacks != requested) {
+        printf("%u requests accepted but %u callbacks ran\n", requested, callbacks);
+    }
+    if (wrongFrames) {
+        printf("%u frames read back wrong pixels\n", wrongFrames);
+    }
+    return passed;
+}
+
+int main() {
+    std::vector<FormatInfo> formats = {
+        { "R8G8B8A8_UNORM", IMAGE_FORMAT_R8G8B8A8_UNORM, 1, false, false },
+        { "R8G8B8A8_SRGB", IMAGE_FORMAT_R8G8B8A8_SRGB, 1, false, true },
+        { "B8G8R8A8_UNORM", IMAGE_FORMAT_B8G8R8A8_UNORM, 1, true, false },
+        { "B8G8R8A8_SRGB", IMAGE_FORMAT_B8G8R8A8_SRGB, 1, true, true },
+        { "R16G16B16A16_SFLOAT", IMAGE_FORMAT_R16G16B16A16_SFLOAT, 2, false, false },
+        { "R32G32B32A32_SFLOAT", IMAGE_FORMAT_R32G32B32A32_SFLOAT, 4, false, false },
+    };
+    int result = 0;
+    for (const FormatInfo& info : formats) {
+        if (runFormat(info) == false) {
+            result = -1;
+        }
+    }
+    return result;
+}
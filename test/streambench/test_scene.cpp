@@ -0,0 +1,192 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <string>
+#include <vector>
+#include "matrix.h"
+#include "renderer.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Vertex stream benchmark: a dynamically loaded sphere with positions, normals and a custom float4 attribute has
+// its positions rewritten every frame through Mesh::MapDynamicRange with VERTEX_ATTRIBUTE_POSITION only, stored
+// interleaved, as split streams and as split streams with static normals and custom data. Reports the time per
+// update and FrameStats::dynamicBytes, and checks that
+// - only the position view is mapped
+// - the bytes written and copied forward per frame are the position stream's alone with split streams, the
+//   normal and custom streams are never rewritten
+// - the last frame reads back identical to the same positions loaded statically
+// Returns nonzero if a check fails
+
+static constexpr unsigned width = 256, height = 256;
+static constexpr unsigned frames = 30;
+static constexpr unsigned customSlot = 2;
+
+struct BenchConfig {
+    std::string name;
+    bool splitStreams;
+    bool dynamicNormals;
+};
+
+static bool readFrame(Renderer& renderer, const WorldObject& obj, Camera& camera, unsigned pipeline, std::vector<uint8_t>& image) {
+    std::atomic<bool> done(false);
+    renderer.RequestFrameReadback([&](const FrameReadbackData& data) {
+        image.assign(data.data, data.data + data.height * data.rowPitch);
+        done = true;
+    });
+    // the callback runs once the GPU finished the frame, which the renderer notices while drawing the next ones
+    while (done == false) {
+        if (renderer.DrawObject(obj, camera, pipeline) == false || renderer.PresentFrame() == false) {
+            printf("failed to render frame\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+static Vec<4> wobble(const Vec<4>& position, unsigned vertex, unsigned frame) {
+    float scale = 1 + 0.1f * sinf(0.3f * frame + 0.05f * vertex);
+    return Vec<4>({ position(0) * scale, position(1) * scale, position(2) * scale, position(3) });
+}
+
+static bool run(Renderer& renderer, const BenchConfig& bench, const Mesh& sphere) {
+    PipelineConfig config;
+    config.useDefaultVertData = false;
+    config.vertDataLayout.splitStreams = bench.splitStreams;
+    config.vertDataLayout.vertNormBufferDynamic = bench.dynamicNormals;
+    config.vertDataLayout.customVertInputLayouts = { { customSlot, GLSL_FLOAT, 4, bench.dynamicNormals } };
+    unsigned pipeline;
+    if (renderer.CreateCustomPipeline(config, pipeline) == false) {
+        printf("failed to create pipeline\n");
+        return false;
+    }
+
+//  the custom attribute isn't read by the default shaders, it only takes up a stream
+    unsigned numVerts = sphere.GetNumVertices();
+    Mesh mesh(renderer, config.vertDataLayout, numVerts, sphere.GetNumIndices());
+    mesh.SetVertices(sphere.GetVertices());
+    mesh.SetVertexNormals(sphere.GetVertexNormals());
+    mesh.SetIndexBuffer(sphere.GetIndexBuffer());
+    mesh.SetCustomVertexDataBuffer(customSlot, std::vector<float>(4 * numVerts, 1.0f));
+    if (mesh.LoadMesh(true) == false) {
+        printf("failed to load mesh to the GPU\n");
+        return false;
+    }
+
+    Camera camera({ 0, 0, width, height });
+    camera.Move(Vec<3>({ 0, 0, -30 }));
+    WorldObject obj(mesh);
+    obj.SetScale(8, 8, 8);
+    obj.GetMaterial().colour = Vec<4>({ 0.8f, 0.6f, 0.4f, 1 });
+
+//  every copy of the dynamic data is written once before the measured frames, so each switch copies a whole frame's
+//  writes forward
+    unsigned framesInFlight = renderer.GetFrameStats().framesInFlight;
+    bool viewsCorrect = true;
+    double updateTime = 0;
+    unsigned frame = 0;
+    for (; frame < frames + framesInFlight + 1; frame++) {
+        if (frame == framesInFlight + 1) {
+            renderer.ResetFrameStats();
+            updateTime = 0;
+        }
+        auto start = steady_clock::now();
+        DynamicVertexRange range;
+        if (mesh.MapDynamicRange(0, numVerts, range, VERTEX_ATTRIBUTE_POSITION) == false) {
+            printf("failed to map vertex range\n");
+            return false;
+        }
+        viewsCorrect = viewsCorrect && range.positions.IsValid() && range.normals.IsValid() == false &&
+            range.customData.size() == 1 && range.customData[0].IsValid() == false;
+        if (range.positions.IsValid()) {
+            for (unsigned i = 0; i < numVerts; i++) {
+                range.positions.Set(i, wobble(sphere.GetVertices()[i], i, frame));
+            }
+        }
+        if (mesh.UnmapDynamicRange() == false) {
+            printf("failed to unmap vertex range\n");
+            return false;
+        }
+        updateTime += duration<double, std::milli>(steady_clock::now() - start).count();
+
+        if (renderer.DrawObject(obj, camera, pipeline) == false || renderer.PresentFrame() == false) {
+            printf("failed to render frame\n");
+            return false;
+        }
+    }
+    FrameStats stats = renderer.GetFrameStats();
+
+    std::vector<uint8_t> image;
+    if (readFrame(renderer, obj, camera, pipeline, image) == false) {
+        return false;
+    }
+
+//  the last positions written, loaded statically with the same layout
+    std::vector<Vec<4>> positions(numVerts);
+    for (unsigned i = 0; i < numVerts; i++) {
+        positions[i] = wobble(sphere.GetVertices()[i], i, frame - 1);
+    }
+    Mesh reference(renderer, config.vertDataLayout, numVerts, sphere.GetNumIndices());
+    reference.SetVertices(positions);
+    reference.SetVertexNormals(sphere.GetVertexNormals());
+    reference.SetIndexBuffer(sphere.GetIndexBuffer());
+    reference.SetCustomVertexDataBuffer(customSlot, std::vector<float>(4 * numVerts, 1.0f));
+    if (reference.LoadMesh() == false) {
+        printf("failed to load mesh to the GPU\n");
+        return false;
+    }
+    WorldObject referenceObj(reference);
+    referenceObj.SetScale(8, 8, 8);
+    referenceObj.GetMaterial().colour = obj.GetMaterial().colour;
+    std::vector<uint8_t> referenceImage;
+    if (readFrame(renderer, referenceObj, camera, pipeline, referenceImage) == false) {
+        return false;
+    }
+
+//  each update flushes the positions and the next one copies them forward to the copy it switches to
+    double stride = sizeof(Vec<4>) + (bench.splitStreams ? 0 : sizeof(Vec<3>) + 4 * sizeof(float));
+    double expectedBytes = 2 * stride * numVerts;
+    bool bytesCorrect = stats.dynamicBytes == expectedBytes;
+    // an image of nothing but the clear colour would match trivially
+    bool drawn = false;
+    for (size_t i = 4; i < image.size() && drawn == false; i++) {
+        drawn = image[i] != image[i % 4];
+    }
+    bool imageCorrect = drawn && image == referenceImage;
+    printf("%-28s update %7.3f ms, %9.0f bytes written per frame (%9.0f expected), %s, %s, %s\n", bench.name.c_str(),
+        updateTime / frames, stats.dynamicBytes, expectedBytes, viewsCorrect ? "views correct" : "VIEWS WRONG",
+        bytesCorrect ? "bytes correct" : "BYTES WRONG", imageCorrect ? "image matches" : "IMAGE DIFFERS");
+    return viewsCorrect && bytesCorrect && imageCorrect;
+}
+
+int main() {
+    Renderer renderer;
+    if (renderer.InitializeOffscreen(width, height, IMAGE_FORMAT_R8G8B8A8_UNORM) == false) {
+        printf("failed to initialize renderer\n");
+        return -1;
+    }
+    Mesh sphere = Mesh::Icosphere(renderer, 5);
+
+    std::vector<BenchConfig> configs = {
+        { "interleaved", false, true },
+        { "split streams", true, true },
+        { "split streams, static rest", true, false },
+    };
+    int result = 0;
+    for (const BenchConfig& bench : configs) {
+        if (run(renderer, bench, sphere) == false) {
+            result = -1;
+        }
+    }
+
+    if (renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return -1;
+    }
+    return result;
+}
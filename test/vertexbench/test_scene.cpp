@@ -0,0 +1,180 @@
+#include <iostream>
+#include <chrono>
+#include <math.h>
+#include <string>
+#include <vector>
+#include "matrix.h"
+#include "window.h"
+#include "renderer.h"
+
+
+using namespace std::chrono;
+
+using namespace RenderingFramework3D;
+using namespace MathUtil;
+
+// Vertex fetch benchmark: draws nObj small, densely tessellated spheres per frame with lit default shaders
+// and alternates between vertex storage formats every n frames, reporting the bytes per vertex, the indexed
+// vertices per second of GPU time and the vertex data fetched at least. With --offscreen it renders without
+// a window and exits after one round of all formats
+
+static int renderer_test(bool offscreen);
+
+int main(int argc, char** argv) {
+    bool offscreen = argc > 1 && std::string(argv[1]) == "--offscreen";
+    return renderer_test(offscreen);
+}
+
+void random_init() {
+    srand(0);
+}
+
+float RandomFloat(float max, float min) {
+    return ((max - min) * rand()) / (float)(RAND_MAX)+min;
+}
+
+struct BenchConfig {
+    std::string name;
+    VertexPositionFormat vertFormat;
+    VertexNormalFormat vertNormFormat;
+    unsigned pipeline;
+};
+
+static int renderer_test(bool offscreen) {
+    unsigned windowWidth=1000, windowHeight=800;
+
+    random_init();
+
+//  Create Window
+    Window wnd;
+    if(offscreen == false && wnd.Initialize(false, windowWidth, windowHeight , "Vertex Format Benchmark") == false) {
+        printf("failed to initialize window\n");
+        return -1;
+    }
+
+//  Create Renderer
+    Renderer renderer;
+    bool rendererInit = offscreen ? renderer.InitializeOffscreen(windowWidth, windowHeight) : renderer.Initialize(wnd);
+    if(rendererInit==false) {
+        printf("failed to initialize renderer\n");
+        return -1;
+    }
+
+//  Source geometry, copied into one mesh per benchmarked vertex format
+    Mesh sphere = Mesh::Icosphere(renderer, 5);
+
+    std::vector<BenchConfig> configs = {
+        { "float4 / float3", VERTEX_POSITION_FLOAT4, VERTEX_NORMAL_FLOAT3, 0 },
+        { "float3 / float3", VERTEX_POSITION_FLOAT3, VERTEX_NORMAL_FLOAT3, 0 },
+        { "float3 / 10:10:10:2", VERTEX_POSITION_FLOAT3, VERTEX_NORMAL_UNORM10, 0 },
+        { "snorm16 / octahedral", VERTEX_POSITION_SNORM16, VERTEX_NORMAL_OCT16, 0 },
+        { "snorm16 / 10:10:10:2", VERTEX_POSITION_SNORM16, VERTEX_NORMAL_UNORM10, 0 },
+    };
+    std::vector<Mesh> meshes;
+    for (auto& bench : configs) {
+        PipelineConfig config;
+        config.useDefaultVertData = false;
+        config.vertDataLayout.vertFormat = bench.vertFormat;
+        config.vertDataLayout.vertNormFormat = bench.vertNormFormat;
+        config.uniformShaderInputLayout.ObjectInputs.useInstancing = true;
+        if (renderer.CreateCustomPipeline(config, bench.pipeline) == false) {
+            printf("failed to create pipeline\n");
+            return -1;
+        }
+
+        meshes.push_back(Mesh(renderer, config.vertDataLayout, sphere.GetNumVertices(), sphere.GetNumIndices()));
+        meshes.back().SetVertices(sphere.GetVertices());
+        meshes.back().SetVertexNormals(sphere.GetVertexNormals());
+        meshes.back().SetIndexBuffer(sphere.GetIndexBuffer());
+        if (meshes.back().LoadMesh() == false) {
+            printf("failed to load mesh to the GPU\n");
+            return -1;
+        }
+    }
+
+//  Create Camera
+    Camera mainCamera({ 0,0,windowWidth, windowHeight });
+    mainCamera.Move(Vec<3>({ 0, 0, -400 }));
+
+//  Initialize Objects, small on screen so the frame is bound by vertex processing rather than shading
+    static constexpr unsigned nObj = 500;
+    std::vector<WorldObject> objList(nObj);
+    for (auto& obj : objList) {
+        obj = WorldObject(meshes[0]);
+        obj.SetPosition(Vec<3>({ RandomFloat(150, -150), RandomFloat(150, -150), RandomFloat(150, -150) }));
+        obj.GetMaterial().colour = Vec<4>({ 0.8f, 0.6f, 0.3f, 1 });
+        obj.SetScale(2, 2, 2);
+    }
+
+//  main loop
+    unsigned n = 200;
+    unsigned configIdx = 0;
+    for (int i = 1;; i++) {
+        for (auto& obj : objList) {
+            if(renderer.DrawObject(obj, mainCamera, configs[configIdx].pipeline)==false) {
+                printf("failed to draw object\n");
+                return -1;
+            }
+        }
+
+    //  Present frame
+        if (renderer.PresentFrame() == false) {
+            printf("present frame failed\n");
+            break;
+        }
+
+        if (offscreen == false) {
+        //  Window Update
+            wnd.Update();
+
+        //  Reset Camera View Port if window resized
+            if (wnd.IsResized()) {
+                mainCamera.SetViewPort({ 0,0,wnd.GetWidth(), wnd.GetHeight() });
+            }
+
+        //  Check Window exit event to exit main loop
+            if (wnd.CheckExit()) {
+                std::cout << "exit" << std::endl;
+                break;
+            }
+        }
+
+    //  Report vertex throughput after "n" frames and switch to the next format
+        if (i % n == 0) {
+            FrameStats stats = renderer.GetFrameStats();
+            const BenchConfig& bench = configs[configIdx];
+            unsigned bytesPerVertex = meshes[configIdx].GetVertexSize();
+            // every index invokes the vertex shader unless the post-transform cache hits, each vertex is fetched at least once
+            double indexedVertices = (double)nObj * sphere.GetNumIndices();
+            double fetchedBytes = (double)nObj * sphere.GetNumVertices() * bytesPerVertex;
+            printf("%-22s %2u bytes/vertex, %.1f MB vertex data: frame %.3f ms, gpu %.3f ms", bench.name.c_str(), bytesPerVertex,
+                bytesPerVertex * (double)sphere.GetNumVertices() / 1e6, stats.frameTime, stats.gpuTime);
+            if (stats.gpuTime > 0) {
+                printf(" (%.1f M indexed vertices/s, at least %.2f GB/s fetched)", indexedVertices / stats.gpuTime / 1e3, fetchedBytes / stats.gpuTime / 1e6);
+            }
+            printf("\n");
+            renderer.ResetFrameStats();
+            configIdx = (configIdx + 1) % configs.size();
+            for (auto& obj : objList) {
+                obj.SetMesh(meshes[configIdx]);
+            }
+            if (offscreen && configIdx == 0) {
+                break;
+            }
+        }
+    }
+
+//  Renderer Cleanup
+    if(renderer.Cleanup() == false) {
+        printf("Renderer cleanup failed");
+        return -1;
+    }
+
+//  Window Cleanup
+    if(offscreen == false && wnd.Cleanup() == false) {
+        printf("Window Cleanup Failed\n");
+        return -1;
+
+    }
+    return 0;
+}